@@ -0,0 +1,72 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# bench-repro.sh measures how reliably and how fast each reproducer triggers
+# its bug on a given kernel. Every reproducer is run RUNS times, each time in
+# a fresh initramfs boot (see make-initramfs.sh). Time-to-crash is taken from
+# the console timestamps: from the runner's "runner: start" line to the first
+# line of the crash report recorded by watch-console.sh.
+#
+# Prints, per reproducer: runs, crashes, crash probability, and the median and
+# p95 time-to-crash in seconds over the crashing runs. Console logs are kept
+# in $OUT_DIR.
+
+if [ $# -lt 4 ]; then
+	echo "Usage: $0 <BZIMAGE> <RUNS> <TIMEOUT_SECONDS> <TEST.exe>..." >&2
+	exit 1
+fi
+
+BZIMAGE=$1
+RUNS=$2
+TIMEOUT=$3
+shift 3
+
+OUT_DIR=${OUT_DIR:-bench}
+INITRAMFS=build/initramfs.cpio.gz
+
+# Prints the printk timestamp of a console line, e.g. "12.345678".
+timestamp() {
+	sed -n 's/^\[ *\([0-9]*\.[0-9]*\)\].*/\1/p'
+}
+
+./make-initramfs.sh > /dev/null 2>&1 || exit 1
+mkdir -p $OUT_DIR
+
+printf '%-24s %5s %7s %6s %9s %9s\n' test runs crashes prob median_s p95_s
+for test in "$@"; do
+	test=`basename $test`
+	ttc=$OUT_DIR/$test.ttc
+	: > $ttc
+	crashes=0
+	for ((run = 1; run <= RUNS; run++)); do
+		log=$OUT_DIR/$test.$run.log
+		KERNEL=$BZIMAGE INITRAMFS=$INITRAMFS TESTS=$test TIMEOUT=$TIMEOUT \
+			VM_LOG=$log VM_PID=$OUT_DIR/vm.pid VM_QMP=$OUT_DIR/vm.qmp \
+			./run-qemu.sh > /dev/null 2>&1
+		[ -s $log.crash ] || continue
+		crashes=$((crashes + 1))
+		start=`grep -m1 "runner: start" $log |timestamp`
+		offset=`head -1 $log.crash |cut -f1`
+		crash=`tail -c +$((offset + 1)) $log |head -1 |timestamp`
+		# A crash before the reproducer started (e.g. at boot) has no
+		# time-to-crash.
+		if [ -n "$start" ] && [ -n "$crash" ]; then
+			awk -v s=$start -v c=$crash 'BEGIN { if (c >= s) printf "%.3f\n", c - s }' >> $ttc
+		fi
+	done
+	sort -n $ttc |awk -v test=$test -v runs=$RUNS -v crashes=$crashes '
+		{ t[NR] = $1 }
+		END {
+			median = p95 = "-"
+			if (NR > 0) {
+				median = (t[int((NR + 1) / 2)] + t[int(NR / 2) + 1]) / 2
+				i = int(0.95 * NR)
+				if (i < 0.95 * NR)
+					i++
+				p95 = t[i]
+			}
+			printf "%-24s %5d %7d %6.2f %9s %9s\n", test, runs, crashes,
+				crashes / runs, median, p95
+		}'
+done
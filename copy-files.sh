@@ -6,6 +6,14 @@
 MOD_DIR=build/linux/modules
 IMG_NAME=stretch.img
 OVERLAY_NAME=stretch.qcow2
+
+# --multi installs a single multi-call binary plus name.exe symlinks to it
+# instead of one binary per reproducer, each with its own copy of libsyz.a.
+MULTI=0
+if [ "${1:-}" = "--multi" ]; then
+	MULTI=1
+fi
+
 set -eux
 
 MNT_DIR=/mnt/${IMG_NAME%.*}
@@ -21,9 +29,27 @@ fi
 sudo mkdir -p $MNT_DIR/lib/modules
 sudo cp -rd $MOD_DIR/lib/modules/* $MNT_DIR/lib/modules/
 sudo mkdir -p $MNT_DIR/root/test
-make -C test
-sudo cp -p test/*/*.exe $MNT_DIR/root/test
-sudo find $MNT_DIR/root/test -name "*.exe" |sudo xargs chmod +x
+if [ $MULTI -eq 1 ]; then
+	make -C test multi
+	sudo cp -p test/syz-repro $MNT_DIR/root/test
+	sudo chmod +x $MNT_DIR/root/test/syz-repro
+	for name in `./test/syz-repro --list`; do
+		sudo ln -sf syz-repro $MNT_DIR/root/test/$name.exe
+	done
+else
+	make -C test
+	sudo cp -p test/bin/*.exe $MNT_DIR/root/test
+	sudo find $MNT_DIR/root/test -name "*.exe" |sudo xargs chmod +x
+fi
+sudo cp -p test/syz-netns $MNT_DIR/root/test
+make -C runner
+sudo cp -p runner/runner $MNT_DIR/usr/local/bin
+
+# Older images lack the 9p mounts for the directories run-qemu.sh shares.
+if ! grep -q '^test ' $MNT_DIR/etc/fstab; then
+	echo 'test /root/test 9p trans=virtio,version=9p2000.L,msize=262144,ro,nofail 0 0' | sudo tee -a $MNT_DIR/etc/fstab
+	echo 'modules /lib/modules 9p trans=virtio,version=9p2000.L,msize=262144,ro,nofail 0 0' | sudo tee -a $MNT_DIR/etc/fstab
+fi
 
 if [ -f $OVERLAY_NAME ]; then
 	sudo guestunmount /mnt/stretch
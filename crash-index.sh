@@ -0,0 +1,180 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# crash-index.sh keeps an on-disk index of distinct kernel crashes.
+#
+#   crash-index.sh add <LOG> [REPRODUCER]   index every report found in LOG
+#   crash-index.sh list                     print the index, most frequent first
+#
+# A crash is identified by its normalized title plus its top stack frames.
+# Each signature owns a directory $CRASH_DIR/<sha1> holding title, frames,
+# count, first and last (seen, seconds since the epoch), reproducers and the
+# latest report, so "is this crash new" is a single directory lookup. `add`
+# prints "new" or "dup", the signature hash and the title for each report.
+# Reports preceded by a race-window offset also get it appended to staggers.
+# The offset is the one logged by the process the report names; when the
+# crash happened elsewhere, it is used only if a single proc was logging.
+
+CRASH_DIR=${CRASH_DIR:-crashes}
+NFRAMES=4
+
+. $(dirname $0)/crash-patterns.sh
+
+export LC_ALL=C
+
+# Frames that belong to the reporting machinery rather than to the bug.
+SKIP_FRAME_RE='^(dump_stack|dump_stack_lvl|show_stack|print_address_description|print_report|kasan_report|__kasan_report|kasan_check_range|check_memory_region|__asan_.*|__kasan_.*|__warn|report_bug|handle_bug|exc_invalid_op|asm_exc_invalid_op|do_error_trap|do_invalid_op|invalid_op|ubsan_epilogue|__ubsan_handle_.*|panic|__might_sleep|___might_sleep|__might_fault|lockdep_.*|__lock_acquire|lock_acquire|check_noncircular|print_circular_bug|print_deadlock_bug|validate_chain|watchdog|check_hung_task|check_hung_uninterruptible_tasks)$'
+
+WARNING_RE='^WARNING: CPU: [0-9]+ PID: [0-9]+ at [^ ]+ ([^+ ]+)'
+# " func+0x1a/0x30 [module]", possibly after a timestamp and/or an old style
+# "[<ffffffff81000000>]" address. "? func" frames are unreliable leftovers on
+# the stack and are ignored.
+FRAME_RE='(^|\]| ) ([A-Za-z_][A-Za-z0-9_.]*)\+0x[0-9a-f]+/0x[0-9a-f]+'
+UNRELIABLE_FRAME_RE=' \? [A-Za-z_]'
+# Logged by the reproducer runtime in race-window amplification mode.
+STAGGER_RE='syz: stagger (-?[0-9]+) ns proc ([0-9]+) iter [0-9]+ pid ([0-9]+)'
+PID_RE='CPU: [0-9]+ (UID: [0-9]+ )?PID: ([0-9]+)'
+
+usage() {
+	echo "Usage: $0 add <LOG> [REPRODUCER]" >&2
+	echo "       $0 list" >&2
+	exit 1
+}
+
+# Strips the timestamp and everything that changes from run to run: addresses,
+# offsets, pids, cpu numbers and line numbers.
+normalize_title() {
+	local t=${1//$'\r'/}
+	t=${t#*\] }
+	if [[ $t =~ $WARNING_RE ]]; then
+		t="WARNING in ${BASH_REMATCH[1]}"
+	fi
+	t=$(sed -E 's/\+0x[0-9a-f]+\/0x[0-9a-f]+//g; s/(0x)?[0-9a-f]{8,}/ADDR/g; s/\b[0-9]+\b/N/g; s/ +$//' <<< "$t")
+	echo "$t"
+}
+
+# Prints the offset behind a report from process $1 (empty if unknown).
+stagger_for() {
+	local pid=$1
+	if [ -n "$pid" ] && [ -n "${STAGGER_PID[$pid]}" ]; then
+		echo ${STAGGER_PID[$pid]}
+	elif [ ${#STAGGER_PROC[@]} -eq 1 ]; then
+		echo ${STAGGER_PROC[@]}
+	fi
+}
+
+# Records one report: title in $1, frames in $2, report text in $3 and the
+# pid it names in $4.
+record() {
+	local title=$1 frames=$2 report=$3
+	local stagger=`stagger_for "$4"`
+	local hash=`printf '%s\n%s\n' "$title" "$frames" |sha1sum |cut -d' ' -f1`
+	local dir=$CRASH_DIR/$hash
+	local now=`date +%s`
+	local state=dup
+	if mkdir $dir 2>/dev/null; then
+		state=new
+		echo "$title" > $dir/title
+		echo "$frames" > $dir/frames
+		echo $now > $dir/first
+		echo 0 > $dir/count
+		: > $dir/reproducers
+	fi
+	echo $(($(cat $dir/count) + 1)) > $dir/count
+	echo $now > $dir/last
+	printf '%s\n' "$report" > $dir/report
+	if [ -n "$REPRODUCER" ] && ! grep -qxF "$REPRODUCER" $dir/reproducers; then
+		echo "$REPRODUCER" >> $dir/reproducers
+	fi
+	if [ -n "$stagger" ]; then
+		echo $stagger >> $dir/staggers
+	fi
+	echo "$state $hash $title"
+}
+
+add() {
+	local log=$1
+	local in_report=0 in_trace=0
+	local title frames report pid
+	# Latest offset logged per pid and per proc.
+	declare -gA STAGGER_PID=() STAGGER_PROC=()
+	while IFS= read -r line || [ -n "$line" ]; do
+		line=${line//$'\r'/}
+		if [ $in_report -eq 0 ]; then
+			if [[ $line =~ $STAGGER_RE ]]; then
+				STAGGER_PID[${BASH_REMATCH[3]}]=${BASH_REMATCH[1]}
+				STAGGER_PROC[${BASH_REMATCH[2]}]=${BASH_REMATCH[1]}
+			elif [[ $line =~ $CRASH_RE ]]; then
+				in_report=1
+				in_trace=0
+				title=`normalize_title "$line"`
+				frames=""
+				report=$line
+				pid=""
+			fi
+			continue
+		fi
+		report+=$'\n'$line
+		if [ -z "$pid" ] && [[ $line =~ $PID_RE ]]; then
+			pid=${BASH_REMATCH[2]}
+		fi
+		if [[ $line =~ $END_RE ]]; then
+			record "$title" "$frames" "$report" "$pid"
+			in_report=0
+			# The next report gets only stagger lines printed after this one.
+			STAGGER_PID=()
+			STAGGER_PROC=()
+			continue
+		fi
+		if [[ $line == *"Call Trace:"* ]]; then
+			in_trace=1
+			continue
+		fi
+		[ $in_trace -eq 1 ] || continue
+		local n=`wc -w <<< "$frames"`
+		[ $n -lt $NFRAMES ] || continue
+		if [[ ! $line =~ $UNRELIABLE_FRAME_RE && $line =~ $FRAME_RE ]]; then
+			local fn=${BASH_REMATCH[2]}
+			fn=${fn%%.*}
+			if [[ ! $fn =~ $SKIP_FRAME_RE ]]; then
+				frames="${frames:+$frames }$fn"
+			fi
+		elif [[ $line == *RIP:* || $line == *"</TASK>"* ||
+			$line == *"Allocated by task"* ]]; then
+			in_trace=0
+		fi
+	done < $log
+	# The log may end mid-report when the VM was torn down.
+	if [ $in_report -eq 1 ]; then
+		record "$title" "$frames" "$report" "$pid"
+	fi
+}
+
+list() {
+	local dir
+	for dir in $CRASH_DIR/*/; do
+		[ -f $dir/title ] || continue
+		printf '%s\t%s\t%s\t%s\t%s\n' `cat $dir/count` `basename $dir` \
+			"`date -d @$(cat $dir/first) +%F.%T`" \
+			"`date -d @$(cat $dir/last) +%F.%T`" "`cat $dir/title`"
+	done |sort -t$'\t' -k1,1nr
+}
+
+case "$1" in
+add)
+	[ $# -ge 2 ] && [ $# -le 3 ] || usage
+	REPRODUCER=$3
+	mkdir -p $CRASH_DIR
+	exec 9> $CRASH_DIR/.lock
+	flock 9
+	add $2
+	;;
+list)
+	[ $# -eq 1 ] || usage
+	list
+	;;
+*)
+	usage
+	;;
+esac
@@ -0,0 +1,8 @@
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# Kernel crash report patterns shared by watch-console.sh and crash-index.sh.
+# CRASH_RE matches the first line of a report, END_RE its closing line.
+
+CRASH_RE='(BUG: |WARNING: |KASAN: |UBSAN: |kernel BUG at|general protection fault|Oops: |Kernel panic|possible circular locking dependency|possible recursive locking|INFO: task .* blocked for more than|INFO: rcu_[a-z]* (self-)?detected stall)'
+END_RE='(---\[ end trace|(^|\] )={20,}|end Kernel panic|Kernel Offset:)'
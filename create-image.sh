@@ -163,6 +163,8 @@ echo 'debugfs /sys/kernel/debug debugfs defaults 0 0' | sudo tee -a $DIR/etc/fst
 echo 'securityfs /sys/kernel/security securityfs defaults 0 0' | sudo tee -a $DIR/etc/fstab
 echo 'configfs /sys/kernel/config/ configfs defaults 0 0' | sudo tee -a $DIR/etc/fstab
 echo 'binfmt_misc /proc/sys/fs/binfmt_misc binfmt_misc defaults 0 0' | sudo tee -a $DIR/etc/fstab
+echo 'test /root/test 9p trans=virtio,version=9p2000.L,msize=262144,ro,nofail 0 0' | sudo tee -a $DIR/etc/fstab
+echo 'modules /lib/modules 9p trans=virtio,version=9p2000.L,msize=262144,ro,nofail 0 0' | sudo tee -a $DIR/etc/fstab
 echo -en "127.0.0.1\tlocalhost\n" | sudo tee $DIR/etc/hosts
 echo "nameserver 8.8.8.8" | sudo tee -a $DIR/etc/resolve.conf
 echo "csi2115" | sudo tee $DIR/etc/hostname
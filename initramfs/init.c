@@ -0,0 +1,116 @@
+// Copyright 2021 Dokyung Song. All rights reserved.
+// Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+// init for the fast-boot initramfs built by make-initramfs.sh. It mounts the
+// pseudo filesystems the reproducers expect, runs the runner over /test on the
+// serial console and powers the machine off. The kernel command line selects
+// what to run:
+//
+//   syz.tests=a.exe,b.exe   reproducers to run (default: all of /test)
+//   syz.timeout=N           per-reproducer budget in seconds (default: 60)
+//   syz.jobs=N              reproducers run at once (default: online CPUs)
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mount.h>
+#include <sys/reboot.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define MAX_ARGS 256
+
+static void mount_fs(const char* source, const char* target, const char* type)
+{
+  mkdir(target, 0755);
+  if (mount(source, target, type, 0, NULL))
+    fprintf(stderr, "syz-init: mount %s on %s failed\n", type, target);
+}
+
+static void setup_console(void)
+{
+  int fd = open("/dev/console", O_RDWR);
+  if (fd < 0)
+    return;
+  dup2(fd, 0);
+  dup2(fd, 1);
+  dup2(fd, 2);
+  if (fd > 2)
+    close(fd);
+}
+
+// Returns the value of key=value on the kernel command line, or NULL.
+static char* cmdline_param(char* cmdline, const char* key)
+{
+  size_t len = strlen(key);
+  for (char* p = cmdline; (p = strstr(p, key)); p += len) {
+    if ((p == cmdline || p[-1] == ' ') && p[len] == '=') {
+      return strndup(p + len + 1, strcspn(p + len + 1, " \n"));
+    }
+  }
+  return NULL;
+}
+
+int main(void)
+{
+  mount_fs("devtmpfs", "/dev", "devtmpfs");
+  setup_console();
+  mount_fs("proc", "/proc", "proc");
+  mount_fs("sysfs", "/sys", "sysfs");
+  mount_fs("debugfs", "/sys/kernel/debug", "debugfs");
+  mount_fs("configfs", "/sys/kernel/config", "configfs");
+  mount_fs("tmpfs", "/tmp", "tmpfs");
+  mount_fs("tmpfs", "/run", "tmpfs");
+  mount_fs("devpts", "/dev/pts", "devpts");
+
+  char cmdline[4096] = {};
+  int fd = open("/proc/cmdline", O_RDONLY);
+  if (fd >= 0) {
+    if (read(fd, cmdline, sizeof(cmdline) - 1) < 0)
+      cmdline[0] = 0;
+    close(fd);
+  }
+  char* tests = cmdline_param(cmdline, "syz.tests");
+  char* timeout = cmdline_param(cmdline, "syz.timeout");
+  char* jobs = cmdline_param(cmdline, "syz.jobs");
+
+  char* argv[MAX_ARGS];
+  int argc = 0;
+  argv[argc++] = "/bin/runner";
+  argv[argc++] = "-t";
+  argv[argc++] = timeout ? timeout : "60";
+  if (jobs) {
+    argv[argc++] = "-j";
+    argv[argc++] = jobs;
+  }
+  for (char* test = tests ? strtok(tests, ",") : NULL;
+       test && argc < MAX_ARGS - 1; test = strtok(NULL, ","))
+    argv[argc++] = test;
+  argv[argc] = NULL;
+
+  printf("syz-init: running reproducers\n");
+  fflush(stdout);
+  int pid = fork();
+  if (pid == 0) {
+    if (chdir("/test") == 0)
+      execv(argv[0], argv);
+    _exit(127);
+  }
+  int status = 0;
+  // We are pid 1: reap everything until the runner itself is done.
+  while (pid > 0) {
+    int res = wait(&status);
+    if (res == pid || res < 0)
+      break;
+  }
+  printf("syz-init: done, status %d\n", status);
+  fflush(stdout);
+  sync();
+  reboot(RB_POWER_OFF);
+  for (;;)
+    pause();
+}
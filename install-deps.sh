@@ -13,4 +13,7 @@ sudo apt install automake
 sudo apt install cmake
 sudo apt install libglib2.0-dev libpixman-1-dev
 sudo apt install cpu-checker
+sudo apt install socat
+sudo apt install cpio
+sudo apt install zlib1g-dev
 sudo dpkg -i dwarves_1.17-1_amd64.deb
@@ -0,0 +1,38 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# make-initramfs.sh packs initramfs/init, the runner and every reproducer from
+# test/ (plus the shared libraries they need) into build/initramfs.cpio.gz.
+# Boot it with
+#
+#   INITRAMFS=build/initramfs.cpio.gz TESTS=a.exe,b.exe ./run-qemu.sh
+#
+# to run reproducers a couple of seconds after the kernel starts, without the
+# Debian image.
+
+OUT=build/initramfs.cpio.gz
+ROOT=build/initramfs
+
+set -eux
+
+make -C test
+make -C runner
+make -C initramfs
+
+rm -rf $ROOT
+mkdir -p $ROOT/bin $ROOT/test
+for dir in dev proc sys tmp run; do
+	mkdir -p $ROOT/$dir
+done
+
+cp initramfs/init $ROOT/init
+cp runner/runner $ROOT/bin/runner
+cp test/bin/*.exe test/bin/syz-netns $ROOT/test/
+
+# Everything is dynamically linked against the host libc; take it along.
+for lib in `ldd $ROOT/init $ROOT/bin/runner $ROOT/test/* |awk '$2 == "=>" && $3 ~ /^\// {print $3} $1 ~ /^\// {print $1}' |sort -u`; do
+	cp --parents -L $lib $ROOT
+done
+
+(cd $ROOT && find . |cpio -o -H newc --quiet) |gzip -1 > $OUT
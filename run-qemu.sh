@@ -4,14 +4,20 @@
 
 
 QEMU=./build/qemu/install/bin/qemu-system-x86_64
-KERNEL=./build/linux/csi2115_f21/arch/x86_64/boot/bzImage
+KERNEL=${KERNEL:-./build/linux/csi2115_f21/arch/x86_64/boot/bzImage}
 IMAGE=./stretch.img
-OVERLAY=./stretch.qcow2
+OVERLAY=${OVERLAY:-./stretch.qcow2}
+
+# Per-instance settings, overridden by vm-pool.sh to run several guests.
+SSH_PORT=${SSH_PORT:-10022}
+VM_PID=${VM_PID:-vm.pid}
+VM_LOG=${VM_LOG:-vm.log}
+VM_QMP=${VM_QMP:-vm.qmp}
 
 LOADVM=""
 if [ -f $OVERLAY ]; then
 	IMAGE=$OVERLAY
-	SNAPSHOT=`qemu-img snapshot -l stretch.qcow2 |tail -1 |awk '{print $2}'`
+	SNAPSHOT=`qemu-img snapshot -l $OVERLAY |tail -1 |awk '{print $2}'`
 	if [[ $SNAPSHOT =~ vm-* ]]; then
 		LOADVM="-loadvm $SNAPSHOT"
 	fi
@@ -21,6 +27,49 @@ if [ $# -ge 1 ]; then
 	QEMU=$1
 fi
 
+# Export the reproducers and kernel modules read-only over virtio-9p; the
+# image mounts them on /root/test and /lib/modules when they are present.
+# QEMU refuses to snapshot a guest with a 9p share mounted, so SHARE=0 leaves
+# them out (the guest then uses what copy-files.sh installed), and so does
+# loading a vm-* snapshot, which was taken without them.
+SHARE=${SHARE:-1}
+VIRTFS=""
+if [ "$SHARE" != 0 ] && [ -z "$LOADVM" ]; then
+	if [ -d test/bin ]; then
+		VIRTFS="$VIRTFS -virtfs local,path=test/bin,mount_tag=test,security_model=none,readonly=on"
+	fi
+	if [ -d build/linux/modules/lib/modules ]; then
+		VIRTFS="$VIRTFS -virtfs local,path=build/linux/modules/lib/modules,mount_tag=modules,security_model=none,readonly=on"
+	fi
+fi
+
+DISK="-hda $IMAGE"
+ROOT="root=/dev/sda"
+NET="-net nic -net user,hostfwd=tcp::$SSH_PORT-:22"
+
+# Fast-boot mode (see make-initramfs.sh): no disk, no network, the
+# reproducers in TESTS run straight from the initramfs. VAR=value words in
+# SYZ_ENV end up in their environment via the kernel command line.
+if [ -n "${INITRAMFS:-}" ]; then
+	DISK="-initrd $INITRAMFS"
+	ROOT="rdinit=/init syz.tests=${TESTS:-} syz.timeout=${TIMEOUT:-60} ${SYZ_ENV:-}"
+	NET=""
+	LOADVM=""
+	VIRTFS=""
+fi
+
+# Restoring a vm-* snapshot needs the machine shape it was taken with, so
+# -loadvm pins 2 CPUs and 4G. A fresh boot is sized from the host instead:
+# every CPU and half of the available memory. vm-pool.sh exports SMP and MEM
+# to split the host between its guests.
+if [ -n "$LOADVM" ]; then
+	SMP=${SMP:-2}
+	MEM=${MEM:-4G}
+else
+	SMP=${SMP:-`nproc`}
+	MEM=${MEM:-$((`awk '/^MemAvailable:/ {print $2}' /proc/meminfo` / 2048))M}
+fi
+
 set -eux
 
 ENABLE_KVM=""
@@ -28,11 +77,13 @@ if output=$(kvm-ok); then
 	ENABLE_KVM=-enable-kvm
 fi
 
-$QEMU -smp 2 -m 4G $ENABLE_KVM $LOADVM \
+$QEMU -smp $SMP -m $MEM $ENABLE_KVM $LOADVM \
 	-kernel $KERNEL \
-	-hda $IMAGE \
-	-net nic -net user,hostfwd=tcp::10022-:22 \
-	-append "root=/dev/sda console=ttyS0 earlyprintk=serial oops=panic panic_on_warn=1 panic=86400 kvm-intel.nested=1 kvm-intel.unrestricted_guest=1 kvm-intel.vmm_exclusive=1 kvm-intel.fasteoi=1 kvm-intel.ept=1 kvm-intel.flexpriority=1 kvm-intel.vpid=1 kvm-intel.emulate_invalid_guest_state=1 kvm-intel.eptad=1 kvm-intel.enable_shadow_vmcs=1 kvm-intel.pml=1 kvm-intel.enable_apicv=1" \
+	$DISK \
+	$VIRTFS \
+	$NET \
+	-append "$ROOT console=ttyS0 earlyprintk=serial oops=panic panic_on_warn=1 panic=86400 kvm-intel.nested=1 kvm-intel.unrestricted_guest=1 kvm-intel.vmm_exclusive=1 kvm-intel.fasteoi=1 kvm-intel.ept=1 kvm-intel.flexpriority=1 kvm-intel.vpid=1 kvm-intel.emulate_invalid_guest_state=1 kvm-intel.eptad=1 kvm-intel.enable_shadow_vmcs=1 kvm-intel.pml=1 kvm-intel.enable_apicv=1" \
 	-nographic \
-	-pidfile vm.pid \
-	2>&1 | tee vm.log
+	-pidfile $VM_PID \
+	-qmp unix:$VM_QMP,server,nowait \
+	2>&1 | ./watch-console.sh $VM_LOG $VM_PID
@@ -0,0 +1,371 @@
+// Copyright 2021 Dokyung Song. All rights reserved.
+// Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+// runner executes reproducers inside the guest, several at a time, and
+// prints one JSON record per reproducer:
+//
+//   runner [-j jobs] [-t seconds] [-l logdir] [test.exe ...]
+//
+// Without arguments every *.exe in the current directory is run.  Each
+// reproducer gets a wall-clock budget after which its process group is
+// killed; reproducers built around loop() never exit on their own, so
+// "timeout" is their normal status.  Kernel taint and oops-like lines in
+// /dev/kmsg are attributed to every reproducer running when they appear.
+//
+// If ./syz-netns is there (see test/lib/netns.c), it is run whenever no
+// reproducer is running to prepare their network namespaces, and with -c at
+// the end to remove the unused ones. SYZ_NET_TEMPLATE=0 turns this off.
+
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+struct test {
+  const char* path;
+  int pid;
+  uint64_t start;
+  uint64_t end;
+  bool timed_out;
+  int status;
+  unsigned long taint;
+  char oops[256];
+};
+
+static struct test* tests;
+static int ntests;
+static int kmsg_fd = -1;
+static int kmsg_wfd = -1;
+static unsigned long taint_seen;
+
+static uint64_t current_time_ms(void)
+{
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts))
+    exit(1);
+  return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static unsigned long read_taint(void)
+{
+  unsigned long taint = 0;
+  FILE* f = fopen("/proc/sys/kernel/tainted", "r");
+  if (!f)
+    return 0;
+  if (fscanf(f, "%lu", &taint) != 1)
+    taint = 0;
+  fclose(f);
+  return taint;
+}
+
+static const char* const oops_markers[] = {
+    "BUG:",
+    "WARNING:",
+    "KASAN:",
+    "UBSAN:",
+    "general protection fault",
+    "Oops:",
+    "Kernel panic",
+    "possible circular locking dependency",
+    "possible recursive locking",
+    "blocked for more than",
+};
+
+static bool is_oops(const char* line)
+{
+  for (size_t i = 0; i < sizeof(oops_markers) / sizeof(oops_markers[0]);
+       i++) {
+    if (strstr(line, oops_markers[i]))
+      return true;
+  }
+  return false;
+}
+
+// Blames a kernel event on every reproducer that is currently running.
+static void blame_running(unsigned long taint, const char* oops)
+{
+  for (int i = 0; i < ntests; i++) {
+    struct test* t = &tests[i];
+    if (t->pid <= 0)
+      continue;
+    t->taint |= taint;
+    if (oops && !t->oops[0])
+      snprintf(t->oops, sizeof(t->oops), "%.*s", (int)sizeof(t->oops) - 1,
+               oops);
+  }
+}
+
+static void scan_kernel(void)
+{
+  unsigned long taint = read_taint();
+  if (taint & ~taint_seen) {
+    blame_running(taint & ~taint_seen, NULL);
+    taint_seen |= taint;
+  }
+  if (kmsg_fd < 0)
+    return;
+  char rec[1024];
+  for (;;) {
+    ssize_t n = read(kmsg_fd, rec, sizeof(rec) - 1);
+    if (n < 0 && errno == EPIPE)
+      continue;
+    if (n <= 0)
+      break;
+    rec[n] = 0;
+    char* msg = strchr(rec, ';');
+    msg = msg ? msg + 1 : rec;
+    msg[strcspn(msg, "\n")] = 0;
+    if (is_oops(msg))
+      blame_running(0, msg);
+  }
+}
+
+static void start_test(struct test* t, const char* logdir)
+{
+  int pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    exit(1);
+  }
+  if (pid == 0) {
+    setpgid(0, 0);
+    int fd = open("/dev/null", O_RDWR);
+    if (logdir) {
+      char path[4096];
+      const char* base = strrchr(t->path, '/');
+      snprintf(path, sizeof(path), "%s/%s.log", logdir,
+               base ? base + 1 : t->path);
+      int log = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (log >= 0) {
+        dup2(log, 1);
+        dup2(log, 2);
+        close(log);
+      }
+    } else if (fd >= 0) {
+      dup2(fd, 1);
+      dup2(fd, 2);
+    }
+    if (fd >= 0) {
+      dup2(fd, 0);
+      close(fd);
+    }
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigprocmask(SIG_SETMASK, &mask, NULL);
+    execl(t->path, t->path, (char*)NULL);
+    _exit(127);
+  }
+  setpgid(pid, pid);
+  t->pid = pid;
+  t->start = current_time_ms();
+  // Timestamp the start in the kernel log, next to any report it triggers.
+  if (kmsg_wfd >= 0)
+    dprintf(kmsg_wfd, "runner: start %s\n", t->path);
+}
+
+#define NETNS_HELPER "./syz-netns"
+
+// Runs the namespace helper to completion; nothing else runs meanwhile.
+static void run_netns_helper(const char* arg)
+{
+  const char* env = getenv("SYZ_NET_TEMPLATE");
+  if ((env && strcmp(env, "0") == 0) || access(NETNS_HELPER, X_OK))
+    return;
+  int pid = fork();
+  if (pid < 0)
+    return;
+  if (pid == 0) {
+    int fd = open("/dev/null", O_RDWR);
+    if (fd >= 0) {
+      dup2(fd, 1);
+      dup2(fd, 2);
+    }
+    execl(NETNS_HELPER, NETNS_HELPER, arg, (char*)NULL);
+    _exit(127);
+  }
+  while (waitpid(pid, NULL, __WALL) != pid && errno == EINTR) {
+  }
+}
+
+static void print_json_string(const char* s)
+{
+  putchar('"');
+  for (; *s; s++) {
+    unsigned char c = *s;
+    if (c == '"' || c == '\\')
+      printf("\\%c", c);
+    else if (c < 0x20)
+      printf("\\u%04x", c);
+    else
+      putchar(c);
+  }
+  putchar('"');
+}
+
+static void report(struct test* t)
+{
+  const char* result;
+  int code = 0;
+  if (t->timed_out) {
+    result = "timeout";
+  } else if (WIFSIGNALED(t->status)) {
+    result = "signaled";
+    code = WTERMSIG(t->status);
+  } else {
+    result = "exited";
+    code = WEXITSTATUS(t->status);
+  }
+  printf("{\"test\":");
+  print_json_string(t->path);
+  printf(",\"result\":\"%s\",\"code\":%d,\"duration_ms\":%llu,"
+         "\"taint\":%lu,\"oops\":",
+         result, code, (unsigned long long)(t->end - t->start), t->taint);
+  if (t->oops[0])
+    print_json_string(t->oops);
+  else
+    printf("null");
+  printf(",\"crashed\":%s}\n", t->taint || t->oops[0] ? "true" : "false");
+  fflush(stdout);
+}
+
+static void finish_test(struct test* t, int status)
+{
+  // The reproducer's children live in its process group (and the sandboxed
+  // ones in a pid namespace whose init is in that group); take them all down.
+  kill(-t->pid, SIGKILL);
+  t->status = status;
+  t->end = current_time_ms();
+  scan_kernel();
+  t->pid = -1;
+  report(t);
+}
+
+static int filter_exe(const struct dirent* ent)
+{
+  size_t len = strlen(ent->d_name);
+  return len > 4 && strcmp(ent->d_name + len - 4, ".exe") == 0;
+}
+
+static void usage(const char* argv0)
+{
+  fprintf(stderr,
+          "usage: %s [-j jobs] [-t seconds] [-l logdir] [test.exe ...]\n",
+          argv0);
+  exit(1);
+}
+
+int main(int argc, char** argv)
+{
+  long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  uint64_t timeout_ms = 60 * 1000;
+  const char* logdir = NULL;
+  int opt;
+  while ((opt = getopt(argc, argv, "j:t:l:h")) != -1) {
+    switch (opt) {
+    case 'j':
+      jobs = atol(optarg);
+      break;
+    case 't':
+      timeout_ms = strtoull(optarg, NULL, 0) * 1000;
+      break;
+    case 'l':
+      logdir = optarg;
+      mkdir(logdir, 0755);
+      break;
+    default:
+      usage(argv[0]);
+    }
+  }
+  if (jobs < 1)
+    jobs = 1;
+
+  if (optind < argc) {
+    ntests = argc - optind;
+    tests = calloc(ntests, sizeof(*tests));
+    for (int i = 0; i < ntests; i++)
+      tests[i].path = argv[optind + i];
+  } else {
+    struct dirent** ents;
+    ntests = scandir(".", &ents, filter_exe, alphasort);
+    if (ntests < 0) {
+      perror("scandir");
+      return 1;
+    }
+    tests = calloc(ntests, sizeof(*tests));
+    for (int i = 0; i < ntests; i++) {
+      char* path;
+      if (asprintf(&path, "./%s", ents[i]->d_name) < 0)
+        return 1;
+      tests[i].path = path;
+    }
+  }
+
+  // Orphaned reproducer children are re-parented to us, so nothing survives
+  // the run.
+  prctl(PR_SET_CHILD_SUBREAPER, 1);
+  sigset_t mask;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &mask, NULL);
+
+  kmsg_fd = open("/dev/kmsg", O_RDONLY | O_NONBLOCK);
+  if (kmsg_fd >= 0)
+    lseek(kmsg_fd, 0, SEEK_END);
+  kmsg_wfd = open("/dev/kmsg", O_WRONLY);
+  taint_seen = read_taint();
+
+  int next = 0, running = 0, crashed = 0;
+  while (next < ntests || running) {
+    if (next < ntests && running == 0)
+      run_netns_helper(NULL);
+    while (next < ntests && running < jobs) {
+      start_test(&tests[next++], logdir);
+      running++;
+    }
+    int status;
+    int pid;
+    while ((pid = waitpid(-1, &status, WNOHANG | __WALL)) > 0) {
+      for (int i = 0; i < ntests; i++) {
+        if (tests[i].pid == pid) {
+          finish_test(&tests[i], status);
+          crashed += tests[i].taint || tests[i].oops[0];
+          running--;
+          break;
+        }
+      }
+    }
+    scan_kernel();
+    uint64_t now = current_time_ms();
+    uint64_t wait_ms = 1000;
+    for (int i = 0; i < ntests; i++) {
+      struct test* t = &tests[i];
+      if (t->pid <= 0)
+        continue;
+      if (now - t->start >= timeout_ms) {
+        t->timed_out = true;
+        kill(-t->pid, SIGKILL);
+        kill(t->pid, SIGKILL);
+        continue;
+      }
+      if (timeout_ms - (now - t->start) < wait_ms)
+        wait_ms = timeout_ms - (now - t->start);
+    }
+    struct timespec ts = {wait_ms / 1000, (wait_ms % 1000) * 1000000};
+    sigtimedwait(&mask, NULL, &ts);
+  }
+  run_netns_helper("-c");
+  return crashed ? 2 : 0;
+}
@@ -0,0 +1,116 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# snapshot-run.sh runs reproducers from /root/test, each one in a guest freshly
+# restored from a post-boot snapshot. The VM is booted once; as soon as sshd
+# answers, the running state is saved as $SNAPSHOT in the qcow2 overlay and
+# then loaded again through QMP before every reproducer. A reproducer that
+# crashes the guest gets it killed by watch-console.sh; the next one restarts
+# QEMU, which -loadvm's the same snapshot instead of booting. The restart
+# truncates vm.log, so the console log of a crash is kept as
+# $CRASH_LOGS/<test>.crash.log.
+# The guest runs without run-qemu.sh's 9p shares, which would block savevm,
+# so the reproducers must be installed in the image with copy-files.sh.
+#
+# Prints "<test> ok|timeout|crash <title>" for every reproducer.
+
+if [ $# -lt 2 ]; then
+	echo "Usage: $0 <TIMEOUT_SECONDS> <TEST.exe>..." >&2
+	exit 1
+fi
+
+TIMEOUT=$1
+shift
+
+OVERLAY=stretch.qcow2
+SNAPSHOT=vm-boot
+QMP=vm.qmp
+CRASH=vm.log.crash
+CRASH_LOGS=snapshot-crashes
+SSH="ssh -i stretch.id_rsa -p 10022 -o StrictHostKeyChecking=no -o ConnectTimeout=2 root@localhost"
+
+if [ ! -f $OVERLAY ]; then
+	./create-overlay.sh
+fi
+
+# Sends one QMP command and prints its reply, skipping asynchronous events.
+qmp() {
+	local reply
+	echo "$1" >&${QMP_IO[1]}
+	while IFS= read -r -u ${QMP_IO[0]} reply; do
+		if [[ $reply == *'"return"'* || $reply == *'"error"'* ]]; then
+			echo "$reply"
+			return
+		fi
+	done
+	return 1
+}
+
+# Runs a human monitor command; savevm/loadvm print nothing on success.
+hmp() {
+	local reply
+	reply=`qmp "{\"execute\": \"human-monitor-command\", \"arguments\": {\"command-line\": \"$1\"}}"` || return 1
+	if [ "$reply" != '{"return": ""}' ]; then
+		echo "$1: $reply" >&2
+		return 1
+	fi
+}
+
+start_vm() {
+	if [ -n "$QMP_IO_PID" ]; then
+		kill $QMP_IO_PID 2>/dev/null
+		wait $QMP_IO_PID 2>/dev/null
+	fi
+	rm -f $QMP
+	SHARE=0 ./run-qemu.sh > /dev/null 2>&1 &
+	while [ ! -S $QMP ]; do
+		sleep 0.1
+	done
+	coproc QMP_IO { socat - UNIX-CONNECT:$QMP; }
+	# Greeting, then leave capabilities negotiation mode.
+	read -r -u ${QMP_IO[0]}
+	qmp '{"execute": "qmp_capabilities"}' > /dev/null
+	until $SSH true 2>/dev/null; do
+		sleep 0.5
+	done
+}
+
+vm_alive() {
+	[ -f vm.pid ] && kill -0 `cat vm.pid` 2>/dev/null
+}
+
+HAVE_SNAPSHOT=0
+if qemu-img snapshot -l $OVERLAY |awk '{print $2}' |grep -qx $SNAPSHOT; then
+	HAVE_SNAPSHOT=1
+fi
+start_vm
+if [ $HAVE_SNAPSHOT -eq 0 ]; then
+	hmp "savevm $SNAPSHOT" || exit 1
+fi
+
+for test in "$@"; do
+	test=`basename $test`
+	if vm_alive; then
+		hmp "loadvm $SNAPSHOT" || exit 1
+	else
+		start_vm
+	fi
+	crashes=`cat $CRASH 2>/dev/null |wc -l`
+	$SSH "timeout -s KILL $TIMEOUT /root/test/$test" > /dev/null 2>&1
+	status=$?
+	if [ `cat $CRASH 2>/dev/null |wc -l` -gt $crashes ]; then
+		echo "$test crash `tail -1 $CRASH |cut -f2-`"
+		mkdir -p $CRASH_LOGS
+		cp vm.log $CRASH_LOGS/$test.crash.log
+	elif [ $status -eq 137 ]; then
+		echo "$test timeout"
+	else
+		echo "$test ok"
+	fi
+done
+
+if vm_alive; then
+	qmp '{"execute": "quit"}' > /dev/null
+fi
+wait
@@ -1,108 +1,9 @@
 // https://syzkaller.appspot.com/bug?id=ef79070d08a744686c4db202d9ba6817bba86ebb
 // autogenerated by syzkaller (http://github.com/google/syzkaller)
 
-#define _GNU_SOURCE
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <linux/loop.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <string.h>
-#include <sys/ioctl.h>
-#include <sys/mount.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <unistd.h>
+#include "syz.h"
 
-extern unsigned long long procid;
-
-struct fs_image_segment {
-  void* data;
-  uintptr_t size;
-  uintptr_t offset;
-};
-
-#define IMAGE_MAX_SEGMENTS 4096
-#define IMAGE_MAX_SIZE (32 << 20)
-
-#define SYZ_memfd_create 319
-
-static uintptr_t syz_mount_image(uintptr_t fs, uintptr_t dir, uintptr_t size,
-                                 uintptr_t nsegs, uintptr_t segments,
-                                 uintptr_t flags, uintptr_t opts)
-{
-  char loopname[64];
-  int loopfd, err = 0, res = -1;
-  uintptr_t i;
-  struct fs_image_segment* segs = (struct fs_image_segment*)segments;
-
-  if (nsegs > IMAGE_MAX_SEGMENTS)
-    nsegs = IMAGE_MAX_SEGMENTS;
-  for (i = 0; i < nsegs; i++) {
-    if (segs[i].size > IMAGE_MAX_SIZE)
-      segs[i].size = IMAGE_MAX_SIZE;
-    segs[i].offset %= IMAGE_MAX_SIZE;
-    if (segs[i].offset > IMAGE_MAX_SIZE - segs[i].size)
-      segs[i].offset = IMAGE_MAX_SIZE - segs[i].size;
-    if (size < segs[i].offset + segs[i].offset)
-      size = segs[i].offset + segs[i].offset;
-  }
-  if (size > IMAGE_MAX_SIZE)
-    size = IMAGE_MAX_SIZE;
-  int memfd = syscall(SYZ_memfd_create, "syz_mount_image", 0);
-  if (memfd == -1) {
-    err = errno;
-    goto error;
-  }
-  if (ftruncate(memfd, size)) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  for (i = 0; i < nsegs; i++) {
-    if (pwrite(memfd, segs[i].data, segs[i].size, segs[i].offset) < 0) {
-    }
-  }
-  snprintf(loopname, sizeof(loopname), "/dev/loop%llu", procid);
-  loopfd = open(loopname, O_RDWR);
-  if (loopfd == -1) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-    if (errno != EBUSY) {
-      err = errno;
-      goto error_close_loop;
-    }
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    usleep(1000);
-    if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-      err = errno;
-      goto error_close_loop;
-    }
-  }
-  mkdir((char*)dir, 0777);
-  if (strcmp((char*)fs, "iso9660") == 0)
-    flags |= MS_RDONLY;
-  if (mount(loopname, (char*)dir, (char*)fs, flags, (char*)opts)) {
-    err = errno;
-    goto error_clear_loop;
-  }
-  res = 0;
-error_clear_loop:
-  ioctl(loopfd, LOOP_CLR_FD, 0);
-error_close_loop:
-  close(loopfd);
-error_close_memfd:
-  close(memfd);
-error:
-  errno = err;
-  return res;
-}
-
-unsigned long long procid;
-void loop()
+void execute_one(void)
 {
   memcpy((void*)0x20000000, "reiserfs", 9);
   memcpy((void*)0x20000100, "./file0", 8);
@@ -160,6 +61,6 @@ void loop()
 int main()
 {
   syscall(__NR_mmap, 0x20000000, 0x1000000, 3, 0x32, -1, 0);
-  loop();
+  execute_one();
   return 0;
 }
@@ -1,286 +1,7 @@
 // https://syzkaller.appspot.com/bug?id=a1a1e379b225812688566745c3e2f7242bffc246
 // autogenerated by syzkaller (https://github.com/google/syzkaller)
 
-#define _GNU_SOURCE
-
-#include <dirent.h>
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <signal.h>
-#include <stdarg.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/ioctl.h>
-#include <sys/mount.h>
-#include <sys/prctl.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <sys/wait.h>
-#include <time.h>
-#include <unistd.h>
-
-#include <linux/loop.h>
-
-static unsigned long long procid;
-
-static void sleep_ms(uint64_t ms)
-{
-  usleep(ms * 1000);
-}
-
-static uint64_t current_time_ms(void)
-{
-  struct timespec ts;
-  if (clock_gettime(CLOCK_MONOTONIC, &ts))
-    exit(1);
-  return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
-}
-
-static bool write_file(const char* file, const char* what, ...)
-{
-  char buf[1024];
-  va_list args;
-  va_start(args, what);
-  vsnprintf(buf, sizeof(buf), what, args);
-  va_end(args);
-  buf[sizeof(buf) - 1] = 0;
-  int len = strlen(buf);
-  int fd = open(file, O_WRONLY | O_CLOEXEC);
-  if (fd == -1)
-    return false;
-  if (write(fd, buf, len) != len) {
-    int err = errno;
-    close(fd);
-    errno = err;
-    return false;
-  }
-  close(fd);
-  return true;
-}
-
-struct fs_image_segment {
-  void* data;
-  uintptr_t size;
-  uintptr_t offset;
-};
-
-#define IMAGE_MAX_SEGMENTS 4096
-#define IMAGE_MAX_SIZE (129 << 20)
-
-#define sys_memfd_create 319
-
-static unsigned long fs_image_segment_check(unsigned long size,
-                                            unsigned long nsegs,
-                                            struct fs_image_segment* segs)
-{
-  if (nsegs > IMAGE_MAX_SEGMENTS)
-    nsegs = IMAGE_MAX_SEGMENTS;
-  for (size_t i = 0; i < nsegs; i++) {
-    if (segs[i].size > IMAGE_MAX_SIZE)
-      segs[i].size = IMAGE_MAX_SIZE;
-    segs[i].offset %= IMAGE_MAX_SIZE;
-    if (segs[i].offset > IMAGE_MAX_SIZE - segs[i].size)
-      segs[i].offset = IMAGE_MAX_SIZE - segs[i].size;
-    if (size < segs[i].offset + segs[i].offset)
-      size = segs[i].offset + segs[i].offset;
-  }
-  if (size > IMAGE_MAX_SIZE)
-    size = IMAGE_MAX_SIZE;
-  return size;
-}
-static int setup_loop_device(long unsigned size, long unsigned nsegs,
-                             struct fs_image_segment* segs,
-                             const char* loopname, int* memfd_p, int* loopfd_p)
-{
-  int err = 0, loopfd = -1;
-  size = fs_image_segment_check(size, nsegs, segs);
-  int memfd = syscall(sys_memfd_create, "syzkaller", 0);
-  if (memfd == -1) {
-    err = errno;
-    goto error;
-  }
-  if (ftruncate(memfd, size)) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  for (size_t i = 0; i < nsegs; i++) {
-    if (pwrite(memfd, segs[i].data, segs[i].size, segs[i].offset) < 0) {
-    }
-  }
-  loopfd = open(loopname, O_RDWR);
-  if (loopfd == -1) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-    if (errno != EBUSY) {
-      err = errno;
-      goto error_close_loop;
-    }
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    usleep(1000);
-    if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-      err = errno;
-      goto error_close_loop;
-    }
-  }
-  *memfd_p = memfd;
-  *loopfd_p = loopfd;
-  return 0;
-
-error_close_loop:
-  close(loopfd);
-error_close_memfd:
-  close(memfd);
-error:
-  errno = err;
-  return -1;
-}
-
-static long syz_mount_image(volatile long fsarg, volatile long dir,
-                            volatile unsigned long size,
-                            volatile unsigned long nsegs,
-                            volatile long segments, volatile long flags,
-                            volatile long optsarg)
-{
-  struct fs_image_segment* segs = (struct fs_image_segment*)segments;
-  int res = -1, err = 0, loopfd = -1, memfd = -1, need_loop_device = !!segs;
-  char* mount_opts = (char*)optsarg;
-  char* target = (char*)dir;
-  char* fs = (char*)fsarg;
-  char* source = NULL;
-  char loopname[64];
-  if (need_loop_device) {
-    memset(loopname, 0, sizeof(loopname));
-    snprintf(loopname, sizeof(loopname), "/dev/loop%llu", procid);
-    if (setup_loop_device(size, nsegs, segs, loopname, &memfd, &loopfd) == -1)
-      return -1;
-    source = loopname;
-  }
-  mkdir(target, 0777);
-  char opts[256];
-  memset(opts, 0, sizeof(opts));
-  if (strlen(mount_opts) > (sizeof(opts) - 32)) {
-  }
-  strncpy(opts, mount_opts, sizeof(opts) - 32);
-  if (strcmp(fs, "iso9660") == 0) {
-    flags |= MS_RDONLY;
-  } else if (strncmp(fs, "ext", 3) == 0) {
-    if (strstr(opts, "errors=panic") || strstr(opts, "errors=remount-ro") == 0)
-      strcat(opts, ",errors=continue");
-  } else if (strcmp(fs, "xfs") == 0) {
-    strcat(opts, ",nouuid");
-  }
-  res = mount(source, target, fs, flags, opts);
-  if (res == -1) {
-    err = errno;
-    goto error_clear_loop;
-  }
-  res = open(target, O_RDONLY | O_DIRECTORY);
-  if (res == -1) {
-    err = errno;
-  }
-
-error_clear_loop:
-  if (need_loop_device) {
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    close(loopfd);
-    close(memfd);
-  }
-  errno = err;
-  return res;
-}
-
-static void kill_and_wait(int pid, int* status)
-{
-  kill(-pid, SIGKILL);
-  kill(pid, SIGKILL);
-  for (int i = 0; i < 100; i++) {
-    if (waitpid(-1, status, WNOHANG | __WALL) == pid)
-      return;
-    usleep(1000);
-  }
-  DIR* dir = opendir("/sys/fs/fuse/connections");
-  if (dir) {
-    for (;;) {
-      struct dirent* ent = readdir(dir);
-      if (!ent)
-        break;
-      if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0)
-        continue;
-      char abort[300];
-      snprintf(abort, sizeof(abort), "/sys/fs/fuse/connections/%s/abort",
-               ent->d_name);
-      int fd = open(abort, O_WRONLY);
-      if (fd == -1) {
-        continue;
-      }
-      if (write(fd, abort, 1) < 0) {
-      }
-      close(fd);
-    }
-    closedir(dir);
-  } else {
-  }
-  while (waitpid(-1, status, __WALL) != pid) {
-  }
-}
-
-static void reset_loop()
-{
-  char buf[64];
-  snprintf(buf, sizeof(buf), "/dev/loop%llu", procid);
-  int loopfd = open(buf, O_RDWR);
-  if (loopfd != -1) {
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    close(loopfd);
-  }
-}
-
-static void setup_test()
-{
-  prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
-  setpgrp();
-  write_file("/proc/self/oom_score_adj", "1000");
-}
-
-static void execute_one(void);
-
-#define WAIT_FLAGS __WALL
-
-static void loop(void)
-{
-  int iter = 0;
-  for (;; iter++) {
-    reset_loop();
-    int pid = fork();
-    if (pid < 0)
-      exit(1);
-    if (pid == 0) {
-      setup_test();
-      execute_one();
-      exit(0);
-    }
-    int status = 0;
-    uint64_t start = current_time_ms();
-    for (;;) {
-      if (waitpid(-1, &status, WNOHANG | WAIT_FLAGS) == pid)
-        break;
-      sleep_ms(1);
-      if (current_time_ms() - start < 5000) {
-        continue;
-      }
-      kill_and_wait(pid, &status);
-      break;
-    }
-  }
-}
+#include "syz.h"
 
 void execute_one(void)
 {
@@ -1402,11 +1123,13 @@ void execute_one(void)
   syz_mount_image(0x20000000, 0x20000100, 0x200000, 0x13c, 0x20000200, 0,
                   0x20086e00);
 }
+
 int main(void)
 {
   syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
+  syz_features = SYZ_LOOP_DEVICE;
   loop();
   return 0;
 }
@@ -0,0 +1,624 @@
+// Loop-device backed filesystem images for syz_mount_image() and
+// syz_read_part_table().
+
+#include "syz.h"
+
+#include <sys/mount.h>
+
+#include <linux/loop.h>
+
+#ifndef LOOP_CONFIGURE
+#define LOOP_CONFIGURE 0x4C0A
+struct loop_config {
+  __u32 fd;
+  __u32 block_size;
+  struct loop_info64 info;
+  __u64 __reserved[8];
+};
+#endif
+
+#include <zlib.h>
+
+long syz_open_dev(volatile long a0, volatile long a1, volatile long a2)
+{
+  if (a0 == 0xc || a0 == 0xb) {
+    char buf[128];
+    sprintf(buf, "/dev/%s/%d:%d", a0 == 0xc ? "char" : "block", (uint8_t)a1,
+            (uint8_t)a2);
+    return open(buf, O_RDWR, 0);
+  } else {
+    char buf[1024];
+    char* hash;
+    strncpy(buf, (char*)a0, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = 0;
+    while ((hash = strchr(buf, '#'))) {
+      *hash = '0' + (char)(a1 % 10);
+      a1 /= 10;
+    }
+    return open(buf, a2, 0);
+  }
+}
+
+struct fs_image_segment {
+  void* data;
+  uintptr_t size;
+  uintptr_t offset;
+};
+
+#define IMAGE_MAX_SEGMENTS 4096
+#define IMAGE_MAX_SIZE (129 << 20)
+
+#define sys_memfd_create 319
+
+static unsigned long fs_image_segment_check(unsigned long size,
+                                            unsigned long nsegs,
+                                            struct fs_image_segment* segs)
+{
+  if (nsegs > IMAGE_MAX_SEGMENTS)
+    nsegs = IMAGE_MAX_SEGMENTS;
+  for (size_t i = 0; i < nsegs; i++) {
+    if (segs[i].size > IMAGE_MAX_SIZE)
+      segs[i].size = IMAGE_MAX_SIZE;
+    segs[i].offset %= IMAGE_MAX_SIZE;
+    if (segs[i].offset > IMAGE_MAX_SIZE - segs[i].size)
+      segs[i].offset = IMAGE_MAX_SIZE - segs[i].size;
+    if (size < segs[i].offset + segs[i].size)
+      size = segs[i].offset + segs[i].size;
+  }
+  if (size > IMAGE_MAX_SIZE)
+    size = IMAGE_MAX_SIZE;
+  return size;
+}
+
+// An image is assembled once per boot into a read-only template file,
+// $SYZ_IMAGE_CACHE/syz-image-<hash> (default /dev/shm). Every mount then only
+// copies the data extents of the template into an unnamed O_TMPFILE in the
+// same directory, which stays sparse and private to the loop device it backs.
+// Keeping both on one filesystem lets copy_file_range() share or copy the
+// pages in the kernel; since 5.19 it refuses to cross superblocks, e.g. from
+// /dev/shm into a memfd. Without a usable cache directory images are built
+// from scratch into a memfd as before.
+#define IMAGE_CACHE_DIR "/dev/shm"
+
+static const char* image_cache_dir(void)
+{
+  const char* dir = getenv("SYZ_IMAGE_CACHE");
+  return dir ? dir : IMAGE_CACHE_DIR;
+}
+
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+{
+  const uint8_t* p = (const uint8_t*)data;
+  uint64_t word;
+  for (; size >= sizeof(word); p += sizeof(word), size -= sizeof(word)) {
+    memcpy(&word, p, sizeof(word));
+    hash = (hash ^ word) * 0x100000001b3ull;
+    hash ^= hash >> 29;
+  }
+  for (; size; p++, size--)
+    hash = (hash ^ *p) * 0x100000001b3ull;
+  return hash;
+}
+
+typedef int (*fill_image_t)(int fd, unsigned long size, void* arg);
+
+// Returns a read-only fd of the template for hash, building it with fill if
+// it does not exist yet, or -1 if templates cannot be used.
+static int open_template(uint64_t hash, unsigned long size, fill_image_t fill,
+                         void* arg)
+{
+  char path[256], tmp[256 + 32];
+  snprintf(path, sizeof(path), "%s/syz-image-%016llx", image_cache_dir(),
+           (unsigned long long)hash);
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd != -1)
+    return fd;
+  // Build it under a private name and rename it into place, so concurrent
+  // workers never see a partial template.
+  snprintf(tmp, sizeof(tmp), "%s.%d", path, getpid());
+  fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0444);
+  if (fd == -1)
+    return -1;
+  if (ftruncate(fd, size) || fill(fd, size, arg) || rename(tmp, path)) {
+    int err = errno;
+    close(fd);
+    unlink(tmp);
+    errno = err;
+    return -1;
+  }
+  return fd;
+}
+
+// Copies the template into a new unnamed file next to it, skipping holes.
+static int copy_template(int template_fd, unsigned long size)
+{
+  int fd = open(image_cache_dir(), O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+  if (fd == -1)
+    fd = syscall(sys_memfd_create, "syzkaller", 0);
+  if (fd == -1)
+    return -1;
+  const size_t bufsize = 64 << 10;
+  char* buf = NULL;
+  if (ftruncate(fd, size))
+    goto error;
+  off_t data = 0, hole;
+  while ((data = lseek(template_fd, data, SEEK_DATA)) >= 0) {
+    hole = lseek(template_fd, data, SEEK_HOLE);
+    if (hole < 0)
+      goto error;
+    while (data < hole) {
+      off_t out = data;
+      ssize_t n = -1;
+      if (!buf)
+        n = syscall(__NR_copy_file_range, template_fd, &data, fd, &out,
+                    hole - data, 0);
+      if (n > 0)
+        continue;
+      // Only reached if the tmpfile fell back to a memfd or the filesystem
+      // cannot copy_file_range; from then on go through a heap buffer, as
+      // worker thread stacks are small.
+      if (!buf && !(buf = (char*)malloc(bufsize)))
+        goto error;
+      n = pread(template_fd, buf,
+                hole - data < (off_t)bufsize ? hole - data : (off_t)bufsize,
+                data);
+      if (n <= 0 || pwrite(fd, buf, n, data) != n)
+        goto error;
+      data += n;
+    }
+  }
+  if (errno != ENXIO)
+    goto error;
+  free(buf);
+  return fd;
+
+error:;
+  int err = errno;
+  free(buf);
+  close(fd);
+  errno = err;
+  return -1;
+}
+
+// Builds an image into a new file via its template if possible, else
+// directly into a memfd.
+static int build_image(uint64_t hash, unsigned long size, fill_image_t fill,
+                       void* arg)
+{
+  int template_fd = open_template(hash, size, fill, arg);
+  if (template_fd != -1) {
+    int memfd = copy_template(template_fd, size);
+    close(template_fd);
+    return memfd;
+  }
+  int memfd = syscall(sys_memfd_create, "syzkaller", 0);
+  if (memfd == -1)
+    return -1;
+  if (ftruncate(memfd, size) || fill(memfd, size, arg)) {
+    int err = errno;
+    close(memfd);
+    errno = err;
+    return -1;
+  }
+  return memfd;
+}
+
+struct image_segments {
+  unsigned long nsegs;
+  struct fs_image_segment* segs;
+};
+
+static int fill_segments(int fd, unsigned long size, void* arg)
+{
+  struct image_segments* image = (struct image_segments*)arg;
+  for (size_t i = 0; i < image->nsegs; i++) {
+    struct fs_image_segment* seg = &image->segs[i];
+    if (pwrite(fd, seg->data, seg->size, seg->offset) < 0) {
+    }
+  }
+  return 0;
+}
+
+// With SYZ_DUMP_IMAGE=<file> in the environment, the first image assembled
+// from segments is written to <file> and the process exits. That is how the
+// blobs for syz_mount_image_blob() are made (see mkblob.sh).
+static void dump_image(int memfd, unsigned long size)
+{
+  const char* path = getenv("SYZ_DUMP_IMAGE");
+  if (!path)
+    return;
+  void* image = mmap(NULL, size, PROT_READ, MAP_SHARED, memfd, 0);
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (image == MAP_FAILED || fd == -1)
+    exit(1);
+  exit(write(fd, image, size) == (ssize_t)size ? 0 : 1);
+}
+
+// Segment data is copied into place by the reproducer's execute_one() right
+// before the call, so the executable, the call site and the segment layout
+// identify an image without hashing all of its data on every call. The head
+// of each segment is hashed as well, as a guard against a program that
+// builds different images in the same buffers.
+static uint64_t hash_segments(uint64_t hash, const void* site,
+                              unsigned long nsegs,
+                              struct fs_image_segment* segs)
+{
+  struct stat st;
+  if (stat("/proc/self/exe", &st) == 0) {
+    hash = hash_bytes(hash, &st.st_dev, sizeof(st.st_dev));
+    hash = hash_bytes(hash, &st.st_ino, sizeof(st.st_ino));
+    hash = hash_bytes(hash, &st.st_mtim, sizeof(st.st_mtim));
+  }
+  // Relative to this library, so that it survives PIE load addresses.
+  uintptr_t off = (uintptr_t)site - (uintptr_t)&hash_segments;
+  hash = hash_bytes(hash, &off, sizeof(off));
+  for (size_t i = 0; i < nsegs; i++) {
+    hash = hash_bytes(hash, &segs[i], sizeof(segs[i]));
+    hash = hash_bytes(hash, segs[i].data,
+                      segs[i].size < 64 ? segs[i].size : 64);
+  }
+  return hash;
+}
+
+static int create_image(const void* site, unsigned long size,
+                        unsigned long nsegs, struct fs_image_segment* segs)
+{
+  size = fs_image_segment_check(size, nsegs, segs);
+  if (nsegs > IMAGE_MAX_SEGMENTS)
+    nsegs = IMAGE_MAX_SEGMENTS;
+  uint64_t hash = hash_bytes(0xcbf29ce484222325ull, &size, sizeof(size));
+  hash = hash_segments(hash, site, nsegs, segs);
+  struct image_segments image = {nsegs, segs};
+  int memfd = build_image(hash, size, fill_segments, &image);
+  if (memfd != -1)
+    dump_image(memfd, size);
+  return memfd;
+}
+
+struct image_blob {
+  const void* data;
+  unsigned long size;
+};
+
+// Inflates a zlib-compressed image into fd, leaving all-zero pages as holes
+// so that the template stays as sparse as a segment-built one.
+static int fill_blob(int fd, unsigned long size, void* arg)
+{
+  struct image_blob* blob = (struct image_blob*)arg;
+  // Heap, not static: threaded reproducers may build templates concurrently.
+  const size_t bufsize = 64 << 10;
+  char* buf = (char*)malloc(bufsize);
+  if (!buf)
+    return -1;
+  z_stream zs;
+  memset(&zs, 0, sizeof(zs));
+  zs.next_in = (Bytef*)blob->data;
+  zs.avail_in = blob->size;
+  int ret = inflateInit(&zs);
+  unsigned long off = 0;
+  while (ret == Z_OK && off < size) {
+    zs.next_out = (Bytef*)buf;
+    zs.avail_out = size - off < bufsize ? size - off : bufsize;
+    ret = inflate(&zs, Z_NO_FLUSH);
+    size_t n = (char*)zs.next_out - buf;
+    for (size_t page = 0; page < n; page += 4096) {
+      size_t len = n - page < 4096 ? n - page : 4096;
+      if (buf[page] == 0 && memcmp(buf + page, buf + page + 1, len - 1) == 0)
+        continue;
+      if (pwrite(fd, buf + page, len, off + page) != (ssize_t)len) {
+        inflateEnd(&zs);
+        free(buf);
+        return -1;
+      }
+    }
+    off += n;
+    if (ret == Z_BUF_ERROR && n)
+      ret = Z_OK;
+  }
+  inflateEnd(&zs);
+  free(buf);
+  if (ret != Z_STREAM_END) {
+    errno = EINVAL;
+    return -1;
+  }
+  return 0;
+}
+
+static int inflate_image(unsigned long size, const void* data,
+                         unsigned long datalen)
+{
+  if (size > IMAGE_MAX_SIZE)
+    size = IMAGE_MAX_SIZE;
+  // Blobs are compressed and small, so hashing all of one is cheap. A
+  // different seed keeps blob and segment templates apart.
+  uint64_t hash = hash_bytes(~0xcbf29ce484222325ull, &size, sizeof(size));
+  hash = hash_bytes(hash, data, datalen);
+  struct image_blob blob = {data, datalen};
+  return build_image(hash, size, fill_blob, &blob);
+}
+
+// Loop devices come from /dev/loop-control rather than being tied to procid,
+// and are bound with LOOP_CONFIGURE, which sets the backing file and flags
+// in one step. Devices a process has bound before are kept in a pool and
+// tried first. The pool lives in shared memory, so when loop() sets it up
+// with init_loop_pool() before forking, devices found by one iteration are
+// reused by the next, and reset_loop_device() can detach all of them.
+// The pool also caps how many devices are used: filesystems stay mounted
+// across iterations, and each new device would pin another image.
+#define LOOP_POOL_SIZE 8
+
+struct loop_pool {
+  struct {
+    int num; // device number + 1, 0 until published
+    int busy;
+  } slots[LOOP_POOL_SIZE];
+};
+
+static struct loop_pool* loop_pool;
+
+static struct loop_pool* get_loop_pool(void)
+{
+  struct loop_pool* pool = __atomic_load_n(&loop_pool, __ATOMIC_ACQUIRE);
+  if (pool)
+    return pool;
+  pool = (struct loop_pool*)mmap(NULL, sizeof(*pool), PROT_READ | PROT_WRITE,
+                                 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (pool == MAP_FAILED)
+    return NULL;
+  struct loop_pool* old = NULL;
+  if (!__atomic_compare_exchange_n(&loop_pool, &old, pool, false,
+                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+    munmap(pool, sizeof(*pool));
+    return old;
+  }
+  return pool;
+}
+
+void init_loop_pool(void)
+{
+  get_loop_pool();
+}
+
+// Binds memfd to /dev/loop<num> and returns an fd of the device.
+static int configure_loop_device(int num, int memfd, uint32_t flags)
+{
+  char loopname[64];
+  snprintf(loopname, sizeof(loopname), "/dev/loop%d", num);
+  int loopfd = open(loopname, O_RDWR | O_CLOEXEC);
+  if (loopfd == -1)
+    return -1;
+  struct loop_config config;
+  memset(&config, 0, sizeof(config));
+  config.fd = memfd;
+  config.info.lo_flags = flags;
+  if (ioctl(loopfd, LOOP_CONFIGURE, &config) == 0)
+    return loopfd;
+  if (errno == EINVAL || errno == ENOTTY) {
+    // Kernels before 5.8 lack LOOP_CONFIGURE.
+    struct loop_info64 info;
+    memset(&info, 0, sizeof(info));
+    info.lo_flags = flags;
+    if (ioctl(loopfd, LOOP_SET_FD, memfd) == 0) {
+      if (ioctl(loopfd, LOOP_SET_STATUS64, &info) == 0)
+        return loopfd;
+      int err = errno;
+      ioctl(loopfd, LOOP_CLR_FD, 0);
+      errno = err;
+    }
+  }
+  int err = errno;
+  close(loopfd);
+  errno = err;
+  return -1;
+}
+
+// Binds memfd to a free loop device. Returns the device fd and stores the
+// device number and pool slot (-1 if not pooled) for release_loop_device().
+static int acquire_loop_device(int memfd, uint32_t flags, int* num_p,
+                               int* slot_p)
+{
+  struct loop_pool* pool = get_loop_pool();
+  int loopfd, slot = -1;
+  if (pool) {
+    for (int i = 0; i < LOOP_POOL_SIZE; i++) {
+      int num = __atomic_load_n(&pool->slots[i].num, __ATOMIC_ACQUIRE);
+      int idle = 0;
+      if (!num || !__atomic_compare_exchange_n(&pool->slots[i].busy, &idle, 1,
+                                               false, __ATOMIC_ACQ_REL,
+                                               __ATOMIC_RELAXED))
+        continue;
+      loopfd = configure_loop_device(num - 1, memfd, flags);
+      if (loopfd != -1) {
+        *num_p = num - 1;
+        *slot_p = i;
+        return loopfd;
+      }
+      // Still bound, e.g. to a filesystem left mounted by an earlier test.
+      __atomic_store_n(&pool->slots[i].busy, 0, __ATOMIC_RELEASE);
+    }
+    // Reserve an unpublished slot for a new device; with none left, fail
+    // the way a single busy loop device used to.
+    for (int i = 0; i < LOOP_POOL_SIZE && slot == -1; i++) {
+      int idle = 0;
+      if (!__atomic_load_n(&pool->slots[i].num, __ATOMIC_ACQUIRE) &&
+          __atomic_compare_exchange_n(&pool->slots[i].busy, &idle, 1, false,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        slot = i;
+    }
+    if (slot == -1) {
+      errno = EBUSY;
+      return -1;
+    }
+  }
+  int ctlfd = open("/dev/loop-control", O_RDWR | O_CLOEXEC);
+  if (ctlfd == -1)
+    goto error;
+  // Another process may bind the device between LOOP_CTL_GET_FREE and
+  // LOOP_CONFIGURE; then just ask for the next free one.
+  for (int attempt = 0; attempt < 16; attempt++) {
+    int num = ioctl(ctlfd, LOOP_CTL_GET_FREE);
+    if (num < 0)
+      break;
+    loopfd = configure_loop_device(num, memfd, flags);
+    if (loopfd == -1) {
+      if (errno == EBUSY)
+        continue;
+      break;
+    }
+    close(ctlfd);
+    *num_p = num;
+    *slot_p = slot;
+    if (slot != -1)
+      __atomic_store_n(&pool->slots[slot].num, num + 1, __ATOMIC_RELEASE);
+    return loopfd;
+  }
+  int err = errno;
+  close(ctlfd);
+  errno = err;
+error:
+  if (slot != -1)
+    __atomic_store_n(&pool->slots[slot].busy, 0, __ATOMIC_RELEASE);
+  return -1;
+}
+
+// Detaches the device (lazily, if a filesystem on it is still mounted) and
+// returns it to the pool.
+static void release_loop_device(int loopfd, int slot)
+{
+  ioctl(loopfd, LOOP_CLR_FD, 0);
+  close(loopfd);
+  if (slot >= 0)
+    __atomic_store_n(&loop_pool->slots[slot].busy, 0, __ATOMIC_RELEASE);
+}
+
+long syz_read_part_table(volatile unsigned long size,
+                                volatile unsigned long nsegs,
+                                volatile long segments)
+{
+  struct fs_image_segment* segs = (struct fs_image_segment*)segments;
+  int memfd = create_image(__builtin_return_address(0), size, nsegs, segs);
+  if (memfd == -1)
+    return -1;
+  int num, slot;
+  int loopfd = acquire_loop_device(memfd, LO_FLAGS_PARTSCAN, &num, &slot);
+  if (loopfd == -1) {
+    int err = errno;
+    close(memfd);
+    errno = err;
+    return -1;
+  }
+  char loopname[64];
+  for (unsigned long i = 1, j = 0; i < 8; i++) {
+    snprintf(loopname, sizeof(loopname), "/dev/loop%dp%d", num, (int)i);
+    struct stat statbuf;
+    if (stat(loopname, &statbuf) == 0) {
+      char linkname[64];
+      snprintf(linkname, sizeof(linkname), "./file%d", (int)j++);
+      if (symlink(loopname, linkname)) {
+      }
+    }
+  }
+  release_loop_device(loopfd, slot);
+  close(memfd);
+  errno = 0;
+  return 0;
+}
+
+// Mounts fs on dir, backed by a loop device over memfd unless it is -1.
+// Takes ownership of memfd.
+static long mount_image(const char* fs, const char* target, long flags,
+                        const char* mount_opts, int memfd)
+{
+  int res = -1, err = 0, loopfd = -1, slot = -1, num;
+  int need_loop_device = memfd != -1;
+  char* source = NULL;
+  char loopname[64];
+  if (need_loop_device) {
+    loopfd = acquire_loop_device(memfd, 0, &num, &slot);
+    if (loopfd == -1) {
+      err = errno;
+      close(memfd);
+      errno = err;
+      return -1;
+    }
+    snprintf(loopname, sizeof(loopname), "/dev/loop%d", num);
+    source = loopname;
+  }
+  mkdir(target, 0777);
+  char opts[256];
+  memset(opts, 0, sizeof(opts));
+  if (strlen(mount_opts) > (sizeof(opts) - 32)) {
+  }
+  strncpy(opts, mount_opts, sizeof(opts) - 32);
+  if (strcmp(fs, "iso9660") == 0) {
+    flags |= MS_RDONLY;
+  } else if (strncmp(fs, "ext", 3) == 0) {
+    if (strstr(opts, "errors=panic") || strstr(opts, "errors=remount-ro") == 0)
+      strcat(opts, ",errors=continue");
+  } else if (strcmp(fs, "xfs") == 0) {
+    strcat(opts, ",nouuid");
+  }
+  res = mount(source, target, fs, flags, opts);
+  if (res == -1) {
+    err = errno;
+    goto error_clear_loop;
+  }
+  res = open(target, O_RDONLY | O_DIRECTORY);
+  if (res == -1) {
+    err = errno;
+  }
+
+error_clear_loop:
+  if (need_loop_device) {
+    release_loop_device(loopfd, slot);
+    close(memfd);
+  }
+  errno = err;
+  return res;
+}
+
+long syz_mount_image(volatile long fsarg, volatile long dir,
+                     volatile unsigned long size, volatile unsigned long nsegs,
+                     volatile long segments, volatile long flags,
+                     volatile long optsarg)
+{
+  struct fs_image_segment* segs = (struct fs_image_segment*)segments;
+  int memfd = -1;
+  if (segs) {
+    memfd = create_image(__builtin_return_address(0), size, nsegs, segs);
+    if (memfd == -1)
+      return -1;
+  }
+  return mount_image((char*)fsarg, (char*)dir, flags, (char*)optsarg, memfd);
+}
+
+long syz_mount_image_blob(volatile long fsarg, volatile long dir,
+                          volatile unsigned long size, const void* blob,
+                          unsigned long bloblen, volatile long flags,
+                          volatile long optsarg)
+{
+  int memfd = inflate_image(size, blob, bloblen);
+  if (memfd == -1)
+    return -1;
+  return mount_image((char*)fsarg, (char*)dir, flags, (char*)optsarg, memfd);
+}
+
+void reset_loop_device(void)
+{
+  struct loop_pool* pool = get_loop_pool();
+  if (!pool)
+    return;
+  for (int i = 0; i < LOOP_POOL_SIZE; i++) {
+    int num = pool->slots[i].num;
+    if (!num)
+      continue;
+    char loopname[64];
+    snprintf(loopname, sizeof(loopname), "/dev/loop%d", num - 1);
+    int loopfd = open(loopname, O_RDWR | O_CLOEXEC);
+    if (loopfd != -1) {
+      ioctl(loopfd, LOOP_CLR_FD, 0);
+      close(loopfd);
+    }
+    pool->slots[i].busy = 0;
+  }
+}
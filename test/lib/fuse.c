@@ -0,0 +1,214 @@
+// Canned replies to FUSE requests read from /dev/fuse.
+
+#include "syz.h"
+
+#define FUSE_MIN_READ_BUFFER 8192
+enum fuse_opcode {
+  FUSE_LOOKUP = 1,
+  FUSE_FORGET = 2,
+  FUSE_GETATTR = 3,
+  FUSE_SETATTR = 4,
+  FUSE_READLINK = 5,
+  FUSE_SYMLINK = 6,
+  FUSE_MKNOD = 8,
+  FUSE_MKDIR = 9,
+  FUSE_UNLINK = 10,
+  FUSE_RMDIR = 11,
+  FUSE_RENAME = 12,
+  FUSE_LINK = 13,
+  FUSE_OPEN = 14,
+  FUSE_READ = 15,
+  FUSE_WRITE = 16,
+  FUSE_STATFS = 17,
+  FUSE_RELEASE = 18,
+  FUSE_FSYNC = 20,
+  FUSE_SETXATTR = 21,
+  FUSE_GETXATTR = 22,
+  FUSE_LISTXATTR = 23,
+  FUSE_REMOVEXATTR = 24,
+  FUSE_FLUSH = 25,
+  FUSE_INIT = 26,
+  FUSE_OPENDIR = 27,
+  FUSE_READDIR = 28,
+  FUSE_RELEASEDIR = 29,
+  FUSE_FSYNCDIR = 30,
+  FUSE_GETLK = 31,
+  FUSE_SETLK = 32,
+  FUSE_SETLKW = 33,
+  FUSE_ACCESS = 34,
+  FUSE_CREATE = 35,
+  FUSE_INTERRUPT = 36,
+  FUSE_BMAP = 37,
+  FUSE_DESTROY = 38,
+  FUSE_IOCTL = 39,
+  FUSE_POLL = 40,
+  FUSE_NOTIFY_REPLY = 41,
+  FUSE_BATCH_FORGET = 42,
+  FUSE_FALLOCATE = 43,
+  FUSE_READDIRPLUS = 44,
+  FUSE_RENAME2 = 45,
+  FUSE_LSEEK = 46,
+  FUSE_COPY_FILE_RANGE = 47,
+  FUSE_SETUPMAPPING = 48,
+  FUSE_REMOVEMAPPING = 49,
+  CUSE_INIT = 4096,
+  CUSE_INIT_BSWAP_RESERVED = 1048576,
+  FUSE_INIT_BSWAP_RESERVED = 436207616,
+};
+struct fuse_in_header {
+  uint32_t len;
+  uint32_t opcode;
+  uint64_t unique;
+  uint64_t nodeid;
+  uint32_t uid;
+  uint32_t gid;
+  uint32_t pid;
+  uint32_t padding;
+};
+struct fuse_out_header {
+  uint32_t len;
+  uint32_t error;
+  uint64_t unique;
+};
+struct syz_fuse_req_out {
+  struct fuse_out_header* init;
+  struct fuse_out_header* lseek;
+  struct fuse_out_header* bmap;
+  struct fuse_out_header* poll;
+  struct fuse_out_header* getxattr;
+  struct fuse_out_header* lk;
+  struct fuse_out_header* statfs;
+  struct fuse_out_header* write;
+  struct fuse_out_header* read;
+  struct fuse_out_header* open;
+  struct fuse_out_header* attr;
+  struct fuse_out_header* entry;
+  struct fuse_out_header* dirent;
+  struct fuse_out_header* direntplus;
+  struct fuse_out_header* create_open;
+  struct fuse_out_header* ioctl;
+};
+static int fuse_send_response(int fd, const struct fuse_in_header* in_hdr,
+                              struct fuse_out_header* out_hdr)
+{
+  if (!out_hdr) {
+    return -1;
+  }
+  out_hdr->unique = in_hdr->unique;
+  if (write(fd, out_hdr, out_hdr->len) == -1) {
+    return -1;
+  }
+  return 0;
+}
+volatile long syz_fuse_handle_req(volatile long a0, volatile long a1,
+                                         volatile long a2, volatile long a3)
+{
+  struct syz_fuse_req_out* req_out = (struct syz_fuse_req_out*)a3;
+  struct fuse_out_header* out_hdr = NULL;
+  char* buf = (char*)a1;
+  int buf_len = (int)a2;
+  int fd = (int)a0;
+  if (!req_out) {
+    return -1;
+  }
+  if (buf_len < FUSE_MIN_READ_BUFFER) {
+    return -1;
+  }
+  int ret = read(fd, buf, buf_len);
+  if (ret == -1) {
+    return -1;
+  }
+  if ((size_t)ret < sizeof(struct fuse_in_header)) {
+    return -1;
+  }
+  const struct fuse_in_header* in_hdr = (const struct fuse_in_header*)buf;
+  if (in_hdr->len > (uint32_t)ret) {
+    return -1;
+  }
+  switch (in_hdr->opcode) {
+  case FUSE_GETATTR:
+  case FUSE_SETATTR:
+    out_hdr = req_out->attr;
+    break;
+  case FUSE_LOOKUP:
+  case FUSE_SYMLINK:
+  case FUSE_LINK:
+  case FUSE_MKNOD:
+  case FUSE_MKDIR:
+    out_hdr = req_out->entry;
+    break;
+  case FUSE_OPEN:
+  case FUSE_OPENDIR:
+    out_hdr = req_out->open;
+    break;
+  case FUSE_STATFS:
+    out_hdr = req_out->statfs;
+    break;
+  case FUSE_RMDIR:
+  case FUSE_RENAME:
+  case FUSE_RENAME2:
+  case FUSE_FALLOCATE:
+  case FUSE_SETXATTR:
+  case FUSE_REMOVEXATTR:
+  case FUSE_FSYNCDIR:
+  case FUSE_FSYNC:
+  case FUSE_SETLKW:
+  case FUSE_SETLK:
+  case FUSE_ACCESS:
+  case FUSE_FLUSH:
+  case FUSE_RELEASE:
+  case FUSE_RELEASEDIR:
+  case FUSE_UNLINK:
+  case FUSE_DESTROY:
+    out_hdr = req_out->init;
+    if (!out_hdr) {
+      return -1;
+    }
+    out_hdr->len = sizeof(struct fuse_out_header);
+    break;
+  case FUSE_READ:
+    out_hdr = req_out->read;
+    break;
+  case FUSE_READDIR:
+    out_hdr = req_out->dirent;
+    break;
+  case FUSE_READDIRPLUS:
+    out_hdr = req_out->direntplus;
+    break;
+  case FUSE_INIT:
+    out_hdr = req_out->init;
+    break;
+  case FUSE_LSEEK:
+    out_hdr = req_out->lseek;
+    break;
+  case FUSE_GETLK:
+    out_hdr = req_out->lk;
+    break;
+  case FUSE_BMAP:
+    out_hdr = req_out->bmap;
+    break;
+  case FUSE_POLL:
+    out_hdr = req_out->poll;
+    break;
+  case FUSE_GETXATTR:
+  case FUSE_LISTXATTR:
+    out_hdr = req_out->getxattr;
+    break;
+  case FUSE_WRITE:
+  case FUSE_COPY_FILE_RANGE:
+    out_hdr = req_out->write;
+    break;
+  case FUSE_FORGET:
+  case FUSE_BATCH_FORGET:
+    return 0;
+  case FUSE_CREATE:
+    out_hdr = req_out->create_open;
+    break;
+  case FUSE_IOCTL:
+    out_hdr = req_out->ioctl;
+    break;
+  default:
+    return -1;
+  }
+  return fuse_send_response(fd, in_hdr, out_hdr);
+}
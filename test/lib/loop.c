@@ -0,0 +1,121 @@
+// Iteration supervisor: forks a fresh test process for every execute_one().
+//
+// By default it runs forever and kills an iteration after 5 seconds. The
+// environment can bound it:
+//
+//   SYZ_ITERATIONS=N     stop after N iterations
+//   SYZ_DURATION_MS=N    stop after N ms in total
+//   SYZ_TIMEOUT_MS=N     kill an iteration after N ms
+//   SYZ_STOP_ON_TAINT=1  stop once the kernel becomes tainted
+//
+// On stop it prints a summary to stderr and exits, 2 if the kernel got
+// tainted and 0 otherwise. A reproducer's main() collects its workers with
+// wait_workers(), so a bounded run ends once all of them have stopped.
+
+#include "syz.h"
+
+#include <signal.h>
+#include <sys/wait.h>
+
+static unsigned long read_taint(void)
+{
+  unsigned long taint = 0;
+  FILE* f = fopen("/proc/sys/kernel/tainted", "r");
+  if (!f)
+    return 0;
+  if (fscanf(f, "%lu", &taint) != 1)
+    taint = 0;
+  fclose(f);
+  return taint;
+}
+
+void loop(void)
+{
+  uint64_t max_iters = env_u64("SYZ_ITERATIONS", 0);
+  uint64_t duration_ms = env_u64("SYZ_DURATION_MS", 0);
+  uint64_t timeout_ms = env_u64("SYZ_TIMEOUT_MS", 5 * 1000);
+  bool stop_on_taint = env_u64("SYZ_STOP_ON_TAINT", 0);
+  unsigned long taint = read_taint();
+  uint64_t loop_start = current_time_ms();
+  uint64_t timeouts = 0;
+  const char* reason = NULL;
+  if (syz_features & SYZ_LOOP_DEVICE)
+    init_loop_pool();
+  if (syz_features & SYZ_NET_RESET)
+    checkpoint_net_namespace();
+  // SIGCHLD stays blocked so that sigtimedwait() below sleeps until the test
+  // process exits or its deadline passes, whichever comes first.
+  sigset_t sigchld;
+  sigemptyset(&sigchld);
+  sigaddset(&sigchld, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &sigchld, NULL);
+  uint64_t iter = 0;
+  for (;; iter++) {
+    if (max_iters && iter >= max_iters) {
+      reason = "iterations";
+      break;
+    }
+    if (duration_ms && current_time_ms() - loop_start >= duration_ms) {
+      reason = "duration";
+      break;
+    }
+    if (syz_features & SYZ_LOOP_DEVICE)
+      reset_loop_device();
+    if (syz_features & SYZ_NET_RESET)
+      reset_net_namespace();
+    syz_iteration = iter;
+    int pid = fork();
+    if (pid < 0)
+      exit(1);
+    if (pid == 0) {
+      sigprocmask(SIG_UNBLOCK, &sigchld, NULL);
+      setup_test();
+      execute_one();
+      if (syz_features & SYZ_CLOSE_FDS)
+        close_fds();
+      exit(0);
+    }
+    int status = 0;
+    uint64_t start = current_time_ms();
+    for (;;) {
+      if (waitpid(-1, &status, WNOHANG | WAIT_FLAGS) == pid)
+        break;
+      uint64_t elapsed = current_time_ms() - start;
+      if (elapsed >= timeout_ms) {
+        kill_and_wait(pid, &status);
+        timeouts++;
+        break;
+      }
+      uint64_t left = timeout_ms - elapsed;
+      struct timespec ts = {left / 1000, (left % 1000) * 1000000};
+      sigtimedwait(&sigchld, NULL, &ts);
+    }
+    if (stop_on_taint && (read_taint() & ~taint)) {
+      iter++;
+      reason = "taint";
+      break;
+    }
+  }
+  fprintf(stderr,
+          "loop: %llu iterations, %llu timed out, %llu ms, stopped by %s\n",
+          (unsigned long long)iter, (unsigned long long)timeouts,
+          (unsigned long long)(current_time_ms() - loop_start), reason);
+  exit(read_taint() & ~taint ? 2 : 0);
+}
+
+// Waits for every child of the calling process and returns the worst exit
+// status among them; a worker killed by a signal counts as 1.
+int wait_workers(void)
+{
+  int worst = 0, status;
+  for (;;) {
+    if (waitpid(-1, &status, __WALL) == -1) {
+      if (errno == EINTR)
+        continue;
+      return worst;
+    }
+    int code = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    if (code > worst)
+      worst = code;
+  }
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# mkblob.sh turns the filesystem image that a reproducer builds from
+# syz_mount_image() segments into a zlib blob for syz_mount_image_blob().
+# The reproducer is run with SYZ_DUMP_IMAGE set, so it exits as soon as the
+# image is assembled and mounts nothing. Prints the raw image size, which is
+# the size argument to pass along with the blob.
+
+if [ $# -ne 2 ]; then
+	echo "Usage: $0 <TEST.exe> <BLOB.img.z>" >&2
+	exit 1
+fi
+
+EXE=$1
+BLOB=$2
+RAW=`mktemp`
+trap "rm -f $RAW" EXIT
+
+SYZ_DUMP_IMAGE=$RAW $EXE || exit 1
+python3 -c 'import sys, zlib; sys.stdout.buffer.write(zlib.compress(sys.stdin.buffer.read(), 9))' \
+	< $RAW > $BLOB || exit 1
+printf '0x%x\n' `stat -c %s $RAW`
@@ -0,0 +1,84 @@
+// Multi-call entry point: every reproducer linked into one binary.
+//
+// The Makefile renames each reproducer's main/execute_one/execute_call to
+// <sym>_main etc. and lists them in applets.h.  The applet is picked from
+// argv[0] (so name.exe -> syz-repro symlinks keep working) or, when invoked
+// as syz-repro itself, from the first argument.
+
+#include "syz.h"
+
+#define APPLET(name, sym)                                                      \
+  int sym##_main(void);                                                        \
+  void sym##_execute_one(void) __attribute__((weak));                          \
+  void sym##_execute_call(int call) __attribute__((weak));
+#include "applets.h"
+#undef APPLET
+
+struct applet {
+  const char* name;
+  int (*main)(void);
+  void (*execute_one)(void);
+  void (*execute_call)(int call);
+};
+
+static const struct applet applets[] = {
+#define APPLET(name, sym)                                                      \
+  {name, sym##_main, sym##_execute_one, sym##_execute_call},
+#include "applets.h"
+#undef APPLET
+};
+
+static const struct applet* current;
+
+void execute_one(void)
+{
+  if (!current->execute_one)
+    exit(1);
+  current->execute_one();
+}
+
+void execute_call(int call)
+{
+  if (!current->execute_call)
+    exit(1);
+  current->execute_call(call);
+}
+
+static const struct applet* find_applet(const char* name)
+{
+  const char* base = strrchr(name, '/');
+  base = base ? base + 1 : name;
+  size_t len = strlen(base);
+  if (len > 4 && strcmp(base + len - 4, ".exe") == 0)
+    len -= 4;
+  for (size_t i = 0; i < sizeof(applets) / sizeof(applets[0]); i++) {
+    if (strlen(applets[i].name) == len &&
+        memcmp(applets[i].name, base, len) == 0)
+      return &applets[i];
+  }
+  return NULL;
+}
+
+static void usage(const char* argv0)
+{
+  fprintf(stderr, "usage: %s <reproducer> | --list\n", argv0);
+  exit(1);
+}
+
+int main(int argc, char** argv)
+{
+  current = find_applet(argv[0]);
+  if (!current) {
+    if (argc < 2)
+      usage(argv[0]);
+    if (strcmp(argv[1], "--list") == 0) {
+      for (size_t i = 0; i < sizeof(applets) / sizeof(applets[0]); i++)
+        printf("%s\n", applets[i].name);
+      return 0;
+    }
+    current = find_applet(argv[1]);
+    if (!current)
+      usage(argv[0]);
+  }
+  return current->main();
+}
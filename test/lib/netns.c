@@ -0,0 +1,17 @@
+// syz-netns: builds the network namespace templates that do_sandbox_none()
+// hands to SYZ_NET_DEVICES workers, one per procid (SYZ_PROCS), or with -c
+// removes the ones left unclaimed. The runner calls it whenever no reproducer
+// is running, so building never competes with a racing test for the CPU.
+
+#include "syz.h"
+
+int main(int argc, char** argv)
+{
+  if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+    remove_net_templates();
+    return 0;
+  }
+  syz_features = SYZ_NET_DEVICES;
+  build_net_templates(syz_procs());
+  return 0;
+}
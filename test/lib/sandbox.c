@@ -0,0 +1,256 @@
+// Sandbox setup: namespaces, rlimits and capabilities for each worker, and
+// the per-feature device initialization selected by syz_features.
+
+#include "syz.h"
+
+#include <dirent.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mount.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/file.h>
+#include <sys/wait.h>
+
+#include <linux/capability.h>
+
+void setup_common(void)
+{
+  if (mount(0, "/sys/fs/fuse/connections", "fusectl", 0, 0)) {
+  }
+}
+
+void sandbox_common(void)
+{
+  prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
+  setsid();
+  struct rlimit rlim;
+  rlim.rlim_cur = rlim.rlim_max = (200 << 20);
+  setrlimit(RLIMIT_AS, &rlim);
+  rlim.rlim_cur = rlim.rlim_max = 32 << 20;
+  setrlimit(RLIMIT_MEMLOCK, &rlim);
+  rlim.rlim_cur = rlim.rlim_max = 136 << 20;
+  setrlimit(RLIMIT_FSIZE, &rlim);
+  rlim.rlim_cur = rlim.rlim_max = 1 << 20;
+  setrlimit(RLIMIT_STACK, &rlim);
+  rlim.rlim_cur = rlim.rlim_max = 0;
+  setrlimit(RLIMIT_CORE, &rlim);
+  rlim.rlim_cur = rlim.rlim_max = 256;
+  setrlimit(RLIMIT_NOFILE, &rlim);
+  if (unshare(CLONE_NEWNS)) {
+  }
+  if (mount(NULL, "/", NULL, MS_REC | MS_PRIVATE, NULL)) {
+  }
+  if (unshare(CLONE_NEWIPC)) {
+  }
+  if (unshare(0x02000000)) {
+  }
+  if (unshare(CLONE_NEWUTS)) {
+  }
+  if (unshare(CLONE_SYSVSEM)) {
+  }
+  typedef struct {
+    const char* name;
+    const char* value;
+  } sysctl_t;
+  static const sysctl_t sysctls[] = {
+      {"/proc/sys/kernel/shmmax", "16777216"},
+      {"/proc/sys/kernel/shmall", "536870912"},
+      {"/proc/sys/kernel/shmmni", "1024"},
+      {"/proc/sys/kernel/msgmax", "8192"},
+      {"/proc/sys/kernel/msgmni", "1024"},
+      {"/proc/sys/kernel/msgmnb", "1024"},
+      {"/proc/sys/kernel/sem", "1024 1048576 500 1024"},
+  };
+  unsigned i;
+  for (i = 0; i < sizeof(sysctls) / sizeof(sysctls[0]); i++)
+    write_file(sysctls[i].name, sysctls[i].value);
+}
+
+static int wait_for_loop(int pid)
+{
+  if (pid < 0)
+    exit(1);
+  int status = 0;
+  while (waitpid(-1, &status, __WALL) != pid) {
+  }
+  return WEXITSTATUS(status);
+}
+
+void drop_caps(void)
+{
+  struct __user_cap_header_struct cap_hdr = {};
+  struct __user_cap_data_struct cap_data[2] = {};
+  cap_hdr.version = _LINUX_CAPABILITY_VERSION_3;
+  cap_hdr.pid = getpid();
+  if (syscall(SYS_capget, &cap_hdr, &cap_data))
+    exit(1);
+  const int drop = (1 << CAP_SYS_PTRACE) | (1 << CAP_SYS_NICE);
+  cap_data[0].effective &= ~drop;
+  cap_data[0].permitted &= ~drop;
+  cap_data[0].inheritable &= ~drop;
+  if (syscall(SYS_capset, &cap_hdr, &cap_data))
+    exit(1);
+}
+
+// Building the SYZ_NET_DEVICES device zoo is most of a worker's startup
+// time, and a network namespace cannot be cloned. Instead, syz-netns (run by
+// the runner while no reproducer is running) builds one namespace per procid
+// ahead of time and pins it with a bind mount on NET_TEMPLATE_DIR/net<procid>.
+// A worker claims the one for its procid by unmounting the pin, which only
+// one claimant can do, and enters it with setns(); a namespace is never
+// handed out twice. With no template ready, or with SYZ_NET_TEMPLATE=0, the
+// worker builds its own namespace as before.
+#define NET_TEMPLATE_DIR "/run/syz-netns"
+
+static void net_template_path(char* path, size_t size)
+{
+  snprintf(path, size, NET_TEMPLATE_DIR "/net%llu", procid);
+}
+
+// Returns an fd of a pinned, unused template namespace, or -1.
+static int claim_net_template(void)
+{
+  char path[64];
+  net_template_path(path, sizeof(path));
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd == -1)
+    return -1;
+  if (umount2(path, MNT_DETACH)) {
+    // Not pinned (yet): an empty file, or a builder still at work.
+    close(fd);
+    return -1;
+  }
+  unlink(path);
+  return fd;
+}
+
+static void build_net_template(void)
+{
+  char path[64], lock[sizeof(path) + 5];
+  net_template_path(path, sizeof(path));
+  snprintf(lock, sizeof(lock), "%s.lock", path);
+  int lockfd = open(lock, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (lockfd == -1 || flock(lockfd, LOCK_EX | LOCK_NB))
+    return;
+  struct stat dir, pin;
+  if (stat(NET_TEMPLATE_DIR, &dir) == 0 && stat(path, &pin) == 0 &&
+      dir.st_dev != pin.st_dev)
+    return; // Already pinned and unclaimed.
+  if (unshare(CLONE_NEWNET))
+    return;
+  initialize_netdevices();
+  int fd = open(path, O_RDONLY | O_CREAT | O_CLOEXEC, 0600);
+  if (fd == -1)
+    return;
+  close(fd);
+  if (mount("/proc/self/ns/net", path, NULL, MS_BIND, NULL))
+    unlink(path);
+}
+
+void build_net_templates(int procs)
+{
+  mkdir(NET_TEMPLATE_DIR, 0700);
+  for (procid = 0; procid < (unsigned long long)procs; procid++) {
+    // Each namespace is built in a child, which may also exit(1) halfway.
+    int pid = fork();
+    if (pid < 0)
+      return;
+    if (pid == 0) {
+      build_net_template();
+      _exit(0);
+    }
+    while (waitpid(pid, NULL, __WALL) != pid) {
+    }
+  }
+}
+
+void remove_net_templates(void)
+{
+  DIR* dir = opendir(NET_TEMPLATE_DIR);
+  if (!dir)
+    return;
+  struct dirent* ent;
+  while ((ent = readdir(dir))) {
+    if (ent->d_name[0] == '.')
+      continue;
+    char path[64 + sizeof(ent->d_name)];
+    snprintf(path, sizeof(path), NET_TEMPLATE_DIR "/%s", ent->d_name);
+    umount2(path, MNT_DETACH);
+    unlink(path);
+  }
+  closedir(dir);
+  rmdir(NET_TEMPLATE_DIR);
+}
+
+int do_sandbox_none(void (*fn)(void))
+{
+  // Claimed here rather than in the child, whose unmount of the pin would
+  // otherwise stay private to its mount namespace.
+  int netns = -1;
+  if ((syz_features & SYZ_NET_DEVICES) && env_u64("SYZ_NET_TEMPLATE", 1))
+    netns = claim_net_template();
+  if (unshare(CLONE_NEWPID)) {
+  }
+  int pid = fork();
+  if (pid != 0) {
+    if (netns != -1)
+      close(netns);
+    return wait_for_loop(pid);
+  }
+  setup_common();
+  if (syz_features & SYZ_VHCI)
+    initialize_vhci();
+  sandbox_common();
+  drop_caps();
+  if (syz_features & SYZ_NET_DEVICES)
+    initialize_netdevices_init();
+  if (netns == -1 || setns(netns, CLONE_NEWNET)) {
+    if (unshare(CLONE_NEWNET)) {
+    }
+    if (netns != -1) {
+      close(netns);
+      netns = -1;
+    }
+  }
+  if (syz_features & SYZ_NET_INJECTION)
+    initialize_tun();
+  if ((syz_features & SYZ_NET_DEVICES) && netns == -1)
+    initialize_netdevices();
+  if (netns != -1)
+    close(netns);
+  if (syz_features & SYZ_WIFI)
+    initialize_wifi_devices();
+  fn();
+  exit(1);
+}
+
+void setup_test(void)
+{
+  prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
+  setpgrp();
+  write_file("/proc/self/oom_score_adj", "1000");
+  if (syz_features & SYZ_NET_INJECTION)
+    flush_tun();
+}
+
+void close_fds(void)
+{
+  for (int fd = 3; fd < MAX_FDS; fd++)
+    close(fd);
+}
+
+void setup_binfmt_misc(void)
+{
+  if (mount(0, "/proc/sys/fs/binfmt_misc", "binfmt_misc", 0, 0)) {
+  }
+  write_file("/proc/sys/fs/binfmt_misc/register", ":syz0:M:0:\x01::./file0:");
+  write_file("/proc/sys/fs/binfmt_misc/register",
+             ":syz1:M:1:\x02::./file0:POC");
+}
+
+void setup_usb(void)
+{
+  if (chmod("/dev/raw-gadget", 0666))
+    exit(1);
+}
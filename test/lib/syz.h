@@ -0,0 +1,219 @@
+// Shared runtime for the syzkaller reproducers under test/.
+//
+// The helpers below are the ones syzkaller pastes into every generated C
+// reproducer (executor/common_linux.h).  They are built once into
+// lib/libsyz.a and each reproducer keeps only its main()/execute_one().
+
+#ifndef SYZ_H
+#define SYZ_H
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <endian.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BITMASK(bf_off, bf_len) (((1ull << (bf_len)) - 1) << (bf_off))
+#define STORE_BY_BITMASK(type, htobe, addr, val, bf_off, bf_len)               \
+  *(type*)(addr) =                                                             \
+      htobe((htobe(*(type*)(addr)) & ~BITMASK((bf_off), (bf_len))) |           \
+            (((type)(val) << (bf_off)) & BITMASK((bf_off), (bf_len))))
+
+#define WAIT_FLAGS __WALL
+#define MAX_FDS 30
+#define MAX_PROCS 32
+
+// Features a reproducer opts into by setting syz_features before it enters
+// the sandbox.  They select what do_sandbox_none() initializes and what
+// loop() does around every iteration.
+#define SYZ_NET_DEVICES (1 << 0)   // netdevsim/veth/... device zoo
+#define SYZ_NET_INJECTION (1 << 1) // syz_tun, flushed before each test
+#define SYZ_NET_RESET (1 << 2)     // restore netfilter tables per iteration
+#define SYZ_WIFI (1 << 3)          // mac80211_hwsim devices in IBSS mode
+#define SYZ_VHCI (1 << 4)          // emulated bluetooth controller
+#define SYZ_LOOP_DEVICE (1 << 5)   // detach pooled loop devices per iteration
+#define SYZ_CLOSE_FDS (1 << 6)     // close leftover fds after each test
+
+// Links file (a path relative to test/) into the reproducer as the local
+// symbols name[] and name_end[]; used for compressed filesystem images.
+#define SYZ_BLOB(name, file)                                                   \
+  __asm__(".pushsection .rodata\n"                                             \
+          ".balign 16\n" #name ":\n"                                           \
+          ".incbin \"" file "\"\n"                                             \
+          #name "_end:\n"                                                      \
+          ".popsection\n");                                                    \
+  extern const char name[], name##_end[]
+
+extern unsigned long long procid;
+extern unsigned syz_features;
+// Index of the current loop() iteration, as seen by the test process.
+extern uint64_t syz_iteration;
+
+// Provided by the reproducer.
+void execute_one(void);
+void execute_call(int call);
+
+// common.c
+extern __thread int skip_segv;
+extern __thread jmp_buf segv_env;
+
+#define NONFAILING(...)                                                        \
+  ({                                                                           \
+    int ok = 1;                                                                \
+    __atomic_fetch_add(&skip_segv, 1, __ATOMIC_SEQ_CST);                       \
+    if (_setjmp(segv_env) == 0) {                                              \
+      __VA_ARGS__;                                                             \
+    } else                                                                     \
+      ok = 0;                                                                  \
+    __atomic_fetch_sub(&skip_segv, 1, __ATOMIC_SEQ_CST);                       \
+    ok;                                                                        \
+  })
+
+typedef struct {
+  int state;
+} event_t;
+
+void install_segv_handler(void);
+void sleep_ms(uint64_t ms);
+uint64_t current_time_ms(void);
+uint64_t env_u64(const char* name, uint64_t def);
+int syz_procs(void);
+void thread_start(void* (*fn)(void*), void* arg);
+void event_init(event_t* ev);
+void event_reset(event_t* ev);
+void event_set(event_t* ev);
+void event_wait(event_t* ev);
+int event_isset(event_t* ev);
+int event_timedwait(event_t* ev, uint64_t timeout);
+bool write_file(const char* file, const char* what, ...);
+void kill_and_wait(int pid, int* status);
+
+// netlink.c
+struct nlmsg {
+  char* pos;
+  int nesting;
+  struct nlattr* nested[8];
+  char buf[4096];
+};
+
+// Many requests sent as one datagram; see netlink_batch_send().
+#define NLBATCH_MAX_MSGS 256
+struct nlbatch {
+  int count;
+  unsigned len;
+  int err[NLBATCH_MAX_MSGS];
+  char buf[32 << 10];
+};
+
+void netlink_init(struct nlmsg* nlmsg, int typ, int flags, const void* data,
+                  int size);
+void netlink_attr(struct nlmsg* nlmsg, int typ, const void* data, int size);
+void netlink_nest(struct nlmsg* nlmsg, int typ);
+void netlink_done(struct nlmsg* nlmsg);
+int netlink_send_ext(struct nlmsg* nlmsg, int sock, uint16_t reply_type,
+                     int* reply_len, bool dofail);
+int netlink_send(struct nlmsg* nlmsg, int sock);
+void netlink_batch_init(struct nlbatch* batch);
+void netlink_batch_add(struct nlbatch* batch, struct nlmsg* nlmsg);
+int netlink_batch_send(struct nlbatch* batch, int sock);
+int netlink_query_family_id(struct nlmsg* nlmsg, int sock,
+                            const char* family_name, bool dofail);
+// Forgets the cached ID of family_name if err (-errno of a request sent to
+// it) may come from the ID being stale; true means look it up and retry.
+bool netlink_family_id_stale(const char* family_name, int err);
+void initialize_tun(void);
+void flush_tun(void);
+void initialize_netdevices_init(void);
+void initialize_netdevices(void);
+
+// wifi.c
+void initialize_wifi_devices(void);
+
+// vhci.c
+void initialize_vhci(void);
+
+// netfilter.c
+void checkpoint_net_namespace(void);
+void reset_net_namespace(void);
+
+// fs.c
+long syz_open_dev(volatile long a0, volatile long a1, volatile long a2);
+long syz_read_part_table(volatile unsigned long size,
+                         volatile unsigned long nsegs, volatile long segments);
+long syz_mount_image(volatile long fsarg, volatile long dir,
+                     volatile unsigned long size, volatile unsigned long nsegs,
+                     volatile long segments, volatile long flags,
+                     volatile long optsarg);
+long syz_mount_image_blob(volatile long fsarg, volatile long dir,
+                          volatile unsigned long size, const void* blob,
+                          unsigned long bloblen, volatile long flags,
+                          volatile long optsarg);
+void reset_loop_device(void);
+void init_loop_pool(void);
+
+// usb.c
+volatile long syz_usb_connect(volatile long a0, volatile long a1,
+                              volatile long a2, volatile long a3);
+volatile long syz_usb_connect_ath9k(volatile long a0, volatile long a1,
+                                    volatile long a2, volatile long a3);
+volatile long syz_usb_disconnect(volatile long a0);
+volatile long syz_usb_control_io(volatile long a0, volatile long a1,
+                                 volatile long a2);
+volatile long syz_usb_ep_write(volatile long a0, volatile long a1,
+                               volatile long a2, volatile long a3);
+volatile long syz_usb_ep_read(volatile long a0, volatile long a1,
+                              volatile long a2, volatile long a3);
+long syz_usbip_server_init(volatile long a0);
+
+// io_uring.c
+long syz_io_uring_setup(volatile long a0, volatile long a1, volatile long a2,
+                        volatile long a3, volatile long a4, volatile long a5);
+long syz_io_uring_submit(volatile long a0, volatile long a1, volatile long a2,
+                         volatile long a3);
+
+// fuse.c
+volatile long syz_fuse_handle_req(volatile long a0, volatile long a1,
+                                  volatile long a2, volatile long a3);
+
+// fault.c
+int inject_fault(int nth);
+void setup_fault(void);
+
+// sandbox.c
+void setup_common(void);
+void sandbox_common(void);
+void drop_caps(void);
+int do_sandbox_none(void (*fn)(void));
+void build_net_templates(int procs);
+void remove_net_templates(void);
+void setup_binfmt_misc(void);
+void setup_usb(void);
+void setup_test(void);
+void close_fds(void);
+
+// loop.c
+void loop(void);
+int wait_workers(void);
+
+// threads.c
+void execute_calls(int ncalls, uint64_t timeout_ms, bool collide);
+
+#endif
@@ -0,0 +1,233 @@
+// Worker thread pool that runs the calls of a threaded reproducer, with
+// optional "collide" passes that let pairs of calls race.
+//
+// The schedule the reproducer asks for can be overridden from the
+// environment when hunting races:
+//
+//   SYZ_THREADS=N          worker threads (default 16, at most MAX_THREADS)
+//   SYZ_CPUS=0,2-3         pin worker i to the i-th listed CPU, round robin
+//   SYZ_CALL_WAIT_MS=N     how long to wait for each call before moving on
+//   SYZ_COLLIDE_PASSES=N   colliding passes after the first, in-order one
+//
+// In colliding passes the two calls of a pair normally start whenever their
+// threads get to them. Race-window amplification lines them up instead: both
+// threads meet at a spin barrier and one of them then spins for a fixed
+// offset before making its call, so the overlap is controlled to within a
+// few hundred nanoseconds. Pin the threads with SYZ_CPUS for best results.
+//
+//   SYZ_STAGGER=1          sweep the offset over stagger_ns[], both ways,
+//                          one step per loop() iteration
+//   SYZ_STAGGER_NS=N       use a fixed offset; negative delays the first call
+//
+// The offset in use is logged to /dev/kmsg as
+// "syz: stagger N ns proc P iter I pid PID". With several procs the lines of
+// all workers interleave on the console, so crash-index.sh attributes a crash
+// report to the offset logged by the pid the report names.
+
+#include "syz.h"
+
+#include <limits.h>
+#include <sched.h>
+
+#include <linux/futex.h>
+
+#define MAX_THREADS 64
+
+#if defined(__x86_64__) || defined(__i386__)
+#define cpu_relax() __builtin_ia32_pause()
+#else
+#define cpu_relax() __asm__ __volatile__("" ::: "memory")
+#endif
+
+struct thread_t {
+  int created, call, cpu;
+  event_t ready, done;
+  int* gate;
+  uint64_t delay_ns;
+};
+
+static const int64_t stagger_ns[] = {
+    0,     100,    200,    500,    1000,   2000,   5000,    10000,
+    20000, 50000, 100000, 200000, 500000, 1000000,
+};
+
+static struct thread_t threads[MAX_THREADS];
+static int running;
+
+static bool configured;
+static int nthreads = 16;
+static int ncpus;
+static int cpus[CPU_SETSIZE];
+static bool stagger;
+static int64_t stagger_offset;
+static int pair_gate;
+
+// Parses a CPU list such as "0,2-3" into cpus[].
+static void parse_cpus(const char* list)
+{
+  while (*list && ncpus < CPU_SETSIZE) {
+    char* end;
+    long first = strtol(list, &end, 10);
+    long last = first;
+    if (end == list)
+      break;
+    if (*end == '-')
+      last = strtol(end + 1, &end, 10);
+    for (long cpu = first; cpu <= last && ncpus < CPU_SETSIZE; cpu++)
+      cpus[ncpus++] = cpu;
+    list = *end == ',' ? end + 1 : end;
+  }
+}
+
+static void configure(void)
+{
+  configured = true;
+  nthreads = env_u64("SYZ_THREADS", nthreads);
+  if (nthreads < 1)
+    nthreads = 1;
+  if (nthreads > MAX_THREADS)
+    nthreads = MAX_THREADS;
+  const char* list = getenv("SYZ_CPUS");
+  if (list)
+    parse_cpus(list);
+  const char* fixed = getenv("SYZ_STAGGER_NS");
+  const int nsteps = sizeof(stagger_ns) / sizeof(stagger_ns[0]);
+  if (fixed && *fixed) {
+    stagger = true;
+    stagger_offset = strtoll(fixed, NULL, 0);
+  } else if (env_u64("SYZ_STAGGER", 0)) {
+    // 0, +100, ..., +1ms, -100, ..., -1ms.
+    int step = syz_iteration % (2 * nsteps - 1);
+    stagger = true;
+    stagger_offset =
+        step < nsteps ? stagger_ns[step] : -stagger_ns[step - nsteps + 1];
+  }
+  if (stagger) {
+    int fd = open("/dev/kmsg", O_WRONLY);
+    if (fd >= 0) {
+      dprintf(fd, "syz: stagger %lld ns proc %llu iter %llu pid %d\n",
+              (long long)stagger_offset, procid,
+              (unsigned long long)syz_iteration, getpid());
+      close(fd);
+    }
+  }
+}
+
+static uint64_t current_time_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Spins until both threads of a pair arrive, then for delay_ns more. The
+// partner is never dispatched if no thread was free for it, so the barrier
+// gives up after 100 ms.
+static void stagger_start(int* gate, uint64_t delay_ns)
+{
+  __atomic_fetch_add(gate, 1, __ATOMIC_ACQ_REL);
+  uint64_t deadline = current_time_ns() + 100 * 1000 * 1000;
+  while (__atomic_load_n(gate, __ATOMIC_ACQUIRE) < 2) {
+    if (current_time_ns() > deadline)
+      return;
+    cpu_relax();
+  }
+  if (!delay_ns)
+    return;
+  uint64_t until = current_time_ns() + delay_ns;
+  while (current_time_ns() < until)
+    cpu_relax();
+}
+
+// Sleeps until the last in-flight call finishes or timeout_ms passes.
+static void wait_running(uint64_t timeout_ms)
+{
+  uint64_t start = current_time_ms();
+  for (;;) {
+    int cur = __atomic_load_n(&running, __ATOMIC_ACQUIRE);
+    if (cur == 0)
+      return;
+    uint64_t elapsed = current_time_ms() - start;
+    if (elapsed >= timeout_ms)
+      return;
+    uint64_t remain = timeout_ms - elapsed;
+    struct timespec ts;
+    ts.tv_sec = remain / 1000;
+    ts.tv_nsec = (remain % 1000) * 1000 * 1000;
+    syscall(SYS_futex, &running, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, cur, &ts);
+  }
+}
+
+static void* thr(void* arg)
+{
+  struct thread_t* th = (struct thread_t*)arg;
+  if (th->cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(th->cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+  }
+  for (;;) {
+    event_wait(&th->ready);
+    event_reset(&th->ready);
+    if (th->gate)
+      stagger_start(th->gate, th->delay_ns);
+    execute_call(th->call);
+    if (__atomic_sub_fetch(&running, 1, __ATOMIC_RELEASE) == 0)
+      syscall(SYS_futex, &running, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX);
+    event_set(&th->done);
+  }
+  return 0;
+}
+
+void execute_calls(int ncalls, uint64_t timeout_ms, bool collide)
+{
+  int call, thread;
+  if (!configured)
+    configure();
+  timeout_ms = env_u64("SYZ_CALL_WAIT_MS", timeout_ms);
+  int passes = env_u64("SYZ_COLLIDE_PASSES", collide ? 1 : 0);
+  int pass = 0;
+  bool colliding = false;
+again:
+  for (call = 0; call < ncalls; call++) {
+    for (thread = 0; thread < nthreads; thread++) {
+      struct thread_t* th = &threads[thread];
+      if (!th->created) {
+        th->created = 1;
+        th->cpu = ncpus ? cpus[thread % ncpus] : -1;
+        event_init(&th->ready);
+        event_init(&th->done);
+        event_set(&th->done);
+        thread_start(thr, th);
+      }
+      if (!event_isset(&th->done))
+        continue;
+      event_reset(&th->done);
+      th->call = call;
+      th->gate = NULL;
+      if (stagger && colliding && (call % 2) == 0 && call + 1 < ncalls) {
+        __atomic_store_n(&pair_gate, 0, __ATOMIC_RELEASE);
+        th->gate = &pair_gate;
+        th->delay_ns = stagger_offset < 0 ? -stagger_offset : 0;
+      } else if (stagger && colliding && (call % 2) == 1) {
+        th->gate = &pair_gate;
+        th->delay_ns = stagger_offset > 0 ? stagger_offset : 0;
+      }
+      __atomic_fetch_add(&running, 1, __ATOMIC_RELEASE);
+      event_set(&th->ready);
+      if (colliding && (call % 2) == 0)
+        break;
+      event_timedwait(&th->done, timeout_ms);
+      break;
+    }
+  }
+  wait_running(100);
+  if (syz_features & SYZ_CLOSE_FDS)
+    close_fds();
+  if (pass < passes) {
+    pass++;
+    colliding = true;
+    goto again;
+  }
+}
@@ -0,0 +1,891 @@
+// USB device emulation on top of the raw-gadget interface, plus the usbip
+// server side for syz_usbip_server_init().
+//
+// Emulated devices are kept in a table indexed by their raw-gadget fd, so
+// every call finds its device directly. Each device binds its own dummy_hcd
+// UDC: the first one of a worker keeps dummy_udc.<procid>, further ones it
+// connects at the same time take dummy_udc.<procid + k * procs>, so a
+// reproducer can drive several gadgets at once when the kernel is booted
+// with enough instances (dummy_hcd.num).
+//
+//   SYZ_USB_SETTLE_MS=N   time given to the host after each emulated
+//                         transfer (default 200)
+
+#include "syz.h"
+
+#include <linux/usb/ch9.h>
+
+#define USB_MAX_IFACE_NUM 4
+#define USB_MAX_EP_NUM 32
+#define USB_MAX_UDCS_PER_PROC 4
+
+struct usb_endpoint_index {
+  struct usb_endpoint_descriptor desc;
+  int handle;
+};
+
+struct usb_response_entry {
+  const char* data;
+  uint32_t len;
+  bool set;
+};
+
+struct usb_iface_index {
+  struct usb_interface_descriptor* iface;
+  uint8_t bInterfaceNumber;
+  uint8_t bAlternateSetting;
+  uint8_t bInterfaceClass;
+  struct usb_endpoint_index eps[USB_MAX_EP_NUM];
+  int eps_num;
+  int8_t next_alt;
+};
+
+struct usb_device_index {
+  struct usb_device_descriptor* dev;
+  struct usb_config_descriptor* config;
+  uint8_t bDeviceClass;
+  uint8_t bMaxPower;
+  int config_length;
+  struct usb_iface_index ifaces[USB_MAX_IFACE_NUM];
+  int ifaces_num;
+  int iface_cur;
+  // Flat lookup tables, filled once per connect. Standard GET_DESCRIPTOR
+  // answers are keyed by descriptor type, strings by their index, interfaces
+  // by number (alternate settings are chained through next_alt), and the
+  // endpoints of the current interface by address.
+  struct usb_response_entry desc_resps[256];
+  struct usb_response_entry str_resps[256];
+  struct usb_qualifier_descriptor qual;
+  int8_t iface_by_num[256];
+  int ep_handles[256];
+};
+
+struct usb_info {
+  int used;
+  struct usb_device_index index;
+};
+
+static struct usb_info usb_devices[MAX_FDS];
+
+static bool parse_usb_descriptor(const char* buffer, size_t length,
+                                 struct usb_device_index* index)
+{
+  if (length < sizeof(*index->dev) + sizeof(*index->config))
+    return false;
+  memset(index, 0, sizeof(*index));
+  index->dev = (struct usb_device_descriptor*)buffer;
+  index->config = (struct usb_config_descriptor*)(buffer + sizeof(*index->dev));
+  index->bDeviceClass = index->dev->bDeviceClass;
+  index->bMaxPower = index->config->bMaxPower;
+  index->config_length = length - sizeof(*index->dev);
+  index->iface_cur = -1;
+  memset(index->iface_by_num, -1, sizeof(index->iface_by_num));
+  memset(index->ep_handles, -1, sizeof(index->ep_handles));
+  size_t offset = 0;
+  while (true) {
+    if (offset + 1 >= length)
+      break;
+    uint8_t desc_length = buffer[offset];
+    uint8_t desc_type = buffer[offset + 1];
+    if (desc_length <= 2)
+      break;
+    if (offset + desc_length > length)
+      break;
+    if (desc_type == USB_DT_INTERFACE &&
+        index->ifaces_num < USB_MAX_IFACE_NUM) {
+      struct usb_interface_descriptor* iface =
+          (struct usb_interface_descriptor*)(buffer + offset);
+      index->ifaces[index->ifaces_num].iface = iface;
+      index->ifaces[index->ifaces_num].bInterfaceNumber =
+          iface->bInterfaceNumber;
+      index->ifaces[index->ifaces_num].bAlternateSetting =
+          iface->bAlternateSetting;
+      index->ifaces[index->ifaces_num].bInterfaceClass = iface->bInterfaceClass;
+      index->ifaces[index->ifaces_num].next_alt = -1;
+      int8_t* slot = &index->iface_by_num[iface->bInterfaceNumber];
+      while (*slot >= 0)
+        slot = &index->ifaces[(int)*slot].next_alt;
+      *slot = index->ifaces_num;
+      index->ifaces_num++;
+    }
+    if (desc_type == USB_DT_ENDPOINT && index->ifaces_num > 0) {
+      struct usb_iface_index* iface = &index->ifaces[index->ifaces_num - 1];
+      if (iface->eps_num < USB_MAX_EP_NUM) {
+        memcpy(&iface->eps[iface->eps_num].desc, buffer + offset,
+               sizeof(iface->eps[iface->eps_num].desc));
+        iface->eps_num++;
+      }
+    }
+    offset += desc_length;
+  }
+  return true;
+}
+
+static struct usb_device_index* add_usb_index(int fd, const char* dev,
+                                              size_t dev_len)
+{
+  if (fd < 0 || fd >= MAX_FDS)
+    return NULL;
+  struct usb_info* info = &usb_devices[fd];
+  __atomic_store_n(&info->used, 0, __ATOMIC_RELEASE);
+  if (!parse_usb_descriptor(dev, dev_len, &info->index))
+    return NULL;
+  __atomic_store_n(&info->used, 1, __ATOMIC_RELEASE);
+  return &info->index;
+}
+
+static struct usb_device_index* lookup_usb_index(int fd)
+{
+  if (fd < 0 || fd >= MAX_FDS)
+    return NULL;
+  if (!__atomic_load_n(&usb_devices[fd].used, __ATOMIC_ACQUIRE))
+    return NULL;
+  return &usb_devices[fd].index;
+}
+
+static void remove_usb_index(int fd)
+{
+  if (fd >= 0 && fd < MAX_FDS)
+    __atomic_store_n(&usb_devices[fd].used, 0, __ATOMIC_RELEASE);
+}
+
+struct vusb_connect_string_descriptor {
+  uint32_t len;
+  char* str;
+} __attribute__((packed));
+
+struct vusb_connect_descriptors {
+  uint32_t qual_len;
+  char* qual;
+  uint32_t bos_len;
+  char* bos;
+  uint32_t strs_len;
+  struct vusb_connect_string_descriptor strs[0];
+} __attribute__((packed));
+
+static const char default_string[] = {8, USB_DT_STRING, 's', 0, 'y', 0, 'z', 0};
+
+static const char default_lang_id[] = {4, USB_DT_STRING, 0x09, 0x04};
+
+static void set_response(struct usb_response_entry* entry, const char* data,
+                         uint32_t len)
+{
+  entry->data = data;
+  entry->len = len;
+  entry->set = true;
+}
+
+// Fills the response tables of a freshly parsed device with everything the
+// host may ask for while enumerating it.
+static void
+compile_connect_responses(struct usb_device_index* index,
+                          const struct vusb_connect_descriptors* descs)
+{
+  set_response(&index->desc_resps[USB_DT_DEVICE], (char*)index->dev,
+               sizeof(*index->dev));
+  set_response(&index->desc_resps[USB_DT_CONFIG], (char*)index->config,
+               index->config_length);
+  if (descs)
+    set_response(&index->desc_resps[USB_DT_BOS], descs->bos, descs->bos_len);
+  if (descs && descs->qual) {
+    set_response(&index->desc_resps[USB_DT_DEVICE_QUALIFIER], descs->qual,
+                 descs->qual_len);
+  } else {
+    struct usb_qualifier_descriptor* qual = &index->qual;
+    qual->bLength = sizeof(*qual);
+    qual->bDescriptorType = USB_DT_DEVICE_QUALIFIER;
+    qual->bcdUSB = index->dev->bcdUSB;
+    qual->bDeviceClass = index->dev->bDeviceClass;
+    qual->bDeviceSubClass = index->dev->bDeviceSubClass;
+    qual->bDeviceProtocol = index->dev->bDeviceProtocol;
+    qual->bMaxPacketSize0 = index->dev->bMaxPacketSize0;
+    qual->bNumConfigurations = index->dev->bNumConfigurations;
+    qual->bRESERVED = 0;
+    set_response(&index->desc_resps[USB_DT_DEVICE_QUALIFIER], (char*)qual,
+                 sizeof(*qual));
+  }
+  set_response(&index->desc_resps[USB_DT_STRING], NULL, 0);
+  for (int i = 0; i < 256; i++) {
+    if (descs && (uint32_t)i < descs->strs_len)
+      set_response(&index->str_resps[i], descs->strs[i].str,
+                   descs->strs[i].len);
+    else if (i == 0)
+      set_response(&index->str_resps[i], default_lang_id, default_lang_id[0]);
+    else
+      set_response(&index->str_resps[i], default_string, default_string[0]);
+  }
+}
+
+static bool lookup_connect_response_in(int fd,
+                                       const struct usb_ctrlrequest* ctrl,
+                                       char** response_data,
+                                       uint32_t* response_length)
+{
+  struct usb_device_index* index = lookup_usb_index(fd);
+  if (!index)
+    return false;
+  if ((ctrl->bRequestType & USB_TYPE_MASK) != USB_TYPE_STANDARD ||
+      ctrl->bRequest != USB_REQ_GET_DESCRIPTOR)
+    return false;
+  uint8_t desc_type = ctrl->wValue >> 8;
+  const struct usb_response_entry* entry = &index->desc_resps[desc_type];
+  if (desc_type == USB_DT_STRING)
+    entry = &index->str_resps[(uint8_t)ctrl->wValue];
+  if (!entry->set)
+    return false;
+  *response_data = (char*)entry->data;
+  *response_length = entry->len;
+  return true;
+}
+
+typedef bool (*lookup_connect_out_response_t)(
+    int fd, const struct vusb_connect_descriptors* descs,
+    const struct usb_ctrlrequest* ctrl, bool* done);
+
+static bool lookup_connect_response_out_generic(
+    int fd, const struct vusb_connect_descriptors* descs,
+    const struct usb_ctrlrequest* ctrl, bool* done)
+{
+  switch (ctrl->bRequestType & USB_TYPE_MASK) {
+  case USB_TYPE_STANDARD:
+    switch (ctrl->bRequest) {
+    case USB_REQ_SET_CONFIGURATION:
+      *done = true;
+      return true;
+    default:
+      break;
+    }
+    break;
+  }
+  return false;
+}
+
+#define ATH9K_FIRMWARE_DOWNLOAD 0x30
+#define ATH9K_FIRMWARE_DOWNLOAD_COMP 0x31
+
+static bool lookup_connect_response_out_ath9k(
+    int fd, const struct vusb_connect_descriptors* descs,
+    const struct usb_ctrlrequest* ctrl, bool* done)
+{
+  switch (ctrl->bRequestType & USB_TYPE_MASK) {
+  case USB_TYPE_STANDARD:
+    switch (ctrl->bRequest) {
+    case USB_REQ_SET_CONFIGURATION:
+      return true;
+    default:
+      break;
+    }
+    break;
+  case USB_TYPE_VENDOR:
+    switch (ctrl->bRequest) {
+    case ATH9K_FIRMWARE_DOWNLOAD:
+      return true;
+    case ATH9K_FIRMWARE_DOWNLOAD_COMP:
+      *done = true;
+      return true;
+    default:
+      break;
+    }
+    break;
+  }
+  return false;
+}
+
+struct vusb_descriptor {
+  uint8_t req_type;
+  uint8_t desc_type;
+  uint32_t len;
+  char data[0];
+} __attribute__((packed));
+
+struct vusb_descriptors {
+  uint32_t len;
+  struct vusb_descriptor* generic;
+  struct vusb_descriptor* descs[0];
+} __attribute__((packed));
+
+struct vusb_response {
+  uint8_t type;
+  uint8_t req;
+  uint32_t len;
+  char data[0];
+} __attribute__((packed));
+
+struct vusb_responses {
+  uint32_t len;
+  struct vusb_response* generic;
+  struct vusb_response* resps[0];
+} __attribute__((packed));
+
+static bool lookup_control_response(const struct vusb_descriptors* descs,
+                                    const struct vusb_responses* resps,
+                                    struct usb_ctrlrequest* ctrl,
+                                    char** response_data,
+                                    uint32_t* response_length)
+{
+  int descs_num = 0;
+  int resps_num = 0;
+  if (descs)
+    descs_num = (descs->len - offsetof(struct vusb_descriptors, descs)) /
+                sizeof(descs->descs[0]);
+  if (resps)
+    resps_num = (resps->len - offsetof(struct vusb_responses, resps)) /
+                sizeof(resps->resps[0]);
+  uint8_t req = ctrl->bRequest;
+  uint8_t req_type = ctrl->bRequestType & USB_TYPE_MASK;
+  uint8_t desc_type = ctrl->wValue >> 8;
+  if (req == USB_REQ_GET_DESCRIPTOR) {
+    int i;
+    for (i = 0; i < descs_num; i++) {
+      struct vusb_descriptor* desc = descs->descs[i];
+      if (!desc)
+        continue;
+      if (desc->req_type == req_type && desc->desc_type == desc_type) {
+        *response_length = desc->len;
+        if (*response_length != 0)
+          *response_data = &desc->data[0];
+        else
+          *response_data = NULL;
+        return true;
+      }
+    }
+    if (descs && descs->generic) {
+      *response_data = &descs->generic->data[0];
+      *response_length = descs->generic->len;
+      return true;
+    }
+  } else {
+    int i;
+    for (i = 0; i < resps_num; i++) {
+      struct vusb_response* resp = resps->resps[i];
+      if (!resp)
+        continue;
+      if (resp->type == req_type && resp->req == req) {
+        *response_length = resp->len;
+        if (*response_length != 0)
+          *response_data = &resp->data[0];
+        else
+          *response_data = NULL;
+        return true;
+      }
+    }
+    if (resps && resps->generic) {
+      *response_data = &resps->generic->data[0];
+      *response_length = resps->generic->len;
+      return true;
+    }
+  }
+  return false;
+}
+
+#define UDC_NAME_LENGTH_MAX 128
+
+struct usb_raw_init {
+  __u8 driver_name[UDC_NAME_LENGTH_MAX];
+  __u8 device_name[UDC_NAME_LENGTH_MAX];
+  __u8 speed;
+};
+
+enum usb_raw_event_type {
+  USB_RAW_EVENT_INVALID = 0,
+  USB_RAW_EVENT_CONNECT = 1,
+  USB_RAW_EVENT_CONTROL = 2,
+};
+
+struct usb_raw_event {
+  __u32 type;
+  __u32 length;
+  __u8 data[0];
+};
+
+struct usb_raw_ep_io {
+  __u16 ep;
+  __u16 flags;
+  __u32 length;
+  __u8 data[0];
+};
+
+#define USB_RAW_EPS_NUM_MAX 30
+#define USB_RAW_EP_NAME_MAX 16
+#define USB_RAW_EP_ADDR_ANY 0xff
+
+struct usb_raw_ep_caps {
+  __u32 type_control : 1;
+  __u32 type_iso : 1;
+  __u32 type_bulk : 1;
+  __u32 type_int : 1;
+  __u32 dir_in : 1;
+  __u32 dir_out : 1;
+};
+
+struct usb_raw_ep_limits {
+  __u16 maxpacket_limit;
+  __u16 max_streams;
+  __u32 reserved;
+};
+
+struct usb_raw_ep_info {
+  __u8 name[USB_RAW_EP_NAME_MAX];
+  __u32 addr;
+  struct usb_raw_ep_caps caps;
+  struct usb_raw_ep_limits limits;
+};
+
+struct usb_raw_eps_info {
+  struct usb_raw_ep_info eps[USB_RAW_EPS_NUM_MAX];
+};
+
+#define USB_RAW_IOCTL_INIT _IOW('U', 0, struct usb_raw_init)
+#define USB_RAW_IOCTL_RUN _IO('U', 1)
+#define USB_RAW_IOCTL_EVENT_FETCH _IOR('U', 2, struct usb_raw_event)
+#define USB_RAW_IOCTL_EP0_WRITE _IOW('U', 3, struct usb_raw_ep_io)
+#define USB_RAW_IOCTL_EP0_READ _IOWR('U', 4, struct usb_raw_ep_io)
+#define USB_RAW_IOCTL_EP_ENABLE _IOW('U', 5, struct usb_endpoint_descriptor)
+#define USB_RAW_IOCTL_EP_DISABLE _IOW('U', 6, __u32)
+#define USB_RAW_IOCTL_EP_WRITE _IOW('U', 7, struct usb_raw_ep_io)
+#define USB_RAW_IOCTL_EP_READ _IOWR('U', 8, struct usb_raw_ep_io)
+#define USB_RAW_IOCTL_CONFIGURE _IO('U', 9)
+#define USB_RAW_IOCTL_VBUS_DRAW _IOW('U', 10, __u32)
+#define USB_RAW_IOCTL_EPS_INFO _IOR('U', 11, struct usb_raw_eps_info)
+#define USB_RAW_IOCTL_EP0_STALL _IO('U', 12)
+#define USB_RAW_IOCTL_EP_SET_HALT _IOW('U', 13, __u32)
+#define USB_RAW_IOCTL_EP_CLEAR_HALT _IOW('U', 14, __u32)
+#define USB_RAW_IOCTL_EP_SET_WEDGE _IOW('U', 15, __u32)
+
+static int usb_raw_open()
+{
+  return open("/dev/raw-gadget", O_RDWR);
+}
+
+static int usb_raw_init(int fd, uint32_t speed, const char* driver,
+                        const char* device)
+{
+  struct usb_raw_init arg;
+  strncpy((char*)&arg.driver_name[0], driver, sizeof(arg.driver_name));
+  strncpy((char*)&arg.device_name[0], device, sizeof(arg.device_name));
+  arg.speed = speed;
+  return ioctl(fd, USB_RAW_IOCTL_INIT, &arg);
+}
+
+static int usb_raw_run(int fd)
+{
+  return ioctl(fd, USB_RAW_IOCTL_RUN, 0);
+}
+
+static int usb_raw_event_fetch(int fd, struct usb_raw_event* event)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EVENT_FETCH, event);
+}
+
+static int usb_raw_ep0_write(int fd, struct usb_raw_ep_io* io)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP0_WRITE, io);
+}
+
+static int usb_raw_ep0_read(int fd, struct usb_raw_ep_io* io)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP0_READ, io);
+}
+
+static int usb_raw_ep_write(int fd, struct usb_raw_ep_io* io)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP_WRITE, io);
+}
+
+static int usb_raw_ep_read(int fd, struct usb_raw_ep_io* io)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP_READ, io);
+}
+
+static int usb_raw_ep_enable(int fd, struct usb_endpoint_descriptor* desc)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP_ENABLE, desc);
+}
+
+static int usb_raw_ep_disable(int fd, int ep)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP_DISABLE, ep);
+}
+
+static int usb_raw_configure(int fd)
+{
+  return ioctl(fd, USB_RAW_IOCTL_CONFIGURE, 0);
+}
+
+static int usb_raw_vbus_draw(int fd, uint32_t power)
+{
+  return ioctl(fd, USB_RAW_IOCTL_VBUS_DRAW, power);
+}
+
+static int usb_raw_ep0_stall(int fd)
+{
+  return ioctl(fd, USB_RAW_IOCTL_EP0_STALL, 0);
+}
+
+// Opens a raw-gadget device and binds it to the first free UDC of this
+// worker. Binding a busy or missing UDC fails with EBUSY or ENODEV, and a
+// raw-gadget fd can only be initialized once, so each try uses a new fd.
+static int usb_raw_start(uint64_t speed)
+{
+  int procs = syz_procs();
+  for (int k = 0; k < USB_MAX_UDCS_PER_PROC; k++) {
+    int fd = usb_raw_open();
+    if (fd < 0)
+      return fd;
+    char device[32];
+    sprintf(&device[0], "dummy_udc.%llu", procid + k * procs);
+    if (usb_raw_init(fd, speed, "dummy_udc", &device[0]) == 0 &&
+        usb_raw_run(fd) == 0)
+      return fd;
+    int err = errno;
+    close(fd);
+    if (err != EBUSY && err != ENODEV)
+      return -1;
+  }
+  return -1;
+}
+
+static void usb_settle(void)
+{
+  sleep_ms(env_u64("SYZ_USB_SETTLE_MS", 200));
+}
+
+static int lookup_interface(int fd, uint8_t bInterfaceNumber,
+                            uint8_t bAlternateSetting)
+{
+  struct usb_device_index* index = lookup_usb_index(fd);
+  if (!index)
+    return -1;
+  int i = index->iface_by_num[bInterfaceNumber];
+  while (i >= 0 && index->ifaces[i].bAlternateSetting != bAlternateSetting)
+    i = index->ifaces[i].next_alt;
+  return i;
+}
+
+static int lookup_endpoint(int fd, uint8_t bEndpointAddress)
+{
+  struct usb_device_index* index = lookup_usb_index(fd);
+  if (!index)
+    return -1;
+  return index->ep_handles[bEndpointAddress];
+}
+
+static void set_interface(int fd, int n)
+{
+  struct usb_device_index* index = lookup_usb_index(fd);
+  if (!index)
+    return;
+  if (index->iface_cur >= 0 && index->iface_cur < index->ifaces_num) {
+    for (int ep = 0; ep < index->ifaces[index->iface_cur].eps_num; ep++) {
+      int rv = usb_raw_ep_disable(
+          fd, index->ifaces[index->iface_cur].eps[ep].handle);
+      if (rv < 0) {
+      } else {
+      }
+    }
+  }
+  if (n >= 0 && n < index->ifaces_num) {
+    for (int ep = 0; ep < index->ifaces[n].eps_num; ep++) {
+      int rv = usb_raw_ep_enable(fd, &index->ifaces[n].eps[ep].desc);
+      if (rv < 0) {
+      } else {
+        index->ifaces[n].eps[ep].handle = rv;
+      }
+    }
+    // Walk backwards so that the first endpoint with an address wins.
+    memset(index->ep_handles, -1, sizeof(index->ep_handles));
+    for (int ep = index->ifaces[n].eps_num - 1; ep >= 0; ep--) {
+      struct usb_endpoint_index* e = &index->ifaces[n].eps[ep];
+      index->ep_handles[e->desc.bEndpointAddress] = e->handle;
+    }
+    index->iface_cur = n;
+  }
+}
+
+static int configure_device(int fd)
+{
+  struct usb_device_index* index = lookup_usb_index(fd);
+  if (!index)
+    return -1;
+  int rv = usb_raw_vbus_draw(fd, index->bMaxPower);
+  if (rv < 0) {
+    return rv;
+  }
+  rv = usb_raw_configure(fd);
+  if (rv < 0) {
+    return rv;
+  }
+  set_interface(fd, 0);
+  return 0;
+}
+
+#define USB_MAX_PACKET_SIZE 4096
+
+struct usb_raw_control_event {
+  struct usb_raw_event inner;
+  struct usb_ctrlrequest ctrl;
+  char data[USB_MAX_PACKET_SIZE];
+};
+
+struct usb_raw_ep_io_data {
+  struct usb_raw_ep_io inner;
+  char data[USB_MAX_PACKET_SIZE];
+};
+
+static volatile long
+syz_usb_connect_impl(uint64_t speed, uint64_t dev_len, const char* dev,
+                     const struct vusb_connect_descriptors* descs,
+                     lookup_connect_out_response_t lookup_connect_response_out)
+{
+  if (!dev) {
+    return -1;
+  }
+  int fd = usb_raw_start(speed);
+  if (fd < 0) {
+    return fd;
+  }
+  if (fd >= MAX_FDS) {
+    close(fd);
+    return -1;
+  }
+  struct usb_device_index* index = add_usb_index(fd, dev, dev_len);
+  if (!index) {
+    close(fd);
+    return -1;
+  }
+  compile_connect_responses(index, descs);
+  int rv;
+  bool done = false;
+  while (!done) {
+    struct usb_raw_control_event event;
+    event.inner.type = 0;
+    event.inner.length = sizeof(event.ctrl);
+    rv = usb_raw_event_fetch(fd, (struct usb_raw_event*)&event);
+    if (rv < 0) {
+      return rv;
+    }
+    if (event.inner.type != USB_RAW_EVENT_CONTROL)
+      continue;
+    char* response_data = NULL;
+    uint32_t response_length = 0;
+    if (event.ctrl.bRequestType & USB_DIR_IN) {
+      if (!lookup_connect_response_in(fd, &event.ctrl, &response_data,
+                                      &response_length)) {
+        usb_raw_ep0_stall(fd);
+        continue;
+      }
+    } else {
+      if (!lookup_connect_response_out(fd, descs, &event.ctrl, &done)) {
+        usb_raw_ep0_stall(fd);
+        continue;
+      }
+      response_data = NULL;
+      response_length = event.ctrl.wLength;
+    }
+    if ((event.ctrl.bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD &&
+        event.ctrl.bRequest == USB_REQ_SET_CONFIGURATION) {
+      rv = configure_device(fd);
+      if (rv < 0) {
+        return rv;
+      }
+    }
+    struct usb_raw_ep_io_data response;
+    response.inner.ep = 0;
+    response.inner.flags = 0;
+    if (response_length > sizeof(response.data))
+      response_length = 0;
+    if (event.ctrl.wLength < response_length)
+      response_length = event.ctrl.wLength;
+    response.inner.length = response_length;
+    if (response_data)
+      memcpy(&response.data[0], response_data, response_length);
+    else
+      memset(&response.data[0], 0, response_length);
+    if (event.ctrl.bRequestType & USB_DIR_IN) {
+      rv = usb_raw_ep0_write(fd, (struct usb_raw_ep_io*)&response);
+    } else {
+      rv = usb_raw_ep0_read(fd, (struct usb_raw_ep_io*)&response);
+    }
+    if (rv < 0) {
+      return rv;
+    }
+  }
+  usb_settle();
+  return fd;
+}
+
+volatile long syz_usb_connect(volatile long a0, volatile long a1,
+                                     volatile long a2, volatile long a3)
+{
+  uint64_t speed = a0;
+  uint64_t dev_len = a1;
+  const char* dev = (const char*)a2;
+  const struct vusb_connect_descriptors* descs =
+      (const struct vusb_connect_descriptors*)a3;
+  return syz_usb_connect_impl(speed, dev_len, dev, descs,
+                              &lookup_connect_response_out_generic);
+}
+
+volatile long syz_usb_connect_ath9k(volatile long a0, volatile long a1,
+                                    volatile long a2, volatile long a3)
+{
+  uint64_t speed = a0;
+  uint64_t dev_len = a1;
+  const char* dev = (const char*)a2;
+  const struct vusb_connect_descriptors* descs =
+      (const struct vusb_connect_descriptors*)a3;
+  return syz_usb_connect_impl(speed, dev_len, dev, descs,
+                              &lookup_connect_response_out_ath9k);
+}
+
+volatile long syz_usb_control_io(volatile long a0, volatile long a1,
+                                        volatile long a2)
+{
+  int fd = a0;
+  const struct vusb_descriptors* descs = (const struct vusb_descriptors*)a1;
+  const struct vusb_responses* resps = (const struct vusb_responses*)a2;
+  struct usb_raw_control_event event;
+  event.inner.type = 0;
+  event.inner.length = USB_MAX_PACKET_SIZE;
+  int rv = usb_raw_event_fetch(fd, (struct usb_raw_event*)&event);
+  if (rv < 0) {
+    return rv;
+  }
+  if (event.inner.type != USB_RAW_EVENT_CONTROL) {
+    return -1;
+  }
+  char* response_data = NULL;
+  uint32_t response_length = 0;
+  if ((event.ctrl.bRequestType & USB_DIR_IN) && event.ctrl.wLength) {
+    if (!lookup_control_response(descs, resps, &event.ctrl, &response_data,
+                                 &response_length)) {
+      usb_raw_ep0_stall(fd);
+      return -1;
+    }
+  } else {
+    if ((event.ctrl.bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD ||
+        event.ctrl.bRequest == USB_REQ_SET_INTERFACE) {
+      int iface_num = event.ctrl.wIndex;
+      int alt_set = event.ctrl.wValue;
+      int iface_index = lookup_interface(fd, iface_num, alt_set);
+      if (iface_index < 0) {
+      } else {
+        set_interface(fd, iface_index);
+      }
+    }
+    response_length = event.ctrl.wLength;
+  }
+  struct usb_raw_ep_io_data response;
+  response.inner.ep = 0;
+  response.inner.flags = 0;
+  if (response_length > sizeof(response.data))
+    response_length = 0;
+  if (event.ctrl.wLength < response_length)
+    response_length = event.ctrl.wLength;
+  if ((event.ctrl.bRequestType & USB_DIR_IN) && !event.ctrl.wLength) {
+    response_length = USB_MAX_PACKET_SIZE;
+  }
+  response.inner.length = response_length;
+  if (response_data)
+    memcpy(&response.data[0], response_data, response_length);
+  else
+    memset(&response.data[0], 0, response_length);
+  if ((event.ctrl.bRequestType & USB_DIR_IN) && event.ctrl.wLength) {
+    rv = usb_raw_ep0_write(fd, (struct usb_raw_ep_io*)&response);
+  } else {
+    rv = usb_raw_ep0_read(fd, (struct usb_raw_ep_io*)&response);
+  }
+  if (rv < 0) {
+    return rv;
+  }
+  usb_settle();
+  return 0;
+}
+
+volatile long syz_usb_ep_write(volatile long a0, volatile long a1,
+                               volatile long a2, volatile long a3)
+{
+  int fd = a0;
+  uint8_t ep = a1;
+  uint32_t len = a2;
+  char* data = (char*)a3;
+  int ep_handle = lookup_endpoint(fd, ep);
+  if (ep_handle < 0) {
+    return -1;
+  }
+  struct usb_raw_ep_io_data io_data;
+  io_data.inner.ep = ep_handle;
+  io_data.inner.flags = 0;
+  if (len > sizeof(io_data.data))
+    len = sizeof(io_data.data);
+  io_data.inner.length = len;
+  memcpy(&io_data.data[0], data, len);
+  int rv = usb_raw_ep_write(fd, (struct usb_raw_ep_io*)&io_data);
+  if (rv < 0) {
+    return rv;
+  }
+  usb_settle();
+  return 0;
+}
+
+volatile long syz_usb_ep_read(volatile long a0, volatile long a1,
+                              volatile long a2, volatile long a3)
+{
+  int fd = a0;
+  uint8_t ep = a1;
+  uint32_t len = a2;
+  char* data = (char*)a3;
+  int ep_handle = lookup_endpoint(fd, ep);
+  if (ep_handle < 0) {
+    return -1;
+  }
+  struct usb_raw_ep_io_data io_data;
+  io_data.inner.ep = ep_handle;
+  io_data.inner.flags = 0;
+  if (len > sizeof(io_data.data))
+    len = sizeof(io_data.data);
+  io_data.inner.length = len;
+  int rv = usb_raw_ep_read(fd, (struct usb_raw_ep_io*)&io_data);
+  if (rv < 0) {
+    return rv;
+  }
+  memcpy(&data[0], &io_data.data[0], io_data.inner.length);
+  usb_settle();
+  return 0;
+}
+
+volatile long syz_usb_disconnect(volatile long a0)
+{
+  int fd = a0;
+  remove_usb_index(fd);
+  int rv = close(fd);
+  usb_settle();
+  return rv;
+}
+
+#define VHCI_HC_PORTS 8
+#define VHCI_PORTS (VHCI_HC_PORTS * 2)
+
+long syz_usbip_server_init(volatile long a0)
+{
+  int socket_pair[2];
+  char buffer[100];
+  static int port_alloc[2];
+  int speed = (int)a0;
+  bool usb3 = (speed == USB_SPEED_SUPER);
+  int rc = socketpair(AF_UNIX, SOCK_STREAM, 0, socket_pair);
+  if (rc < 0)
+    exit(1);
+  int client_fd = socket_pair[0];
+  int server_fd = socket_pair[1];
+  int available_port_num =
+      __atomic_fetch_add(&port_alloc[usb3], 1, __ATOMIC_RELAXED);
+  if (available_port_num > VHCI_HC_PORTS) {
+    return -1;
+  }
+  int port_num =
+      procid * VHCI_PORTS + usb3 * VHCI_HC_PORTS + available_port_num;
+  sprintf(buffer, "%d %d %s %d", port_num, client_fd, "0", speed);
+  write_file("/sys/devices/platform/vhci_hcd.0/attach", buffer);
+  return server_fd;
+}
@@ -0,0 +1,293 @@
+// Emulated bluetooth controller on /dev/vhci, set up for SYZ_VHCI.
+
+#include "syz.h"
+
+#include <pthread.h>
+#include <sys/uio.h>
+
+#include <linux/rfkill.h>
+
+#define BTPROTO_HCI 1
+#define ACL_LINK 1
+#define SCAN_PAGE 2
+
+typedef struct {
+  uint8_t b[6];
+} __attribute__((packed)) bdaddr_t;
+
+#define HCI_COMMAND_PKT 1
+#define HCI_EVENT_PKT 4
+#define HCI_VENDOR_PKT 0xff
+
+struct hci_command_hdr {
+  uint16_t opcode;
+  uint8_t plen;
+} __attribute__((packed));
+
+struct hci_event_hdr {
+  uint8_t evt;
+  uint8_t plen;
+} __attribute__((packed));
+
+#define HCI_EV_CONN_COMPLETE 0x03
+struct hci_ev_conn_complete {
+  uint8_t status;
+  uint16_t handle;
+  bdaddr_t bdaddr;
+  uint8_t link_type;
+  uint8_t encr_mode;
+} __attribute__((packed));
+
+#define HCI_EV_CONN_REQUEST 0x04
+struct hci_ev_conn_request {
+  bdaddr_t bdaddr;
+  uint8_t dev_class[3];
+  uint8_t link_type;
+} __attribute__((packed));
+
+#define HCI_EV_REMOTE_FEATURES 0x0b
+struct hci_ev_remote_features {
+  uint8_t status;
+  uint16_t handle;
+  uint8_t features[8];
+} __attribute__((packed));
+
+#define HCI_EV_CMD_COMPLETE 0x0e
+struct hci_ev_cmd_complete {
+  uint8_t ncmd;
+  uint16_t opcode;
+} __attribute__((packed));
+
+#define HCI_OP_WRITE_SCAN_ENABLE 0x0c1a
+
+#define HCI_OP_READ_BUFFER_SIZE 0x1005
+struct hci_rp_read_buffer_size {
+  uint8_t status;
+  uint16_t acl_mtu;
+  uint8_t sco_mtu;
+  uint16_t acl_max_pkt;
+  uint16_t sco_max_pkt;
+} __attribute__((packed));
+
+#define HCI_OP_READ_BD_ADDR 0x1009
+struct hci_rp_read_bd_addr {
+  uint8_t status;
+  bdaddr_t bdaddr;
+} __attribute__((packed));
+
+#define HCI_EV_LE_META 0x3e
+struct hci_ev_le_meta {
+  uint8_t subevent;
+} __attribute__((packed));
+
+#define HCI_EV_LE_CONN_COMPLETE 0x01
+struct hci_ev_le_conn_complete {
+  uint8_t status;
+  uint16_t handle;
+  uint8_t role;
+  uint8_t bdaddr_type;
+  bdaddr_t bdaddr;
+  uint16_t interval;
+  uint16_t latency;
+  uint16_t supervision_timeout;
+  uint8_t clk_accurancy;
+} __attribute__((packed));
+
+struct hci_dev_req {
+  uint16_t dev_id;
+  uint32_t dev_opt;
+};
+
+struct vhci_vendor_pkt {
+  uint8_t type;
+  uint8_t opcode;
+  uint16_t id;
+};
+
+#define HCIDEVUP _IOW('H', 201, int)
+#define HCISETSCAN _IOW('H', 221, int)
+
+static int vhci_fd = -1;
+
+static void rfkill_unblock_all()
+{
+  int fd = open("/dev/rfkill", O_WRONLY);
+  if (fd < 0)
+    exit(1);
+  struct rfkill_event event = {0};
+  event.idx = 0;
+  event.type = RFKILL_TYPE_ALL;
+  event.op = RFKILL_OP_CHANGE_ALL;
+  event.soft = 0;
+  event.hard = 0;
+  if (write(fd, &event, sizeof(event)) < 0)
+    exit(1);
+  close(fd);
+}
+
+static void hci_send_event_packet(int fd, uint8_t evt, void* data,
+                                  size_t data_len)
+{
+  struct iovec iv[3];
+  struct hci_event_hdr hdr;
+  hdr.evt = evt;
+  hdr.plen = data_len;
+  uint8_t type = HCI_EVENT_PKT;
+  iv[0].iov_base = &type;
+  iv[0].iov_len = sizeof(type);
+  iv[1].iov_base = &hdr;
+  iv[1].iov_len = sizeof(hdr);
+  iv[2].iov_base = data;
+  iv[2].iov_len = data_len;
+  if (writev(fd, iv, sizeof(iv) / sizeof(struct iovec)) < 0)
+    exit(1);
+}
+
+static void hci_send_event_cmd_complete(int fd, uint16_t opcode, void* data,
+                                        size_t data_len)
+{
+  struct iovec iv[4];
+  struct hci_event_hdr hdr;
+  hdr.evt = HCI_EV_CMD_COMPLETE;
+  hdr.plen = sizeof(struct hci_ev_cmd_complete) + data_len;
+  struct hci_ev_cmd_complete evt_hdr;
+  evt_hdr.ncmd = 1;
+  evt_hdr.opcode = opcode;
+  uint8_t type = HCI_EVENT_PKT;
+  iv[0].iov_base = &type;
+  iv[0].iov_len = sizeof(type);
+  iv[1].iov_base = &hdr;
+  iv[1].iov_len = sizeof(hdr);
+  iv[2].iov_base = &evt_hdr;
+  iv[2].iov_len = sizeof(evt_hdr);
+  iv[3].iov_base = data;
+  iv[3].iov_len = data_len;
+  if (writev(fd, iv, sizeof(iv) / sizeof(struct iovec)) < 0)
+    exit(1);
+}
+
+static bool process_command_pkt(int fd, char* buf, ssize_t buf_size)
+{
+  struct hci_command_hdr* hdr = (struct hci_command_hdr*)buf;
+  if (buf_size < (ssize_t)sizeof(struct hci_command_hdr) ||
+      hdr->plen != buf_size - sizeof(struct hci_command_hdr)) {
+    exit(1);
+  }
+  switch (hdr->opcode) {
+  case HCI_OP_WRITE_SCAN_ENABLE: {
+    uint8_t status = 0;
+    hci_send_event_cmd_complete(fd, hdr->opcode, &status, sizeof(status));
+    return true;
+  }
+  case HCI_OP_READ_BD_ADDR: {
+    struct hci_rp_read_bd_addr rp = {0};
+    rp.status = 0;
+    memset(&rp.bdaddr, 0xaa, 6);
+    hci_send_event_cmd_complete(fd, hdr->opcode, &rp, sizeof(rp));
+    return false;
+  }
+  case HCI_OP_READ_BUFFER_SIZE: {
+    struct hci_rp_read_buffer_size rp = {0};
+    rp.status = 0;
+    rp.acl_mtu = 1021;
+    rp.sco_mtu = 96;
+    rp.acl_max_pkt = 4;
+    rp.sco_max_pkt = 6;
+    hci_send_event_cmd_complete(fd, hdr->opcode, &rp, sizeof(rp));
+    return false;
+  }
+  }
+  char dummy[0xf9] = {0};
+  hci_send_event_cmd_complete(fd, hdr->opcode, dummy, sizeof(dummy));
+  return false;
+}
+
+static void* event_thread(void* arg)
+{
+  while (1) {
+    char buf[1024] = {0};
+    ssize_t buf_size = read(vhci_fd, buf, sizeof(buf));
+    if (buf_size < 0)
+      exit(1);
+    if (buf_size > 0 && buf[0] == HCI_COMMAND_PKT) {
+      if (process_command_pkt(vhci_fd, buf + 1, buf_size - 1))
+        break;
+    }
+  }
+  return NULL;
+}
+#define HCI_HANDLE_1 200
+#define HCI_HANDLE_2 201
+
+void initialize_vhci(void)
+{
+  int hci_sock = socket(AF_BLUETOOTH, SOCK_RAW, BTPROTO_HCI);
+  if (hci_sock < 0)
+    exit(1);
+  vhci_fd = open("/dev/vhci", O_RDWR);
+  if (vhci_fd == -1)
+    exit(1);
+  const int kVhciFd = 241;
+  if (dup2(vhci_fd, kVhciFd) < 0)
+    exit(1);
+  close(vhci_fd);
+  vhci_fd = kVhciFd;
+  struct vhci_vendor_pkt vendor_pkt;
+  if (read(vhci_fd, &vendor_pkt, sizeof(vendor_pkt)) != sizeof(vendor_pkt))
+    exit(1);
+  if (vendor_pkt.type != HCI_VENDOR_PKT)
+    exit(1);
+  pthread_t th;
+  if (pthread_create(&th, NULL, event_thread, NULL))
+    exit(1);
+  int ret = ioctl(hci_sock, HCIDEVUP, vendor_pkt.id);
+  if (ret) {
+    if (errno == ERFKILL) {
+      rfkill_unblock_all();
+      ret = ioctl(hci_sock, HCIDEVUP, vendor_pkt.id);
+    }
+    if (ret && errno != EALREADY)
+      exit(1);
+  }
+  struct hci_dev_req dr = {0};
+  dr.dev_id = vendor_pkt.id;
+  dr.dev_opt = SCAN_PAGE;
+  if (ioctl(hci_sock, HCISETSCAN, &dr))
+    exit(1);
+  struct hci_ev_conn_request request;
+  memset(&request, 0, sizeof(request));
+  memset(&request.bdaddr, 0xaa, 6);
+  *(uint8_t*)&request.bdaddr.b[5] = 0x10;
+  request.link_type = ACL_LINK;
+  hci_send_event_packet(vhci_fd, HCI_EV_CONN_REQUEST, &request,
+                        sizeof(request));
+  struct hci_ev_conn_complete complete;
+  memset(&complete, 0, sizeof(complete));
+  complete.status = 0;
+  complete.handle = HCI_HANDLE_1;
+  memset(&complete.bdaddr, 0xaa, 6);
+  *(uint8_t*)&complete.bdaddr.b[5] = 0x10;
+  complete.link_type = ACL_LINK;
+  complete.encr_mode = 0;
+  hci_send_event_packet(vhci_fd, HCI_EV_CONN_COMPLETE, &complete,
+                        sizeof(complete));
+  struct hci_ev_remote_features features;
+  memset(&features, 0, sizeof(features));
+  features.status = 0;
+  features.handle = HCI_HANDLE_1;
+  hci_send_event_packet(vhci_fd, HCI_EV_REMOTE_FEATURES, &features,
+                        sizeof(features));
+  struct {
+    struct hci_ev_le_meta le_meta;
+    struct hci_ev_le_conn_complete le_conn;
+  } le_conn;
+  memset(&le_conn, 0, sizeof(le_conn));
+  le_conn.le_meta.subevent = HCI_EV_LE_CONN_COMPLETE;
+  memset(&le_conn.le_conn.bdaddr, 0xaa, 6);
+  *(uint8_t*)&le_conn.le_conn.bdaddr.b[5] = 0x11;
+  le_conn.le_conn.role = 1;
+  le_conn.le_conn.handle = HCI_HANDLE_2;
+  hci_send_event_packet(vhci_fd, HCI_EV_LE_META, &le_conn, sizeof(le_conn));
+  pthread_join(th, NULL);
+  close(hci_sock);
+}
@@ -0,0 +1,319 @@
+// mac80211_hwsim devices joined to a shared IBSS, set up for SYZ_WIFI.
+
+#include "syz.h"
+
+#include <net/if.h>
+
+#include <linux/genetlink.h>
+#include <linux/if_ether.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/nl80211.h>
+#include <linux/rfkill.h>
+#include <linux/rtnetlink.h>
+
+static struct nlmsg nlmsg;
+
+#define WIFI_INITIAL_DEVICE_COUNT 2
+#define WIFI_MAC_BASE                                                          \
+  {                                                                            \
+    0x08, 0x02, 0x11, 0x00, 0x00, 0x00                                         \
+  }
+#define WIFI_IBSS_BSSID                                                        \
+  {                                                                            \
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50                                         \
+  }
+#define WIFI_IBSS_SSID                                                         \
+  {                                                                            \
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10                                         \
+  }
+#define WIFI_DEFAULT_FREQUENCY 2412
+#define WIFI_DEFAULT_SIGNAL 0
+#define WIFI_DEFAULT_RX_RATE 1
+#define HWSIM_CMD_REGISTER 1
+#define HWSIM_CMD_FRAME 2
+#define HWSIM_CMD_NEW_RADIO 4
+#define HWSIM_ATTR_SUPPORT_P2P_DEVICE 14
+#define HWSIM_ATTR_PERM_ADDR 22
+
+#define IF_OPER_UP 6
+struct join_ibss_props {
+  int wiphy_freq;
+  bool wiphy_freq_fixed;
+  uint8_t* mac;
+  uint8_t* ssid;
+  int ssid_len;
+};
+
+static int set_interface_state(const char* interface_name, int on)
+{
+  struct ifreq ifr;
+  int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if (sock < 0) {
+    return -1;
+  }
+  memset(&ifr, 0, sizeof(ifr));
+  strcpy(ifr.ifr_name, interface_name);
+  int ret = ioctl(sock, SIOCGIFFLAGS, &ifr);
+  if (ret < 0) {
+    close(sock);
+    return -1;
+  }
+  if (on)
+    ifr.ifr_flags |= IFF_UP;
+  else
+    ifr.ifr_flags &= ~IFF_UP;
+  ret = ioctl(sock, SIOCSIFFLAGS, &ifr);
+  close(sock);
+  if (ret < 0) {
+    return -1;
+  }
+  return 0;
+}
+
+static int nl80211_set_interface(struct nlmsg* nlmsg, int sock,
+                                 int nl80211_family, uint32_t ifindex,
+                                 uint32_t iftype)
+{
+  struct genlmsghdr genlhdr;
+  memset(&genlhdr, 0, sizeof(genlhdr));
+  genlhdr.cmd = NL80211_CMD_SET_INTERFACE;
+  netlink_init(nlmsg, nl80211_family, 0, &genlhdr, sizeof(genlhdr));
+  netlink_attr(nlmsg, NL80211_ATTR_IFINDEX, &ifindex, sizeof(ifindex));
+  netlink_attr(nlmsg, NL80211_ATTR_IFTYPE, &iftype, sizeof(iftype));
+  int err = netlink_send(nlmsg, sock);
+  if (err < 0) {
+  }
+  return err;
+}
+
+static int nl80211_join_ibss(struct nlmsg* nlmsg, int sock, int nl80211_family,
+                             uint32_t ifindex, struct join_ibss_props* props)
+{
+  struct genlmsghdr genlhdr;
+  memset(&genlhdr, 0, sizeof(genlhdr));
+  genlhdr.cmd = NL80211_CMD_JOIN_IBSS;
+  netlink_init(nlmsg, nl80211_family, 0, &genlhdr, sizeof(genlhdr));
+  netlink_attr(nlmsg, NL80211_ATTR_IFINDEX, &ifindex, sizeof(ifindex));
+  netlink_attr(nlmsg, NL80211_ATTR_SSID, props->ssid, props->ssid_len);
+  netlink_attr(nlmsg, NL80211_ATTR_WIPHY_FREQ, &(props->wiphy_freq),
+               sizeof(props->wiphy_freq));
+  if (props->mac)
+    netlink_attr(nlmsg, NL80211_ATTR_MAC, props->mac, ETH_ALEN);
+  if (props->wiphy_freq_fixed)
+    netlink_attr(nlmsg, NL80211_ATTR_FREQ_FIXED, NULL, 0);
+  int err = netlink_send(nlmsg, sock);
+  if (err < 0) {
+  }
+  return err;
+}
+
+static int get_ifla_operstate(struct nlmsg* nlmsg, int ifindex)
+{
+  struct ifinfomsg info;
+  memset(&info, 0, sizeof(info));
+  info.ifi_family = AF_UNSPEC;
+  info.ifi_index = ifindex;
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (sock == -1) {
+    return -1;
+  }
+  netlink_init(nlmsg, RTM_GETLINK, 0, &info, sizeof(info));
+  int n;
+  int err = netlink_send_ext(nlmsg, sock, RTM_NEWLINK, &n, true);
+  close(sock);
+  if (err) {
+    return -1;
+  }
+  struct rtattr* attr = IFLA_RTA(NLMSG_DATA(nlmsg->buf));
+  for (; RTA_OK(attr, n); attr = RTA_NEXT(attr, n)) {
+    if (attr->rta_type == IFLA_OPERSTATE)
+      return *((uint8_t*)RTA_DATA(attr));
+  }
+  return -1;
+}
+
+// Opens a socket that receives RTM_NEWLINK notifications. Opened before the
+// devices are created, so that no operstate transition can be missed.
+static int open_link_monitor(void)
+{
+  int sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+  if (sock == -1)
+    return -1;
+  struct sockaddr_nl addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.nl_family = AF_NETLINK;
+  addr.nl_groups = RTMGRP_LINK;
+  if (bind(sock, (struct sockaddr*)&addr, sizeof(addr))) {
+    close(sock);
+    return -1;
+  }
+  return sock;
+}
+
+// Waits until all ndevs interfaces reach operstate, sleeping on link
+// notifications from monitor instead of polling each device.
+static int await_ifla_operstate_all(struct nlmsg* nlmsg, int monitor,
+                                    const int* ifindexes, int ndevs,
+                                    int operstate)
+{
+  bool done[ndevs];
+  int left = 0;
+  bool recheck = true;
+  static char buf[16 << 10];
+  for (;;) {
+    if (recheck) {
+      // Initially, and whenever notifications were dropped (ENOBUFS), ask
+      // for the current state directly.
+      recheck = false;
+      left = 0;
+      for (int i = 0; i < ndevs; i++) {
+        int ret = get_ifla_operstate(nlmsg, ifindexes[i]);
+        if (ret < 0)
+          return ret;
+        done[i] = ret == operstate;
+        left += !done[i];
+      }
+    }
+    if (!left)
+      return 0;
+    int n = recv(monitor, buf, sizeof(buf), 0);
+    if (n < 0) {
+      if (errno == ENOBUFS) {
+        recheck = true;
+        continue;
+      }
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    for (struct nlmsghdr* hdr = (struct nlmsghdr*)buf; NLMSG_OK(hdr, n);
+         hdr = NLMSG_NEXT(hdr, n)) {
+      if (hdr->nlmsg_type != RTM_NEWLINK)
+        continue;
+      struct ifinfomsg* info = (struct ifinfomsg*)NLMSG_DATA(hdr);
+      int i = 0;
+      while (i < ndevs && ifindexes[i] != info->ifi_index)
+        i++;
+      if (i == ndevs || done[i])
+        continue;
+      int len = IFLA_PAYLOAD(hdr);
+      for (struct rtattr* attr = IFLA_RTA(info); RTA_OK(attr, len);
+           attr = RTA_NEXT(attr, len)) {
+        if (attr->rta_type == IFLA_OPERSTATE &&
+            *(uint8_t*)RTA_DATA(attr) == operstate) {
+          done[i] = true;
+          left--;
+        }
+      }
+    }
+  }
+}
+
+static int nl80211_setup_ibss_interface(struct nlmsg* nlmsg, int sock,
+                                        int nl80211_family_id, char* interface,
+                                        struct join_ibss_props* ibss_props)
+{
+  int ifindex = if_nametoindex(interface);
+  if (ifindex == 0) {
+    return -1;
+  }
+  int ret = nl80211_set_interface(nlmsg, sock, nl80211_family_id, ifindex,
+                                  NL80211_IFTYPE_ADHOC);
+  if (ret < 0) {
+    return ret;
+  }
+  ret = set_interface_state(interface, 1);
+  if (ret < 0) {
+    return -1;
+  }
+  ret = nl80211_join_ibss(nlmsg, sock, nl80211_family_id, ifindex, ibss_props);
+  if (ret < 0) {
+    return ret;
+  }
+  return 0;
+}
+
+static int hwsim80211_create_device(struct nlmsg* nlmsg, int sock,
+                                    int hwsim_family,
+                                    uint8_t mac_addr[ETH_ALEN])
+{
+  struct genlmsghdr genlhdr;
+  memset(&genlhdr, 0, sizeof(genlhdr));
+  genlhdr.cmd = HWSIM_CMD_NEW_RADIO;
+  netlink_init(nlmsg, hwsim_family, 0, &genlhdr, sizeof(genlhdr));
+  netlink_attr(nlmsg, HWSIM_ATTR_SUPPORT_P2P_DEVICE, NULL, 0);
+  netlink_attr(nlmsg, HWSIM_ATTR_PERM_ADDR, mac_addr, ETH_ALEN);
+  int err = netlink_send(nlmsg, sock);
+  if (err < 0) {
+  }
+  return err;
+}
+
+void initialize_wifi_devices(void)
+{
+  int rfkill = open("/dev/rfkill", O_RDWR);
+  if (rfkill == -1) {
+    if (errno != ENOENT && errno != EACCES)
+      exit(1);
+  } else {
+    struct rfkill_event event = {0};
+    event.type = RFKILL_TYPE_ALL;
+    event.op = RFKILL_OP_CHANGE_ALL;
+    if (write(rfkill, &event, sizeof(event)) != (ssize_t)(sizeof(event)))
+      exit(1);
+    close(rfkill);
+  }
+  uint8_t mac_addr[6] = WIFI_MAC_BASE;
+  int monitor = open_link_monitor();
+  if (monitor < 0)
+    exit(1);
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_GENERIC);
+  if (sock < 0) {
+    close(monitor);
+    return;
+  }
+  int hwsim_family_id =
+      netlink_query_family_id(&nlmsg, sock, "MAC80211_HWSIM", true);
+  int nl80211_family_id =
+      netlink_query_family_id(&nlmsg, sock, "nl80211", true);
+  uint8_t ssid[] = WIFI_IBSS_SSID;
+  uint8_t bssid[] = WIFI_IBSS_BSSID;
+  struct join_ibss_props ibss_props = {.wiphy_freq = WIFI_DEFAULT_FREQUENCY,
+                                       .wiphy_freq_fixed = true,
+                                       .mac = bssid,
+                                       .ssid = ssid,
+                                       .ssid_len = sizeof(ssid)};
+  int ifindexes[WIFI_INITIAL_DEVICE_COUNT];
+  for (int device_id = 0; device_id < WIFI_INITIAL_DEVICE_COUNT; device_id++) {
+    mac_addr[5] = device_id;
+    // A failure may just mean the cached family ID went stale; look it up
+    // again and retry once.
+    int ret = hwsim80211_create_device(&nlmsg, sock, hwsim_family_id, mac_addr);
+    if (ret < 0 && netlink_family_id_stale("MAC80211_HWSIM", ret)) {
+      hwsim_family_id =
+          netlink_query_family_id(&nlmsg, sock, "MAC80211_HWSIM", true);
+      ret = hwsim80211_create_device(&nlmsg, sock, hwsim_family_id, mac_addr);
+    }
+    if (ret < 0)
+      exit(1);
+    char interface[6] = "wlan0";
+    interface[4] += device_id;
+    ret = nl80211_setup_ibss_interface(&nlmsg, sock, nl80211_family_id,
+                                       interface, &ibss_props);
+    if (ret < 0 && netlink_family_id_stale("nl80211", ret)) {
+      nl80211_family_id =
+          netlink_query_family_id(&nlmsg, sock, "nl80211", true);
+      ret = nl80211_setup_ibss_interface(&nlmsg, sock, nl80211_family_id,
+                                         interface, &ibss_props);
+    }
+    if (ret < 0)
+      exit(1);
+    ifindexes[device_id] = if_nametoindex(interface);
+  }
+  if (await_ifla_operstate_all(&nlmsg, monitor, ifindexes,
+                               WIFI_INITIAL_DEVICE_COUNT, IF_OPER_UP) < 0)
+    exit(1);
+  close(monitor);
+  close(sock);
+}
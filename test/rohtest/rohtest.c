@@ -1,308 +1,299 @@
-// https://syzkaller.appspot.com/bug?id=b5abe408ec75f81f246a0c793535a0f543af5ee4
-// autogenerated by syzkaller (https://github.com/google/syzkaller)
-
-#define _GNU_SOURCE
-
-#include <endian.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <unistd.h>
-
-#ifndef __NR_bpf
-#define __NR_bpf 321
-#endif
-
-uint64_t r[3] = { 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff };
-
-int main(void)
-{
-    syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-    syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
-    syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-    intptr_t res = 0;
-    *(uint32_t*)0x20000100 = 1;
-    *(uint32_t*)0x20000104 = 3;
-    *(uint64_t*)0x20000108 = 0x20001000;
-    memcpy(
-        (void*)0x20001000,
-        "\x18\x00\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00\x26\xd0\x00\x00\x95\x00"
-        "\x2b\x00\x00\x00\x00\x00\x93\xad\xff\xa8\x22\x55\xf6\x74\x41\x2d\x02\x00"
-        "\x00\x00\x00\x00\x00\x5a\xb5\x27\xee\x36\x97\xf1\xed\x44\x36\xdd\x11\x64"
-        "\xb1\xb3\xf4\x27\xf6\xba\x6b\x34\xf9\x81\x25\xf3\x0e\x63\x26\x99\x6a\x3c"
-        "\xfe\xe3\x30\x25\xa3\x0b\x45\xbd\xcf\x2c\x69\xd1\x05\xe5\xe5\x5a\x1d\x27"
-        "\x36\x83\x62\x6e\x00\xdc\xff\x7f\x00\x00\xca\x6b\x78\xad\x83\x34\x88\xcf"
-        "\xe4\x10\x9e\xaf\x00\x9e\xdd\x0d\x69\x61\x3d\x3c\xd6\x2f\x00\x15\x8e\x6e"
-        "\xee\x85\x01\x00\x00\x00\x52\x0a\x00\x00\x15\x1d\x01\x00\x00\x00\x01\x00"
-        "\xbf\x00\x00\x00\x00\xcc\x58\x74\x24\x36\x3d\xc6\xad\x7f\x3b\xbd\x42\x4c"
-        "\x6e\x6c\xaf\xbe\x93\x09\xab\xa2\x18\xa5\x20\x01\xa3\xcd\x00\x00\x41\xf0"
-        "\xdb\x74\x59\x6f\xd7\x2c\x00\x2a\x60\xc1\xbc\x7d\xc8\xc3\x8b\x7d\x2e\x13"
-        "\xc5\x04\x24\xb9\xdd\x11\x45\xd0\x3f\xf4\x5f\x70\x68\x5c\x6b\xd9\xff\x41"
-        "\xc6\x9b\x7d\xe4\x75\x8c\x10\x96\xa1\xdc\x52\xf2\x9e\x47\x0a\x00\x05\x17"
-        "\xeb\xc4\x06\xe8\x9d\xcb\xb7\x67\x7e\x65\x28\xb0\x85\x6e\x31\xed\x94\x74"
-        "\xac\x24\xcf\x60\x90\x68\xf6\x45\xce\x97\x1f\xc0\x48\x07\x37\xa5\x5e\xbb"
-        "\x0b\xd7\x01\xf7\xfb\x21\xe8\x8b\x3c\xfc\x22\xdf\x01\xe4\xba\xc9\xd9\x69"
-        "\x28\xfa\x2a\x82\xb5\xe8\x74\x1e\x02\x05\x6d\x93\x3b\xed\x75\x9f\xf2\x32"
-        "\xce\xbc\x68\xb9\x1a\xf5\x04\x79\x38\x74\x67\x82\x42\x62\x85\x2c\x79\x39"
-        "\xdb\x56\x72\xd0\x7c\xdb\xe8\xe1\x4a\xbf\x56\x49\x7e\x5d\x56\xd0\x6c\x75"
-        "\x51\xb8\x70\xb2\x85\x1c\x3f\x0a\x1a\xab\x71\x58\x7a\x21\xc8\xf1\xb3\x36"
-        "\x9e\xbf\xcb\xa1\x05\xa6\xcc\xdd\x01\xb0\xf0\x4e\xdb\x25\x6c\x60\x4f\x06"
-        "\x87\x73\xf6\xdb\x9d\x66\x1b\xd7\xf0\xe2\x53\x6f\xfb\xfe\x5c\xa3\x1b\x40"
-        "\x83\x14\x55\x31\x45\x8b\x7d\x1e\x34\x1c\x6b\x86\x4f\x98\x3d\x74\x5f\x58"
-        "\x65\xaa\xd4\x1d\x29\x15\xaa\xe7\x60\x2a\x00\x00\xd4\x15\xe8\x35\x1e\xbc"
-        "\x42\x23\xf5\x4d\x6b\xec\x66\x47\x09\xff\x03\xf1\xaa\x3d\xc7\xf1\x58\x0a"
-        "\xce\x9b\xf2\xaf\xd2\x8d\x71\x57\xe6\x7f\xb9\x8d\x12\x1a\xd6\xeb\x37\x27"
-        "\x13\x25\x50\x12\xe0\x28\xcb\x26\x54\xd4\x93\xa0\xb4\xb3\x5f\xaa\xe1\x76"
-        "\xa6\x9b\x74\x5e\xda\x29\x67\x19\x9c\xc9\x36\x85\x9a\x53\x7e\x8e\x48\x71"
-        "\xd4\xac\xf3\xe3\xdc\x10\xe1\x3e\xf2\x27\xf6\x27\xa4\x00\x00\xad\x1f\xa2"
-        "\x53\xd3\x3f\xa7\x4f\x17\x2d\x34\x07\xae\x4e\x1e\x34\x7c\x0c\x6e\xf9\xdd"
-        "\x2b\x6b\xb7\xaa\x38\x04\xb9\xf2\xa8\xf2\x88\x0c\x58\x62\x06\xc3\xf4\xd7"
-        "\x9b\xc3\x63\x05\x74\x5c\xb1\xcb\x38\x5e\x6a\xdd\x14\x65\x20\x03\xc7\xcd"
-        "\xd3\x32\x4f\x07\xd1\x34\xd3\xed\x07\xf1\xc1\x09\x00\x00\x00\x09\xdd\x87"
-        "\x2e\xc6\x4f\xa6\xc7\x18\xbb\xd1\xaa\x59\x11\x40\xcb\xe6\xf1\x96\x26\xce"
-        "\x8c\xce\x57\xf0\xbe\x4c\x6f\x8d\xf0\x84\xc5\xe9\x73\x4a\xe3\x0a\xa9\xaf"
-        "\xdc\x71\x25\xf0\x1a\xb0\x3a\x9b\x10\x74\x40\x71\x36\xb4\x50\x60\x00\xf0"
-        "\x91\x6a\x39\xd3\x05\x7d\x55\x18\x36\x12\xb3\x9e\x73\xae\xeb\x6e\xaf\x14"
-        "\x65\x2d\xda\x68\xc9\x8e\xf9\x38\xe6\x51\x5a\x94\xa7\x18\x36\x46\x9e\x20"
-        "\x51\xd9\x37\xeb\x85\xf3\xf2\xd5\xae\x2c\x1d\xca\xab\x2a\xb8\xb6\x3f\x47"
-        "\x6b\x97\x41\x9a\x3b\x76\x60\xdf\x4c\x51\x24\xca\x42\x5d\x37\x4b\x37\x18"
-        "\x67\xa7\x9b\x31\xc6\x61\x7f\xc3\x32\x71\x91\xf9\xf5\x14\x57\x3f\x0e\x30"
-        "\xd1\xd6\x0b\xe2\x16\x8f\xff\xc2\xf3\xdc\xcd\x59\x9a\x2c\xb7\x7f\x12\x4e"
-        "\x22\xf8\x76\x73\x67\x58\x05\x49\x4d\xb8\x21\xf3\x87\x50\xd9\x38\xd5\xfd"
-        "\x8c\x6b\x2a\x3a\x32\x4c\x25\x7b\xc9\x11\x09\x71\xb7\x49\xcc\xd7\x40\x89"
-        "\xed\x6b\x86\xf8\x1c\xa3\xd2\x47\xd8\xf7\x1d\x29\x0e\xd1\xb1\xa1\x1f\x7a"
-        "\x67\x12\x51\x70\xc8\x8c\x3b\x6a\x50\x69\x63\x32\x22\x64\x01\x00\x01\xda"
-        "\x9c\x78\x6e\xec\xa2\x2d\xeb\xc9\x93\x35\x58\x3b\x54\xc1\x3c\x31\x30\x97"
-        "\x8f\xa0\x69\xaf\x82\x23\xb3\x8c\xed\x73\x5c\x2d\x90\x5f\x51\xca\x85\xff"
-        "\xa4\xad\xd5\x64\x74\x89\xb3\x96\x01\x27\x69\x6c\xf2\xf1\x66\x25\xc0\xc1"
-        "\x02\x00\x00\x00\x00\xc7\xa5\xca\x60\xfd\xad\x15\x9f\x2e\x64\x17\x1f\x39"
-        "\x63\x84\x10\x86\xe3\x79\x7a\x48\x25\xd0\x81\xf2\xd9\x87\xf0\x5c\x53\x41"
-        "\x87\x73\x86\x55\xd7\xdc\x95\x8f\xd2\x35\xd6\x07\x16\x19\xa6\x55\x4b\x82"
-        "\xd9\xc1\x62\xf3\x55\x60\x76\xb8\x05\x50\xd7\x61\xca\x74\xf1\xff\xda\xcc"
-        "\xf0\xea\x5f\x02\xe0\xfc\xa8\xb2\x7f\xf3\x98\x3a\xb7\x4f\xd3\xd5\x60\x70"
-        "\x0a\x1f\xab\x44\xa7\x7e\x31\x2b\x3b\x12\x9e\x00\x03\x02\x27\xf8\x8d\xba"
-        "\x81\x60\x20\xbe\x76\x0f\x7b\x45\xe0\x01\xef\xad\xa8\x00\x00\x00\x00\x00"
-        "\x00\x00\xfd\xaf\x46\x60\x40\x2f\x7b\x3b\x79\xa4\x33\xe0\x80\x74\xea\x24"
-        "\x62\x97\x4a\x00\x04\x00\x00\xeb\x1c\xfa\x26\x38\xf5\x6d\xae\xe5\x7e\xd1"
-        "\x4b\xc7\x4d\xe0\xfd\x87\xa9\xce\x63\x81\x90\xf3\x57\x0e\x0b\x4c\x80\xef"
-        "\x68\x2d\xf2\x22\x01\x27\x09\x55\xaf\xb6\x00\x88\x46\x55\x7e\xe3\xbc\x09"
-        "\xfd\xa6\xdb\xb6\x55\x0d\x59\x73\x00\x07\xf4\xf0\xef\xc9\x6f\xfd\xe5\x0f"
-        "\xc6\xfa\x9f\xd8\x66\x66\x5b\x98\xca\x20\x02\xc8\x04\xc2\x2f\xf2\x63\x4b"
-        "\x7b\xfb\xf5\xc0\xd5\x86\xcd\xa5\xb4\x5f\xd0\x12\x46\x38\xfe\xc5\x8f\xae"
-        "\xb4\x41\x58\xbb\x44\x0d\xf2\xa6\x94\xf4\xcd\xca\xa4\xf6\x5c\x22\xf0\x00"
-        "\x00\x00\x00\x00\x00\x00\x5b\xb3\xff\x5b\x3a\xd5\x53\x4a\x8e\x00\x00\x00"
-        "\x00\x00\x00\xd5\x03\xd7\x99\x06\x95\x81\x02\x00\x00\x00\x00\x00\x00\x00"
-        "\x00\x00\x00\x1f\xff\xf0\xef\x89\x09\x00\x00\x00\x00\x00\x00\x00\x86\x33"
-        "\x15\xe8\x44\x98\xdf\xb5\x2b\xb9\x3f\x6c\x90\x84\x65\x9c\xe7\x77\xdd\xac"
-        "\x56\x3c\x85\x96\xc2\xb1\xd8\x18\x02\x89\xa6\x1f\xaa\x95\xa8\x2b\xf1\xcf"
-        "\xb7\xf2\xfd\x72\x52\xe9\x32\x75\x75\x66\xdc\x0a\x46\xe0\x91\xd3\x08\x6c"
-        "\x2a\xbe\x28\x2c\x33\x44\x5d\x44\x3a\x67\x46\x78\x93\xb9\xbf\x0d\x1c\x81"
-        "\x30\xae\x6b\x22\x69\x00\x11\x06\x35\x37\xb2\x61\x64\x13\xc2\x9f\x7c\x6f"
-        "\x7b\x7e\x29\xb9\x07\xbd\xdd\x5e\x32\x86\x61\xf4\xc0\x6e\x01\xf7\xd7\xdc"
-        "\x22\x17\x4e\x5e\x62\x7a\x6f\x60\x8a\xd5\x3a\x41\x68\xd4\xd8\xf7\xfb\xc7"
-        "\x11\x04\x51\x2e\xfe\x8e\x5d\x7d\x93\x4a\xa2\x89\xb4\xbd\x2b\x87\x00\x00"
-        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-        "\x00\x9b\x77\x78\x83\xa0\x2f\x05\x93\xdf\xc4\xcb\x41\x14\xb9\xf9\xcf\x4a"
-        "\xd1\x55\x11\x0c\xd3\xac\xe2\xb3\x22\xac\x31\xbf\xa2\x78\x47\xc7\x99\xc8"
-        "\x00\x9a\x1e\xa5\xb9\x8e\x52\x5e\x63\x83\xad\x7f\xd9\x79\x51\x70\xe7\xb1"
-        "\x1e\x24\x76\x03\xc2\xff\x49\xa1\x14\x59\xc7\xf6\x06\xd7\x29\xd3\x97\x96"
-        "\x76\xbf\xfb\x30\x49\x16\x6a\xb8\x4a\x0f\x06\x19\x91\xbd\x57\xc2\x56\x6c"
-        "\x10\xc2\x82\x35\x2a\xba\x05\xb6\x16\x4e\x3f\x24\x91\xe4\x79\x3e\x59\x0d"
-        "\xcc\x71\xde\x10\xda\x96\x36\x6c\x40\xdd\x44\xa2\xc9\x88\x2d\x3a\xa0\xf8"
-        "\xa7\x97\xb8\xfe\xa6\xef\xcf\xb5\x27\x6b\x76\x79\xf1\x55\x59\xcd\xaa\x97"
-        "\x75\x04\xcc\x0b\x2f\x77\x7a\xcb\x90\x7e\xbf\x5f\xc1\x4a\xdd\x71\xd0\xbc"
-        "\xa3\x74\x05\xde\xd6\x9b\x77\xab\x4a\x3d\x74\xaa\xfd\x50\xc5\xe2\x2a\xde"
-        "\x67\x54\xf6\xb5\x74\x5a\xfb\x3b\x5b\x18\x9b\x5f\xd1\xf3\x0e\x8d\xc8\x13"
-        "\xf6\x08\x70\xfd\xe1\xf8\x8d\x83\x0b\x11\x00\x21\x35\xe8\xe7\x26\x2f\x29"
-        "\x9e\xd7\x92\x3b\xfb\xe0\x0a\xd8\x8b\xe1\x79\xe5\x6b\x41\xff\x37\x92\xce"
-        "\xe2\xfc\x37\xee\xe7\x39\xc3\xe3\x6a\x4b\xc8\x01\x12\x96\x8e\xc0\xd8\x90"
-        "\x2e\xce\xd1\xfe\x55\x53\x18\x01\x4a\x46\x3a\xbb\xbf\x7c\xcd\x6a\x92\xa5"
-        "\xe0\x4e\x3e\xbf\xca\x9b\x6e\x88\xe0\x31\xf3\x1d\xe2\x18\x36\x52\xe7\x7c"
-        "\x05\x39\x15\x2f\x85\xa1\x1a\xcb\xdb\x46\x16\x4c\x64\x6a\xef\x65\x1c\xfd"
-        "\x37\x10\xaa\x42\x05\xd8\xd4\xd4\xf9\x74\x13\x3c\xcb\x1e\x49\xfe\xb4\x26"
-        "\x64\xec\xcd\x80\x9c\x0b\xa8\x91\x7e\xda\x87\x48\x9e\xb6\x6f\xd5\xdb\x1c"
-        "\x05\x3d\xd3\x5d\x00\x2d\xd8\xd6\xda\x80\xd3\x93\x02\x9c\x2c\x78\x61\x55"
-        "\x23\x9e\x64\x63\x65\x06\x6e\xf9\xa3\x6a\x44\x9c\x96\x48\x5c\x22\xad\xcd"
-        "\x54\xdb\x0b\xb0\xea\x5f\x4f\x1e\x87\x73\x14\x4f\xb6\xac\x9a\x44\xd4\x35"
-        "\x93\xd7\x7e\x66\xaa\x7e\xd7\xf3\xd4\xe7\xb2\x11\x59\x0c\x73\x88\x88\xd0"
-        "\x2b\x2d\xbb\x0b\x2b\xa7\x3e\xc7\x2e\x1d\x8d\x73\x60\xa1\x28\x49\x9d\xd1"
-        "\x9e\x1e\x7b\x9b\x06\x71\xf4\xf5\x85\x15\xb4\x5e\xcb\x99\x64\xf3\xc4\xdd"
-        "\xb8\x23\x43\x91\xd5\x14\xf8\xd9\x96\xd8\xc6\xdd\x7f\x8f\xad\xfe\xe2\xd7"
-        "\xa0\x03\x56\x38\xce\x27\xc2\x93\x6c\xb0\x4b\x30\xa0\x9d\xcc\x44\x7f\x0b"
-        "\x3e\x2c\x2f\x1a\xa5\xb9\x96\xf3\xd6\x5a\x95\x48\xf9\x6a\xb0\x49\x0a\x8a"
-        "\x4c\xab\xd2\xf1\x73\xab\x3b\x0a\x30\x9b\xc7\x74\x41\x01\x11\x75\xef\xf3"
-        "\x35\x74\x71\x7c\xb2\x48\x1b\xa1\x68\x57\x94\x3a\xc0\x4e\x40\x43\x55\xbf"
-        "\x59\xc0\xae\x9a\x8d\x79\x1e\xeb\xc1\x3b\x92\xf5\x33\x5d\x41\x4c\x65\x6c"
-        "\xdd\x78\x90\x88\x6c\x4e\x23\x0b\xa2\x01\x37\xbd\xac\x9b\xc0\x4c\xf8\x63"
-        "\x92\x85\xb9\x00\xa7\xb1\x1d\x4d\xd5\xbb\x93\x40\x65\x34\xb4\xf4\x01\x43"
-        "\xaa\x06\x71\xeb\xc6\x85\xa1\xaf\x6e\x44\xd2\xd4\xc5\xa6\x45\x54\x8b\xb9"
-        "\xb3\xcf\xa0\xa1\xbd\x89\x11\x2f\xfe\x45\x29\xfb\x38\x75\x03\x7b\xc2\xc3"
-        "\xed\x25\xb2\xb9\x7a\x11\x25\xdc\xf7\x89\x9e\x07\xeb\xc6\xee\xb1\x13\xd5"
-        "\xea\x6c\x0a\x76\x0d\x7d\xd3\xe5\xc4\x2a\x0f\x51\xfb\x61\x14\x21\x01\x41"
-        "\xdd\x37\x7e\xc6\x9b\xab\xe2\xf9\xc2\x26\xbe\xc8\x64\xa1\x3c\x07\x67\xcc"
-        "\xe6\x3e\xf5\xef\x3a\x15\xbd\xe9\x30\xf6\x88\x37\xae\x5f\x0f\xc5\x1c\x32"
-        "\x58\xf5\xd8\xd0\x1b\xea\x72\x78\x53\x5e\xb4\x6b\x6b\x24\x58\x85\x10\x80"
-        "\xf6\x3f\x07\x12\xca\x43\xa2\x88\xfd\xc1\xbd\xa4\x03\xf1\x70\x4b\x54\xc6"
-        "\x09\xdf\xe4\x5a\xae\xa5\xf9\xc3\x74\x1f\x12\x55\x97\x65\x9e\x66\x92\x22"
-        "\x79\xf5\x0e\x95\x58\x57\xd2\xf7\xdb\x24\xa6\x7a\x78\x3d\xc8\xd7\x3d\x59"
-        "\x89\x28\x00\xaf\x83\xa1\x5b\x0b\x5e\x59\x43\xec\xa8\xad\xa0\x98\xa6\x51"
-        "\xc8\xc2\x7f\xa8\x3f\xaa\x0b\x53\x69\x47\x2d\x5f\x3d\x50\x73\xa4\x14\xc3"
-        "\x6f\x58\xc7\xef\x30\xc9\x7e\x4f\xc1\x97\xbe\xaf\xcb\x31\x16\xa6\x18\xcb"
-        "\x0d\x7d\xe8\x82\x3f\x54\x31\xf9\x24\x2f\x1b\x3b\xfa\x1d\x15\xbd\xea\x76"
-        "\xbe\x02\xe7\x1d\x91\xc2\x4c\x39\xda\x9b\x5a\x06\x91\xcb\xb5\x0f\x62\xfa"
-        "\x65\x6e\xd9\x06\x33\xeb\x9b\x11\x85\x9a\xec\x47\x88\x63\xf5\x4f\xf0\x64"
-        "\x64\xf6\x43\x5f\x15\x99\xf7\x9f\x25\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-        "\x00\x00\x00\x00\x00\x00\xa0\x03\xba\x7e\xbb\x74\xf3\xdb\x93\x3c\xa4\x64"
-        "\x2b\xff\xb3\x79\xad\x02\x21\x1f\xb1\x40\x36\xf3\xa4\xe2\xcf\xa8\x54\xc3"
-        "\xdd\xcd\x81\xda\xaf\xcd\x61\x12\x37\xa9\x15\x31\xfc\x9d\x75\x54\x83\x74"
-        "\x78\xf1\x94\x4f\x28\x04\xad\xca\x7d\x96\x6e\x80\xf4\x53\xa4\xca\x82\x84"
-        "\xb7\x7f\x61\xd7\xd9\x84\x26\xbc\xbc\xdd\x6f\x30\xd6\x65\x79\x84\x0f\xd2"
-        "\xf0\x05\x32\x89\x4b\x34\x39\x0a\x2a\x80\x14\x04\x68\x45\xf9\xed\xf6\x73"
-        "\x11\xae\x5b\xb7\xa5\x8e\x51\x2e\x40\x86\x0d\xe3\x55\x68\xf7\x9c\x40\xb1"
-        "\xef\xf8\x53\x59\xc1\x96\xdd\xdb\xb3\x3d\x06\x64\x9e\xcc\x8e\x6c\x5d\x1b"
-        "\x54\xbc\x9f\x6a\x67\xc5\xe4\x31\x25\x88\x6e\x13\xb8\xcb\x78\x3d\x36\x2b"
-        "\x37\x46\xea\x8d\xb2\xfa\x45\x44\x32\x5a\x0c\x9f",
-        2442);
-    *(uint64_t*)0x20000110 = 0x202bf000;
-    memcpy((void*)0x202bf000, "syzkaller\000", 10);
-    *(uint32_t*)0x20000118 = 4;
-    *(uint32_t*)0x2000011c = 0x436;
-    *(uint64_t*)0x20000120 = 0x20000040;
-    *(uint32_t*)0x20000128 = 0;
-    *(uint32_t*)0x2000012c = 0;
-    memset((void*)0x20000130, 0, 16);
-    *(uint32_t*)0x20000140 = 0;
-    *(uint32_t*)0x20000144 = 0;
-    *(uint32_t*)0x20000148 = -1;
-    *(uint32_t*)0x2000014c = 8;
-    *(uint64_t*)0x20000150 = 0x20000000;
-    *(uint32_t*)0x20000000 = 0;
-    *(uint32_t*)0x20000004 = 0;
-    *(uint32_t*)0x20000158 = 7;
-    *(uint32_t*)0x2000015c = 0x10;
-    *(uint64_t*)0x20000160 = 0x20000000;
-    *(uint32_t*)0x20000000 = 0;
-    *(uint32_t*)0x20000004 = 0;
-    *(uint32_t*)0x20000008 = 0;
-    *(uint32_t*)0x2000000c = 0;
-    *(uint32_t*)0x20000168 = 0;
-    *(uint32_t*)0x2000016c = 0;
-    *(uint32_t*)0x20000170 = -1;
-    res = syscall(__NR_bpf, 5ul, 0x20000100ul, 0x48ul);
-    if (res != -1)
-        r[0] = res;
-    res = syscall(__NR_socket, 0x29ul, 2ul, 0);
-    if (res != -1)
-        r[1] = res;
-    res = syscall(__NR_socket, 0xaul, 1ul, 0);
-    if (res != -1)
-        r[2] = res;
-    *(uint32_t*)0x20000040 = 1;
-    syscall(__NR_setsockopt, r[2], 6, 0x13, 0x20000040ul, 0x76dcul);
-    *(uint16_t*)0x20002600 = 0xa;
-    *(uint16_t*)0x20002602 = htobe16(0);
-    *(uint32_t*)0x20002604 = htobe32(0);
-    memset((void*)0x20002608, 0, 16);
-    *(uint32_t*)0x20002618 = 0;
-    syscall(__NR_connect, r[2], 0x20002600ul, 0x1cul);
-    memcpy((void*)0x200002c0, "tls\000", 4);
-    syscall(__NR_setsockopt, r[2], 6, 0x1f, 0x200002c0ul, 4ul);
-    *(uint16_t*)0x20000300 = 0x304;
-    *(uint16_t*)0x20000302 = 0x34;
-    memcpy((void*)0x20000304, "\x54\x27\x01\x0e\xde\x10\x25\x9c", 8);
-    memcpy((void*)0x2000030c,
-        "\xd6\x2b\x94\x9a\xca\x1e\x27\xe1\x48\x20\x80\x6f\x1b\x32\x11\x76\x62"
-        "\x97\xc5\x50\xc9\xbe\xfe\xe0\x98\x67\x00\x2a\xa9\xb6\x3d\x50",
-        32);
-    memcpy((void*)0x2000032c, "\xd6\x52\x0a\xed", 4);
-    memcpy((void*)0x20000330, "\x37\x77\x62\x01\xe1\x59\x4f\xb9", 8);
-    syscall(__NR_setsockopt, r[2], 0x11a, 2, 0x20000300ul, 0x38ul);
-    *(uint32_t*)0x20000200 = r[2];
-    *(uint32_t*)0x20000204 = r[0];
-    syscall(__NR_ioctl, r[1], 0x89e0, 0x20000200ul);
-    *(uint64_t*)0x200030c0 = 0;
-    *(uint32_t*)0x200030c8 = 0;
-    *(uint64_t*)0x200030d0 = 0;
-    *(uint64_t*)0x200030d8 = 0;
-    *(uint64_t*)0x200030e0 = 0;
-    *(uint64_t*)0x200030e8 = 0;
-    *(uint32_t*)0x200030f0 = 0;
-    *(uint32_t*)0x200030f8 = 6;
-    *(uint64_t*)0x20003100 = 0;
-    *(uint32_t*)0x20003108 = 0;
-    *(uint64_t*)0x20003110 = 0;
-    *(uint64_t*)0x20003118 = 0;
-    *(uint64_t*)0x20003120 = 0;
-    *(uint64_t*)0x20003128 = 0;
-    *(uint32_t*)0x20003130 = 0;
-    *(uint32_t*)0x20003138 = 0;
-    *(uint64_t*)0x20003140 = 0;
-    *(uint32_t*)0x20003148 = 0;
-    *(uint64_t*)0x20003150 = 0;
-    *(uint64_t*)0x20003158 = 0;
-    *(uint64_t*)0x20003160 = 0;
-    *(uint64_t*)0x20003168 = 0;
-    *(uint32_t*)0x20003170 = 0;
-    *(uint32_t*)0x20003178 = 0x3ebf;
-    *(uint64_t*)0x20003180 = 0;
-    *(uint32_t*)0x20003188 = 0;
-    *(uint64_t*)0x20003190 = 0;
-    *(uint64_t*)0x20003198 = 0;
-    *(uint64_t*)0x200031a0 = 0;
-    *(uint64_t*)0x200031a8 = 0;
-    *(uint32_t*)0x200031b0 = 0;
-    *(uint32_t*)0x200031b8 = 0xfffff903;
-    *(uint64_t*)0x200031c0 = 0;
-    *(uint32_t*)0x200031c8 = 0;
-    *(uint64_t*)0x200031d0 = 0;
-    *(uint64_t*)0x200031d8 = 0;
-    *(uint64_t*)0x200031e0 = 0;
-    *(uint64_t*)0x200031e8 = 0;
-    *(uint32_t*)0x200031f0 = 0;
-    *(uint32_t*)0x200031f8 = 4;
-    *(uint64_t*)0x20003200 = 0;
-    *(uint32_t*)0x20003208 = 0;
-    *(uint64_t*)0x20003210 = 0;
-    *(uint64_t*)0x20003218 = 0;
-    *(uint64_t*)0x20003220 = 0;
-    *(uint64_t*)0x20003228 = 0;
-    *(uint32_t*)0x20003230 = 0;
-    *(uint32_t*)0x20003238 = 0x1a47;
-    *(uint64_t*)0x20003240 = 0;
-    *(uint32_t*)0x20003248 = 0;
-    *(uint64_t*)0x20003250 = 0;
-    *(uint64_t*)0x20003258 = 0;
-    *(uint64_t*)0x20003260 = 0;
-    *(uint64_t*)0x20003268 = 0;
-    *(uint32_t*)0x20003270 = 0;
-    *(uint32_t*)0x20003278 = 0xe0;
-    *(uint64_t*)0x20003280 = 0;
-    *(uint32_t*)0x20003288 = 0;
-    *(uint64_t*)0x20003290 = 0;
-    *(uint64_t*)0x20003298 = 0;
-    *(uint64_t*)0x200032a0 = 0;
-    *(uint64_t*)0x200032a8 = 0;
-    *(uint32_t*)0x200032b0 = 0;
-    *(uint32_t*)0x200032b8 = 0x23d6;
-    *(uint64_t*)0x200032c0 = 0;
-    *(uint32_t*)0x200032c8 = 0;
-    *(uint64_t*)0x200032d0 = 0;
-    *(uint64_t*)0x200032d8 = 0;
-    *(uint64_t*)0x200032e0 = 0;
-    *(uint64_t*)0x200032e8 = 0;
-    *(uint32_t*)0x200032f0 = 0;
-    *(uint32_t*)0x200032f8 = 2;
-    *(uint64_t*)0x20003300 = 0;
-    *(uint32_t*)0x20003308 = 0;
-    *(uint64_t*)0x20003310 = 0;
-    *(uint64_t*)0x20003318 = 0;
-    *(uint64_t*)0x20003320 = 0;
-    *(uint64_t*)0x20003328 = 0;
-    *(uint32_t*)0x20003330 = 0;
-    *(uint32_t*)0x20003338 = 9;
-    syscall(__NR_recvmmsg, r[2], 0x200030c0ul, 0xaul, 0x10000ul, 0ul);
-    return 0;
-}
\ No newline at end of file
+// https://syzkaller.appspot.com/bug?id=b5abe408ec75f81f246a0c793535a0f543af5ee4
+// autogenerated by syzkaller (https://github.com/google/syzkaller)
+
+#include "syz.h"
+
+#ifndef __NR_bpf
+#define __NR_bpf 321
+#endif
+
+uint64_t r[3] = { 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff };
+
+int main(void)
+{
+    syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
+    syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
+    syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
+    intptr_t res = 0;
+    *(uint32_t*)0x20000100 = 1;
+    *(uint32_t*)0x20000104 = 3;
+    *(uint64_t*)0x20000108 = 0x20001000;
+    memcpy(
+        (void*)0x20001000,
+        "\x18\x00\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00\x26\xd0\x00\x00\x95\x00"
+        "\x2b\x00\x00\x00\x00\x00\x93\xad\xff\xa8\x22\x55\xf6\x74\x41\x2d\x02\x00"
+        "\x00\x00\x00\x00\x00\x5a\xb5\x27\xee\x36\x97\xf1\xed\x44\x36\xdd\x11\x64"
+        "\xb1\xb3\xf4\x27\xf6\xba\x6b\x34\xf9\x81\x25\xf3\x0e\x63\x26\x99\x6a\x3c"
+        "\xfe\xe3\x30\x25\xa3\x0b\x45\xbd\xcf\x2c\x69\xd1\x05\xe5\xe5\x5a\x1d\x27"
+        "\x36\x83\x62\x6e\x00\xdc\xff\x7f\x00\x00\xca\x6b\x78\xad\x83\x34\x88\xcf"
+        "\xe4\x10\x9e\xaf\x00\x9e\xdd\x0d\x69\x61\x3d\x3c\xd6\x2f\x00\x15\x8e\x6e"
+        "\xee\x85\x01\x00\x00\x00\x52\x0a\x00\x00\x15\x1d\x01\x00\x00\x00\x01\x00"
+        "\xbf\x00\x00\x00\x00\xcc\x58\x74\x24\x36\x3d\xc6\xad\x7f\x3b\xbd\x42\x4c"
+        "\x6e\x6c\xaf\xbe\x93\x09\xab\xa2\x18\xa5\x20\x01\xa3\xcd\x00\x00\x41\xf0"
+        "\xdb\x74\x59\x6f\xd7\x2c\x00\x2a\x60\xc1\xbc\x7d\xc8\xc3\x8b\x7d\x2e\x13"
+        "\xc5\x04\x24\xb9\xdd\x11\x45\xd0\x3f\xf4\x5f\x70\x68\x5c\x6b\xd9\xff\x41"
+        "\xc6\x9b\x7d\xe4\x75\x8c\x10\x96\xa1\xdc\x52\xf2\x9e\x47\x0a\x00\x05\x17"
+        "\xeb\xc4\x06\xe8\x9d\xcb\xb7\x67\x7e\x65\x28\xb0\x85\x6e\x31\xed\x94\x74"
+        "\xac\x24\xcf\x60\x90\x68\xf6\x45\xce\x97\x1f\xc0\x48\x07\x37\xa5\x5e\xbb"
+        "\x0b\xd7\x01\xf7\xfb\x21\xe8\x8b\x3c\xfc\x22\xdf\x01\xe4\xba\xc9\xd9\x69"
+        "\x28\xfa\x2a\x82\xb5\xe8\x74\x1e\x02\x05\x6d\x93\x3b\xed\x75\x9f\xf2\x32"
+        "\xce\xbc\x68\xb9\x1a\xf5\x04\x79\x38\x74\x67\x82\x42\x62\x85\x2c\x79\x39"
+        "\xdb\x56\x72\xd0\x7c\xdb\xe8\xe1\x4a\xbf\x56\x49\x7e\x5d\x56\xd0\x6c\x75"
+        "\x51\xb8\x70\xb2\x85\x1c\x3f\x0a\x1a\xab\x71\x58\x7a\x21\xc8\xf1\xb3\x36"
+        "\x9e\xbf\xcb\xa1\x05\xa6\xcc\xdd\x01\xb0\xf0\x4e\xdb\x25\x6c\x60\x4f\x06"
+        "\x87\x73\xf6\xdb\x9d\x66\x1b\xd7\xf0\xe2\x53\x6f\xfb\xfe\x5c\xa3\x1b\x40"
+        "\x83\x14\x55\x31\x45\x8b\x7d\x1e\x34\x1c\x6b\x86\x4f\x98\x3d\x74\x5f\x58"
+        "\x65\xaa\xd4\x1d\x29\x15\xaa\xe7\x60\x2a\x00\x00\xd4\x15\xe8\x35\x1e\xbc"
+        "\x42\x23\xf5\x4d\x6b\xec\x66\x47\x09\xff\x03\xf1\xaa\x3d\xc7\xf1\x58\x0a"
+        "\xce\x9b\xf2\xaf\xd2\x8d\x71\x57\xe6\x7f\xb9\x8d\x12\x1a\xd6\xeb\x37\x27"
+        "\x13\x25\x50\x12\xe0\x28\xcb\x26\x54\xd4\x93\xa0\xb4\xb3\x5f\xaa\xe1\x76"
+        "\xa6\x9b\x74\x5e\xda\x29\x67\x19\x9c\xc9\x36\x85\x9a\x53\x7e\x8e\x48\x71"
+        "\xd4\xac\xf3\xe3\xdc\x10\xe1\x3e\xf2\x27\xf6\x27\xa4\x00\x00\xad\x1f\xa2"
+        "\x53\xd3\x3f\xa7\x4f\x17\x2d\x34\x07\xae\x4e\x1e\x34\x7c\x0c\x6e\xf9\xdd"
+        "\x2b\x6b\xb7\xaa\x38\x04\xb9\xf2\xa8\xf2\x88\x0c\x58\x62\x06\xc3\xf4\xd7"
+        "\x9b\xc3\x63\x05\x74\x5c\xb1\xcb\x38\x5e\x6a\xdd\x14\x65\x20\x03\xc7\xcd"
+        "\xd3\x32\x4f\x07\xd1\x34\xd3\xed\x07\xf1\xc1\x09\x00\x00\x00\x09\xdd\x87"
+        "\x2e\xc6\x4f\xa6\xc7\x18\xbb\xd1\xaa\x59\x11\x40\xcb\xe6\xf1\x96\x26\xce"
+        "\x8c\xce\x57\xf0\xbe\x4c\x6f\x8d\xf0\x84\xc5\xe9\x73\x4a\xe3\x0a\xa9\xaf"
+        "\xdc\x71\x25\xf0\x1a\xb0\x3a\x9b\x10\x74\x40\x71\x36\xb4\x50\x60\x00\xf0"
+        "\x91\x6a\x39\xd3\x05\x7d\x55\x18\x36\x12\xb3\x9e\x73\xae\xeb\x6e\xaf\x14"
+        "\x65\x2d\xda\x68\xc9\x8e\xf9\x38\xe6\x51\x5a\x94\xa7\x18\x36\x46\x9e\x20"
+        "\x51\xd9\x37\xeb\x85\xf3\xf2\xd5\xae\x2c\x1d\xca\xab\x2a\xb8\xb6\x3f\x47"
+        "\x6b\x97\x41\x9a\x3b\x76\x60\xdf\x4c\x51\x24\xca\x42\x5d\x37\x4b\x37\x18"
+        "\x67\xa7\x9b\x31\xc6\x61\x7f\xc3\x32\x71\x91\xf9\xf5\x14\x57\x3f\x0e\x30"
+        "\xd1\xd6\x0b\xe2\x16\x8f\xff\xc2\xf3\xdc\xcd\x59\x9a\x2c\xb7\x7f\x12\x4e"
+        "\x22\xf8\x76\x73\x67\x58\x05\x49\x4d\xb8\x21\xf3\x87\x50\xd9\x38\xd5\xfd"
+        "\x8c\x6b\x2a\x3a\x32\x4c\x25\x7b\xc9\x11\x09\x71\xb7\x49\xcc\xd7\x40\x89"
+        "\xed\x6b\x86\xf8\x1c\xa3\xd2\x47\xd8\xf7\x1d\x29\x0e\xd1\xb1\xa1\x1f\x7a"
+        "\x67\x12\x51\x70\xc8\x8c\x3b\x6a\x50\x69\x63\x32\x22\x64\x01\x00\x01\xda"
+        "\x9c\x78\x6e\xec\xa2\x2d\xeb\xc9\x93\x35\x58\x3b\x54\xc1\x3c\x31\x30\x97"
+        "\x8f\xa0\x69\xaf\x82\x23\xb3\x8c\xed\x73\x5c\x2d\x90\x5f\x51\xca\x85\xff"
+        "\xa4\xad\xd5\x64\x74\x89\xb3\x96\x01\x27\x69\x6c\xf2\xf1\x66\x25\xc0\xc1"
+        "\x02\x00\x00\x00\x00\xc7\xa5\xca\x60\xfd\xad\x15\x9f\x2e\x64\x17\x1f\x39"
+        "\x63\x84\x10\x86\xe3\x79\x7a\x48\x25\xd0\x81\xf2\xd9\x87\xf0\x5c\x53\x41"
+        "\x87\x73\x86\x55\xd7\xdc\x95\x8f\xd2\x35\xd6\x07\x16\x19\xa6\x55\x4b\x82"
+        "\xd9\xc1\x62\xf3\x55\x60\x76\xb8\x05\x50\xd7\x61\xca\x74\xf1\xff\xda\xcc"
+        "\xf0\xea\x5f\x02\xe0\xfc\xa8\xb2\x7f\xf3\x98\x3a\xb7\x4f\xd3\xd5\x60\x70"
+        "\x0a\x1f\xab\x44\xa7\x7e\x31\x2b\x3b\x12\x9e\x00\x03\x02\x27\xf8\x8d\xba"
+        "\x81\x60\x20\xbe\x76\x0f\x7b\x45\xe0\x01\xef\xad\xa8\x00\x00\x00\x00\x00"
+        "\x00\x00\xfd\xaf\x46\x60\x40\x2f\x7b\x3b\x79\xa4\x33\xe0\x80\x74\xea\x24"
+        "\x62\x97\x4a\x00\x04\x00\x00\xeb\x1c\xfa\x26\x38\xf5\x6d\xae\xe5\x7e\xd1"
+        "\x4b\xc7\x4d\xe0\xfd\x87\xa9\xce\x63\x81\x90\xf3\x57\x0e\x0b\x4c\x80\xef"
+        "\x68\x2d\xf2\x22\x01\x27\x09\x55\xaf\xb6\x00\x88\x46\x55\x7e\xe3\xbc\x09"
+        "\xfd\xa6\xdb\xb6\x55\x0d\x59\x73\x00\x07\xf4\xf0\xef\xc9\x6f\xfd\xe5\x0f"
+        "\xc6\xfa\x9f\xd8\x66\x66\x5b\x98\xca\x20\x02\xc8\x04\xc2\x2f\xf2\x63\x4b"
+        "\x7b\xfb\xf5\xc0\xd5\x86\xcd\xa5\xb4\x5f\xd0\x12\x46\x38\xfe\xc5\x8f\xae"
+        "\xb4\x41\x58\xbb\x44\x0d\xf2\xa6\x94\xf4\xcd\xca\xa4\xf6\x5c\x22\xf0\x00"
+        "\x00\x00\x00\x00\x00\x00\x5b\xb3\xff\x5b\x3a\xd5\x53\x4a\x8e\x00\x00\x00"
+        "\x00\x00\x00\xd5\x03\xd7\x99\x06\x95\x81\x02\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x1f\xff\xf0\xef\x89\x09\x00\x00\x00\x00\x00\x00\x00\x86\x33"
+        "\x15\xe8\x44\x98\xdf\xb5\x2b\xb9\x3f\x6c\x90\x84\x65\x9c\xe7\x77\xdd\xac"
+        "\x56\x3c\x85\x96\xc2\xb1\xd8\x18\x02\x89\xa6\x1f\xaa\x95\xa8\x2b\xf1\xcf"
+        "\xb7\xf2\xfd\x72\x52\xe9\x32\x75\x75\x66\xdc\x0a\x46\xe0\x91\xd3\x08\x6c"
+        "\x2a\xbe\x28\x2c\x33\x44\x5d\x44\x3a\x67\x46\x78\x93\xb9\xbf\x0d\x1c\x81"
+        "\x30\xae\x6b\x22\x69\x00\x11\x06\x35\x37\xb2\x61\x64\x13\xc2\x9f\x7c\x6f"
+        "\x7b\x7e\x29\xb9\x07\xbd\xdd\x5e\x32\x86\x61\xf4\xc0\x6e\x01\xf7\xd7\xdc"
+        "\x22\x17\x4e\x5e\x62\x7a\x6f\x60\x8a\xd5\x3a\x41\x68\xd4\xd8\xf7\xfb\xc7"
+        "\x11\x04\x51\x2e\xfe\x8e\x5d\x7d\x93\x4a\xa2\x89\xb4\xbd\x2b\x87\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x9b\x77\x78\x83\xa0\x2f\x05\x93\xdf\xc4\xcb\x41\x14\xb9\xf9\xcf\x4a"
+        "\xd1\x55\x11\x0c\xd3\xac\xe2\xb3\x22\xac\x31\xbf\xa2\x78\x47\xc7\x99\xc8"
+        "\x00\x9a\x1e\xa5\xb9\x8e\x52\x5e\x63\x83\xad\x7f\xd9\x79\x51\x70\xe7\xb1"
+        "\x1e\x24\x76\x03\xc2\xff\x49\xa1\x14\x59\xc7\xf6\x06\xd7\x29\xd3\x97\x96"
+        "\x76\xbf\xfb\x30\x49\x16\x6a\xb8\x4a\x0f\x06\x19\x91\xbd\x57\xc2\x56\x6c"
+        "\x10\xc2\x82\x35\x2a\xba\x05\xb6\x16\x4e\x3f\x24\x91\xe4\x79\x3e\x59\x0d"
+        "\xcc\x71\xde\x10\xda\x96\x36\x6c\x40\xdd\x44\xa2\xc9\x88\x2d\x3a\xa0\xf8"
+        "\xa7\x97\xb8\xfe\xa6\xef\xcf\xb5\x27\x6b\x76\x79\xf1\x55\x59\xcd\xaa\x97"
+        "\x75\x04\xcc\x0b\x2f\x77\x7a\xcb\x90\x7e\xbf\x5f\xc1\x4a\xdd\x71\xd0\xbc"
+        "\xa3\x74\x05\xde\xd6\x9b\x77\xab\x4a\x3d\x74\xaa\xfd\x50\xc5\xe2\x2a\xde"
+        "\x67\x54\xf6\xb5\x74\x5a\xfb\x3b\x5b\x18\x9b\x5f\xd1\xf3\x0e\x8d\xc8\x13"
+        "\xf6\x08\x70\xfd\xe1\xf8\x8d\x83\x0b\x11\x00\x21\x35\xe8\xe7\x26\x2f\x29"
+        "\x9e\xd7\x92\x3b\xfb\xe0\x0a\xd8\x8b\xe1\x79\xe5\x6b\x41\xff\x37\x92\xce"
+        "\xe2\xfc\x37\xee\xe7\x39\xc3\xe3\x6a\x4b\xc8\x01\x12\x96\x8e\xc0\xd8\x90"
+        "\x2e\xce\xd1\xfe\x55\x53\x18\x01\x4a\x46\x3a\xbb\xbf\x7c\xcd\x6a\x92\xa5"
+        "\xe0\x4e\x3e\xbf\xca\x9b\x6e\x88\xe0\x31\xf3\x1d\xe2\x18\x36\x52\xe7\x7c"
+        "\x05\x39\x15\x2f\x85\xa1\x1a\xcb\xdb\x46\x16\x4c\x64\x6a\xef\x65\x1c\xfd"
+        "\x37\x10\xaa\x42\x05\xd8\xd4\xd4\xf9\x74\x13\x3c\xcb\x1e\x49\xfe\xb4\x26"
+        "\x64\xec\xcd\x80\x9c\x0b\xa8\x91\x7e\xda\x87\x48\x9e\xb6\x6f\xd5\xdb\x1c"
+        "\x05\x3d\xd3\x5d\x00\x2d\xd8\xd6\xda\x80\xd3\x93\x02\x9c\x2c\x78\x61\x55"
+        "\x23\x9e\x64\x63\x65\x06\x6e\xf9\xa3\x6a\x44\x9c\x96\x48\x5c\x22\xad\xcd"
+        "\x54\xdb\x0b\xb0\xea\x5f\x4f\x1e\x87\x73\x14\x4f\xb6\xac\x9a\x44\xd4\x35"
+        "\x93\xd7\x7e\x66\xaa\x7e\xd7\xf3\xd4\xe7\xb2\x11\x59\x0c\x73\x88\x88\xd0"
+        "\x2b\x2d\xbb\x0b\x2b\xa7\x3e\xc7\x2e\x1d\x8d\x73\x60\xa1\x28\x49\x9d\xd1"
+        "\x9e\x1e\x7b\x9b\x06\x71\xf4\xf5\x85\x15\xb4\x5e\xcb\x99\x64\xf3\xc4\xdd"
+        "\xb8\x23\x43\x91\xd5\x14\xf8\xd9\x96\xd8\xc6\xdd\x7f\x8f\xad\xfe\xe2\xd7"
+        "\xa0\x03\x56\x38\xce\x27\xc2\x93\x6c\xb0\x4b\x30\xa0\x9d\xcc\x44\x7f\x0b"
+        "\x3e\x2c\x2f\x1a\xa5\xb9\x96\xf3\xd6\x5a\x95\x48\xf9\x6a\xb0\x49\x0a\x8a"
+        "\x4c\xab\xd2\xf1\x73\xab\x3b\x0a\x30\x9b\xc7\x74\x41\x01\x11\x75\xef\xf3"
+        "\x35\x74\x71\x7c\xb2\x48\x1b\xa1\x68\x57\x94\x3a\xc0\x4e\x40\x43\x55\xbf"
+        "\x59\xc0\xae\x9a\x8d\x79\x1e\xeb\xc1\x3b\x92\xf5\x33\x5d\x41\x4c\x65\x6c"
+        "\xdd\x78\x90\x88\x6c\x4e\x23\x0b\xa2\x01\x37\xbd\xac\x9b\xc0\x4c\xf8\x63"
+        "\x92\x85\xb9\x00\xa7\xb1\x1d\x4d\xd5\xbb\x93\x40\x65\x34\xb4\xf4\x01\x43"
+        "\xaa\x06\x71\xeb\xc6\x85\xa1\xaf\x6e\x44\xd2\xd4\xc5\xa6\x45\x54\x8b\xb9"
+        "\xb3\xcf\xa0\xa1\xbd\x89\x11\x2f\xfe\x45\x29\xfb\x38\x75\x03\x7b\xc2\xc3"
+        "\xed\x25\xb2\xb9\x7a\x11\x25\xdc\xf7\x89\x9e\x07\xeb\xc6\xee\xb1\x13\xd5"
+        "\xea\x6c\x0a\x76\x0d\x7d\xd3\xe5\xc4\x2a\x0f\x51\xfb\x61\x14\x21\x01\x41"
+        "\xdd\x37\x7e\xc6\x9b\xab\xe2\xf9\xc2\x26\xbe\xc8\x64\xa1\x3c\x07\x67\xcc"
+        "\xe6\x3e\xf5\xef\x3a\x15\xbd\xe9\x30\xf6\x88\x37\xae\x5f\x0f\xc5\x1c\x32"
+        "\x58\xf5\xd8\xd0\x1b\xea\x72\x78\x53\x5e\xb4\x6b\x6b\x24\x58\x85\x10\x80"
+        "\xf6\x3f\x07\x12\xca\x43\xa2\x88\xfd\xc1\xbd\xa4\x03\xf1\x70\x4b\x54\xc6"
+        "\x09\xdf\xe4\x5a\xae\xa5\xf9\xc3\x74\x1f\x12\x55\x97\x65\x9e\x66\x92\x22"
+        "\x79\xf5\x0e\x95\x58\x57\xd2\xf7\xdb\x24\xa6\x7a\x78\x3d\xc8\xd7\x3d\x59"
+        "\x89\x28\x00\xaf\x83\xa1\x5b\x0b\x5e\x59\x43\xec\xa8\xad\xa0\x98\xa6\x51"
+        "\xc8\xc2\x7f\xa8\x3f\xaa\x0b\x53\x69\x47\x2d\x5f\x3d\x50\x73\xa4\x14\xc3"
+        "\x6f\x58\xc7\xef\x30\xc9\x7e\x4f\xc1\x97\xbe\xaf\xcb\x31\x16\xa6\x18\xcb"
+        "\x0d\x7d\xe8\x82\x3f\x54\x31\xf9\x24\x2f\x1b\x3b\xfa\x1d\x15\xbd\xea\x76"
+        "\xbe\x02\xe7\x1d\x91\xc2\x4c\x39\xda\x9b\x5a\x06\x91\xcb\xb5\x0f\x62\xfa"
+        "\x65\x6e\xd9\x06\x33\xeb\x9b\x11\x85\x9a\xec\x47\x88\x63\xf5\x4f\xf0\x64"
+        "\x64\xf6\x43\x5f\x15\x99\xf7\x9f\x25\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\xa0\x03\xba\x7e\xbb\x74\xf3\xdb\x93\x3c\xa4\x64"
+        "\x2b\xff\xb3\x79\xad\x02\x21\x1f\xb1\x40\x36\xf3\xa4\xe2\xcf\xa8\x54\xc3"
+        "\xdd\xcd\x81\xda\xaf\xcd\x61\x12\x37\xa9\x15\x31\xfc\x9d\x75\x54\x83\x74"
+        "\x78\xf1\x94\x4f\x28\x04\xad\xca\x7d\x96\x6e\x80\xf4\x53\xa4\xca\x82\x84"
+        "\xb7\x7f\x61\xd7\xd9\x84\x26\xbc\xbc\xdd\x6f\x30\xd6\x65\x79\x84\x0f\xd2"
+        "\xf0\x05\x32\x89\x4b\x34\x39\x0a\x2a\x80\x14\x04\x68\x45\xf9\xed\xf6\x73"
+        "\x11\xae\x5b\xb7\xa5\x8e\x51\x2e\x40\x86\x0d\xe3\x55\x68\xf7\x9c\x40\xb1"
+        "\xef\xf8\x53\x59\xc1\x96\xdd\xdb\xb3\x3d\x06\x64\x9e\xcc\x8e\x6c\x5d\x1b"
+        "\x54\xbc\x9f\x6a\x67\xc5\xe4\x31\x25\x88\x6e\x13\xb8\xcb\x78\x3d\x36\x2b"
+        "\x37\x46\xea\x8d\xb2\xfa\x45\x44\x32\x5a\x0c\x9f",
+        2442);
+    *(uint64_t*)0x20000110 = 0x202bf000;
+    memcpy((void*)0x202bf000, "syzkaller\000", 10);
+    *(uint32_t*)0x20000118 = 4;
+    *(uint32_t*)0x2000011c = 0x436;
+    *(uint64_t*)0x20000120 = 0x20000040;
+    *(uint32_t*)0x20000128 = 0;
+    *(uint32_t*)0x2000012c = 0;
+    memset((void*)0x20000130, 0, 16);
+    *(uint32_t*)0x20000140 = 0;
+    *(uint32_t*)0x20000144 = 0;
+    *(uint32_t*)0x20000148 = -1;
+    *(uint32_t*)0x2000014c = 8;
+    *(uint64_t*)0x20000150 = 0x20000000;
+    *(uint32_t*)0x20000000 = 0;
+    *(uint32_t*)0x20000004 = 0;
+    *(uint32_t*)0x20000158 = 7;
+    *(uint32_t*)0x2000015c = 0x10;
+    *(uint64_t*)0x20000160 = 0x20000000;
+    *(uint32_t*)0x20000000 = 0;
+    *(uint32_t*)0x20000004 = 0;
+    *(uint32_t*)0x20000008 = 0;
+    *(uint32_t*)0x2000000c = 0;
+    *(uint32_t*)0x20000168 = 0;
+    *(uint32_t*)0x2000016c = 0;
+    *(uint32_t*)0x20000170 = -1;
+    res = syscall(__NR_bpf, 5ul, 0x20000100ul, 0x48ul);
+    if (res != -1)
+        r[0] = res;
+    res = syscall(__NR_socket, 0x29ul, 2ul, 0);
+    if (res != -1)
+        r[1] = res;
+    res = syscall(__NR_socket, 0xaul, 1ul, 0);
+    if (res != -1)
+        r[2] = res;
+    *(uint32_t*)0x20000040 = 1;
+    syscall(__NR_setsockopt, r[2], 6, 0x13, 0x20000040ul, 0x76dcul);
+    *(uint16_t*)0x20002600 = 0xa;
+    *(uint16_t*)0x20002602 = htobe16(0);
+    *(uint32_t*)0x20002604 = htobe32(0);
+    memset((void*)0x20002608, 0, 16);
+    *(uint32_t*)0x20002618 = 0;
+    syscall(__NR_connect, r[2], 0x20002600ul, 0x1cul);
+    memcpy((void*)0x200002c0, "tls\000", 4);
+    syscall(__NR_setsockopt, r[2], 6, 0x1f, 0x200002c0ul, 4ul);
+    *(uint16_t*)0x20000300 = 0x304;
+    *(uint16_t*)0x20000302 = 0x34;
+    memcpy((void*)0x20000304, "\x54\x27\x01\x0e\xde\x10\x25\x9c", 8);
+    memcpy((void*)0x2000030c,
+        "\xd6\x2b\x94\x9a\xca\x1e\x27\xe1\x48\x20\x80\x6f\x1b\x32\x11\x76\x62"
+        "\x97\xc5\x50\xc9\xbe\xfe\xe0\x98\x67\x00\x2a\xa9\xb6\x3d\x50",
+        32);
+    memcpy((void*)0x2000032c, "\xd6\x52\x0a\xed", 4);
+    memcpy((void*)0x20000330, "\x37\x77\x62\x01\xe1\x59\x4f\xb9", 8);
+    syscall(__NR_setsockopt, r[2], 0x11a, 2, 0x20000300ul, 0x38ul);
+    *(uint32_t*)0x20000200 = r[2];
+    *(uint32_t*)0x20000204 = r[0];
+    syscall(__NR_ioctl, r[1], 0x89e0, 0x20000200ul);
+    *(uint64_t*)0x200030c0 = 0;
+    *(uint32_t*)0x200030c8 = 0;
+    *(uint64_t*)0x200030d0 = 0;
+    *(uint64_t*)0x200030d8 = 0;
+    *(uint64_t*)0x200030e0 = 0;
+    *(uint64_t*)0x200030e8 = 0;
+    *(uint32_t*)0x200030f0 = 0;
+    *(uint32_t*)0x200030f8 = 6;
+    *(uint64_t*)0x20003100 = 0;
+    *(uint32_t*)0x20003108 = 0;
+    *(uint64_t*)0x20003110 = 0;
+    *(uint64_t*)0x20003118 = 0;
+    *(uint64_t*)0x20003120 = 0;
+    *(uint64_t*)0x20003128 = 0;
+    *(uint32_t*)0x20003130 = 0;
+    *(uint32_t*)0x20003138 = 0;
+    *(uint64_t*)0x20003140 = 0;
+    *(uint32_t*)0x20003148 = 0;
+    *(uint64_t*)0x20003150 = 0;
+    *(uint64_t*)0x20003158 = 0;
+    *(uint64_t*)0x20003160 = 0;
+    *(uint64_t*)0x20003168 = 0;
+    *(uint32_t*)0x20003170 = 0;
+    *(uint32_t*)0x20003178 = 0x3ebf;
+    *(uint64_t*)0x20003180 = 0;
+    *(uint32_t*)0x20003188 = 0;
+    *(uint64_t*)0x20003190 = 0;
+    *(uint64_t*)0x20003198 = 0;
+    *(uint64_t*)0x200031a0 = 0;
+    *(uint64_t*)0x200031a8 = 0;
+    *(uint32_t*)0x200031b0 = 0;
+    *(uint32_t*)0x200031b8 = 0xfffff903;
+    *(uint64_t*)0x200031c0 = 0;
+    *(uint32_t*)0x200031c8 = 0;
+    *(uint64_t*)0x200031d0 = 0;
+    *(uint64_t*)0x200031d8 = 0;
+    *(uint64_t*)0x200031e0 = 0;
+    *(uint64_t*)0x200031e8 = 0;
+    *(uint32_t*)0x200031f0 = 0;
+    *(uint32_t*)0x200031f8 = 4;
+    *(uint64_t*)0x20003200 = 0;
+    *(uint32_t*)0x20003208 = 0;
+    *(uint64_t*)0x20003210 = 0;
+    *(uint64_t*)0x20003218 = 0;
+    *(uint64_t*)0x20003220 = 0;
+    *(uint64_t*)0x20003228 = 0;
+    *(uint32_t*)0x20003230 = 0;
+    *(uint32_t*)0x20003238 = 0x1a47;
+    *(uint64_t*)0x20003240 = 0;
+    *(uint32_t*)0x20003248 = 0;
+    *(uint64_t*)0x20003250 = 0;
+    *(uint64_t*)0x20003258 = 0;
+    *(uint64_t*)0x20003260 = 0;
+    *(uint64_t*)0x20003268 = 0;
+    *(uint32_t*)0x20003270 = 0;
+    *(uint32_t*)0x20003278 = 0xe0;
+    *(uint64_t*)0x20003280 = 0;
+    *(uint32_t*)0x20003288 = 0;
+    *(uint64_t*)0x20003290 = 0;
+    *(uint64_t*)0x20003298 = 0;
+    *(uint64_t*)0x200032a0 = 0;
+    *(uint64_t*)0x200032a8 = 0;
+    *(uint32_t*)0x200032b0 = 0;
+    *(uint32_t*)0x200032b8 = 0x23d6;
+    *(uint64_t*)0x200032c0 = 0;
+    *(uint32_t*)0x200032c8 = 0;
+    *(uint64_t*)0x200032d0 = 0;
+    *(uint64_t*)0x200032d8 = 0;
+    *(uint64_t*)0x200032e0 = 0;
+    *(uint64_t*)0x200032e8 = 0;
+    *(uint32_t*)0x200032f0 = 0;
+    *(uint32_t*)0x200032f8 = 2;
+    *(uint64_t*)0x20003300 = 0;
+    *(uint32_t*)0x20003308 = 0;
+    *(uint64_t*)0x20003310 = 0;
+    *(uint64_t*)0x20003318 = 0;
+    *(uint64_t*)0x20003320 = 0;
+    *(uint64_t*)0x20003328 = 0;
+    *(uint32_t*)0x20003330 = 0;
+    *(uint32_t*)0x20003338 = 9;
+    syscall(__NR_recvmmsg, r[2], 0x200030c0ul, 0xaul, 0x10000ul, 0ul);
+    return 0;
+}
@@ -1,928 +1,9 @@
 // https://syzkaller.appspot.com/bug?id=fd3e063bddd1c046b909237e56d95517449da4f6
 // autogenerated by syzkaller (https://github.com/google/syzkaller)
 
-#define _GNU_SOURCE
+#include "syz.h"
 
-#include <arpa/inet.h>
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <net/if.h>
-#include <net/if_arp.h>
-#include <netinet/in.h>
-#include <sched.h>
-#include <stdarg.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/ioctl.h>
-#include <sys/mount.h>
-#include <sys/prctl.h>
-#include <sys/resource.h>
-#include <sys/socket.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/time.h>
-#include <sys/types.h>
-#include <sys/wait.h>
-#include <unistd.h>
-
-#include <linux/capability.h>
-#include <linux/genetlink.h>
-#include <linux/if_addr.h>
-#include <linux/if_ether.h>
-#include <linux/if_link.h>
-#include <linux/if_tun.h>
-#include <linux/in6.h>
-#include <linux/ip.h>
-#include <linux/neighbour.h>
-#include <linux/net.h>
-#include <linux/netlink.h>
-#include <linux/rtnetlink.h>
-#include <linux/tcp.h>
-#include <linux/usb/ch9.h>
-#include <linux/veth.h>
-
-static unsigned long long procid;
-
-static void sleep_ms(uint64_t ms)
-{
-  usleep(ms * 1000);
-}
-
-static bool write_file(const char* file, const char* what, ...)
-{
-  char buf[1024];
-  va_list args;
-  va_start(args, what);
-  vsnprintf(buf, sizeof(buf), what, args);
-  va_end(args);
-  buf[sizeof(buf) - 1] = 0;
-  int len = strlen(buf);
-  int fd = open(file, O_WRONLY | O_CLOEXEC);
-  if (fd == -1)
-    return false;
-  if (write(fd, buf, len) != len) {
-    int err = errno;
-    close(fd);
-    errno = err;
-    return false;
-  }
-  close(fd);
-  return true;
-}
-
-struct nlmsg {
-  char* pos;
-  int nesting;
-  struct nlattr* nested[8];
-  char buf[4096];
-};
-
-static void netlink_init(struct nlmsg* nlmsg, int typ, int flags,
-                         const void* data, int size)
-{
-  memset(nlmsg, 0, sizeof(*nlmsg));
-  struct nlmsghdr* hdr = (struct nlmsghdr*)nlmsg->buf;
-  hdr->nlmsg_type = typ;
-  hdr->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | flags;
-  memcpy(hdr + 1, data, size);
-  nlmsg->pos = (char*)(hdr + 1) + NLMSG_ALIGN(size);
-}
-
-static void netlink_attr(struct nlmsg* nlmsg, int typ, const void* data,
-                         int size)
-{
-  struct nlattr* attr = (struct nlattr*)nlmsg->pos;
-  attr->nla_len = sizeof(*attr) + size;
-  attr->nla_type = typ;
-  if (size > 0)
-    memcpy(attr + 1, data, size);
-  nlmsg->pos += NLMSG_ALIGN(attr->nla_len);
-}
-
-static int netlink_send_ext(struct nlmsg* nlmsg, int sock, uint16_t reply_type,
-                            int* reply_len)
-{
-  if (nlmsg->pos > nlmsg->buf + sizeof(nlmsg->buf) || nlmsg->nesting)
-    exit(1);
-  struct nlmsghdr* hdr = (struct nlmsghdr*)nlmsg->buf;
-  hdr->nlmsg_len = nlmsg->pos - nlmsg->buf;
-  struct sockaddr_nl addr;
-  memset(&addr, 0, sizeof(addr));
-  addr.nl_family = AF_NETLINK;
-  unsigned n = sendto(sock, nlmsg->buf, hdr->nlmsg_len, 0,
-                      (struct sockaddr*)&addr, sizeof(addr));
-  if (n != hdr->nlmsg_len)
-    exit(1);
-  n = recv(sock, nlmsg->buf, sizeof(nlmsg->buf), 0);
-  if (reply_len)
-    *reply_len = 0;
-  if (hdr->nlmsg_type == NLMSG_DONE)
-    return 0;
-  if (n < sizeof(struct nlmsghdr))
-    exit(1);
-  if (reply_len && hdr->nlmsg_type == reply_type) {
-    *reply_len = n;
-    return 0;
-  }
-  if (n < sizeof(struct nlmsghdr) + sizeof(struct nlmsgerr))
-    exit(1);
-  if (hdr->nlmsg_type != NLMSG_ERROR)
-    exit(1);
-  return ((struct nlmsgerr*)(hdr + 1))->error;
-}
-
-static int netlink_send(struct nlmsg* nlmsg, int sock)
-{
-  return netlink_send_ext(nlmsg, sock, 0, NULL);
-}
-
-static int netlink_query_family_id(struct nlmsg* nlmsg, int sock,
-                                   const char* family_name)
-{
-  struct genlmsghdr genlhdr;
-  memset(&genlhdr, 0, sizeof(genlhdr));
-  genlhdr.cmd = CTRL_CMD_GETFAMILY;
-  netlink_init(nlmsg, GENL_ID_CTRL, 0, &genlhdr, sizeof(genlhdr));
-  netlink_attr(nlmsg, CTRL_ATTR_FAMILY_NAME, family_name,
-               strnlen(family_name, GENL_NAMSIZ - 1) + 1);
-  int n = 0;
-  int err = netlink_send_ext(nlmsg, sock, GENL_ID_CTRL, &n);
-  if (err < 0) {
-    return -1;
-  }
-  uint16_t id = 0;
-  struct nlattr* attr = (struct nlattr*)(nlmsg->buf + NLMSG_HDRLEN +
-                                         NLMSG_ALIGN(sizeof(genlhdr)));
-  for (; (char*)attr < nlmsg->buf + n;
-       attr = (struct nlattr*)((char*)attr + NLMSG_ALIGN(attr->nla_len))) {
-    if (attr->nla_type == CTRL_ATTR_FAMILY_ID) {
-      id = *(uint16_t*)(attr + 1);
-      break;
-    }
-  }
-  if (!id) {
-    return -1;
-  }
-  recv(sock, nlmsg->buf, sizeof(nlmsg->buf), 0);
-  return id;
-}
-
-static void netlink_device_change(struct nlmsg* nlmsg, int sock,
-                                  const char* name, bool up, const char* master,
-                                  const void* mac, int macsize,
-                                  const char* new_name)
-{
-  struct ifinfomsg hdr;
-  memset(&hdr, 0, sizeof(hdr));
-  if (up)
-    hdr.ifi_flags = hdr.ifi_change = IFF_UP;
-  hdr.ifi_index = if_nametoindex(name);
-  netlink_init(nlmsg, RTM_NEWLINK, 0, &hdr, sizeof(hdr));
-  if (new_name)
-    netlink_attr(nlmsg, IFLA_IFNAME, new_name, strlen(new_name));
-  if (master) {
-    int ifindex = if_nametoindex(master);
-    netlink_attr(nlmsg, IFLA_MASTER, &ifindex, sizeof(ifindex));
-  }
-  if (macsize)
-    netlink_attr(nlmsg, IFLA_ADDRESS, mac, macsize);
-  int err = netlink_send(nlmsg, sock);
-  (void)err;
-}
-
-static int netlink_add_addr(struct nlmsg* nlmsg, int sock, const char* dev,
-                            const void* addr, int addrsize)
-{
-  struct ifaddrmsg hdr;
-  memset(&hdr, 0, sizeof(hdr));
-  hdr.ifa_family = addrsize == 4 ? AF_INET : AF_INET6;
-  hdr.ifa_prefixlen = addrsize == 4 ? 24 : 120;
-  hdr.ifa_scope = RT_SCOPE_UNIVERSE;
-  hdr.ifa_index = if_nametoindex(dev);
-  netlink_init(nlmsg, RTM_NEWADDR, NLM_F_CREATE | NLM_F_REPLACE, &hdr,
-               sizeof(hdr));
-  netlink_attr(nlmsg, IFA_LOCAL, addr, addrsize);
-  netlink_attr(nlmsg, IFA_ADDRESS, addr, addrsize);
-  return netlink_send(nlmsg, sock);
-}
-
-static void netlink_add_addr4(struct nlmsg* nlmsg, int sock, const char* dev,
-                              const char* addr)
-{
-  struct in_addr in_addr;
-  inet_pton(AF_INET, addr, &in_addr);
-  int err = netlink_add_addr(nlmsg, sock, dev, &in_addr, sizeof(in_addr));
-  (void)err;
-}
-
-static void netlink_add_addr6(struct nlmsg* nlmsg, int sock, const char* dev,
-                              const char* addr)
-{
-  struct in6_addr in6_addr;
-  inet_pton(AF_INET6, addr, &in6_addr);
-  int err = netlink_add_addr(nlmsg, sock, dev, &in6_addr, sizeof(in6_addr));
-  (void)err;
-}
-
-static void netlink_add_neigh(struct nlmsg* nlmsg, int sock, const char* name,
-                              const void* addr, int addrsize, const void* mac,
-                              int macsize)
-{
-  struct ndmsg hdr;
-  memset(&hdr, 0, sizeof(hdr));
-  hdr.ndm_family = addrsize == 4 ? AF_INET : AF_INET6;
-  hdr.ndm_ifindex = if_nametoindex(name);
-  hdr.ndm_state = NUD_PERMANENT;
-  netlink_init(nlmsg, RTM_NEWNEIGH, NLM_F_EXCL | NLM_F_CREATE, &hdr,
-               sizeof(hdr));
-  netlink_attr(nlmsg, NDA_DST, addr, addrsize);
-  netlink_attr(nlmsg, NDA_LLADDR, mac, macsize);
-  int err = netlink_send(nlmsg, sock);
-  (void)err;
-}
-
-static struct nlmsg nlmsg;
-
-static int tunfd = -1;
-
-#define TUN_IFACE "syz_tun"
-#define LOCAL_MAC 0xaaaaaaaaaaaa
-#define REMOTE_MAC 0xaaaaaaaaaabb
-#define LOCAL_IPV4 "172.20.20.170"
-#define REMOTE_IPV4 "172.20.20.187"
-#define LOCAL_IPV6 "fe80::aa"
-#define REMOTE_IPV6 "fe80::bb"
-
-#define IFF_NAPI 0x0010
-
-static void initialize_tun(void)
-{
-  tunfd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
-  if (tunfd == -1) {
-    printf("tun: can't open /dev/net/tun: please enable CONFIG_TUN=y\n");
-    printf("otherwise fuzzing or reproducing might not work as intended\n");
-    return;
-  }
-  const int kTunFd = 240;
-  if (dup2(tunfd, kTunFd) < 0)
-    exit(1);
-  close(tunfd);
-  tunfd = kTunFd;
-  struct ifreq ifr;
-  memset(&ifr, 0, sizeof(ifr));
-  strncpy(ifr.ifr_name, TUN_IFACE, IFNAMSIZ);
-  ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
-  if (ioctl(tunfd, TUNSETIFF, (void*)&ifr) < 0) {
-    exit(1);
-  }
-  char sysctl[64];
-  sprintf(sysctl, "/proc/sys/net/ipv6/conf/%s/accept_dad", TUN_IFACE);
-  write_file(sysctl, "0");
-  sprintf(sysctl, "/proc/sys/net/ipv6/conf/%s/router_solicitations", TUN_IFACE);
-  write_file(sysctl, "0");
-  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
-  if (sock == -1)
-    exit(1);
-  netlink_add_addr4(&nlmsg, sock, TUN_IFACE, LOCAL_IPV4);
-  netlink_add_addr6(&nlmsg, sock, TUN_IFACE, LOCAL_IPV6);
-  uint64_t macaddr = REMOTE_MAC;
-  struct in_addr in_addr;
-  inet_pton(AF_INET, REMOTE_IPV4, &in_addr);
-  netlink_add_neigh(&nlmsg, sock, TUN_IFACE, &in_addr, sizeof(in_addr),
-                    &macaddr, ETH_ALEN);
-  struct in6_addr in6_addr;
-  inet_pton(AF_INET6, REMOTE_IPV6, &in6_addr);
-  netlink_add_neigh(&nlmsg, sock, TUN_IFACE, &in6_addr, sizeof(in6_addr),
-                    &macaddr, ETH_ALEN);
-  macaddr = LOCAL_MAC;
-  netlink_device_change(&nlmsg, sock, TUN_IFACE, true, 0, &macaddr, ETH_ALEN,
-                        NULL);
-  close(sock);
-}
-
-#define MAX_FDS 30
-
-#define USB_MAX_IFACE_NUM 4
-#define USB_MAX_EP_NUM 32
-#define USB_MAX_FDS 6
-
-struct usb_endpoint_index {
-  struct usb_endpoint_descriptor desc;
-  int handle;
-};
-
-struct usb_iface_index {
-  struct usb_interface_descriptor* iface;
-  uint8_t bInterfaceNumber;
-  uint8_t bAlternateSetting;
-  uint8_t bInterfaceClass;
-  struct usb_endpoint_index eps[USB_MAX_EP_NUM];
-  int eps_num;
-};
-
-struct usb_device_index {
-  struct usb_device_descriptor* dev;
-  struct usb_config_descriptor* config;
-  uint8_t bDeviceClass;
-  uint8_t bMaxPower;
-  int config_length;
-  struct usb_iface_index ifaces[USB_MAX_IFACE_NUM];
-  int ifaces_num;
-  int iface_cur;
-};
-
-struct usb_info {
-  int fd;
-  struct usb_device_index index;
-};
-
-static struct usb_info usb_devices[USB_MAX_FDS];
-static int usb_devices_num;
-
-static bool parse_usb_descriptor(const char* buffer, size_t length,
-                                 struct usb_device_index* index)
-{
-  if (length < sizeof(*index->dev) + sizeof(*index->config))
-    return false;
-  memset(index, 0, sizeof(*index));
-  index->dev = (struct usb_device_descriptor*)buffer;
-  index->config = (struct usb_config_descriptor*)(buffer + sizeof(*index->dev));
-  index->bDeviceClass = index->dev->bDeviceClass;
-  index->bMaxPower = index->config->bMaxPower;
-  index->config_length = length - sizeof(*index->dev);
-  index->iface_cur = -1;
-  size_t offset = 0;
-  while (true) {
-    if (offset + 1 >= length)
-      break;
-    uint8_t desc_length = buffer[offset];
-    uint8_t desc_type = buffer[offset + 1];
-    if (desc_length <= 2)
-      break;
-    if (offset + desc_length > length)
-      break;
-    if (desc_type == USB_DT_INTERFACE &&
-        index->ifaces_num < USB_MAX_IFACE_NUM) {
-      struct usb_interface_descriptor* iface =
-          (struct usb_interface_descriptor*)(buffer + offset);
-      index->ifaces[index->ifaces_num].iface = iface;
-      index->ifaces[index->ifaces_num].bInterfaceNumber =
-          iface->bInterfaceNumber;
-      index->ifaces[index->ifaces_num].bAlternateSetting =
-          iface->bAlternateSetting;
-      index->ifaces[index->ifaces_num].bInterfaceClass = iface->bInterfaceClass;
-      index->ifaces_num++;
-    }
-    if (desc_type == USB_DT_ENDPOINT && index->ifaces_num > 0) {
-      struct usb_iface_index* iface = &index->ifaces[index->ifaces_num - 1];
-      if (iface->eps_num < USB_MAX_EP_NUM) {
-        memcpy(&iface->eps[iface->eps_num].desc, buffer + offset,
-               sizeof(iface->eps[iface->eps_num].desc));
-        iface->eps_num++;
-      }
-    }
-    offset += desc_length;
-  }
-  return true;
-}
-
-static struct usb_device_index* add_usb_index(int fd, const char* dev,
-                                              size_t dev_len)
-{
-  int i = __atomic_fetch_add(&usb_devices_num, 1, __ATOMIC_RELAXED);
-  if (i >= USB_MAX_FDS)
-    return NULL;
-  if (!parse_usb_descriptor(dev, dev_len, &usb_devices[i].index))
-    return NULL;
-  __atomic_store_n(&usb_devices[i].fd, fd, __ATOMIC_RELEASE);
-  return &usb_devices[i].index;
-}
-
-static struct usb_device_index* lookup_usb_index(int fd)
-{
-  for (int i = 0; i < USB_MAX_FDS; i++) {
-    if (__atomic_load_n(&usb_devices[i].fd, __ATOMIC_ACQUIRE) == fd) {
-      return &usb_devices[i].index;
-    }
-  }
-  return NULL;
-}
-
-struct vusb_connect_string_descriptor {
-  uint32_t len;
-  char* str;
-} __attribute__((packed));
-
-struct vusb_connect_descriptors {
-  uint32_t qual_len;
-  char* qual;
-  uint32_t bos_len;
-  char* bos;
-  uint32_t strs_len;
-  struct vusb_connect_string_descriptor strs[0];
-} __attribute__((packed));
-
-static const char default_string[] = {8, USB_DT_STRING, 's', 0, 'y', 0, 'z', 0};
-
-static const char default_lang_id[] = {4, USB_DT_STRING, 0x09, 0x04};
-
-static bool
-lookup_connect_response_in(int fd, const struct vusb_connect_descriptors* descs,
-                           const struct usb_ctrlrequest* ctrl,
-                           char** response_data, uint32_t* response_length)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  uint8_t str_idx;
-  if (!index)
-    return false;
-  switch (ctrl->bRequestType & USB_TYPE_MASK) {
-  case USB_TYPE_STANDARD:
-    switch (ctrl->bRequest) {
-    case USB_REQ_GET_DESCRIPTOR:
-      switch (ctrl->wValue >> 8) {
-      case USB_DT_DEVICE:
-        *response_data = (char*)index->dev;
-        *response_length = sizeof(*index->dev);
-        return true;
-      case USB_DT_CONFIG:
-        *response_data = (char*)index->config;
-        *response_length = index->config_length;
-        return true;
-      case USB_DT_STRING:
-        str_idx = (uint8_t)ctrl->wValue;
-        if (descs && str_idx < descs->strs_len) {
-          *response_data = descs->strs[str_idx].str;
-          *response_length = descs->strs[str_idx].len;
-          return true;
-        }
-        if (str_idx == 0) {
-          *response_data = (char*)&default_lang_id[0];
-          *response_length = default_lang_id[0];
-          return true;
-        }
-        *response_data = (char*)&default_string[0];
-        *response_length = default_string[0];
-        return true;
-      case USB_DT_BOS:
-        *response_data = descs->bos;
-        *response_length = descs->bos_len;
-        return true;
-      case USB_DT_DEVICE_QUALIFIER:
-        if (!descs->qual) {
-          struct usb_qualifier_descriptor* qual =
-              (struct usb_qualifier_descriptor*)response_data;
-          qual->bLength = sizeof(*qual);
-          qual->bDescriptorType = USB_DT_DEVICE_QUALIFIER;
-          qual->bcdUSB = index->dev->bcdUSB;
-          qual->bDeviceClass = index->dev->bDeviceClass;
-          qual->bDeviceSubClass = index->dev->bDeviceSubClass;
-          qual->bDeviceProtocol = index->dev->bDeviceProtocol;
-          qual->bMaxPacketSize0 = index->dev->bMaxPacketSize0;
-          qual->bNumConfigurations = index->dev->bNumConfigurations;
-          qual->bRESERVED = 0;
-          *response_length = sizeof(*qual);
-          return true;
-        }
-        *response_data = descs->qual;
-        *response_length = descs->qual_len;
-        return true;
-      default:
-        break;
-      }
-      break;
-    default:
-      break;
-    }
-    break;
-  default:
-    break;
-  }
-  return false;
-}
-
-typedef bool (*lookup_connect_out_response_t)(
-    int fd, const struct vusb_connect_descriptors* descs,
-    const struct usb_ctrlrequest* ctrl, bool* done);
-
-static bool lookup_connect_response_out_generic(
-    int fd, const struct vusb_connect_descriptors* descs,
-    const struct usb_ctrlrequest* ctrl, bool* done)
-{
-  switch (ctrl->bRequestType & USB_TYPE_MASK) {
-  case USB_TYPE_STANDARD:
-    switch (ctrl->bRequest) {
-    case USB_REQ_SET_CONFIGURATION:
-      *done = true;
-      return true;
-    default:
-      break;
-    }
-    break;
-  }
-  return false;
-}
-
-#define UDC_NAME_LENGTH_MAX 128
-
-struct usb_raw_init {
-  __u8 driver_name[UDC_NAME_LENGTH_MAX];
-  __u8 device_name[UDC_NAME_LENGTH_MAX];
-  __u8 speed;
-};
-
-enum usb_raw_event_type {
-  USB_RAW_EVENT_INVALID = 0,
-  USB_RAW_EVENT_CONNECT = 1,
-  USB_RAW_EVENT_CONTROL = 2,
-};
-
-struct usb_raw_event {
-  __u32 type;
-  __u32 length;
-  __u8 data[0];
-};
-
-struct usb_raw_ep_io {
-  __u16 ep;
-  __u16 flags;
-  __u32 length;
-  __u8 data[0];
-};
-
-#define USB_RAW_EPS_NUM_MAX 30
-#define USB_RAW_EP_NAME_MAX 16
-#define USB_RAW_EP_ADDR_ANY 0xff
-
-struct usb_raw_ep_caps {
-  __u32 type_control : 1;
-  __u32 type_iso : 1;
-  __u32 type_bulk : 1;
-  __u32 type_int : 1;
-  __u32 dir_in : 1;
-  __u32 dir_out : 1;
-};
-
-struct usb_raw_ep_limits {
-  __u16 maxpacket_limit;
-  __u16 max_streams;
-  __u32 reserved;
-};
-
-struct usb_raw_ep_info {
-  __u8 name[USB_RAW_EP_NAME_MAX];
-  __u32 addr;
-  struct usb_raw_ep_caps caps;
-  struct usb_raw_ep_limits limits;
-};
-
-struct usb_raw_eps_info {
-  struct usb_raw_ep_info eps[USB_RAW_EPS_NUM_MAX];
-};
-
-#define USB_RAW_IOCTL_INIT _IOW('U', 0, struct usb_raw_init)
-#define USB_RAW_IOCTL_RUN _IO('U', 1)
-#define USB_RAW_IOCTL_EVENT_FETCH _IOR('U', 2, struct usb_raw_event)
-#define USB_RAW_IOCTL_EP0_WRITE _IOW('U', 3, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP0_READ _IOWR('U', 4, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP_ENABLE _IOW('U', 5, struct usb_endpoint_descriptor)
-#define USB_RAW_IOCTL_EP_DISABLE _IOW('U', 6, __u32)
-#define USB_RAW_IOCTL_EP_WRITE _IOW('U', 7, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP_READ _IOWR('U', 8, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_CONFIGURE _IO('U', 9)
-#define USB_RAW_IOCTL_VBUS_DRAW _IOW('U', 10, __u32)
-#define USB_RAW_IOCTL_EPS_INFO _IOR('U', 11, struct usb_raw_eps_info)
-#define USB_RAW_IOCTL_EP0_STALL _IO('U', 12)
-#define USB_RAW_IOCTL_EP_SET_HALT _IOW('U', 13, __u32)
-#define USB_RAW_IOCTL_EP_CLEAR_HALT _IOW('U', 14, __u32)
-#define USB_RAW_IOCTL_EP_SET_WEDGE _IOW('U', 15, __u32)
-
-static int usb_raw_open()
-{
-  return open("/dev/raw-gadget", O_RDWR);
-}
-
-static int usb_raw_init(int fd, uint32_t speed, const char* driver,
-                        const char* device)
-{
-  struct usb_raw_init arg;
-  strncpy((char*)&arg.driver_name[0], driver, sizeof(arg.driver_name));
-  strncpy((char*)&arg.device_name[0], device, sizeof(arg.device_name));
-  arg.speed = speed;
-  return ioctl(fd, USB_RAW_IOCTL_INIT, &arg);
-}
-
-static int usb_raw_run(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_RUN, 0);
-}
-
-static int usb_raw_event_fetch(int fd, struct usb_raw_event* event)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EVENT_FETCH, event);
-}
-
-static int usb_raw_ep0_write(int fd, struct usb_raw_ep_io* io)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_WRITE, io);
-}
-
-static int usb_raw_ep0_read(int fd, struct usb_raw_ep_io* io)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_READ, io);
-}
-
-static int usb_raw_ep_enable(int fd, struct usb_endpoint_descriptor* desc)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP_ENABLE, desc);
-}
-
-static int usb_raw_ep_disable(int fd, int ep)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP_DISABLE, ep);
-}
-
-static int usb_raw_configure(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_CONFIGURE, 0);
-}
-
-static int usb_raw_vbus_draw(int fd, uint32_t power)
-{
-  return ioctl(fd, USB_RAW_IOCTL_VBUS_DRAW, power);
-}
-
-static int usb_raw_ep0_stall(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_STALL, 0);
-}
-
-static void set_interface(int fd, int n)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  if (!index)
-    return;
-  if (index->iface_cur >= 0 && index->iface_cur < index->ifaces_num) {
-    for (int ep = 0; ep < index->ifaces[index->iface_cur].eps_num; ep++) {
-      int rv = usb_raw_ep_disable(
-          fd, index->ifaces[index->iface_cur].eps[ep].handle);
-      if (rv < 0) {
-      } else {
-      }
-    }
-  }
-  if (n >= 0 && n < index->ifaces_num) {
-    for (int ep = 0; ep < index->ifaces[n].eps_num; ep++) {
-      int rv = usb_raw_ep_enable(fd, &index->ifaces[n].eps[ep].desc);
-      if (rv < 0) {
-      } else {
-        index->ifaces[n].eps[ep].handle = rv;
-      }
-    }
-    index->iface_cur = n;
-  }
-}
-
-static int configure_device(int fd)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  if (!index)
-    return -1;
-  int rv = usb_raw_vbus_draw(fd, index->bMaxPower);
-  if (rv < 0) {
-    return rv;
-  }
-  rv = usb_raw_configure(fd);
-  if (rv < 0) {
-    return rv;
-  }
-  set_interface(fd, 0);
-  return 0;
-}
-
-#define USB_MAX_PACKET_SIZE 4096
-
-struct usb_raw_control_event {
-  struct usb_raw_event inner;
-  struct usb_ctrlrequest ctrl;
-  char data[USB_MAX_PACKET_SIZE];
-};
-
-struct usb_raw_ep_io_data {
-  struct usb_raw_ep_io inner;
-  char data[USB_MAX_PACKET_SIZE];
-};
-
-static volatile long
-syz_usb_connect_impl(uint64_t speed, uint64_t dev_len, const char* dev,
-                     const struct vusb_connect_descriptors* descs,
-                     lookup_connect_out_response_t lookup_connect_response_out)
-{
-  if (!dev) {
-    return -1;
-  }
-  int fd = usb_raw_open();
-  if (fd < 0) {
-    return fd;
-  }
-  if (fd >= MAX_FDS) {
-    close(fd);
-    return -1;
-  }
-  struct usb_device_index* index = add_usb_index(fd, dev, dev_len);
-  if (!index) {
-    return -1;
-  }
-  char device[32];
-  sprintf(&device[0], "dummy_udc.%llu", procid);
-  int rv = usb_raw_init(fd, speed, "dummy_udc", &device[0]);
-  if (rv < 0) {
-    return rv;
-  }
-  rv = usb_raw_run(fd);
-  if (rv < 0) {
-    return rv;
-  }
-  bool done = false;
-  while (!done) {
-    struct usb_raw_control_event event;
-    event.inner.type = 0;
-    event.inner.length = sizeof(event.ctrl);
-    rv = usb_raw_event_fetch(fd, (struct usb_raw_event*)&event);
-    if (rv < 0) {
-      return rv;
-    }
-    if (event.inner.type != USB_RAW_EVENT_CONTROL)
-      continue;
-    char* response_data = NULL;
-    uint32_t response_length = 0;
-    if (event.ctrl.bRequestType & USB_DIR_IN) {
-      if (!lookup_connect_response_in(fd, descs, &event.ctrl, &response_data,
-                                      &response_length)) {
-        usb_raw_ep0_stall(fd);
-        continue;
-      }
-    } else {
-      if (!lookup_connect_response_out(fd, descs, &event.ctrl, &done)) {
-        usb_raw_ep0_stall(fd);
-        continue;
-      }
-      response_data = NULL;
-      response_length = event.ctrl.wLength;
-    }
-    if ((event.ctrl.bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD &&
-        event.ctrl.bRequest == USB_REQ_SET_CONFIGURATION) {
-      rv = configure_device(fd);
-      if (rv < 0) {
-        return rv;
-      }
-    }
-    struct usb_raw_ep_io_data response;
-    response.inner.ep = 0;
-    response.inner.flags = 0;
-    if (response_length > sizeof(response.data))
-      response_length = 0;
-    if (event.ctrl.wLength < response_length)
-      response_length = event.ctrl.wLength;
-    response.inner.length = response_length;
-    if (response_data)
-      memcpy(&response.data[0], response_data, response_length);
-    else
-      memset(&response.data[0], 0, response_length);
-    if (event.ctrl.bRequestType & USB_DIR_IN) {
-      rv = usb_raw_ep0_write(fd, (struct usb_raw_ep_io*)&response);
-    } else {
-      rv = usb_raw_ep0_read(fd, (struct usb_raw_ep_io*)&response);
-    }
-    if (rv < 0) {
-      return rv;
-    }
-  }
-  sleep_ms(200);
-  return fd;
-}
-
-static volatile long syz_usb_connect(volatile long a0, volatile long a1,
-                                     volatile long a2, volatile long a3)
-{
-  uint64_t speed = a0;
-  uint64_t dev_len = a1;
-  const char* dev = (const char*)a2;
-  const struct vusb_connect_descriptors* descs =
-      (const struct vusb_connect_descriptors*)a3;
-  return syz_usb_connect_impl(speed, dev_len, dev, descs,
-                              &lookup_connect_response_out_generic);
-}
-
-static void setup_common()
-{
-  if (mount(0, "/sys/fs/fuse/connections", "fusectl", 0, 0)) {
-  }
-}
-
-static void loop();
-
-static void sandbox_common()
-{
-  prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
-  setsid();
-  struct rlimit rlim;
-  rlim.rlim_cur = rlim.rlim_max = (200 << 20);
-  setrlimit(RLIMIT_AS, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 32 << 20;
-  setrlimit(RLIMIT_MEMLOCK, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 136 << 20;
-  setrlimit(RLIMIT_FSIZE, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 1 << 20;
-  setrlimit(RLIMIT_STACK, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 0;
-  setrlimit(RLIMIT_CORE, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 256;
-  setrlimit(RLIMIT_NOFILE, &rlim);
-  if (unshare(CLONE_NEWNS)) {
-  }
-  if (mount(NULL, "/", NULL, MS_REC | MS_PRIVATE, NULL)) {
-  }
-  if (unshare(CLONE_NEWIPC)) {
-  }
-  if (unshare(0x02000000)) {
-  }
-  if (unshare(CLONE_NEWUTS)) {
-  }
-  if (unshare(CLONE_SYSVSEM)) {
-  }
-  typedef struct {
-    const char* name;
-    const char* value;
-  } sysctl_t;
-  static const sysctl_t sysctls[] = {
-      {"/proc/sys/kernel/shmmax", "16777216"},
-      {"/proc/sys/kernel/shmall", "536870912"},
-      {"/proc/sys/kernel/shmmni", "1024"},
-      {"/proc/sys/kernel/msgmax", "8192"},
-      {"/proc/sys/kernel/msgmni", "1024"},
-      {"/proc/sys/kernel/msgmnb", "1024"},
-      {"/proc/sys/kernel/sem", "1024 1048576 500 1024"},
-  };
-  unsigned i;
-  for (i = 0; i < sizeof(sysctls) / sizeof(sysctls[0]); i++)
-    write_file(sysctls[i].name, sysctls[i].value);
-}
-
-static int wait_for_loop(int pid)
-{
-  if (pid < 0)
-    exit(1);
-  int status = 0;
-  while (waitpid(-1, &status, __WALL) != pid) {
-  }
-  return WEXITSTATUS(status);
-}
-
-static void drop_caps(void)
-{
-  struct __user_cap_header_struct cap_hdr = {};
-  struct __user_cap_data_struct cap_data[2] = {};
-  cap_hdr.version = _LINUX_CAPABILITY_VERSION_3;
-  cap_hdr.pid = getpid();
-  if (syscall(SYS_capget, &cap_hdr, &cap_data))
-    exit(1);
-  const int drop = (1 << CAP_SYS_PTRACE) | (1 << CAP_SYS_NICE);
-  cap_data[0].effective &= ~drop;
-  cap_data[0].permitted &= ~drop;
-  cap_data[0].inheritable &= ~drop;
-  if (syscall(SYS_capset, &cap_hdr, &cap_data))
-    exit(1);
-}
-
-static int do_sandbox_none(void)
-{
-  if (unshare(CLONE_NEWPID)) {
-  }
-  int pid = fork();
-  if (pid != 0)
-    return wait_for_loop(pid);
-  setup_common();
-  sandbox_common();
-  drop_caps();
-  if (unshare(CLONE_NEWNET)) {
-  }
-  initialize_tun();
-  loop();
-  exit(1);
-}
-
-static void close_fds()
-{
-  for (int fd = 3; fd < MAX_FDS; fd++)
-    close(fd);
-}
-
-void loop(void)
+void execute_one(void)
 {
   *(uint8_t*)0x20000000 = 0x12;
   *(uint8_t*)0x20000001 = 1;
@@ -958,11 +39,13 @@ void loop(void)
   syz_usb_connect(0, 0x24, 0x20000000, 0);
   close_fds();
 }
+
 int main(void)
 {
   syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-  do_sandbox_none();
+  syz_features = SYZ_NET_INJECTION;
+  do_sandbox_none(execute_one);
   return 0;
 }
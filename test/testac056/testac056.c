@@ -1,1217 +1,93 @@
-// https://syzkaller.appspot.com/bug?id=ac056d6363bf43a8b9ed3f1023d9907d953d02cf
-// autogenerated by syzkaller (https://github.com/google/syzkaller)
-
-#define _GNU_SOURCE
-
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <pthread.h>
-#include <sched.h>
-#include <stdarg.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/epoll.h>
-#include <sys/ioctl.h>
-#include <sys/mount.h>
-#include <sys/prctl.h>
-#include <sys/resource.h>
-#include <sys/socket.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/time.h>
-#include <sys/types.h>
-#include <sys/uio.h>
-#include <sys/wait.h>
-#include <unistd.h>
-
-#include <linux/capability.h>
-#include <linux/rfkill.h>
-#include <linux/usb/ch9.h>
-
-static unsigned long long procid;
-
-static void sleep_ms(uint64_t ms)
-{
-  usleep(ms * 1000);
-}
-
-static bool write_file(const char* file, const char* what, ...)
-{
-  char buf[1024];
-  va_list args;
-  va_start(args, what);
-  vsnprintf(buf, sizeof(buf), what, args);
-  va_end(args);
-  buf[sizeof(buf) - 1] = 0;
-  int len = strlen(buf);
-  int fd = open(file, O_WRONLY | O_CLOEXEC);
-  if (fd == -1)
-    return false;
-  if (write(fd, buf, len) != len) {
-    int err = errno;
-    close(fd);
-    errno = err;
-    return false;
-  }
-  close(fd);
-  return true;
-}
-
-#define MAX_FDS 30
-
-#define USB_MAX_IFACE_NUM 4
-#define USB_MAX_EP_NUM 32
-#define USB_MAX_FDS 6
-
-struct usb_endpoint_index {
-  struct usb_endpoint_descriptor desc;
-  int handle;
-};
-
-struct usb_iface_index {
-  struct usb_interface_descriptor* iface;
-  uint8_t bInterfaceNumber;
-  uint8_t bAlternateSetting;
-  uint8_t bInterfaceClass;
-  struct usb_endpoint_index eps[USB_MAX_EP_NUM];
-  int eps_num;
-};
-
-struct usb_device_index {
-  struct usb_device_descriptor* dev;
-  struct usb_config_descriptor* config;
-  uint8_t bDeviceClass;
-  uint8_t bMaxPower;
-  int config_length;
-  struct usb_iface_index ifaces[USB_MAX_IFACE_NUM];
-  int ifaces_num;
-  int iface_cur;
-};
-
-struct usb_info {
-  int fd;
-  struct usb_device_index index;
-};
-
-static struct usb_info usb_devices[USB_MAX_FDS];
-static int usb_devices_num;
-
-static bool parse_usb_descriptor(const char* buffer, size_t length,
-                                 struct usb_device_index* index)
-{
-  if (length < sizeof(*index->dev) + sizeof(*index->config))
-    return false;
-  memset(index, 0, sizeof(*index));
-  index->dev = (struct usb_device_descriptor*)buffer;
-  index->config = (struct usb_config_descriptor*)(buffer + sizeof(*index->dev));
-  index->bDeviceClass = index->dev->bDeviceClass;
-  index->bMaxPower = index->config->bMaxPower;
-  index->config_length = length - sizeof(*index->dev);
-  index->iface_cur = -1;
-  size_t offset = 0;
-  while (true) {
-    if (offset + 1 >= length)
-      break;
-    uint8_t desc_length = buffer[offset];
-    uint8_t desc_type = buffer[offset + 1];
-    if (desc_length <= 2)
-      break;
-    if (offset + desc_length > length)
-      break;
-    if (desc_type == USB_DT_INTERFACE &&
-        index->ifaces_num < USB_MAX_IFACE_NUM) {
-      struct usb_interface_descriptor* iface =
-          (struct usb_interface_descriptor*)(buffer + offset);
-      index->ifaces[index->ifaces_num].iface = iface;
-      index->ifaces[index->ifaces_num].bInterfaceNumber =
-          iface->bInterfaceNumber;
-      index->ifaces[index->ifaces_num].bAlternateSetting =
-          iface->bAlternateSetting;
-      index->ifaces[index->ifaces_num].bInterfaceClass = iface->bInterfaceClass;
-      index->ifaces_num++;
-    }
-    if (desc_type == USB_DT_ENDPOINT && index->ifaces_num > 0) {
-      struct usb_iface_index* iface = &index->ifaces[index->ifaces_num - 1];
-      if (iface->eps_num < USB_MAX_EP_NUM) {
-        memcpy(&iface->eps[iface->eps_num].desc, buffer + offset,
-               sizeof(iface->eps[iface->eps_num].desc));
-        iface->eps_num++;
-      }
-    }
-    offset += desc_length;
-  }
-  return true;
-}
-
-static struct usb_device_index* add_usb_index(int fd, const char* dev,
-                                              size_t dev_len)
-{
-  int i = __atomic_fetch_add(&usb_devices_num, 1, __ATOMIC_RELAXED);
-  if (i >= USB_MAX_FDS)
-    return NULL;
-  if (!parse_usb_descriptor(dev, dev_len, &usb_devices[i].index))
-    return NULL;
-  __atomic_store_n(&usb_devices[i].fd, fd, __ATOMIC_RELEASE);
-  return &usb_devices[i].index;
-}
-
-static struct usb_device_index* lookup_usb_index(int fd)
-{
-  for (int i = 0; i < USB_MAX_FDS; i++) {
-    if (__atomic_load_n(&usb_devices[i].fd, __ATOMIC_ACQUIRE) == fd) {
-      return &usb_devices[i].index;
-    }
-  }
-  return NULL;
-}
-
-struct vusb_connect_string_descriptor {
-  uint32_t len;
-  char* str;
-} __attribute__((packed));
-
-struct vusb_connect_descriptors {
-  uint32_t qual_len;
-  char* qual;
-  uint32_t bos_len;
-  char* bos;
-  uint32_t strs_len;
-  struct vusb_connect_string_descriptor strs[0];
-} __attribute__((packed));
-
-static const char default_string[] = {8, USB_DT_STRING, 's', 0, 'y', 0, 'z', 0};
-
-static const char default_lang_id[] = {4, USB_DT_STRING, 0x09, 0x04};
-
-static bool
-lookup_connect_response_in(int fd, const struct vusb_connect_descriptors* descs,
-                           const struct usb_ctrlrequest* ctrl,
-                           char** response_data, uint32_t* response_length)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  uint8_t str_idx;
-  if (!index)
-    return false;
-  switch (ctrl->bRequestType & USB_TYPE_MASK) {
-  case USB_TYPE_STANDARD:
-    switch (ctrl->bRequest) {
-    case USB_REQ_GET_DESCRIPTOR:
-      switch (ctrl->wValue >> 8) {
-      case USB_DT_DEVICE:
-        *response_data = (char*)index->dev;
-        *response_length = sizeof(*index->dev);
-        return true;
-      case USB_DT_CONFIG:
-        *response_data = (char*)index->config;
-        *response_length = index->config_length;
-        return true;
-      case USB_DT_STRING:
-        str_idx = (uint8_t)ctrl->wValue;
-        if (descs && str_idx < descs->strs_len) {
-          *response_data = descs->strs[str_idx].str;
-          *response_length = descs->strs[str_idx].len;
-          return true;
-        }
-        if (str_idx == 0) {
-          *response_data = (char*)&default_lang_id[0];
-          *response_length = default_lang_id[0];
-          return true;
-        }
-        *response_data = (char*)&default_string[0];
-        *response_length = default_string[0];
-        return true;
-      case USB_DT_BOS:
-        *response_data = descs->bos;
-        *response_length = descs->bos_len;
-        return true;
-      case USB_DT_DEVICE_QUALIFIER:
-        if (!descs->qual) {
-          struct usb_qualifier_descriptor* qual =
-              (struct usb_qualifier_descriptor*)response_data;
-          qual->bLength = sizeof(*qual);
-          qual->bDescriptorType = USB_DT_DEVICE_QUALIFIER;
-          qual->bcdUSB = index->dev->bcdUSB;
-          qual->bDeviceClass = index->dev->bDeviceClass;
-          qual->bDeviceSubClass = index->dev->bDeviceSubClass;
-          qual->bDeviceProtocol = index->dev->bDeviceProtocol;
-          qual->bMaxPacketSize0 = index->dev->bMaxPacketSize0;
-          qual->bNumConfigurations = index->dev->bNumConfigurations;
-          qual->bRESERVED = 0;
-          *response_length = sizeof(*qual);
-          return true;
-        }
-        *response_data = descs->qual;
-        *response_length = descs->qual_len;
-        return true;
-      default:
-        break;
-      }
-      break;
-    default:
-      break;
-    }
-    break;
-  default:
-    break;
-  }
-  return false;
-}
-
-typedef bool (*lookup_connect_out_response_t)(
-    int fd, const struct vusb_connect_descriptors* descs,
-    const struct usb_ctrlrequest* ctrl, bool* done);
-
-static bool lookup_connect_response_out_generic(
-    int fd, const struct vusb_connect_descriptors* descs,
-    const struct usb_ctrlrequest* ctrl, bool* done)
-{
-  switch (ctrl->bRequestType & USB_TYPE_MASK) {
-  case USB_TYPE_STANDARD:
-    switch (ctrl->bRequest) {
-    case USB_REQ_SET_CONFIGURATION:
-      *done = true;
-      return true;
-    default:
-      break;
-    }
-    break;
-  }
-  return false;
-}
-
-struct vusb_descriptor {
-  uint8_t req_type;
-  uint8_t desc_type;
-  uint32_t len;
-  char data[0];
-} __attribute__((packed));
-
-struct vusb_descriptors {
-  uint32_t len;
-  struct vusb_descriptor* generic;
-  struct vusb_descriptor* descs[0];
-} __attribute__((packed));
-
-struct vusb_response {
-  uint8_t type;
-  uint8_t req;
-  uint32_t len;
-  char data[0];
-} __attribute__((packed));
-
-struct vusb_responses {
-  uint32_t len;
-  struct vusb_response* generic;
-  struct vusb_response* resps[0];
-} __attribute__((packed));
-
-static bool lookup_control_response(const struct vusb_descriptors* descs,
-                                    const struct vusb_responses* resps,
-                                    struct usb_ctrlrequest* ctrl,
-                                    char** response_data,
-                                    uint32_t* response_length)
-{
-  int descs_num = 0;
-  int resps_num = 0;
-  if (descs)
-    descs_num = (descs->len - offsetof(struct vusb_descriptors, descs)) /
-                sizeof(descs->descs[0]);
-  if (resps)
-    resps_num = (resps->len - offsetof(struct vusb_responses, resps)) /
-                sizeof(resps->resps[0]);
-  uint8_t req = ctrl->bRequest;
-  uint8_t req_type = ctrl->bRequestType & USB_TYPE_MASK;
-  uint8_t desc_type = ctrl->wValue >> 8;
-  if (req == USB_REQ_GET_DESCRIPTOR) {
-    int i;
-    for (i = 0; i < descs_num; i++) {
-      struct vusb_descriptor* desc = descs->descs[i];
-      if (!desc)
-        continue;
-      if (desc->req_type == req_type && desc->desc_type == desc_type) {
-        *response_length = desc->len;
-        if (*response_length != 0)
-          *response_data = &desc->data[0];
-        else
-          *response_data = NULL;
-        return true;
-      }
-    }
-    if (descs && descs->generic) {
-      *response_data = &descs->generic->data[0];
-      *response_length = descs->generic->len;
-      return true;
-    }
-  } else {
-    int i;
-    for (i = 0; i < resps_num; i++) {
-      struct vusb_response* resp = resps->resps[i];
-      if (!resp)
-        continue;
-      if (resp->type == req_type && resp->req == req) {
-        *response_length = resp->len;
-        if (*response_length != 0)
-          *response_data = &resp->data[0];
-        else
-          *response_data = NULL;
-        return true;
-      }
-    }
-    if (resps && resps->generic) {
-      *response_data = &resps->generic->data[0];
-      *response_length = resps->generic->len;
-      return true;
-    }
-  }
-  return false;
-}
-
-#define UDC_NAME_LENGTH_MAX 128
-
-struct usb_raw_init {
-  __u8 driver_name[UDC_NAME_LENGTH_MAX];
-  __u8 device_name[UDC_NAME_LENGTH_MAX];
-  __u8 speed;
-};
-
-enum usb_raw_event_type {
-  USB_RAW_EVENT_INVALID = 0,
-  USB_RAW_EVENT_CONNECT = 1,
-  USB_RAW_EVENT_CONTROL = 2,
-};
-
-struct usb_raw_event {
-  __u32 type;
-  __u32 length;
-  __u8 data[0];
-};
-
-struct usb_raw_ep_io {
-  __u16 ep;
-  __u16 flags;
-  __u32 length;
-  __u8 data[0];
-};
-
-#define USB_RAW_EPS_NUM_MAX 30
-#define USB_RAW_EP_NAME_MAX 16
-#define USB_RAW_EP_ADDR_ANY 0xff
-
-struct usb_raw_ep_caps {
-  __u32 type_control : 1;
-  __u32 type_iso : 1;
-  __u32 type_bulk : 1;
-  __u32 type_int : 1;
-  __u32 dir_in : 1;
-  __u32 dir_out : 1;
-};
-
-struct usb_raw_ep_limits {
-  __u16 maxpacket_limit;
-  __u16 max_streams;
-  __u32 reserved;
-};
-
-struct usb_raw_ep_info {
-  __u8 name[USB_RAW_EP_NAME_MAX];
-  __u32 addr;
-  struct usb_raw_ep_caps caps;
-  struct usb_raw_ep_limits limits;
-};
-
-struct usb_raw_eps_info {
-  struct usb_raw_ep_info eps[USB_RAW_EPS_NUM_MAX];
-};
-
-#define USB_RAW_IOCTL_INIT _IOW('U', 0, struct usb_raw_init)
-#define USB_RAW_IOCTL_RUN _IO('U', 1)
-#define USB_RAW_IOCTL_EVENT_FETCH _IOR('U', 2, struct usb_raw_event)
-#define USB_RAW_IOCTL_EP0_WRITE _IOW('U', 3, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP0_READ _IOWR('U', 4, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP_ENABLE _IOW('U', 5, struct usb_endpoint_descriptor)
-#define USB_RAW_IOCTL_EP_DISABLE _IOW('U', 6, __u32)
-#define USB_RAW_IOCTL_EP_WRITE _IOW('U', 7, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_EP_READ _IOWR('U', 8, struct usb_raw_ep_io)
-#define USB_RAW_IOCTL_CONFIGURE _IO('U', 9)
-#define USB_RAW_IOCTL_VBUS_DRAW _IOW('U', 10, __u32)
-#define USB_RAW_IOCTL_EPS_INFO _IOR('U', 11, struct usb_raw_eps_info)
-#define USB_RAW_IOCTL_EP0_STALL _IO('U', 12)
-#define USB_RAW_IOCTL_EP_SET_HALT _IOW('U', 13, __u32)
-#define USB_RAW_IOCTL_EP_CLEAR_HALT _IOW('U', 14, __u32)
-#define USB_RAW_IOCTL_EP_SET_WEDGE _IOW('U', 15, __u32)
-
-static int usb_raw_open()
-{
-  return open("/dev/raw-gadget", O_RDWR);
-}
-
-static int usb_raw_init(int fd, uint32_t speed, const char* driver,
-                        const char* device)
-{
-  struct usb_raw_init arg;
-  strncpy((char*)&arg.driver_name[0], driver, sizeof(arg.driver_name));
-  strncpy((char*)&arg.device_name[0], device, sizeof(arg.device_name));
-  arg.speed = speed;
-  return ioctl(fd, USB_RAW_IOCTL_INIT, &arg);
-}
-
-static int usb_raw_run(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_RUN, 0);
-}
-
-static int usb_raw_event_fetch(int fd, struct usb_raw_event* event)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EVENT_FETCH, event);
-}
-
-static int usb_raw_ep0_write(int fd, struct usb_raw_ep_io* io)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_WRITE, io);
-}
-
-static int usb_raw_ep0_read(int fd, struct usb_raw_ep_io* io)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_READ, io);
-}
-
-static int usb_raw_ep_enable(int fd, struct usb_endpoint_descriptor* desc)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP_ENABLE, desc);
-}
-
-static int usb_raw_ep_disable(int fd, int ep)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP_DISABLE, ep);
-}
-
-static int usb_raw_configure(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_CONFIGURE, 0);
-}
-
-static int usb_raw_vbus_draw(int fd, uint32_t power)
-{
-  return ioctl(fd, USB_RAW_IOCTL_VBUS_DRAW, power);
-}
-
-static int usb_raw_ep0_stall(int fd)
-{
-  return ioctl(fd, USB_RAW_IOCTL_EP0_STALL, 0);
-}
-
-static int lookup_interface(int fd, uint8_t bInterfaceNumber,
-                            uint8_t bAlternateSetting)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  if (!index)
-    return -1;
-  for (int i = 0; i < index->ifaces_num; i++) {
-    if (index->ifaces[i].bInterfaceNumber == bInterfaceNumber &&
-        index->ifaces[i].bAlternateSetting == bAlternateSetting)
-      return i;
-  }
-  return -1;
-}
-
-static void set_interface(int fd, int n)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  if (!index)
-    return;
-  if (index->iface_cur >= 0 && index->iface_cur < index->ifaces_num) {
-    for (int ep = 0; ep < index->ifaces[index->iface_cur].eps_num; ep++) {
-      int rv = usb_raw_ep_disable(
-          fd, index->ifaces[index->iface_cur].eps[ep].handle);
-      if (rv < 0) {
-      } else {
-      }
-    }
-  }
-  if (n >= 0 && n < index->ifaces_num) {
-    for (int ep = 0; ep < index->ifaces[n].eps_num; ep++) {
-      int rv = usb_raw_ep_enable(fd, &index->ifaces[n].eps[ep].desc);
-      if (rv < 0) {
-      } else {
-        index->ifaces[n].eps[ep].handle = rv;
-      }
-    }
-    index->iface_cur = n;
-  }
-}
-
-static int configure_device(int fd)
-{
-  struct usb_device_index* index = lookup_usb_index(fd);
-  if (!index)
-    return -1;
-  int rv = usb_raw_vbus_draw(fd, index->bMaxPower);
-  if (rv < 0) {
-    return rv;
-  }
-  rv = usb_raw_configure(fd);
-  if (rv < 0) {
-    return rv;
-  }
-  set_interface(fd, 0);
-  return 0;
-}
-
-#define USB_MAX_PACKET_SIZE 4096
-
-struct usb_raw_control_event {
-  struct usb_raw_event inner;
-  struct usb_ctrlrequest ctrl;
-  char data[USB_MAX_PACKET_SIZE];
-};
-
-struct usb_raw_ep_io_data {
-  struct usb_raw_ep_io inner;
-  char data[USB_MAX_PACKET_SIZE];
-};
-
-static volatile long
-syz_usb_connect_impl(uint64_t speed, uint64_t dev_len, const char* dev,
-                     const struct vusb_connect_descriptors* descs,
-                     lookup_connect_out_response_t lookup_connect_response_out)
-{
-  if (!dev) {
-    return -1;
-  }
-  int fd = usb_raw_open();
-  if (fd < 0) {
-    return fd;
-  }
-  if (fd >= MAX_FDS) {
-    close(fd);
-    return -1;
-  }
-  struct usb_device_index* index = add_usb_index(fd, dev, dev_len);
-  if (!index) {
-    return -1;
-  }
-  char device[32];
-  sprintf(&device[0], "dummy_udc.%llu", procid);
-  int rv = usb_raw_init(fd, speed, "dummy_udc", &device[0]);
-  if (rv < 0) {
-    return rv;
-  }
-  rv = usb_raw_run(fd);
-  if (rv < 0) {
-    return rv;
-  }
-  bool done = false;
-  while (!done) {
-    struct usb_raw_control_event event;
-    event.inner.type = 0;
-    event.inner.length = sizeof(event.ctrl);
-    rv = usb_raw_event_fetch(fd, (struct usb_raw_event*)&event);
-    if (rv < 0) {
-      return rv;
-    }
-    if (event.inner.type != USB_RAW_EVENT_CONTROL)
-      continue;
-    char* response_data = NULL;
-    uint32_t response_length = 0;
-    if (event.ctrl.bRequestType & USB_DIR_IN) {
-      if (!lookup_connect_response_in(fd, descs, &event.ctrl, &response_data,
-                                      &response_length)) {
-        usb_raw_ep0_stall(fd);
-        continue;
-      }
-    } else {
-      if (!lookup_connect_response_out(fd, descs, &event.ctrl, &done)) {
-        usb_raw_ep0_stall(fd);
-        continue;
-      }
-      response_data = NULL;
-      response_length = event.ctrl.wLength;
-    }
-    if ((event.ctrl.bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD &&
-        event.ctrl.bRequest == USB_REQ_SET_CONFIGURATION) {
-      rv = configure_device(fd);
-      if (rv < 0) {
-        return rv;
-      }
-    }
-    struct usb_raw_ep_io_data response;
-    response.inner.ep = 0;
-    response.inner.flags = 0;
-    if (response_length > sizeof(response.data))
-      response_length = 0;
-    if (event.ctrl.wLength < response_length)
-      response_length = event.ctrl.wLength;
-    response.inner.length = response_length;
-    if (response_data)
-      memcpy(&response.data[0], response_data, response_length);
-    else
-      memset(&response.data[0], 0, response_length);
-    if (event.ctrl.bRequestType & USB_DIR_IN) {
-      rv = usb_raw_ep0_write(fd, (struct usb_raw_ep_io*)&response);
-    } else {
-      rv = usb_raw_ep0_read(fd, (struct usb_raw_ep_io*)&response);
-    }
-    if (rv < 0) {
-      return rv;
-    }
-  }
-  sleep_ms(200);
-  return fd;
-}
-
-static volatile long syz_usb_connect(volatile long a0, volatile long a1,
-                                     volatile long a2, volatile long a3)
-{
-  uint64_t speed = a0;
-  uint64_t dev_len = a1;
-  const char* dev = (const char*)a2;
-  const struct vusb_connect_descriptors* descs =
-      (const struct vusb_connect_descriptors*)a3;
-  return syz_usb_connect_impl(speed, dev_len, dev, descs,
-                              &lookup_connect_response_out_generic);
-}
-
-static volatile long syz_usb_control_io(volatile long a0, volatile long a1,
-                                        volatile long a2)
-{
-  int fd = a0;
-  const struct vusb_descriptors* descs = (const struct vusb_descriptors*)a1;
-  const struct vusb_responses* resps = (const struct vusb_responses*)a2;
-  struct usb_raw_control_event event;
-  event.inner.type = 0;
-  event.inner.length = USB_MAX_PACKET_SIZE;
-  int rv = usb_raw_event_fetch(fd, (struct usb_raw_event*)&event);
-  if (rv < 0) {
-    return rv;
-  }
-  if (event.inner.type != USB_RAW_EVENT_CONTROL) {
-    return -1;
-  }
-  char* response_data = NULL;
-  uint32_t response_length = 0;
-  if ((event.ctrl.bRequestType & USB_DIR_IN) && event.ctrl.wLength) {
-    if (!lookup_control_response(descs, resps, &event.ctrl, &response_data,
-                                 &response_length)) {
-      usb_raw_ep0_stall(fd);
-      return -1;
-    }
-  } else {
-    if ((event.ctrl.bRequestType & USB_TYPE_MASK) == USB_TYPE_STANDARD ||
-        event.ctrl.bRequest == USB_REQ_SET_INTERFACE) {
-      int iface_num = event.ctrl.wIndex;
-      int alt_set = event.ctrl.wValue;
-      int iface_index = lookup_interface(fd, iface_num, alt_set);
-      if (iface_index < 0) {
-      } else {
-        set_interface(fd, iface_index);
-      }
-    }
-    response_length = event.ctrl.wLength;
-  }
-  struct usb_raw_ep_io_data response;
-  response.inner.ep = 0;
-  response.inner.flags = 0;
-  if (response_length > sizeof(response.data))
-    response_length = 0;
-  if (event.ctrl.wLength < response_length)
-    response_length = event.ctrl.wLength;
-  if ((event.ctrl.bRequestType & USB_DIR_IN) && !event.ctrl.wLength) {
-    response_length = USB_MAX_PACKET_SIZE;
-  }
-  response.inner.length = response_length;
-  if (response_data)
-    memcpy(&response.data[0], response_data, response_length);
-  else
-    memset(&response.data[0], 0, response_length);
-  if ((event.ctrl.bRequestType & USB_DIR_IN) && event.ctrl.wLength) {
-    rv = usb_raw_ep0_write(fd, (struct usb_raw_ep_io*)&response);
-  } else {
-    rv = usb_raw_ep0_read(fd, (struct usb_raw_ep_io*)&response);
-  }
-  if (rv < 0) {
-    return rv;
-  }
-  sleep_ms(200);
-  return 0;
-}
-
-#define BTPROTO_HCI 1
-#define ACL_LINK 1
-#define SCAN_PAGE 2
-
-typedef struct {
-  uint8_t b[6];
-} __attribute__((packed)) bdaddr_t;
-
-#define HCI_COMMAND_PKT 1
-#define HCI_EVENT_PKT 4
-#define HCI_VENDOR_PKT 0xff
-
-struct hci_command_hdr {
-  uint16_t opcode;
-  uint8_t plen;
-} __attribute__((packed));
-
-struct hci_event_hdr {
-  uint8_t evt;
-  uint8_t plen;
-} __attribute__((packed));
-
-#define HCI_EV_CONN_COMPLETE 0x03
-struct hci_ev_conn_complete {
-  uint8_t status;
-  uint16_t handle;
-  bdaddr_t bdaddr;
-  uint8_t link_type;
-  uint8_t encr_mode;
-} __attribute__((packed));
-
-#define HCI_EV_CONN_REQUEST 0x04
-struct hci_ev_conn_request {
-  bdaddr_t bdaddr;
-  uint8_t dev_class[3];
-  uint8_t link_type;
-} __attribute__((packed));
-
-#define HCI_EV_REMOTE_FEATURES 0x0b
-struct hci_ev_remote_features {
-  uint8_t status;
-  uint16_t handle;
-  uint8_t features[8];
-} __attribute__((packed));
-
-#define HCI_EV_CMD_COMPLETE 0x0e
-struct hci_ev_cmd_complete {
-  uint8_t ncmd;
-  uint16_t opcode;
-} __attribute__((packed));
-
-#define HCI_OP_WRITE_SCAN_ENABLE 0x0c1a
-
-#define HCI_OP_READ_BUFFER_SIZE 0x1005
-struct hci_rp_read_buffer_size {
-  uint8_t status;
-  uint16_t acl_mtu;
-  uint8_t sco_mtu;
-  uint16_t acl_max_pkt;
-  uint16_t sco_max_pkt;
-} __attribute__((packed));
-
-#define HCI_OP_READ_BD_ADDR 0x1009
-struct hci_rp_read_bd_addr {
-  uint8_t status;
-  bdaddr_t bdaddr;
-} __attribute__((packed));
-
-#define HCI_EV_LE_META 0x3e
-struct hci_ev_le_meta {
-  uint8_t subevent;
-} __attribute__((packed));
-
-#define HCI_EV_LE_CONN_COMPLETE 0x01
-struct hci_ev_le_conn_complete {
-  uint8_t status;
-  uint16_t handle;
-  uint8_t role;
-  uint8_t bdaddr_type;
-  bdaddr_t bdaddr;
-  uint16_t interval;
-  uint16_t latency;
-  uint16_t supervision_timeout;
-  uint8_t clk_accurancy;
-} __attribute__((packed));
-
-struct hci_dev_req {
-  uint16_t dev_id;
-  uint32_t dev_opt;
-};
-
-struct vhci_vendor_pkt {
-  uint8_t type;
-  uint8_t opcode;
-  uint16_t id;
-};
-
-#define HCIDEVUP _IOW('H', 201, int)
-#define HCISETSCAN _IOW('H', 221, int)
-
-static int vhci_fd = -1;
-
-static void rfkill_unblock_all()
-{
-  int fd = open("/dev/rfkill", O_WRONLY);
-  if (fd < 0)
-    exit(1);
-  struct rfkill_event event = {0};
-  event.idx = 0;
-  event.type = RFKILL_TYPE_ALL;
-  event.op = RFKILL_OP_CHANGE_ALL;
-  event.soft = 0;
-  event.hard = 0;
-  if (write(fd, &event, sizeof(event)) < 0)
-    exit(1);
-  close(fd);
-}
-
-static void hci_send_event_packet(int fd, uint8_t evt, void* data,
-                                  size_t data_len)
-{
-  struct iovec iv[3];
-  struct hci_event_hdr hdr;
-  hdr.evt = evt;
-  hdr.plen = data_len;
-  uint8_t type = HCI_EVENT_PKT;
-  iv[0].iov_base = &type;
-  iv[0].iov_len = sizeof(type);
-  iv[1].iov_base = &hdr;
-  iv[1].iov_len = sizeof(hdr);
-  iv[2].iov_base = data;
-  iv[2].iov_len = data_len;
-  if (writev(fd, iv, sizeof(iv) / sizeof(struct iovec)) < 0)
-    exit(1);
-}
-
-static void hci_send_event_cmd_complete(int fd, uint16_t opcode, void* data,
-                                        size_t data_len)
-{
-  struct iovec iv[4];
-  struct hci_event_hdr hdr;
-  hdr.evt = HCI_EV_CMD_COMPLETE;
-  hdr.plen = sizeof(struct hci_ev_cmd_complete) + data_len;
-  struct hci_ev_cmd_complete evt_hdr;
-  evt_hdr.ncmd = 1;
-  evt_hdr.opcode = opcode;
-  uint8_t type = HCI_EVENT_PKT;
-  iv[0].iov_base = &type;
-  iv[0].iov_len = sizeof(type);
-  iv[1].iov_base = &hdr;
-  iv[1].iov_len = sizeof(hdr);
-  iv[2].iov_base = &evt_hdr;
-  iv[2].iov_len = sizeof(evt_hdr);
-  iv[3].iov_base = data;
-  iv[3].iov_len = data_len;
-  if (writev(fd, iv, sizeof(iv) / sizeof(struct iovec)) < 0)
-    exit(1);
-}
-
-static bool process_command_pkt(int fd, char* buf, ssize_t buf_size)
-{
-  struct hci_command_hdr* hdr = (struct hci_command_hdr*)buf;
-  if (buf_size < (ssize_t)sizeof(struct hci_command_hdr) ||
-      hdr->plen != buf_size - sizeof(struct hci_command_hdr)) {
-    exit(1);
-  }
-  switch (hdr->opcode) {
-  case HCI_OP_WRITE_SCAN_ENABLE: {
-    uint8_t status = 0;
-    hci_send_event_cmd_complete(fd, hdr->opcode, &status, sizeof(status));
-    return true;
-  }
-  case HCI_OP_READ_BD_ADDR: {
-    struct hci_rp_read_bd_addr rp = {0};
-    rp.status = 0;
-    memset(&rp.bdaddr, 0xaa, 6);
-    hci_send_event_cmd_complete(fd, hdr->opcode, &rp, sizeof(rp));
-    return false;
-  }
-  case HCI_OP_READ_BUFFER_SIZE: {
-    struct hci_rp_read_buffer_size rp = {0};
-    rp.status = 0;
-    rp.acl_mtu = 1021;
-    rp.sco_mtu = 96;
-    rp.acl_max_pkt = 4;
-    rp.sco_max_pkt = 6;
-    hci_send_event_cmd_complete(fd, hdr->opcode, &rp, sizeof(rp));
-    return false;
-  }
-  }
-  char dummy[0xf9] = {0};
-  hci_send_event_cmd_complete(fd, hdr->opcode, dummy, sizeof(dummy));
-  return false;
-}
-
-static void* event_thread(void* arg)
-{
-  while (1) {
-    char buf[1024] = {0};
-    ssize_t buf_size = read(vhci_fd, buf, sizeof(buf));
-    if (buf_size < 0)
-      exit(1);
-    if (buf_size > 0 && buf[0] == HCI_COMMAND_PKT) {
-      if (process_command_pkt(vhci_fd, buf + 1, buf_size - 1))
-        break;
-    }
-  }
-  return NULL;
-}
-#define HCI_HANDLE_1 200
-#define HCI_HANDLE_2 201
-
-static void initialize_vhci()
-{
-  int hci_sock = socket(AF_BLUETOOTH, SOCK_RAW, BTPROTO_HCI);
-  if (hci_sock < 0)
-    exit(1);
-  vhci_fd = open("/dev/vhci", O_RDWR);
-  if (vhci_fd == -1)
-    exit(1);
-  const int kVhciFd = 241;
-  if (dup2(vhci_fd, kVhciFd) < 0)
-    exit(1);
-  close(vhci_fd);
-  vhci_fd = kVhciFd;
-  struct vhci_vendor_pkt vendor_pkt;
-  if (read(vhci_fd, &vendor_pkt, sizeof(vendor_pkt)) != sizeof(vendor_pkt))
-    exit(1);
-  if (vendor_pkt.type != HCI_VENDOR_PKT)
-    exit(1);
-  pthread_t th;
-  if (pthread_create(&th, NULL, event_thread, NULL))
-    exit(1);
-  int ret = ioctl(hci_sock, HCIDEVUP, vendor_pkt.id);
-  if (ret) {
-    if (errno == ERFKILL) {
-      rfkill_unblock_all();
-      ret = ioctl(hci_sock, HCIDEVUP, vendor_pkt.id);
-    }
-    if (ret && errno != EALREADY)
-      exit(1);
-  }
-  struct hci_dev_req dr = {0};
-  dr.dev_id = vendor_pkt.id;
-  dr.dev_opt = SCAN_PAGE;
-  if (ioctl(hci_sock, HCISETSCAN, &dr))
-    exit(1);
-  struct hci_ev_conn_request request;
-  memset(&request, 0, sizeof(request));
-  memset(&request.bdaddr, 0xaa, 6);
-  *(uint8_t*)&request.bdaddr.b[5] = 0x10;
-  request.link_type = ACL_LINK;
-  hci_send_event_packet(vhci_fd, HCI_EV_CONN_REQUEST, &request,
-                        sizeof(request));
-  struct hci_ev_conn_complete complete;
-  memset(&complete, 0, sizeof(complete));
-  complete.status = 0;
-  complete.handle = HCI_HANDLE_1;
-  memset(&complete.bdaddr, 0xaa, 6);
-  *(uint8_t*)&complete.bdaddr.b[5] = 0x10;
-  complete.link_type = ACL_LINK;
-  complete.encr_mode = 0;
-  hci_send_event_packet(vhci_fd, HCI_EV_CONN_COMPLETE, &complete,
-                        sizeof(complete));
-  struct hci_ev_remote_features features;
-  memset(&features, 0, sizeof(features));
-  features.status = 0;
-  features.handle = HCI_HANDLE_1;
-  hci_send_event_packet(vhci_fd, HCI_EV_REMOTE_FEATURES, &features,
-                        sizeof(features));
-  struct {
-    struct hci_ev_le_meta le_meta;
-    struct hci_ev_le_conn_complete le_conn;
-  } le_conn;
-  memset(&le_conn, 0, sizeof(le_conn));
-  le_conn.le_meta.subevent = HCI_EV_LE_CONN_COMPLETE;
-  memset(&le_conn.le_conn.bdaddr, 0xaa, 6);
-  *(uint8_t*)&le_conn.le_conn.bdaddr.b[5] = 0x11;
-  le_conn.le_conn.role = 1;
-  le_conn.le_conn.handle = HCI_HANDLE_2;
-  hci_send_event_packet(vhci_fd, HCI_EV_LE_META, &le_conn, sizeof(le_conn));
-  pthread_join(th, NULL);
-  close(hci_sock);
-}
-
-static void setup_common()
-{
-  if (mount(0, "/sys/fs/fuse/connections", "fusectl", 0, 0)) {
-  }
-}
-
-static void loop();
-
-static void sandbox_common()
-{
-  prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
-  setsid();
-  struct rlimit rlim;
-  rlim.rlim_cur = rlim.rlim_max = (200 << 20);
-  setrlimit(RLIMIT_AS, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 32 << 20;
-  setrlimit(RLIMIT_MEMLOCK, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 136 << 20;
-  setrlimit(RLIMIT_FSIZE, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 1 << 20;
-  setrlimit(RLIMIT_STACK, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 0;
-  setrlimit(RLIMIT_CORE, &rlim);
-  rlim.rlim_cur = rlim.rlim_max = 256;
-  setrlimit(RLIMIT_NOFILE, &rlim);
-  if (unshare(CLONE_NEWNS)) {
-  }
-  if (mount(NULL, "/", NULL, MS_REC | MS_PRIVATE, NULL)) {
-  }
-  if (unshare(CLONE_NEWIPC)) {
-  }
-  if (unshare(0x02000000)) {
-  }
-  if (unshare(CLONE_NEWUTS)) {
-  }
-  if (unshare(CLONE_SYSVSEM)) {
-  }
-  typedef struct {
-    const char* name;
-    const char* value;
-  } sysctl_t;
-  static const sysctl_t sysctls[] = {
-      {"/proc/sys/kernel/shmmax", "16777216"},
-      {"/proc/sys/kernel/shmall", "536870912"},
-      {"/proc/sys/kernel/shmmni", "1024"},
-      {"/proc/sys/kernel/msgmax", "8192"},
-      {"/proc/sys/kernel/msgmni", "1024"},
-      {"/proc/sys/kernel/msgmnb", "1024"},
-      {"/proc/sys/kernel/sem", "1024 1048576 500 1024"},
-  };
-  unsigned i;
-  for (i = 0; i < sizeof(sysctls) / sizeof(sysctls[0]); i++)
-    write_file(sysctls[i].name, sysctls[i].value);
-}
-
-static int wait_for_loop(int pid)
-{
-  if (pid < 0)
-    exit(1);
-  int status = 0;
-  while (waitpid(-1, &status, __WALL) != pid) {
-  }
-  return WEXITSTATUS(status);
-}
-
-static void drop_caps(void)
-{
-  struct __user_cap_header_struct cap_hdr = {};
-  struct __user_cap_data_struct cap_data[2] = {};
-  cap_hdr.version = _LINUX_CAPABILITY_VERSION_3;
-  cap_hdr.pid = getpid();
-  if (syscall(SYS_capget, &cap_hdr, &cap_data))
-    exit(1);
-  const int drop = (1 << CAP_SYS_PTRACE) | (1 << CAP_SYS_NICE);
-  cap_data[0].effective &= ~drop;
-  cap_data[0].permitted &= ~drop;
-  cap_data[0].inheritable &= ~drop;
-  if (syscall(SYS_capset, &cap_hdr, &cap_data))
-    exit(1);
-}
-
-static int do_sandbox_none(void)
-{
-  if (unshare(CLONE_NEWPID)) {
-  }
-  int pid = fork();
-  if (pid != 0)
-    return wait_for_loop(pid);
-  setup_common();
-  initialize_vhci();
-  sandbox_common();
-  drop_caps();
-  if (unshare(CLONE_NEWNET)) {
-  }
-  loop();
-  exit(1);
-}
-
-static void close_fds()
-{
-  for (int fd = 3; fd < MAX_FDS; fd++)
-    close(fd);
-}
-
-uint64_t r[1] = {0xffffffffffffffff};
-
-void loop(void)
-{
-  intptr_t res = 0;
-  *(uint8_t*)0x200000c0 = 0x12;
-  *(uint8_t*)0x200000c1 = 1;
-  *(uint16_t*)0x200000c2 = 0;
-  *(uint8_t*)0x200000c4 = 0xe9;
-  *(uint8_t*)0x200000c5 = 0x5d;
-  *(uint8_t*)0x200000c6 = 0x97;
-  *(uint8_t*)0x200000c7 = 8;
-  *(uint16_t*)0x200000c8 = 0x403;
-  *(uint16_t*)0x200000ca = 0x6010;
-  *(uint16_t*)0x200000cc = 0xca64;
-  *(uint8_t*)0x200000ce = 0;
-  *(uint8_t*)0x200000cf = 0;
-  *(uint8_t*)0x200000d0 = 0;
-  *(uint8_t*)0x200000d1 = 1;
-  *(uint8_t*)0x200000d2 = 9;
-  *(uint8_t*)0x200000d3 = 2;
-  *(uint16_t*)0x200000d4 = 0x12;
-  *(uint8_t*)0x200000d6 = 1;
-  *(uint8_t*)0x200000d7 = 0;
-  *(uint8_t*)0x200000d8 = 0;
-  *(uint8_t*)0x200000d9 = 0;
-  *(uint8_t*)0x200000da = 0;
-  *(uint8_t*)0x200000db = 9;
-  *(uint8_t*)0x200000dc = 4;
-  *(uint8_t*)0x200000dd = 0;
-  *(uint8_t*)0x200000de = 0;
-  *(uint8_t*)0x200000df = 0;
-  *(uint8_t*)0x200000e0 = 0x78;
-  *(uint8_t*)0x200000e1 = 0xad;
-  *(uint8_t*)0x200000e2 = 0x81;
-  *(uint8_t*)0x200000e3 = 0;
-  res = -1;
-  res = syz_usb_connect(0, 0x24, 0x200000c0, 0);
-  if (res != -1)
-    r[0] = res;
-  syz_usb_control_io(r[0], 0, 0);
-  syz_usb_control_io(r[0], 0, 0);
-  *(uint32_t*)0x20000840 = 0x84;
-  *(uint64_t*)0x20000844 = 0x20000300;
-  *(uint8_t*)0x20000300 = 0;
-  *(uint8_t*)0x20000301 = 0;
-  *(uint32_t*)0x20000302 = 2;
-  memcpy((void*)0x20000306, "\x87\x08", 2);
-  *(uint64_t*)0x2000084c = 0;
-  *(uint64_t*)0x20000854 = 0;
-  *(uint64_t*)0x2000085c = 0;
-  *(uint64_t*)0x20000864 = 0;
-  *(uint64_t*)0x2000086c = 0;
-  *(uint64_t*)0x20000874 = 0;
-  *(uint64_t*)0x2000087c = 0;
-  *(uint64_t*)0x20000884 = 0;
-  *(uint64_t*)0x2000088c = 0;
-  *(uint64_t*)0x20000894 = 0;
-  *(uint64_t*)0x2000089c = 0;
-  *(uint64_t*)0x200008a4 = 0;
-  *(uint64_t*)0x200008ac = 0;
-  *(uint64_t*)0x200008b4 = 0;
-  *(uint64_t*)0x200008bc = 0;
-  syz_usb_control_io(r[0], 0, 0x20000840);
-  *(uint32_t*)0x200007c0 = 0x34;
-  *(uint64_t*)0x200007c4 = 0x200005c0;
-  *(uint8_t*)0x200005c0 = 0;
-  *(uint8_t*)0x200005c1 = 0;
-  *(uint32_t*)0x200005c2 = 2;
-  memcpy((void*)0x200005c6, "\x9c\xa8", 2);
-  *(uint64_t*)0x200007cc = 0;
-  *(uint64_t*)0x200007d4 = 0;
-  *(uint64_t*)0x200007dc = 0;
-  *(uint64_t*)0x200007e4 = 0;
-  *(uint64_t*)0x200007ec = 0;
-  syz_usb_control_io(r[0], 0, 0x200007c0);
-  close_fds();
-}
-int main(void)
-{
-  syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-  syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
-  syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-  do_sandbox_none();
-  return 0;
-}
\ No newline at end of file
+// https://syzkaller.appspot.com/bug?id=ac056d6363bf43a8b9ed3f1023d9907d953d02cf
+// autogenerated by syzkaller (https://github.com/google/syzkaller)
+
+#include "syz.h"
+
+uint64_t r[1] = {0xffffffffffffffff};
+
+void execute_one(void)
+{
+  intptr_t res = 0;
+  *(uint8_t*)0x200000c0 = 0x12;
+  *(uint8_t*)0x200000c1 = 1;
+  *(uint16_t*)0x200000c2 = 0;
+  *(uint8_t*)0x200000c4 = 0xe9;
+  *(uint8_t*)0x200000c5 = 0x5d;
+  *(uint8_t*)0x200000c6 = 0x97;
+  *(uint8_t*)0x200000c7 = 8;
+  *(uint16_t*)0x200000c8 = 0x403;
+  *(uint16_t*)0x200000ca = 0x6010;
+  *(uint16_t*)0x200000cc = 0xca64;
+  *(uint8_t*)0x200000ce = 0;
+  *(uint8_t*)0x200000cf = 0;
+  *(uint8_t*)0x200000d0 = 0;
+  *(uint8_t*)0x200000d1 = 1;
+  *(uint8_t*)0x200000d2 = 9;
+  *(uint8_t*)0x200000d3 = 2;
+  *(uint16_t*)0x200000d4 = 0x12;
+  *(uint8_t*)0x200000d6 = 1;
+  *(uint8_t*)0x200000d7 = 0;
+  *(uint8_t*)0x200000d8 = 0;
+  *(uint8_t*)0x200000d9 = 0;
+  *(uint8_t*)0x200000da = 0;
+  *(uint8_t*)0x200000db = 9;
+  *(uint8_t*)0x200000dc = 4;
+  *(uint8_t*)0x200000dd = 0;
+  *(uint8_t*)0x200000de = 0;
+  *(uint8_t*)0x200000df = 0;
+  *(uint8_t*)0x200000e0 = 0x78;
+  *(uint8_t*)0x200000e1 = 0xad;
+  *(uint8_t*)0x200000e2 = 0x81;
+  *(uint8_t*)0x200000e3 = 0;
+  res = -1;
+  res = syz_usb_connect(0, 0x24, 0x200000c0, 0);
+  if (res != -1)
+    r[0] = res;
+  syz_usb_control_io(r[0], 0, 0);
+  syz_usb_control_io(r[0], 0, 0);
+  *(uint32_t*)0x20000840 = 0x84;
+  *(uint64_t*)0x20000844 = 0x20000300;
+  *(uint8_t*)0x20000300 = 0;
+  *(uint8_t*)0x20000301 = 0;
+  *(uint32_t*)0x20000302 = 2;
+  memcpy((void*)0x20000306, "\x87\x08", 2);
+  *(uint64_t*)0x2000084c = 0;
+  *(uint64_t*)0x20000854 = 0;
+  *(uint64_t*)0x2000085c = 0;
+  *(uint64_t*)0x20000864 = 0;
+  *(uint64_t*)0x2000086c = 0;
+  *(uint64_t*)0x20000874 = 0;
+  *(uint64_t*)0x2000087c = 0;
+  *(uint64_t*)0x20000884 = 0;
+  *(uint64_t*)0x2000088c = 0;
+  *(uint64_t*)0x20000894 = 0;
+  *(uint64_t*)0x2000089c = 0;
+  *(uint64_t*)0x200008a4 = 0;
+  *(uint64_t*)0x200008ac = 0;
+  *(uint64_t*)0x200008b4 = 0;
+  *(uint64_t*)0x200008bc = 0;
+  syz_usb_control_io(r[0], 0, 0x20000840);
+  *(uint32_t*)0x200007c0 = 0x34;
+  *(uint64_t*)0x200007c4 = 0x200005c0;
+  *(uint8_t*)0x200005c0 = 0;
+  *(uint8_t*)0x200005c1 = 0;
+  *(uint32_t*)0x200005c2 = 2;
+  memcpy((void*)0x200005c6, "\x9c\xa8", 2);
+  *(uint64_t*)0x200007cc = 0;
+  *(uint64_t*)0x200007d4 = 0;
+  *(uint64_t*)0x200007dc = 0;
+  *(uint64_t*)0x200007e4 = 0;
+  *(uint64_t*)0x200007ec = 0;
+  syz_usb_control_io(r[0], 0, 0x200007c0);
+  close_fds();
+}
+
+int main(void)
+{
+  syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
+  syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
+  syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
+  syz_features = SYZ_VHCI;
+  do_sandbox_none(execute_one);
+  return 0;
+}
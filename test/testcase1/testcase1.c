@@ -1,16 +1,7 @@
 // https://syzkaller.appspot.com/bug?id=91f769e6299331f7ab779fb44b4c269de4512e7b
 // autogenerated by syzkaller (https://github.com/google/syzkaller)
 
-#define _GNU_SOURCE
-
-#include <endian.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <unistd.h>
+#include "syz.h"
 
 uint64_t r[2] = {0xffffffffffffffff, 0xffffffffffffffff};
 
@@ -1,81 +1,4 @@
-#define _GNU_SOURCE
-
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <stdarg.h>
-#include <stdbool.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <unistd.h>
-
-#define BITMASK(bf_off, bf_len) (((1ull << (bf_len)) - 1) << (bf_off))
-#define STORE_BY_BITMASK(type, htobe, addr, val, bf_off, bf_len)               \
-  *(type*)(addr) =                                                             \
-      htobe((htobe(*(type*)(addr)) & ~BITMASK((bf_off), (bf_len))) |           \
-            (((type)(val) << (bf_off)) & BITMASK((bf_off), (bf_len))))
-
-static bool write_file(const char* file, const char* what, ...)
-{
-  char buf[1024];
-  va_list args;
-  va_start(args, what);
-  vsnprintf(buf, sizeof(buf), what, args);
-  va_end(args);
-  buf[sizeof(buf) - 1] = 0;
-  int len = strlen(buf);
-  int fd = open(file, O_WRONLY | O_CLOEXEC);
-  if (fd == -1)
-    return false;
-  if (write(fd, buf, len) != len) {
-    int err = errno;
-    close(fd);
-    errno = err;
-    return false;
-  }
-  close(fd);
-  return true;
-}
-
-static int inject_fault(int nth)
-{
-  int fd;
-  fd = open("/proc/thread-self/fail-nth", O_RDWR);
-  if (fd == -1)
-    exit(1);
-  char buf[16];
-  sprintf(buf, "%d", nth);
-  if (write(fd, buf, strlen(buf)) != (ssize_t)strlen(buf))
-    exit(1);
-  return fd;
-}
-
-static void setup_fault()
-{
-  static struct {
-    const char* file;
-    const char* val;
-    bool fatal;
-  } files[] = {
-      {"/sys/kernel/debug/failslab/ignore-gfp-wait", "N", true},
-      {"/sys/kernel/debug/fail_futex/ignore-private", "N", false},
-      {"/sys/kernel/debug/fail_page_alloc/ignore-gfp-highmem", "N", false},
-      {"/sys/kernel/debug/fail_page_alloc/ignore-gfp-wait", "N", false},
-      {"/sys/kernel/debug/fail_page_alloc/min-order", "0", false},
-  };
-  unsigned i;
-  for (i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
-    if (!write_file(files[i].file, files[i].val)) {
-      if (files[i].fatal)
-        exit(1);
-    }
-  }
-}
+#include "syz.h"
 
 uint64_t r[1] = {0xffffffffffffffff};
 
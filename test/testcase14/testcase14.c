@@ -1,370 +1,12 @@
-#define _GNU_SOURCE
+#include "syz.h"
 
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <pthread.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <time.h>
-#include <unistd.h>
-
-#include <linux/futex.h>
-
-static void sleep_ms(uint64_t ms)
-{
-  usleep(ms * 1000);
-}
-
-static uint64_t current_time_ms(void)
-{
-  struct timespec ts;
-  if (clock_gettime(CLOCK_MONOTONIC, &ts))
-    exit(1);
-  return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
-}
-
-static void thread_start(void* (*fn)(void*), void* arg)
-{
-  pthread_t th;
-  pthread_attr_t attr;
-  pthread_attr_init(&attr);
-  pthread_attr_setstacksize(&attr, 128 << 10);
-  int i = 0;
-  for (; i < 100; i++) {
-    if (pthread_create(&th, &attr, fn, arg) == 0) {
-      pthread_attr_destroy(&attr);
-      return;
-    }
-    if (errno == EAGAIN) {
-      usleep(50);
-      continue;
-    }
-    break;
-  }
-  exit(1);
-}
-
-typedef struct {
-  int state;
-} event_t;
-
-static void event_init(event_t* ev)
-{
-  ev->state = 0;
-}
-
-static void event_reset(event_t* ev)
-{
-  ev->state = 0;
-}
-
-static void event_set(event_t* ev)
-{
-  if (ev->state)
-    exit(1);
-  __atomic_store_n(&ev->state, 1, __ATOMIC_RELEASE);
-  syscall(SYS_futex, &ev->state, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1000000);
-}
-
-static void event_wait(event_t* ev)
-{
-  while (!__atomic_load_n(&ev->state, __ATOMIC_ACQUIRE))
-    syscall(SYS_futex, &ev->state, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, 0, 0);
-}
-
-static int event_isset(event_t* ev)
-{
-  return __atomic_load_n(&ev->state, __ATOMIC_ACQUIRE);
-}
-
-static int event_timedwait(event_t* ev, uint64_t timeout)
-{
-  uint64_t start = current_time_ms();
-  uint64_t now = start;
-  for (;;) {
-    uint64_t remain = timeout - (now - start);
-    struct timespec ts;
-    ts.tv_sec = remain / 1000;
-    ts.tv_nsec = (remain % 1000) * 1000 * 1000;
-    syscall(SYS_futex, &ev->state, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, 0, &ts);
-    if (__atomic_load_n(&ev->state, __ATOMIC_ACQUIRE))
-      return 1;
-    now = current_time_ms();
-    if (now - start > timeout)
-      return 0;
-  }
-}
-
-#define FUSE_MIN_READ_BUFFER 8192
-enum fuse_opcode {
-  FUSE_LOOKUP = 1,
-  FUSE_FORGET = 2,
-  FUSE_GETATTR = 3,
-  FUSE_SETATTR = 4,
-  FUSE_READLINK = 5,
-  FUSE_SYMLINK = 6,
-  FUSE_MKNOD = 8,
-  FUSE_MKDIR = 9,
-  FUSE_UNLINK = 10,
-  FUSE_RMDIR = 11,
-  FUSE_RENAME = 12,
-  FUSE_LINK = 13,
-  FUSE_OPEN = 14,
-  FUSE_READ = 15,
-  FUSE_WRITE = 16,
-  FUSE_STATFS = 17,
-  FUSE_RELEASE = 18,
-  FUSE_FSYNC = 20,
-  FUSE_SETXATTR = 21,
-  FUSE_GETXATTR = 22,
-  FUSE_LISTXATTR = 23,
-  FUSE_REMOVEXATTR = 24,
-  FUSE_FLUSH = 25,
-  FUSE_INIT = 26,
-  FUSE_OPENDIR = 27,
-  FUSE_READDIR = 28,
-  FUSE_RELEASEDIR = 29,
-  FUSE_FSYNCDIR = 30,
-  FUSE_GETLK = 31,
-  FUSE_SETLK = 32,
-  FUSE_SETLKW = 33,
-  FUSE_ACCESS = 34,
-  FUSE_CREATE = 35,
-  FUSE_INTERRUPT = 36,
-  FUSE_BMAP = 37,
-  FUSE_DESTROY = 38,
-  FUSE_IOCTL = 39,
-  FUSE_POLL = 40,
-  FUSE_NOTIFY_REPLY = 41,
-  FUSE_BATCH_FORGET = 42,
-  FUSE_FALLOCATE = 43,
-  FUSE_READDIRPLUS = 44,
-  FUSE_RENAME2 = 45,
-  FUSE_LSEEK = 46,
-  FUSE_COPY_FILE_RANGE = 47,
-  FUSE_SETUPMAPPING = 48,
-  FUSE_REMOVEMAPPING = 49,
-  CUSE_INIT = 4096,
-  CUSE_INIT_BSWAP_RESERVED = 1048576,
-  FUSE_INIT_BSWAP_RESERVED = 436207616,
-};
-struct fuse_in_header {
-  uint32_t len;
-  uint32_t opcode;
-  uint64_t unique;
-  uint64_t nodeid;
-  uint32_t uid;
-  uint32_t gid;
-  uint32_t pid;
-  uint32_t padding;
-};
-struct fuse_out_header {
-  uint32_t len;
-  uint32_t error;
-  uint64_t unique;
-};
-struct syz_fuse_req_out {
-  struct fuse_out_header* init;
-  struct fuse_out_header* lseek;
-  struct fuse_out_header* bmap;
-  struct fuse_out_header* poll;
-  struct fuse_out_header* getxattr;
-  struct fuse_out_header* lk;
-  struct fuse_out_header* statfs;
-  struct fuse_out_header* write;
-  struct fuse_out_header* read;
-  struct fuse_out_header* open;
-  struct fuse_out_header* attr;
-  struct fuse_out_header* entry;
-  struct fuse_out_header* dirent;
-  struct fuse_out_header* direntplus;
-  struct fuse_out_header* create_open;
-  struct fuse_out_header* ioctl;
-};
-static int fuse_send_response(int fd, const struct fuse_in_header* in_hdr,
-                              struct fuse_out_header* out_hdr)
-{
-  if (!out_hdr) {
-    return -1;
-  }
-  out_hdr->unique = in_hdr->unique;
-  if (write(fd, out_hdr, out_hdr->len) == -1) {
-    return -1;
-  }
-  return 0;
-}
-static volatile long syz_fuse_handle_req(volatile long a0, volatile long a1,
-                                         volatile long a2, volatile long a3)
-{
-  struct syz_fuse_req_out* req_out = (struct syz_fuse_req_out*)a3;
-  struct fuse_out_header* out_hdr = NULL;
-  char* buf = (char*)a1;
-  int buf_len = (int)a2;
-  int fd = (int)a0;
-  if (!req_out) {
-    return -1;
-  }
-  if (buf_len < FUSE_MIN_READ_BUFFER) {
-    return -1;
-  }
-  int ret = read(fd, buf, buf_len);
-  if (ret == -1) {
-    return -1;
-  }
-  if ((size_t)ret < sizeof(struct fuse_in_header)) {
-    return -1;
-  }
-  const struct fuse_in_header* in_hdr = (const struct fuse_in_header*)buf;
-  if (in_hdr->len > (uint32_t)ret) {
-    return -1;
-  }
-  switch (in_hdr->opcode) {
-  case FUSE_GETATTR:
-  case FUSE_SETATTR:
-    out_hdr = req_out->attr;
-    break;
-  case FUSE_LOOKUP:
-  case FUSE_SYMLINK:
-  case FUSE_LINK:
-  case FUSE_MKNOD:
-  case FUSE_MKDIR:
-    out_hdr = req_out->entry;
-    break;
-  case FUSE_OPEN:
-  case FUSE_OPENDIR:
-    out_hdr = req_out->open;
-    break;
-  case FUSE_STATFS:
-    out_hdr = req_out->statfs;
-    break;
-  case FUSE_RMDIR:
-  case FUSE_RENAME:
-  case FUSE_RENAME2:
-  case FUSE_FALLOCATE:
-  case FUSE_SETXATTR:
-  case FUSE_REMOVEXATTR:
-  case FUSE_FSYNCDIR:
-  case FUSE_FSYNC:
-  case FUSE_SETLKW:
-  case FUSE_SETLK:
-  case FUSE_ACCESS:
-  case FUSE_FLUSH:
-  case FUSE_RELEASE:
-  case FUSE_RELEASEDIR:
-  case FUSE_UNLINK:
-  case FUSE_DESTROY:
-    out_hdr = req_out->init;
-    if (!out_hdr) {
-      return -1;
-    }
-    out_hdr->len = sizeof(struct fuse_out_header);
-    break;
-  case FUSE_READ:
-    out_hdr = req_out->read;
-    break;
-  case FUSE_READDIR:
-    out_hdr = req_out->dirent;
-    break;
-  case FUSE_READDIRPLUS:
-    out_hdr = req_out->direntplus;
-    break;
-  case FUSE_INIT:
-    out_hdr = req_out->init;
-    break;
-  case FUSE_LSEEK:
-    out_hdr = req_out->lseek;
-    break;
-  case FUSE_GETLK:
-    out_hdr = req_out->lk;
-    break;
-  case FUSE_BMAP:
-    out_hdr = req_out->bmap;
-    break;
-  case FUSE_POLL:
-    out_hdr = req_out->poll;
-    break;
-  case FUSE_GETXATTR:
-  case FUSE_LISTXATTR:
-    out_hdr = req_out->getxattr;
-    break;
-  case FUSE_WRITE:
-  case FUSE_COPY_FILE_RANGE:
-    out_hdr = req_out->write;
-    break;
-  case FUSE_FORGET:
-  case FUSE_BATCH_FORGET:
-    return 0;
-  case FUSE_CREATE:
-    out_hdr = req_out->create_open;
-    break;
-  case FUSE_IOCTL:
-    out_hdr = req_out->ioctl;
-    break;
-  default:
-    return -1;
-  }
-  return fuse_send_response(fd, in_hdr, out_hdr);
-}
-
-struct thread_t {
-  int created, call;
-  event_t ready, done;
-};
-
-static struct thread_t threads[16];
-static void execute_call(int call);
-static int running;
-
-static void* thr(void* arg)
-{
-  struct thread_t* th = (struct thread_t*)arg;
-  for (;;) {
-    event_wait(&th->ready);
-    event_reset(&th->ready);
-    execute_call(th->call);
-    __atomic_fetch_sub(&running, 1, __ATOMIC_RELAXED);
-    event_set(&th->done);
-  }
-  return 0;
-}
+uint64_t r[3] = {0xffffffffffffffff, 0x0, 0xffffffffffffffff};
 
-static void loop(void)
+void execute_one(void)
 {
-  int i, call, thread;
-  for (call = 0; call < 8; call++) {
-    for (thread = 0; thread < (int)(sizeof(threads) / sizeof(threads[0]));
-         thread++) {
-      struct thread_t* th = &threads[thread];
-      if (!th->created) {
-        th->created = 1;
-        event_init(&th->ready);
-        event_init(&th->done);
-        event_set(&th->done);
-        thread_start(thr, th);
-      }
-      if (!event_isset(&th->done))
-        continue;
-      event_reset(&th->done);
-      th->call = call;
-      __atomic_fetch_add(&running, 1, __ATOMIC_RELAXED);
-      event_set(&th->ready);
-      event_timedwait(&th->done, 50);
-      break;
-    }
-  }
-  for (i = 0; i < 100 && __atomic_load_n(&running, __ATOMIC_RELAXED); i++)
-    sleep_ms(1);
+  execute_calls(8, 50, false);
 }
 
-uint64_t r[3] = {0xffffffffffffffff, 0x0, 0xffffffffffffffff};
-
 void execute_call(int call)
 {
   intptr_t res = 0;
@@ -974,11 +616,12 @@ void execute_call(int call)
     break;
   }
 }
+
 int main(void)
 {
   syscall(__NR_mmap, 0x1ffff000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x20000000ul, 0x1000000ul, 7ul, 0x32ul, -1, 0ul);
   syscall(__NR_mmap, 0x21000000ul, 0x1000ul, 0ul, 0x32ul, -1, 0ul);
-  loop();
+  execute_one();
   return 0;
 }
@@ -1,156 +1,6 @@
-#define _GNU_SOURCE
+#include "syz.h"
 
-#include <endian.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/ioctl.h>
-#include <sys/mount.h>
-#include <sys/stat.h>
-#include <sys/syscall.h>
-#include <sys/types.h>
-#include <unistd.h>
-
-#include <linux/loop.h>
-
-static unsigned long long procid;
-
-struct fs_image_segment {
-  void* data;
-  uintptr_t size;
-  uintptr_t offset;
-};
-
-#define IMAGE_MAX_SEGMENTS 4096
-#define IMAGE_MAX_SIZE (129 << 20)
-
-#define sys_memfd_create 319
-
-static unsigned long fs_image_segment_check(unsigned long size,
-                                            unsigned long nsegs,
-                                            struct fs_image_segment* segs)
-{
-  if (nsegs > IMAGE_MAX_SEGMENTS)
-    nsegs = IMAGE_MAX_SEGMENTS;
-  for (size_t i = 0; i < nsegs; i++) {
-    if (segs[i].size > IMAGE_MAX_SIZE)
-      segs[i].size = IMAGE_MAX_SIZE;
-    segs[i].offset %= IMAGE_MAX_SIZE;
-    if (segs[i].offset > IMAGE_MAX_SIZE - segs[i].size)
-      segs[i].offset = IMAGE_MAX_SIZE - segs[i].size;
-    if (size < segs[i].offset + segs[i].offset)
-      size = segs[i].offset + segs[i].offset;
-  }
-  if (size > IMAGE_MAX_SIZE)
-    size = IMAGE_MAX_SIZE;
-  return size;
-}
-static int setup_loop_device(long unsigned size, long unsigned nsegs,
-                             struct fs_image_segment* segs,
-                             const char* loopname, int* memfd_p, int* loopfd_p)
-{
-  int err = 0, loopfd = -1;
-  size = fs_image_segment_check(size, nsegs, segs);
-  int memfd = syscall(sys_memfd_create, "syzkaller", 0);
-  if (memfd == -1) {
-    err = errno;
-    goto error;
-  }
-  if (ftruncate(memfd, size)) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  for (size_t i = 0; i < nsegs; i++) {
-    if (pwrite(memfd, segs[i].data, segs[i].size, segs[i].offset) < 0) {
-    }
-  }
-  loopfd = open(loopname, O_RDWR);
-  if (loopfd == -1) {
-    err = errno;
-    goto error_close_memfd;
-  }
-  if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-    if (errno != EBUSY) {
-      err = errno;
-      goto error_close_loop;
-    }
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    usleep(1000);
-    if (ioctl(loopfd, LOOP_SET_FD, memfd)) {
-      err = errno;
-      goto error_close_loop;
-    }
-  }
-  *memfd_p = memfd;
-  *loopfd_p = loopfd;
-  return 0;
-
-error_close_loop:
-  close(loopfd);
-error_close_memfd:
-  close(memfd);
-error:
-  errno = err;
-  return -1;
-}
-
-static long syz_mount_image(volatile long fsarg, volatile long dir,
-                            volatile unsigned long size,
-                            volatile unsigned long nsegs,
-                            volatile long segments, volatile long flags,
-                            volatile long optsarg)
-{
-  struct fs_image_segment* segs = (struct fs_image_segment*)segments;
-  int res = -1, err = 0, loopfd = -1, memfd = -1, need_loop_device = !!segs;
-  char* mount_opts = (char*)optsarg;
-  char* target = (char*)dir;
-  char* fs = (char*)fsarg;
-  char* source = NULL;
-  char loopname[64];
-  if (need_loop_device) {
-    memset(loopname, 0, sizeof(loopname));
-    snprintf(loopname, sizeof(loopname), "/dev/loop%llu", procid);
-    if (setup_loop_device(size, nsegs, segs, loopname, &memfd, &loopfd) == -1)
-      return -1;
-    source = loopname;
-  }
-  mkdir(target, 0777);
-  char opts[256];
-  memset(opts, 0, sizeof(opts));
-  if (strlen(mount_opts) > (sizeof(opts) - 32)) {
-  }
-  strncpy(opts, mount_opts, sizeof(opts) - 32);
-  if (strcmp(fs, "iso9660") == 0) {
-    flags |= MS_RDONLY;
-  } else if (strncmp(fs, "ext", 3) == 0) {
-    if (strstr(opts, "errors=panic") || strstr(opts, "errors=remount-ro") == 0)
-      strcat(opts, ",errors=continue");
-  } else if (strcmp(fs, "xfs") == 0) {
-    strcat(opts, ",nouuid");
-  }
-  res = mount(source, target, fs, flags, opts);
-  if (res == -1) {
-    err = errno;
-    goto error_clear_loop;
-  }
-  res = open(target, O_RDONLY | O_DIRECTORY);
-  if (res == -1) {
-    err = errno;
-  }
-
-error_clear_loop:
-  if (need_loop_device) {
-    ioctl(loopfd, LOOP_CLR_FD, 0);
-    close(loopfd);
-    close(memfd);
-  }
-  errno = err;
-  return res;
-}
+SYZ_BLOB(image, "testcase3/testcase3.img.z");
 
 int main(void)
 {
@@ -160,7014 +10,8 @@ int main(void)
 
   memcpy((void*)0x20000000, "gfs2\000", 5);
   memcpy((void*)0x20000100, "./file0\000", 8);
-  *(uint64_t*)0x20000200 = 0x20010000;
-  memcpy((void*)0x20010000,
-         "\x01\x16\x19\x70\x00\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x64\x00\x00\x00\x00\x00\x00\x07\x09\x00\x00\x07\x6c\x00\x00"
-         "\x00\x00\x00\x00\x10\x00\x00\x00\x00\x0c\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x02\x00\x00\x00\x00\x00\x00\x08\x1b\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x0c\x00\x00\x00\x00\x00\x00\x09\x27\x6c\x6f\x63\x6b\x5f\x6e"
-         "\x6f\x6c\x6f\x63\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x00\x00\x00\x73\x79\x7a\x3a\x73\x79\x7a\x00\x00\x00"
-         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-         "\x00\x00\x00\x00\x00",
-         192);
-  *(uint64_t*)0x20000208 = 0xc0;
-  *(uint64_t*)0x20000210 = 0x10000;
-  *(uint64_t*)0x20000218 = 0;
-  *(uint64_t*)0x20000220 = 0;
-  *(uint64_t*)0x20000228 = 0x10100;
-  *(uint64_t*)0x20000230 = 0;
-  *(uint64_t*)0x20000238 = 0;
-  *(uint64_t*)0x20000240 = 0x14000;
-  *(uint64_t*)0x20000248 = 0;
-  *(uint64_t*)0x20000250 = 0;
-  *(uint64_t*)0x20000258 = 0x15000;
-  *(uint64_t*)0x20000260 = 0;
-  *(uint64_t*)0x20000268 = 0;
-  *(uint64_t*)0x20000270 = 0x150e0;
-  *(uint64_t*)0x20000278 = 0;
-  *(uint64_t*)0x20000280 = 0;
-  *(uint64_t*)0x20000288 = 0x16000;
-  *(uint64_t*)0x20000290 = 0;
-  *(uint64_t*)0x20000298 = 0;
-  *(uint64_t*)0x200002a0 = 0x1b000;
-  *(uint64_t*)0x200002a8 = 0;
-  *(uint64_t*)0x200002b0 = 0;
-  *(uint64_t*)0x200002b8 = 0x1c000;
-  *(uint64_t*)0x200002c0 = 0;
-  *(uint64_t*)0x200002c8 = 0;
-  *(uint64_t*)0x200002d0 = 0x1d000;
-  *(uint64_t*)0x200002d8 = 0;
-  *(uint64_t*)0x200002e0 = 0;
-  *(uint64_t*)0x200002e8 = 0x1e000;
-  *(uint64_t*)0x200002f0 = 0;
-  *(uint64_t*)0x200002f8 = 0;
-  *(uint64_t*)0x20000300 = 0x1f000;
-  *(uint64_t*)0x20000308 = 0;
-  *(uint64_t*)0x20000310 = 0;
-  *(uint64_t*)0x20000318 = 0x20000;
-  *(uint64_t*)0x20000320 = 0;
-  *(uint64_t*)0x20000328 = 0;
-  *(uint64_t*)0x20000330 = 0x21000;
-  *(uint64_t*)0x20000338 = 0;
-  *(uint64_t*)0x20000340 = 0;
-  *(uint64_t*)0x20000348 = 0x22000;
-  *(uint64_t*)0x20000350 = 0;
-  *(uint64_t*)0x20000358 = 0;
-  *(uint64_t*)0x20000360 = 0x23000;
-  *(uint64_t*)0x20000368 = 0;
-  *(uint64_t*)0x20000370 = 0;
-  *(uint64_t*)0x20000378 = 0x24000;
-  *(uint64_t*)0x20000380 = 0;
-  *(uint64_t*)0x20000388 = 0;
-  *(uint64_t*)0x20000390 = 0x25000;
-  *(uint64_t*)0x20000398 = 0;
-  *(uint64_t*)0x200003a0 = 0;
-  *(uint64_t*)0x200003a8 = 0x26000;
-  *(uint64_t*)0x200003b0 = 0;
-  *(uint64_t*)0x200003b8 = 0;
-  *(uint64_t*)0x200003c0 = 0x27000;
-  *(uint64_t*)0x200003c8 = 0;
-  *(uint64_t*)0x200003d0 = 0;
-  *(uint64_t*)0x200003d8 = 0x28000;
-  *(uint64_t*)0x200003e0 = 0;
-  *(uint64_t*)0x200003e8 = 0;
-  *(uint64_t*)0x200003f0 = 0x29000;
-  *(uint64_t*)0x200003f8 = 0;
-  *(uint64_t*)0x20000400 = 0;
-  *(uint64_t*)0x20000408 = 0x2a000;
-  *(uint64_t*)0x20000410 = 0;
-  *(uint64_t*)0x20000418 = 0;
-  *(uint64_t*)0x20000420 = 0x2b000;
-  *(uint64_t*)0x20000428 = 0;
-  *(uint64_t*)0x20000430 = 0;
-  *(uint64_t*)0x20000438 = 0x2c000;
-  *(uint64_t*)0x20000440 = 0;
-  *(uint64_t*)0x20000448 = 0;
-  *(uint64_t*)0x20000450 = 0x2d000;
-  *(uint64_t*)0x20000458 = 0;
-  *(uint64_t*)0x20000460 = 0;
-  *(uint64_t*)0x20000468 = 0x2e000;
-  *(uint64_t*)0x20000470 = 0;
-  *(uint64_t*)0x20000478 = 0;
-  *(uint64_t*)0x20000480 = 0x2f000;
-  *(uint64_t*)0x20000488 = 0;
-  *(uint64_t*)0x20000490 = 0;
-  *(uint64_t*)0x20000498 = 0x30000;
-  *(uint64_t*)0x200004a0 = 0;
-  *(uint64_t*)0x200004a8 = 0;
-  *(uint64_t*)0x200004b0 = 0x31000;
-  *(uint64_t*)0x200004b8 = 0;
-  *(uint64_t*)0x200004c0 = 0;
-  *(uint64_t*)0x200004c8 = 0x32000;
-  *(uint64_t*)0x200004d0 = 0;
-  *(uint64_t*)0x200004d8 = 0;
-  *(uint64_t*)0x200004e0 = 0x33000;
-  *(uint64_t*)0x200004e8 = 0;
-  *(uint64_t*)0x200004f0 = 0;
-  *(uint64_t*)0x200004f8 = 0x34000;
-  *(uint64_t*)0x20000500 = 0;
-  *(uint64_t*)0x20000508 = 0;
-  *(uint64_t*)0x20000510 = 0x35000;
-  *(uint64_t*)0x20000518 = 0;
-  *(uint64_t*)0x20000520 = 0;
-  *(uint64_t*)0x20000528 = 0x36000;
-  *(uint64_t*)0x20000530 = 0;
-  *(uint64_t*)0x20000538 = 0;
-  *(uint64_t*)0x20000540 = 0x37000;
-  *(uint64_t*)0x20000548 = 0;
-  *(uint64_t*)0x20000550 = 0;
-  *(uint64_t*)0x20000558 = 0x38000;
-  *(uint64_t*)0x20000560 = 0;
-  *(uint64_t*)0x20000568 = 0;
-  *(uint64_t*)0x20000570 = 0x39000;
-  *(uint64_t*)0x20000578 = 0;
-  *(uint64_t*)0x20000580 = 0;
-  *(uint64_t*)0x20000588 = 0x3a000;
-  *(uint64_t*)0x20000590 = 0;
-  *(uint64_t*)0x20000598 = 0;
-  *(uint64_t*)0x200005a0 = 0x3b000;
-  *(uint64_t*)0x200005a8 = 0;
-  *(uint64_t*)0x200005b0 = 0;
-  *(uint64_t*)0x200005b8 = 0x3c000;
-  *(uint64_t*)0x200005c0 = 0;
-  *(uint64_t*)0x200005c8 = 0;
-  *(uint64_t*)0x200005d0 = 0x3d000;
-  *(uint64_t*)0x200005d8 = 0;
-  *(uint64_t*)0x200005e0 = 0;
-  *(uint64_t*)0x200005e8 = 0x3e000;
-  *(uint64_t*)0x200005f0 = 0;
-  *(uint64_t*)0x200005f8 = 0;
-  *(uint64_t*)0x20000600 = 0x3f000;
-  *(uint64_t*)0x20000608 = 0;
-  *(uint64_t*)0x20000610 = 0;
-  *(uint64_t*)0x20000618 = 0x40000;
-  *(uint64_t*)0x20000620 = 0;
-  *(uint64_t*)0x20000628 = 0;
-  *(uint64_t*)0x20000630 = 0x41000;
-  *(uint64_t*)0x20000638 = 0;
-  *(uint64_t*)0x20000640 = 0;
-  *(uint64_t*)0x20000648 = 0x42000;
-  *(uint64_t*)0x20000650 = 0;
-  *(uint64_t*)0x20000658 = 0;
-  *(uint64_t*)0x20000660 = 0x43000;
-  *(uint64_t*)0x20000668 = 0;
-  *(uint64_t*)0x20000670 = 0;
-  *(uint64_t*)0x20000678 = 0x44000;
-  *(uint64_t*)0x20000680 = 0;
-  *(uint64_t*)0x20000688 = 0;
-  *(uint64_t*)0x20000690 = 0x45000;
-  *(uint64_t*)0x20000698 = 0;
-  *(uint64_t*)0x200006a0 = 0;
-  *(uint64_t*)0x200006a8 = 0x46000;
-  *(uint64_t*)0x200006b0 = 0;
-  *(uint64_t*)0x200006b8 = 0;
-  *(uint64_t*)0x200006c0 = 0x47000;
-  *(uint64_t*)0x200006c8 = 0;
-  *(uint64_t*)0x200006d0 = 0;
-  *(uint64_t*)0x200006d8 = 0x48000;
-  *(uint64_t*)0x200006e0 = 0;
-  *(uint64_t*)0x200006e8 = 0;
-  *(uint64_t*)0x200006f0 = 0x49000;
-  *(uint64_t*)0x200006f8 = 0;
-  *(uint64_t*)0x20000700 = 0;
-  *(uint64_t*)0x20000708 = 0x4a000;
-  *(uint64_t*)0x20000710 = 0;
-  *(uint64_t*)0x20000718 = 0;
-  *(uint64_t*)0x20000720 = 0x4b000;
-  *(uint64_t*)0x20000728 = 0;
-  *(uint64_t*)0x20000730 = 0;
-  *(uint64_t*)0x20000738 = 0x4c000;
-  *(uint64_t*)0x20000740 = 0;
-  *(uint64_t*)0x20000748 = 0;
-  *(uint64_t*)0x20000750 = 0x4d000;
-  *(uint64_t*)0x20000758 = 0;
-  *(uint64_t*)0x20000760 = 0;
-  *(uint64_t*)0x20000768 = 0x4e000;
-  *(uint64_t*)0x20000770 = 0;
-  *(uint64_t*)0x20000778 = 0;
-  *(uint64_t*)0x20000780 = 0x4f000;
-  *(uint64_t*)0x20000788 = 0;
-  *(uint64_t*)0x20000790 = 0;
-  *(uint64_t*)0x20000798 = 0x50000;
-  *(uint64_t*)0x200007a0 = 0;
-  *(uint64_t*)0x200007a8 = 0;
-  *(uint64_t*)0x200007b0 = 0x51000;
-  *(uint64_t*)0x200007b8 = 0;
-  *(uint64_t*)0x200007c0 = 0;
-  *(uint64_t*)0x200007c8 = 0x52000;
-  *(uint64_t*)0x200007d0 = 0;
-  *(uint64_t*)0x200007d8 = 0;
-  *(uint64_t*)0x200007e0 = 0x53000;
-  *(uint64_t*)0x200007e8 = 0;
-  *(uint64_t*)0x200007f0 = 0;
-  *(uint64_t*)0x200007f8 = 0x54000;
-  *(uint64_t*)0x20000800 = 0;
-  *(uint64_t*)0x20000808 = 0;
-  *(uint64_t*)0x20000810 = 0x55000;
-  *(uint64_t*)0x20000818 = 0;
-  *(uint64_t*)0x20000820 = 0;
-  *(uint64_t*)0x20000828 = 0x56000;
-  *(uint64_t*)0x20000830 = 0;
-  *(uint64_t*)0x20000838 = 0;
-  *(uint64_t*)0x20000840 = 0x57000;
-  *(uint64_t*)0x20000848 = 0;
-  *(uint64_t*)0x20000850 = 0;
-  *(uint64_t*)0x20000858 = 0x58000;
-  *(uint64_t*)0x20000860 = 0;
-  *(uint64_t*)0x20000868 = 0;
-  *(uint64_t*)0x20000870 = 0x59000;
-  *(uint64_t*)0x20000878 = 0;
-  *(uint64_t*)0x20000880 = 0;
-  *(uint64_t*)0x20000888 = 0x5a000;
-  *(uint64_t*)0x20000890 = 0;
-  *(uint64_t*)0x20000898 = 0;
-  *(uint64_t*)0x200008a0 = 0x5b000;
-  *(uint64_t*)0x200008a8 = 0;
-  *(uint64_t*)0x200008b0 = 0;
-  *(uint64_t*)0x200008b8 = 0x5c000;
-  *(uint64_t*)0x200008c0 = 0;
-  *(uint64_t*)0x200008c8 = 0;
-  *(uint64_t*)0x200008d0 = 0x5d000;
-  *(uint64_t*)0x200008d8 = 0;
-  *(uint64_t*)0x200008e0 = 0;
-  *(uint64_t*)0x200008e8 = 0x5e000;
-  *(uint64_t*)0x200008f0 = 0;
-  *(uint64_t*)0x200008f8 = 0;
-  *(uint64_t*)0x20000900 = 0x5f000;
-  *(uint64_t*)0x20000908 = 0;
-  *(uint64_t*)0x20000910 = 0;
-  *(uint64_t*)0x20000918 = 0x60000;
-  *(uint64_t*)0x20000920 = 0;
-  *(uint64_t*)0x20000928 = 0;
-  *(uint64_t*)0x20000930 = 0x61000;
-  *(uint64_t*)0x20000938 = 0;
-  *(uint64_t*)0x20000940 = 0;
-  *(uint64_t*)0x20000948 = 0x62000;
-  *(uint64_t*)0x20000950 = 0;
-  *(uint64_t*)0x20000958 = 0;
-  *(uint64_t*)0x20000960 = 0x63000;
-  *(uint64_t*)0x20000968 = 0;
-  *(uint64_t*)0x20000970 = 0;
-  *(uint64_t*)0x20000978 = 0x64000;
-  *(uint64_t*)0x20000980 = 0;
-  *(uint64_t*)0x20000988 = 0;
-  *(uint64_t*)0x20000990 = 0x65000;
-  *(uint64_t*)0x20000998 = 0;
-  *(uint64_t*)0x200009a0 = 0;
-  *(uint64_t*)0x200009a8 = 0x66000;
-  *(uint64_t*)0x200009b0 = 0;
-  *(uint64_t*)0x200009b8 = 0;
-  *(uint64_t*)0x200009c0 = 0x67000;
-  *(uint64_t*)0x200009c8 = 0;
-  *(uint64_t*)0x200009d0 = 0;
-  *(uint64_t*)0x200009d8 = 0x68000;
-  *(uint64_t*)0x200009e0 = 0;
-  *(uint64_t*)0x200009e8 = 0;
-  *(uint64_t*)0x200009f0 = 0x69000;
-  *(uint64_t*)0x200009f8 = 0;
-  *(uint64_t*)0x20000a00 = 0;
-  *(uint64_t*)0x20000a08 = 0x6a000;
-  *(uint64_t*)0x20000a10 = 0;
-  *(uint64_t*)0x20000a18 = 0;
-  *(uint64_t*)0x20000a20 = 0x6b000;
-  *(uint64_t*)0x20000a28 = 0;
-  *(uint64_t*)0x20000a30 = 0;
-  *(uint64_t*)0x20000a38 = 0x6c000;
-  *(uint64_t*)0x20000a40 = 0;
-  *(uint64_t*)0x20000a48 = 0;
-  *(uint64_t*)0x20000a50 = 0x6d000;
-  *(uint64_t*)0x20000a58 = 0;
-  *(uint64_t*)0x20000a60 = 0;
-  *(uint64_t*)0x20000a68 = 0x6e000;
-  *(uint64_t*)0x20000a70 = 0;
-  *(uint64_t*)0x20000a78 = 0;
-  *(uint64_t*)0x20000a80 = 0x6f000;
-  *(uint64_t*)0x20000a88 = 0;
-  *(uint64_t*)0x20000a90 = 0;
-  *(uint64_t*)0x20000a98 = 0x70000;
-  *(uint64_t*)0x20000aa0 = 0;
-  *(uint64_t*)0x20000aa8 = 0;
-  *(uint64_t*)0x20000ab0 = 0x71000;
-  *(uint64_t*)0x20000ab8 = 0;
-  *(uint64_t*)0x20000ac0 = 0;
-  *(uint64_t*)0x20000ac8 = 0x72000;
-  *(uint64_t*)0x20000ad0 = 0;
-  *(uint64_t*)0x20000ad8 = 0;
-  *(uint64_t*)0x20000ae0 = 0x73000;
-  *(uint64_t*)0x20000ae8 = 0;
-  *(uint64_t*)0x20000af0 = 0;
-  *(uint64_t*)0x20000af8 = 0x74000;
-  *(uint64_t*)0x20000b00 = 0;
-  *(uint64_t*)0x20000b08 = 0;
-  *(uint64_t*)0x20000b10 = 0x75000;
-  *(uint64_t*)0x20000b18 = 0;
-  *(uint64_t*)0x20000b20 = 0;
-  *(uint64_t*)0x20000b28 = 0x76000;
-  *(uint64_t*)0x20000b30 = 0;
-  *(uint64_t*)0x20000b38 = 0;
-  *(uint64_t*)0x20000b40 = 0x77000;
-  *(uint64_t*)0x20000b48 = 0;
-  *(uint64_t*)0x20000b50 = 0;
-  *(uint64_t*)0x20000b58 = 0x78000;
-  *(uint64_t*)0x20000b60 = 0;
-  *(uint64_t*)0x20000b68 = 0;
-  *(uint64_t*)0x20000b70 = 0x79000;
-  *(uint64_t*)0x20000b78 = 0;
-  *(uint64_t*)0x20000b80 = 0;
-  *(uint64_t*)0x20000b88 = 0x7a000;
-  *(uint64_t*)0x20000b90 = 0;
-  *(uint64_t*)0x20000b98 = 0;
-  *(uint64_t*)0x20000ba0 = 0x7b000;
-  *(uint64_t*)0x20000ba8 = 0;
-  *(uint64_t*)0x20000bb0 = 0;
-  *(uint64_t*)0x20000bb8 = 0x7c000;
-  *(uint64_t*)0x20000bc0 = 0;
-  *(uint64_t*)0x20000bc8 = 0;
-  *(uint64_t*)0x20000bd0 = 0x7d000;
-  *(uint64_t*)0x20000bd8 = 0;
-  *(uint64_t*)0x20000be0 = 0;
-  *(uint64_t*)0x20000be8 = 0x7e000;
-  *(uint64_t*)0x20000bf0 = 0;
-  *(uint64_t*)0x20000bf8 = 0;
-  *(uint64_t*)0x20000c00 = 0x7f000;
-  *(uint64_t*)0x20000c08 = 0;
-  *(uint64_t*)0x20000c10 = 0;
-  *(uint64_t*)0x20000c18 = 0x80000;
-  *(uint64_t*)0x20000c20 = 0;
-  *(uint64_t*)0x20000c28 = 0;
-  *(uint64_t*)0x20000c30 = 0x81000;
-  *(uint64_t*)0x20000c38 = 0;
-  *(uint64_t*)0x20000c40 = 0;
-  *(uint64_t*)0x20000c48 = 0x82000;
-  *(uint64_t*)0x20000c50 = 0;
-  *(uint64_t*)0x20000c58 = 0;
-  *(uint64_t*)0x20000c60 = 0x83000;
-  *(uint64_t*)0x20000c68 = 0;
-  *(uint64_t*)0x20000c70 = 0;
-  *(uint64_t*)0x20000c78 = 0x84000;
-  *(uint64_t*)0x20000c80 = 0;
-  *(uint64_t*)0x20000c88 = 0;
-  *(uint64_t*)0x20000c90 = 0x85000;
-  *(uint64_t*)0x20000c98 = 0;
-  *(uint64_t*)0x20000ca0 = 0;
-  *(uint64_t*)0x20000ca8 = 0x86000;
-  *(uint64_t*)0x20000cb0 = 0;
-  *(uint64_t*)0x20000cb8 = 0;
-  *(uint64_t*)0x20000cc0 = 0x87000;
-  *(uint64_t*)0x20000cc8 = 0;
-  *(uint64_t*)0x20000cd0 = 0;
-  *(uint64_t*)0x20000cd8 = 0x88000;
-  *(uint64_t*)0x20000ce0 = 0;
-  *(uint64_t*)0x20000ce8 = 0;
-  *(uint64_t*)0x20000cf0 = 0x89000;
-  *(uint64_t*)0x20000cf8 = 0;
-  *(uint64_t*)0x20000d00 = 0;
-  *(uint64_t*)0x20000d08 = 0x8a000;
-  *(uint64_t*)0x20000d10 = 0;
-  *(uint64_t*)0x20000d18 = 0;
-  *(uint64_t*)0x20000d20 = 0x8b000;
-  *(uint64_t*)0x20000d28 = 0;
-  *(uint64_t*)0x20000d30 = 0;
-  *(uint64_t*)0x20000d38 = 0x8c000;
-  *(uint64_t*)0x20000d40 = 0;
-  *(uint64_t*)0x20000d48 = 0;
-  *(uint64_t*)0x20000d50 = 0x8d000;
-  *(uint64_t*)0x20000d58 = 0;
-  *(uint64_t*)0x20000d60 = 0;
-  *(uint64_t*)0x20000d68 = 0x8e000;
-  *(uint64_t*)0x20000d70 = 0;
-  *(uint64_t*)0x20000d78 = 0;
-  *(uint64_t*)0x20000d80 = 0x8f000;
-  *(uint64_t*)0x20000d88 = 0;
-  *(uint64_t*)0x20000d90 = 0;
-  *(uint64_t*)0x20000d98 = 0x90000;
-  *(uint64_t*)0x20000da0 = 0;
-  *(uint64_t*)0x20000da8 = 0;
-  *(uint64_t*)0x20000db0 = 0x91000;
-  *(uint64_t*)0x20000db8 = 0;
-  *(uint64_t*)0x20000dc0 = 0;
-  *(uint64_t*)0x20000dc8 = 0x92000;
-  *(uint64_t*)0x20000dd0 = 0;
-  *(uint64_t*)0x20000dd8 = 0;
-  *(uint64_t*)0x20000de0 = 0x93000;
-  *(uint64_t*)0x20000de8 = 0;
-  *(uint64_t*)0x20000df0 = 0;
-  *(uint64_t*)0x20000df8 = 0x94000;
-  *(uint64_t*)0x20000e00 = 0;
-  *(uint64_t*)0x20000e08 = 0;
-  *(uint64_t*)0x20000e10 = 0x95000;
-  *(uint64_t*)0x20000e18 = 0;
-  *(uint64_t*)0x20000e20 = 0;
-  *(uint64_t*)0x20000e28 = 0x96000;
-  *(uint64_t*)0x20000e30 = 0;
-  *(uint64_t*)0x20000e38 = 0;
-  *(uint64_t*)0x20000e40 = 0x97000;
-  *(uint64_t*)0x20000e48 = 0;
-  *(uint64_t*)0x20000e50 = 0;
-  *(uint64_t*)0x20000e58 = 0x98000;
-  *(uint64_t*)0x20000e60 = 0;
-  *(uint64_t*)0x20000e68 = 0;
-  *(uint64_t*)0x20000e70 = 0x99000;
-  *(uint64_t*)0x20000e78 = 0;
-  *(uint64_t*)0x20000e80 = 0;
-  *(uint64_t*)0x20000e88 = 0x9a000;
-  *(uint64_t*)0x20000e90 = 0;
-  *(uint64_t*)0x20000e98 = 0;
-  *(uint64_t*)0x20000ea0 = 0x9b000;
-  *(uint64_t*)0x20000ea8 = 0;
-  *(uint64_t*)0x20000eb0 = 0;
-  *(uint64_t*)0x20000eb8 = 0x9c000;
-  *(uint64_t*)0x20000ec0 = 0;
-  *(uint64_t*)0x20000ec8 = 0;
-  *(uint64_t*)0x20000ed0 = 0x9d000;
-  *(uint64_t*)0x20000ed8 = 0;
-  *(uint64_t*)0x20000ee0 = 0;
-  *(uint64_t*)0x20000ee8 = 0x9e000;
-  *(uint64_t*)0x20000ef0 = 0;
-  *(uint64_t*)0x20000ef8 = 0;
-  *(uint64_t*)0x20000f00 = 0x9f000;
-  *(uint64_t*)0x20000f08 = 0;
-  *(uint64_t*)0x20000f10 = 0;
-  *(uint64_t*)0x20000f18 = 0xa0000;
-  *(uint64_t*)0x20000f20 = 0;
-  *(uint64_t*)0x20000f28 = 0;
-  *(uint64_t*)0x20000f30 = 0xa1000;
-  *(uint64_t*)0x20000f38 = 0;
-  *(uint64_t*)0x20000f40 = 0;
-  *(uint64_t*)0x20000f48 = 0xa2000;
-  *(uint64_t*)0x20000f50 = 0;
-  *(uint64_t*)0x20000f58 = 0;
-  *(uint64_t*)0x20000f60 = 0xa3000;
-  *(uint64_t*)0x20000f68 = 0;
-  *(uint64_t*)0x20000f70 = 0;
-  *(uint64_t*)0x20000f78 = 0xa4000;
-  *(uint64_t*)0x20000f80 = 0;
-  *(uint64_t*)0x20000f88 = 0;
-  *(uint64_t*)0x20000f90 = 0xa5000;
-  *(uint64_t*)0x20000f98 = 0;
-  *(uint64_t*)0x20000fa0 = 0;
-  *(uint64_t*)0x20000fa8 = 0xa6000;
-  *(uint64_t*)0x20000fb0 = 0;
-  *(uint64_t*)0x20000fb8 = 0;
-  *(uint64_t*)0x20000fc0 = 0xa7000;
-  *(uint64_t*)0x20000fc8 = 0;
-  *(uint64_t*)0x20000fd0 = 0;
-  *(uint64_t*)0x20000fd8 = 0xa8000;
-  *(uint64_t*)0x20000fe0 = 0;
-  *(uint64_t*)0x20000fe8 = 0;
-  *(uint64_t*)0x20000ff0 = 0xa9000;
-  *(uint64_t*)0x20000ff8 = 0;
-  *(uint64_t*)0x20001000 = 0;
-  *(uint64_t*)0x20001008 = 0xaa000;
-  *(uint64_t*)0x20001010 = 0;
-  *(uint64_t*)0x20001018 = 0;
-  *(uint64_t*)0x20001020 = 0xab000;
-  *(uint64_t*)0x20001028 = 0;
-  *(uint64_t*)0x20001030 = 0;
-  *(uint64_t*)0x20001038 = 0xac000;
-  *(uint64_t*)0x20001040 = 0;
-  *(uint64_t*)0x20001048 = 0;
-  *(uint64_t*)0x20001050 = 0xad000;
-  *(uint64_t*)0x20001058 = 0;
-  *(uint64_t*)0x20001060 = 0;
-  *(uint64_t*)0x20001068 = 0xae000;
-  *(uint64_t*)0x20001070 = 0;
-  *(uint64_t*)0x20001078 = 0;
-  *(uint64_t*)0x20001080 = 0xaf000;
-  *(uint64_t*)0x20001088 = 0;
-  *(uint64_t*)0x20001090 = 0;
-  *(uint64_t*)0x20001098 = 0xb0000;
-  *(uint64_t*)0x200010a0 = 0;
-  *(uint64_t*)0x200010a8 = 0;
-  *(uint64_t*)0x200010b0 = 0xb1000;
-  *(uint64_t*)0x200010b8 = 0;
-  *(uint64_t*)0x200010c0 = 0;
-  *(uint64_t*)0x200010c8 = 0xb2000;
-  *(uint64_t*)0x200010d0 = 0;
-  *(uint64_t*)0x200010d8 = 0;
-  *(uint64_t*)0x200010e0 = 0xb3000;
-  *(uint64_t*)0x200010e8 = 0;
-  *(uint64_t*)0x200010f0 = 0;
-  *(uint64_t*)0x200010f8 = 0xb4000;
-  *(uint64_t*)0x20001100 = 0;
-  *(uint64_t*)0x20001108 = 0;
-  *(uint64_t*)0x20001110 = 0xb5000;
-  *(uint64_t*)0x20001118 = 0;
-  *(uint64_t*)0x20001120 = 0;
-  *(uint64_t*)0x20001128 = 0xb6000;
-  *(uint64_t*)0x20001130 = 0;
-  *(uint64_t*)0x20001138 = 0;
-  *(uint64_t*)0x20001140 = 0xb7000;
-  *(uint64_t*)0x20001148 = 0;
-  *(uint64_t*)0x20001150 = 0;
-  *(uint64_t*)0x20001158 = 0xb8000;
-  *(uint64_t*)0x20001160 = 0;
-  *(uint64_t*)0x20001168 = 0;
-  *(uint64_t*)0x20001170 = 0xb9000;
-  *(uint64_t*)0x20001178 = 0;
-  *(uint64_t*)0x20001180 = 0;
-  *(uint64_t*)0x20001188 = 0xba000;
-  *(uint64_t*)0x20001190 = 0;
-  *(uint64_t*)0x20001198 = 0;
-  *(uint64_t*)0x200011a0 = 0xbb000;
-  *(uint64_t*)0x200011a8 = 0;
-  *(uint64_t*)0x200011b0 = 0;
-  *(uint64_t*)0x200011b8 = 0xbc000;
-  *(uint64_t*)0x200011c0 = 0;
-  *(uint64_t*)0x200011c8 = 0;
-  *(uint64_t*)0x200011d0 = 0xbd000;
-  *(uint64_t*)0x200011d8 = 0;
-  *(uint64_t*)0x200011e0 = 0;
-  *(uint64_t*)0x200011e8 = 0xbe000;
-  *(uint64_t*)0x200011f0 = 0;
-  *(uint64_t*)0x200011f8 = 0;
-  *(uint64_t*)0x20001200 = 0xbf000;
-  *(uint64_t*)0x20001208 = 0;
-  *(uint64_t*)0x20001210 = 0;
-  *(uint64_t*)0x20001218 = 0xc0000;
-  *(uint64_t*)0x20001220 = 0;
-  *(uint64_t*)0x20001228 = 0;
-  *(uint64_t*)0x20001230 = 0xc1000;
-  *(uint64_t*)0x20001238 = 0;
-  *(uint64_t*)0x20001240 = 0;
-  *(uint64_t*)0x20001248 = 0xc2000;
-  *(uint64_t*)0x20001250 = 0;
-  *(uint64_t*)0x20001258 = 0;
-  *(uint64_t*)0x20001260 = 0xc3000;
-  *(uint64_t*)0x20001268 = 0;
-  *(uint64_t*)0x20001270 = 0;
-  *(uint64_t*)0x20001278 = 0xc4000;
-  *(uint64_t*)0x20001280 = 0;
-  *(uint64_t*)0x20001288 = 0;
-  *(uint64_t*)0x20001290 = 0xc5000;
-  *(uint64_t*)0x20001298 = 0;
-  *(uint64_t*)0x200012a0 = 0;
-  *(uint64_t*)0x200012a8 = 0xc6000;
-  *(uint64_t*)0x200012b0 = 0;
-  *(uint64_t*)0x200012b8 = 0;
-  *(uint64_t*)0x200012c0 = 0xc7000;
-  *(uint64_t*)0x200012c8 = 0;
-  *(uint64_t*)0x200012d0 = 0;
-  *(uint64_t*)0x200012d8 = 0xc8000;
-  *(uint64_t*)0x200012e0 = 0;
-  *(uint64_t*)0x200012e8 = 0;
-  *(uint64_t*)0x200012f0 = 0xc9000;
-  *(uint64_t*)0x200012f8 = 0;
-  *(uint64_t*)0x20001300 = 0;
-  *(uint64_t*)0x20001308 = 0xca000;
-  *(uint64_t*)0x20001310 = 0;
-  *(uint64_t*)0x20001318 = 0;
-  *(uint64_t*)0x20001320 = 0xcb000;
-  *(uint64_t*)0x20001328 = 0;
-  *(uint64_t*)0x20001330 = 0;
-  *(uint64_t*)0x20001338 = 0xcc000;
-  *(uint64_t*)0x20001340 = 0;
-  *(uint64_t*)0x20001348 = 0;
-  *(uint64_t*)0x20001350 = 0xcd000;
-  *(uint64_t*)0x20001358 = 0;
-  *(uint64_t*)0x20001360 = 0;
-  *(uint64_t*)0x20001368 = 0xce000;
-  *(uint64_t*)0x20001370 = 0;
-  *(uint64_t*)0x20001378 = 0;
-  *(uint64_t*)0x20001380 = 0xcf000;
-  *(uint64_t*)0x20001388 = 0;
-  *(uint64_t*)0x20001390 = 0;
-  *(uint64_t*)0x20001398 = 0xd0000;
-  *(uint64_t*)0x200013a0 = 0;
-  *(uint64_t*)0x200013a8 = 0;
-  *(uint64_t*)0x200013b0 = 0xd1000;
-  *(uint64_t*)0x200013b8 = 0;
-  *(uint64_t*)0x200013c0 = 0;
-  *(uint64_t*)0x200013c8 = 0xd2000;
-  *(uint64_t*)0x200013d0 = 0;
-  *(uint64_t*)0x200013d8 = 0;
-  *(uint64_t*)0x200013e0 = 0xd3000;
-  *(uint64_t*)0x200013e8 = 0;
-  *(uint64_t*)0x200013f0 = 0;
-  *(uint64_t*)0x200013f8 = 0xd4000;
-  *(uint64_t*)0x20001400 = 0;
-  *(uint64_t*)0x20001408 = 0;
-  *(uint64_t*)0x20001410 = 0xd5000;
-  *(uint64_t*)0x20001418 = 0;
-  *(uint64_t*)0x20001420 = 0;
-  *(uint64_t*)0x20001428 = 0xd6000;
-  *(uint64_t*)0x20001430 = 0;
-  *(uint64_t*)0x20001438 = 0;
-  *(uint64_t*)0x20001440 = 0xd7000;
-  *(uint64_t*)0x20001448 = 0;
-  *(uint64_t*)0x20001450 = 0;
-  *(uint64_t*)0x20001458 = 0xd8000;
-  *(uint64_t*)0x20001460 = 0;
-  *(uint64_t*)0x20001468 = 0;
-  *(uint64_t*)0x20001470 = 0xd9000;
-  *(uint64_t*)0x20001478 = 0;
-  *(uint64_t*)0x20001480 = 0;
-  *(uint64_t*)0x20001488 = 0xda000;
-  *(uint64_t*)0x20001490 = 0;
-  *(uint64_t*)0x20001498 = 0;
-  *(uint64_t*)0x200014a0 = 0xdb000;
-  *(uint64_t*)0x200014a8 = 0;
-  *(uint64_t*)0x200014b0 = 0;
-  *(uint64_t*)0x200014b8 = 0xdc000;
-  *(uint64_t*)0x200014c0 = 0;
-  *(uint64_t*)0x200014c8 = 0;
-  *(uint64_t*)0x200014d0 = 0xdd000;
-  *(uint64_t*)0x200014d8 = 0;
-  *(uint64_t*)0x200014e0 = 0;
-  *(uint64_t*)0x200014e8 = 0xde000;
-  *(uint64_t*)0x200014f0 = 0;
-  *(uint64_t*)0x200014f8 = 0;
-  *(uint64_t*)0x20001500 = 0xdf000;
-  *(uint64_t*)0x20001508 = 0;
-  *(uint64_t*)0x20001510 = 0;
-  *(uint64_t*)0x20001518 = 0xe0000;
-  *(uint64_t*)0x20001520 = 0;
-  *(uint64_t*)0x20001528 = 0;
-  *(uint64_t*)0x20001530 = 0xe1000;
-  *(uint64_t*)0x20001538 = 0;
-  *(uint64_t*)0x20001540 = 0;
-  *(uint64_t*)0x20001548 = 0xe2000;
-  *(uint64_t*)0x20001550 = 0;
-  *(uint64_t*)0x20001558 = 0;
-  *(uint64_t*)0x20001560 = 0xe3000;
-  *(uint64_t*)0x20001568 = 0;
-  *(uint64_t*)0x20001570 = 0;
-  *(uint64_t*)0x20001578 = 0xe4000;
-  *(uint64_t*)0x20001580 = 0;
-  *(uint64_t*)0x20001588 = 0;
-  *(uint64_t*)0x20001590 = 0xe5000;
-  *(uint64_t*)0x20001598 = 0;
-  *(uint64_t*)0x200015a0 = 0;
-  *(uint64_t*)0x200015a8 = 0xe6000;
-  *(uint64_t*)0x200015b0 = 0;
-  *(uint64_t*)0x200015b8 = 0;
-  *(uint64_t*)0x200015c0 = 0xe7000;
-  *(uint64_t*)0x200015c8 = 0;
-  *(uint64_t*)0x200015d0 = 0;
-  *(uint64_t*)0x200015d8 = 0xe8000;
-  *(uint64_t*)0x200015e0 = 0;
-  *(uint64_t*)0x200015e8 = 0;
-  *(uint64_t*)0x200015f0 = 0xe9000;
-  *(uint64_t*)0x200015f8 = 0;
-  *(uint64_t*)0x20001600 = 0;
-  *(uint64_t*)0x20001608 = 0xea000;
-  *(uint64_t*)0x20001610 = 0;
-  *(uint64_t*)0x20001618 = 0;
-  *(uint64_t*)0x20001620 = 0xeb000;
-  *(uint64_t*)0x20001628 = 0;
-  *(uint64_t*)0x20001630 = 0;
-  *(uint64_t*)0x20001638 = 0xec000;
-  *(uint64_t*)0x20001640 = 0;
-  *(uint64_t*)0x20001648 = 0;
-  *(uint64_t*)0x20001650 = 0xed000;
-  *(uint64_t*)0x20001658 = 0;
-  *(uint64_t*)0x20001660 = 0;
-  *(uint64_t*)0x20001668 = 0xee000;
-  *(uint64_t*)0x20001670 = 0;
-  *(uint64_t*)0x20001678 = 0;
-  *(uint64_t*)0x20001680 = 0xef000;
-  *(uint64_t*)0x20001688 = 0;
-  *(uint64_t*)0x20001690 = 0;
-  *(uint64_t*)0x20001698 = 0xf0000;
-  *(uint64_t*)0x200016a0 = 0;
-  *(uint64_t*)0x200016a8 = 0;
-  *(uint64_t*)0x200016b0 = 0xf1000;
-  *(uint64_t*)0x200016b8 = 0;
-  *(uint64_t*)0x200016c0 = 0;
-  *(uint64_t*)0x200016c8 = 0xf2000;
-  *(uint64_t*)0x200016d0 = 0;
-  *(uint64_t*)0x200016d8 = 0;
-  *(uint64_t*)0x200016e0 = 0xf3000;
-  *(uint64_t*)0x200016e8 = 0;
-  *(uint64_t*)0x200016f0 = 0;
-  *(uint64_t*)0x200016f8 = 0xf4000;
-  *(uint64_t*)0x20001700 = 0;
-  *(uint64_t*)0x20001708 = 0;
-  *(uint64_t*)0x20001710 = 0xf5000;
-  *(uint64_t*)0x20001718 = 0;
-  *(uint64_t*)0x20001720 = 0;
-  *(uint64_t*)0x20001728 = 0xf6000;
-  *(uint64_t*)0x20001730 = 0;
-  *(uint64_t*)0x20001738 = 0;
-  *(uint64_t*)0x20001740 = 0xf7000;
-  *(uint64_t*)0x20001748 = 0;
-  *(uint64_t*)0x20001750 = 0;
-  *(uint64_t*)0x20001758 = 0xf8000;
-  *(uint64_t*)0x20001760 = 0;
-  *(uint64_t*)0x20001768 = 0;
-  *(uint64_t*)0x20001770 = 0xf9000;
-  *(uint64_t*)0x20001778 = 0;
-  *(uint64_t*)0x20001780 = 0;
-  *(uint64_t*)0x20001788 = 0xfa000;
-  *(uint64_t*)0x20001790 = 0;
-  *(uint64_t*)0x20001798 = 0;
-  *(uint64_t*)0x200017a0 = 0xfb000;
-  *(uint64_t*)0x200017a8 = 0;
-  *(uint64_t*)0x200017b0 = 0;
-  *(uint64_t*)0x200017b8 = 0xfc000;
-  *(uint64_t*)0x200017c0 = 0;
-  *(uint64_t*)0x200017c8 = 0;
-  *(uint64_t*)0x200017d0 = 0xfd000;
-  *(uint64_t*)0x200017d8 = 0;
-  *(uint64_t*)0x200017e0 = 0;
-  *(uint64_t*)0x200017e8 = 0xfe000;
-  *(uint64_t*)0x200017f0 = 0;
-  *(uint64_t*)0x200017f8 = 0;
-  *(uint64_t*)0x20001800 = 0xff000;
-  *(uint64_t*)0x20001808 = 0;
-  *(uint64_t*)0x20001810 = 0;
-  *(uint64_t*)0x20001818 = 0x100000;
-  *(uint64_t*)0x20001820 = 0;
-  *(uint64_t*)0x20001828 = 0;
-  *(uint64_t*)0x20001830 = 0x101000;
-  *(uint64_t*)0x20001838 = 0;
-  *(uint64_t*)0x20001840 = 0;
-  *(uint64_t*)0x20001848 = 0x102000;
-  *(uint64_t*)0x20001850 = 0;
-  *(uint64_t*)0x20001858 = 0;
-  *(uint64_t*)0x20001860 = 0x103000;
-  *(uint64_t*)0x20001868 = 0;
-  *(uint64_t*)0x20001870 = 0;
-  *(uint64_t*)0x20001878 = 0x104000;
-  *(uint64_t*)0x20001880 = 0;
-  *(uint64_t*)0x20001888 = 0;
-  *(uint64_t*)0x20001890 = 0x105000;
-  *(uint64_t*)0x20001898 = 0;
-  *(uint64_t*)0x200018a0 = 0;
-  *(uint64_t*)0x200018a8 = 0x106000;
-  *(uint64_t*)0x200018b0 = 0;
-  *(uint64_t*)0x200018b8 = 0;
-  *(uint64_t*)0x200018c0 = 0x107000;
-  *(uint64_t*)0x200018c8 = 0;
-  *(uint64_t*)0x200018d0 = 0;
-  *(uint64_t*)0x200018d8 = 0x108000;
-  *(uint64_t*)0x200018e0 = 0;
-  *(uint64_t*)0x200018e8 = 0;
-  *(uint64_t*)0x200018f0 = 0x109000;
-  *(uint64_t*)0x200018f8 = 0;
-  *(uint64_t*)0x20001900 = 0;
-  *(uint64_t*)0x20001908 = 0x10a000;
-  *(uint64_t*)0x20001910 = 0;
-  *(uint64_t*)0x20001918 = 0;
-  *(uint64_t*)0x20001920 = 0x10b000;
-  *(uint64_t*)0x20001928 = 0;
-  *(uint64_t*)0x20001930 = 0;
-  *(uint64_t*)0x20001938 = 0x10c000;
-  *(uint64_t*)0x20001940 = 0;
-  *(uint64_t*)0x20001948 = 0;
-  *(uint64_t*)0x20001950 = 0x10d000;
-  *(uint64_t*)0x20001958 = 0;
-  *(uint64_t*)0x20001960 = 0;
-  *(uint64_t*)0x20001968 = 0x10e000;
-  *(uint64_t*)0x20001970 = 0;
-  *(uint64_t*)0x20001978 = 0;
-  *(uint64_t*)0x20001980 = 0x10f000;
-  *(uint64_t*)0x20001988 = 0;
-  *(uint64_t*)0x20001990 = 0;
-  *(uint64_t*)0x20001998 = 0x110000;
-  *(uint64_t*)0x200019a0 = 0;
-  *(uint64_t*)0x200019a8 = 0;
-  *(uint64_t*)0x200019b0 = 0x111000;
-  *(uint64_t*)0x200019b8 = 0;
-  *(uint64_t*)0x200019c0 = 0;
-  *(uint64_t*)0x200019c8 = 0x112000;
-  *(uint64_t*)0x200019d0 = 0;
-  *(uint64_t*)0x200019d8 = 0;
-  *(uint64_t*)0x200019e0 = 0x113000;
-  *(uint64_t*)0x200019e8 = 0;
-  *(uint64_t*)0x200019f0 = 0;
-  *(uint64_t*)0x200019f8 = 0x114000;
-  *(uint64_t*)0x20001a00 = 0;
-  *(uint64_t*)0x20001a08 = 0;
-  *(uint64_t*)0x20001a10 = 0x115000;
-  *(uint64_t*)0x20001a18 = 0;
-  *(uint64_t*)0x20001a20 = 0;
-  *(uint64_t*)0x20001a28 = 0x116000;
-  *(uint64_t*)0x20001a30 = 0;
-  *(uint64_t*)0x20001a38 = 0;
-  *(uint64_t*)0x20001a40 = 0x117000;
-  *(uint64_t*)0x20001a48 = 0;
-  *(uint64_t*)0x20001a50 = 0;
-  *(uint64_t*)0x20001a58 = 0x118000;
-  *(uint64_t*)0x20001a60 = 0;
-  *(uint64_t*)0x20001a68 = 0;
-  *(uint64_t*)0x20001a70 = 0x119000;
-  *(uint64_t*)0x20001a78 = 0;
-  *(uint64_t*)0x20001a80 = 0;
-  *(uint64_t*)0x20001a88 = 0x11a000;
-  *(uint64_t*)0x20001a90 = 0;
-  *(uint64_t*)0x20001a98 = 0;
-  *(uint64_t*)0x20001aa0 = 0x11b000;
-  *(uint64_t*)0x20001aa8 = 0;
-  *(uint64_t*)0x20001ab0 = 0;
-  *(uint64_t*)0x20001ab8 = 0x11c000;
-  *(uint64_t*)0x20001ac0 = 0;
-  *(uint64_t*)0x20001ac8 = 0;
-  *(uint64_t*)0x20001ad0 = 0x11d000;
-  *(uint64_t*)0x20001ad8 = 0;
-  *(uint64_t*)0x20001ae0 = 0;
-  *(uint64_t*)0x20001ae8 = 0x11e000;
-  *(uint64_t*)0x20001af0 = 0;
-  *(uint64_t*)0x20001af8 = 0;
-  *(uint64_t*)0x20001b00 = 0x11f000;
-  *(uint64_t*)0x20001b08 = 0;
-  *(uint64_t*)0x20001b10 = 0;
-  *(uint64_t*)0x20001b18 = 0x120000;
-  *(uint64_t*)0x20001b20 = 0;
-  *(uint64_t*)0x20001b28 = 0;
-  *(uint64_t*)0x20001b30 = 0x121000;
-  *(uint64_t*)0x20001b38 = 0;
-  *(uint64_t*)0x20001b40 = 0;
-  *(uint64_t*)0x20001b48 = 0x122000;
-  *(uint64_t*)0x20001b50 = 0;
-  *(uint64_t*)0x20001b58 = 0;
-  *(uint64_t*)0x20001b60 = 0x123000;
-  *(uint64_t*)0x20001b68 = 0;
-  *(uint64_t*)0x20001b70 = 0;
-  *(uint64_t*)0x20001b78 = 0x124000;
-  *(uint64_t*)0x20001b80 = 0;
-  *(uint64_t*)0x20001b88 = 0;
-  *(uint64_t*)0x20001b90 = 0x125000;
-  *(uint64_t*)0x20001b98 = 0;
-  *(uint64_t*)0x20001ba0 = 0;
-  *(uint64_t*)0x20001ba8 = 0x126000;
-  *(uint64_t*)0x20001bb0 = 0;
-  *(uint64_t*)0x20001bb8 = 0;
-  *(uint64_t*)0x20001bc0 = 0x127000;
-  *(uint64_t*)0x20001bc8 = 0;
-  *(uint64_t*)0x20001bd0 = 0;
-  *(uint64_t*)0x20001bd8 = 0x128000;
-  *(uint64_t*)0x20001be0 = 0;
-  *(uint64_t*)0x20001be8 = 0;
-  *(uint64_t*)0x20001bf0 = 0x129000;
-  *(uint64_t*)0x20001bf8 = 0;
-  *(uint64_t*)0x20001c00 = 0;
-  *(uint64_t*)0x20001c08 = 0x12a000;
-  *(uint64_t*)0x20001c10 = 0;
-  *(uint64_t*)0x20001c18 = 0;
-  *(uint64_t*)0x20001c20 = 0x12b000;
-  *(uint64_t*)0x20001c28 = 0;
-  *(uint64_t*)0x20001c30 = 0;
-  *(uint64_t*)0x20001c38 = 0x12c000;
-  *(uint64_t*)0x20001c40 = 0;
-  *(uint64_t*)0x20001c48 = 0;
-  *(uint64_t*)0x20001c50 = 0x12d000;
-  *(uint64_t*)0x20001c58 = 0;
-  *(uint64_t*)0x20001c60 = 0;
-  *(uint64_t*)0x20001c68 = 0x12e000;
-  *(uint64_t*)0x20001c70 = 0;
-  *(uint64_t*)0x20001c78 = 0;
-  *(uint64_t*)0x20001c80 = 0x12f000;
-  *(uint64_t*)0x20001c88 = 0;
-  *(uint64_t*)0x20001c90 = 0;
-  *(uint64_t*)0x20001c98 = 0x130000;
-  *(uint64_t*)0x20001ca0 = 0;
-  *(uint64_t*)0x20001ca8 = 0;
-  *(uint64_t*)0x20001cb0 = 0x131000;
-  *(uint64_t*)0x20001cb8 = 0;
-  *(uint64_t*)0x20001cc0 = 0;
-  *(uint64_t*)0x20001cc8 = 0x132000;
-  *(uint64_t*)0x20001cd0 = 0;
-  *(uint64_t*)0x20001cd8 = 0;
-  *(uint64_t*)0x20001ce0 = 0x133000;
-  *(uint64_t*)0x20001ce8 = 0;
-  *(uint64_t*)0x20001cf0 = 0;
-  *(uint64_t*)0x20001cf8 = 0x134000;
-  *(uint64_t*)0x20001d00 = 0;
-  *(uint64_t*)0x20001d08 = 0;
-  *(uint64_t*)0x20001d10 = 0x135000;
-  *(uint64_t*)0x20001d18 = 0;
-  *(uint64_t*)0x20001d20 = 0;
-  *(uint64_t*)0x20001d28 = 0x136000;
-  *(uint64_t*)0x20001d30 = 0;
-  *(uint64_t*)0x20001d38 = 0;
-  *(uint64_t*)0x20001d40 = 0x137000;
-  *(uint64_t*)0x20001d48 = 0;
-  *(uint64_t*)0x20001d50 = 0;
-  *(uint64_t*)0x20001d58 = 0x138000;
-  *(uint64_t*)0x20001d60 = 0;
-  *(uint64_t*)0x20001d68 = 0;
-  *(uint64_t*)0x20001d70 = 0x139000;
-  *(uint64_t*)0x20001d78 = 0;
-  *(uint64_t*)0x20001d80 = 0;
-  *(uint64_t*)0x20001d88 = 0x13a000;
-  *(uint64_t*)0x20001d90 = 0;
-  *(uint64_t*)0x20001d98 = 0;
-  *(uint64_t*)0x20001da0 = 0x13b000;
-  *(uint64_t*)0x20001da8 = 0;
-  *(uint64_t*)0x20001db0 = 0;
-  *(uint64_t*)0x20001db8 = 0x13c000;
-  *(uint64_t*)0x20001dc0 = 0;
-  *(uint64_t*)0x20001dc8 = 0;
-  *(uint64_t*)0x20001dd0 = 0x13d000;
-  *(uint64_t*)0x20001dd8 = 0;
-  *(uint64_t*)0x20001de0 = 0;
-  *(uint64_t*)0x20001de8 = 0x13e000;
-  *(uint64_t*)0x20001df0 = 0;
-  *(uint64_t*)0x20001df8 = 0;
-  *(uint64_t*)0x20001e00 = 0x13f000;
-  *(uint64_t*)0x20001e08 = 0;
-  *(uint64_t*)0x20001e10 = 0;
-  *(uint64_t*)0x20001e18 = 0x140000;
-  *(uint64_t*)0x20001e20 = 0;
-  *(uint64_t*)0x20001e28 = 0;
-  *(uint64_t*)0x20001e30 = 0x141000;
-  *(uint64_t*)0x20001e38 = 0;
-  *(uint64_t*)0x20001e40 = 0;
-  *(uint64_t*)0x20001e48 = 0x142000;
-  *(uint64_t*)0x20001e50 = 0;
-  *(uint64_t*)0x20001e58 = 0;
-  *(uint64_t*)0x20001e60 = 0x143000;
-  *(uint64_t*)0x20001e68 = 0;
-  *(uint64_t*)0x20001e70 = 0;
-  *(uint64_t*)0x20001e78 = 0x144000;
-  *(uint64_t*)0x20001e80 = 0;
-  *(uint64_t*)0x20001e88 = 0;
-  *(uint64_t*)0x20001e90 = 0x145000;
-  *(uint64_t*)0x20001e98 = 0;
-  *(uint64_t*)0x20001ea0 = 0;
-  *(uint64_t*)0x20001ea8 = 0x146000;
-  *(uint64_t*)0x20001eb0 = 0;
-  *(uint64_t*)0x20001eb8 = 0;
-  *(uint64_t*)0x20001ec0 = 0x147000;
-  *(uint64_t*)0x20001ec8 = 0;
-  *(uint64_t*)0x20001ed0 = 0;
-  *(uint64_t*)0x20001ed8 = 0x148000;
-  *(uint64_t*)0x20001ee0 = 0;
-  *(uint64_t*)0x20001ee8 = 0;
-  *(uint64_t*)0x20001ef0 = 0x149000;
-  *(uint64_t*)0x20001ef8 = 0;
-  *(uint64_t*)0x20001f00 = 0;
-  *(uint64_t*)0x20001f08 = 0x14a000;
-  *(uint64_t*)0x20001f10 = 0;
-  *(uint64_t*)0x20001f18 = 0;
-  *(uint64_t*)0x20001f20 = 0x14b000;
-  *(uint64_t*)0x20001f28 = 0;
-  *(uint64_t*)0x20001f30 = 0;
-  *(uint64_t*)0x20001f38 = 0x14c000;
-  *(uint64_t*)0x20001f40 = 0;
-  *(uint64_t*)0x20001f48 = 0;
-  *(uint64_t*)0x20001f50 = 0x14d000;
-  *(uint64_t*)0x20001f58 = 0;
-  *(uint64_t*)0x20001f60 = 0;
-  *(uint64_t*)0x20001f68 = 0x14e000;
-  *(uint64_t*)0x20001f70 = 0;
-  *(uint64_t*)0x20001f78 = 0;
-  *(uint64_t*)0x20001f80 = 0x14f000;
-  *(uint64_t*)0x20001f88 = 0;
-  *(uint64_t*)0x20001f90 = 0;
-  *(uint64_t*)0x20001f98 = 0x150000;
-  *(uint64_t*)0x20001fa0 = 0;
-  *(uint64_t*)0x20001fa8 = 0;
-  *(uint64_t*)0x20001fb0 = 0x151000;
-  *(uint64_t*)0x20001fb8 = 0;
-  *(uint64_t*)0x20001fc0 = 0;
-  *(uint64_t*)0x20001fc8 = 0x152000;
-  *(uint64_t*)0x20001fd0 = 0;
-  *(uint64_t*)0x20001fd8 = 0;
-  *(uint64_t*)0x20001fe0 = 0x153000;
-  *(uint64_t*)0x20001fe8 = 0;
-  *(uint64_t*)0x20001ff0 = 0;
-  *(uint64_t*)0x20001ff8 = 0x154000;
-  *(uint64_t*)0x20002000 = 0;
-  *(uint64_t*)0x20002008 = 0;
-  *(uint64_t*)0x20002010 = 0x155000;
-  *(uint64_t*)0x20002018 = 0;
-  *(uint64_t*)0x20002020 = 0;
-  *(uint64_t*)0x20002028 = 0x156000;
-  *(uint64_t*)0x20002030 = 0;
-  *(uint64_t*)0x20002038 = 0;
-  *(uint64_t*)0x20002040 = 0x157000;
-  *(uint64_t*)0x20002048 = 0;
-  *(uint64_t*)0x20002050 = 0;
-  *(uint64_t*)0x20002058 = 0x158000;
-  *(uint64_t*)0x20002060 = 0;
-  *(uint64_t*)0x20002068 = 0;
-  *(uint64_t*)0x20002070 = 0x159000;
-  *(uint64_t*)0x20002078 = 0;
-  *(uint64_t*)0x20002080 = 0;
-  *(uint64_t*)0x20002088 = 0x15a000;
-  *(uint64_t*)0x20002090 = 0;
-  *(uint64_t*)0x20002098 = 0;
-  *(uint64_t*)0x200020a0 = 0x15b000;
-  *(uint64_t*)0x200020a8 = 0;
-  *(uint64_t*)0x200020b0 = 0;
-  *(uint64_t*)0x200020b8 = 0x15c000;
-  *(uint64_t*)0x200020c0 = 0;
-  *(uint64_t*)0x200020c8 = 0;
-  *(uint64_t*)0x200020d0 = 0x15d000;
-  *(uint64_t*)0x200020d8 = 0;
-  *(uint64_t*)0x200020e0 = 0;
-  *(uint64_t*)0x200020e8 = 0x15e000;
-  *(uint64_t*)0x200020f0 = 0;
-  *(uint64_t*)0x200020f8 = 0;
-  *(uint64_t*)0x20002100 = 0x15f000;
-  *(uint64_t*)0x20002108 = 0;
-  *(uint64_t*)0x20002110 = 0;
-  *(uint64_t*)0x20002118 = 0x160000;
-  *(uint64_t*)0x20002120 = 0;
-  *(uint64_t*)0x20002128 = 0;
-  *(uint64_t*)0x20002130 = 0x161000;
-  *(uint64_t*)0x20002138 = 0;
-  *(uint64_t*)0x20002140 = 0;
-  *(uint64_t*)0x20002148 = 0x162000;
-  *(uint64_t*)0x20002150 = 0;
-  *(uint64_t*)0x20002158 = 0;
-  *(uint64_t*)0x20002160 = 0x163000;
-  *(uint64_t*)0x20002168 = 0;
-  *(uint64_t*)0x20002170 = 0;
-  *(uint64_t*)0x20002178 = 0x164000;
-  *(uint64_t*)0x20002180 = 0;
-  *(uint64_t*)0x20002188 = 0;
-  *(uint64_t*)0x20002190 = 0x165000;
-  *(uint64_t*)0x20002198 = 0;
-  *(uint64_t*)0x200021a0 = 0;
-  *(uint64_t*)0x200021a8 = 0x166000;
-  *(uint64_t*)0x200021b0 = 0;
-  *(uint64_t*)0x200021b8 = 0;
-  *(uint64_t*)0x200021c0 = 0x167000;
-  *(uint64_t*)0x200021c8 = 0;
-  *(uint64_t*)0x200021d0 = 0;
-  *(uint64_t*)0x200021d8 = 0x168000;
-  *(uint64_t*)0x200021e0 = 0;
-  *(uint64_t*)0x200021e8 = 0;
-  *(uint64_t*)0x200021f0 = 0x169000;
-  *(uint64_t*)0x200021f8 = 0;
-  *(uint64_t*)0x20002200 = 0;
-  *(uint64_t*)0x20002208 = 0x16a000;
-  *(uint64_t*)0x20002210 = 0;
-  *(uint64_t*)0x20002218 = 0;
-  *(uint64_t*)0x20002220 = 0x16b000;
-  *(uint64_t*)0x20002228 = 0;
-  *(uint64_t*)0x20002230 = 0;
-  *(uint64_t*)0x20002238 = 0x16c000;
-  *(uint64_t*)0x20002240 = 0;
-  *(uint64_t*)0x20002248 = 0;
-  *(uint64_t*)0x20002250 = 0x16d000;
-  *(uint64_t*)0x20002258 = 0;
-  *(uint64_t*)0x20002260 = 0;
-  *(uint64_t*)0x20002268 = 0x16e000;
-  *(uint64_t*)0x20002270 = 0;
-  *(uint64_t*)0x20002278 = 0;
-  *(uint64_t*)0x20002280 = 0x16f000;
-  *(uint64_t*)0x20002288 = 0;
-  *(uint64_t*)0x20002290 = 0;
-  *(uint64_t*)0x20002298 = 0x170000;
-  *(uint64_t*)0x200022a0 = 0;
-  *(uint64_t*)0x200022a8 = 0;
-  *(uint64_t*)0x200022b0 = 0x171000;
-  *(uint64_t*)0x200022b8 = 0;
-  *(uint64_t*)0x200022c0 = 0;
-  *(uint64_t*)0x200022c8 = 0x172000;
-  *(uint64_t*)0x200022d0 = 0;
-  *(uint64_t*)0x200022d8 = 0;
-  *(uint64_t*)0x200022e0 = 0x173000;
-  *(uint64_t*)0x200022e8 = 0;
-  *(uint64_t*)0x200022f0 = 0;
-  *(uint64_t*)0x200022f8 = 0x174000;
-  *(uint64_t*)0x20002300 = 0;
-  *(uint64_t*)0x20002308 = 0;
-  *(uint64_t*)0x20002310 = 0x175000;
-  *(uint64_t*)0x20002318 = 0;
-  *(uint64_t*)0x20002320 = 0;
-  *(uint64_t*)0x20002328 = 0x176000;
-  *(uint64_t*)0x20002330 = 0;
-  *(uint64_t*)0x20002338 = 0;
-  *(uint64_t*)0x20002340 = 0x177000;
-  *(uint64_t*)0x20002348 = 0;
-  *(uint64_t*)0x20002350 = 0;
-  *(uint64_t*)0x20002358 = 0x178000;
-  *(uint64_t*)0x20002360 = 0;
-  *(uint64_t*)0x20002368 = 0;
-  *(uint64_t*)0x20002370 = 0x179000;
-  *(uint64_t*)0x20002378 = 0;
-  *(uint64_t*)0x20002380 = 0;
-  *(uint64_t*)0x20002388 = 0x17a000;
-  *(uint64_t*)0x20002390 = 0;
-  *(uint64_t*)0x20002398 = 0;
-  *(uint64_t*)0x200023a0 = 0x17b000;
-  *(uint64_t*)0x200023a8 = 0;
-  *(uint64_t*)0x200023b0 = 0;
-  *(uint64_t*)0x200023b8 = 0x17c000;
-  *(uint64_t*)0x200023c0 = 0;
-  *(uint64_t*)0x200023c8 = 0;
-  *(uint64_t*)0x200023d0 = 0x17d000;
-  *(uint64_t*)0x200023d8 = 0;
-  *(uint64_t*)0x200023e0 = 0;
-  *(uint64_t*)0x200023e8 = 0x17e000;
-  *(uint64_t*)0x200023f0 = 0;
-  *(uint64_t*)0x200023f8 = 0;
-  *(uint64_t*)0x20002400 = 0x17f000;
-  *(uint64_t*)0x20002408 = 0;
-  *(uint64_t*)0x20002410 = 0;
-  *(uint64_t*)0x20002418 = 0x180000;
-  *(uint64_t*)0x20002420 = 0;
-  *(uint64_t*)0x20002428 = 0;
-  *(uint64_t*)0x20002430 = 0x181000;
-  *(uint64_t*)0x20002438 = 0;
-  *(uint64_t*)0x20002440 = 0;
-  *(uint64_t*)0x20002448 = 0x182000;
-  *(uint64_t*)0x20002450 = 0;
-  *(uint64_t*)0x20002458 = 0;
-  *(uint64_t*)0x20002460 = 0x183000;
-  *(uint64_t*)0x20002468 = 0;
-  *(uint64_t*)0x20002470 = 0;
-  *(uint64_t*)0x20002478 = 0x184000;
-  *(uint64_t*)0x20002480 = 0;
-  *(uint64_t*)0x20002488 = 0;
-  *(uint64_t*)0x20002490 = 0x185000;
-  *(uint64_t*)0x20002498 = 0;
-  *(uint64_t*)0x200024a0 = 0;
-  *(uint64_t*)0x200024a8 = 0x186000;
-  *(uint64_t*)0x200024b0 = 0;
-  *(uint64_t*)0x200024b8 = 0;
-  *(uint64_t*)0x200024c0 = 0x187000;
-  *(uint64_t*)0x200024c8 = 0;
-  *(uint64_t*)0x200024d0 = 0;
-  *(uint64_t*)0x200024d8 = 0x188000;
-  *(uint64_t*)0x200024e0 = 0;
-  *(uint64_t*)0x200024e8 = 0;
-  *(uint64_t*)0x200024f0 = 0x189000;
-  *(uint64_t*)0x200024f8 = 0;
-  *(uint64_t*)0x20002500 = 0;
-  *(uint64_t*)0x20002508 = 0x18a000;
-  *(uint64_t*)0x20002510 = 0;
-  *(uint64_t*)0x20002518 = 0;
-  *(uint64_t*)0x20002520 = 0x18b000;
-  *(uint64_t*)0x20002528 = 0;
-  *(uint64_t*)0x20002530 = 0;
-  *(uint64_t*)0x20002538 = 0x18c000;
-  *(uint64_t*)0x20002540 = 0;
-  *(uint64_t*)0x20002548 = 0;
-  *(uint64_t*)0x20002550 = 0x18d000;
-  *(uint64_t*)0x20002558 = 0;
-  *(uint64_t*)0x20002560 = 0;
-  *(uint64_t*)0x20002568 = 0x18e000;
-  *(uint64_t*)0x20002570 = 0;
-  *(uint64_t*)0x20002578 = 0;
-  *(uint64_t*)0x20002580 = 0x18f000;
-  *(uint64_t*)0x20002588 = 0;
-  *(uint64_t*)0x20002590 = 0;
-  *(uint64_t*)0x20002598 = 0x190000;
-  *(uint64_t*)0x200025a0 = 0;
-  *(uint64_t*)0x200025a8 = 0;
-  *(uint64_t*)0x200025b0 = 0x191000;
-  *(uint64_t*)0x200025b8 = 0;
-  *(uint64_t*)0x200025c0 = 0;
-  *(uint64_t*)0x200025c8 = 0x192000;
-  *(uint64_t*)0x200025d0 = 0;
-  *(uint64_t*)0x200025d8 = 0;
-  *(uint64_t*)0x200025e0 = 0x193000;
-  *(uint64_t*)0x200025e8 = 0;
-  *(uint64_t*)0x200025f0 = 0;
-  *(uint64_t*)0x200025f8 = 0x194000;
-  *(uint64_t*)0x20002600 = 0;
-  *(uint64_t*)0x20002608 = 0;
-  *(uint64_t*)0x20002610 = 0x195000;
-  *(uint64_t*)0x20002618 = 0;
-  *(uint64_t*)0x20002620 = 0;
-  *(uint64_t*)0x20002628 = 0x196000;
-  *(uint64_t*)0x20002630 = 0;
-  *(uint64_t*)0x20002638 = 0;
-  *(uint64_t*)0x20002640 = 0x197000;
-  *(uint64_t*)0x20002648 = 0;
-  *(uint64_t*)0x20002650 = 0;
-  *(uint64_t*)0x20002658 = 0x198000;
-  *(uint64_t*)0x20002660 = 0;
-  *(uint64_t*)0x20002668 = 0;
-  *(uint64_t*)0x20002670 = 0x199000;
-  *(uint64_t*)0x20002678 = 0;
-  *(uint64_t*)0x20002680 = 0;
-  *(uint64_t*)0x20002688 = 0x19a000;
-  *(uint64_t*)0x20002690 = 0;
-  *(uint64_t*)0x20002698 = 0;
-  *(uint64_t*)0x200026a0 = 0x19b000;
-  *(uint64_t*)0x200026a8 = 0;
-  *(uint64_t*)0x200026b0 = 0;
-  *(uint64_t*)0x200026b8 = 0x19c000;
-  *(uint64_t*)0x200026c0 = 0;
-  *(uint64_t*)0x200026c8 = 0;
-  *(uint64_t*)0x200026d0 = 0x19d000;
-  *(uint64_t*)0x200026d8 = 0;
-  *(uint64_t*)0x200026e0 = 0;
-  *(uint64_t*)0x200026e8 = 0x19e000;
-  *(uint64_t*)0x200026f0 = 0;
-  *(uint64_t*)0x200026f8 = 0;
-  *(uint64_t*)0x20002700 = 0x19f000;
-  *(uint64_t*)0x20002708 = 0;
-  *(uint64_t*)0x20002710 = 0;
-  *(uint64_t*)0x20002718 = 0x1a0000;
-  *(uint64_t*)0x20002720 = 0;
-  *(uint64_t*)0x20002728 = 0;
-  *(uint64_t*)0x20002730 = 0x1a1000;
-  *(uint64_t*)0x20002738 = 0;
-  *(uint64_t*)0x20002740 = 0;
-  *(uint64_t*)0x20002748 = 0x1a2000;
-  *(uint64_t*)0x20002750 = 0;
-  *(uint64_t*)0x20002758 = 0;
-  *(uint64_t*)0x20002760 = 0x1a3000;
-  *(uint64_t*)0x20002768 = 0;
-  *(uint64_t*)0x20002770 = 0;
-  *(uint64_t*)0x20002778 = 0x1a4000;
-  *(uint64_t*)0x20002780 = 0;
-  *(uint64_t*)0x20002788 = 0;
-  *(uint64_t*)0x20002790 = 0x1a5000;
-  *(uint64_t*)0x20002798 = 0;
-  *(uint64_t*)0x200027a0 = 0;
-  *(uint64_t*)0x200027a8 = 0x1a6000;
-  *(uint64_t*)0x200027b0 = 0;
-  *(uint64_t*)0x200027b8 = 0;
-  *(uint64_t*)0x200027c0 = 0x1a7000;
-  *(uint64_t*)0x200027c8 = 0;
-  *(uint64_t*)0x200027d0 = 0;
-  *(uint64_t*)0x200027d8 = 0x1a8000;
-  *(uint64_t*)0x200027e0 = 0;
-  *(uint64_t*)0x200027e8 = 0;
-  *(uint64_t*)0x200027f0 = 0x1a9000;
-  *(uint64_t*)0x200027f8 = 0;
-  *(uint64_t*)0x20002800 = 0;
-  *(uint64_t*)0x20002808 = 0x1aa000;
-  *(uint64_t*)0x20002810 = 0;
-  *(uint64_t*)0x20002818 = 0;
-  *(uint64_t*)0x20002820 = 0x1ab000;
-  *(uint64_t*)0x20002828 = 0;
-  *(uint64_t*)0x20002830 = 0;
-  *(uint64_t*)0x20002838 = 0x1ac000;
-  *(uint64_t*)0x20002840 = 0;
-  *(uint64_t*)0x20002848 = 0;
-  *(uint64_t*)0x20002850 = 0x1ad000;
-  *(uint64_t*)0x20002858 = 0;
-  *(uint64_t*)0x20002860 = 0;
-  *(uint64_t*)0x20002868 = 0x1ae000;
-  *(uint64_t*)0x20002870 = 0;
-  *(uint64_t*)0x20002878 = 0;
-  *(uint64_t*)0x20002880 = 0x1af000;
-  *(uint64_t*)0x20002888 = 0;
-  *(uint64_t*)0x20002890 = 0;
-  *(uint64_t*)0x20002898 = 0x1b0000;
-  *(uint64_t*)0x200028a0 = 0;
-  *(uint64_t*)0x200028a8 = 0;
-  *(uint64_t*)0x200028b0 = 0x1b1000;
-  *(uint64_t*)0x200028b8 = 0;
-  *(uint64_t*)0x200028c0 = 0;
-  *(uint64_t*)0x200028c8 = 0x1b2000;
-  *(uint64_t*)0x200028d0 = 0;
-  *(uint64_t*)0x200028d8 = 0;
-  *(uint64_t*)0x200028e0 = 0x1b3000;
-  *(uint64_t*)0x200028e8 = 0;
-  *(uint64_t*)0x200028f0 = 0;
-  *(uint64_t*)0x200028f8 = 0x1b4000;
-  *(uint64_t*)0x20002900 = 0;
-  *(uint64_t*)0x20002908 = 0;
-  *(uint64_t*)0x20002910 = 0x1b5000;
-  *(uint64_t*)0x20002918 = 0;
-  *(uint64_t*)0x20002920 = 0;
-  *(uint64_t*)0x20002928 = 0x1b6000;
-  *(uint64_t*)0x20002930 = 0;
-  *(uint64_t*)0x20002938 = 0;
-  *(uint64_t*)0x20002940 = 0x1b7000;
-  *(uint64_t*)0x20002948 = 0;
-  *(uint64_t*)0x20002950 = 0;
-  *(uint64_t*)0x20002958 = 0x1b8000;
-  *(uint64_t*)0x20002960 = 0;
-  *(uint64_t*)0x20002968 = 0;
-  *(uint64_t*)0x20002970 = 0x1b9000;
-  *(uint64_t*)0x20002978 = 0;
-  *(uint64_t*)0x20002980 = 0;
-  *(uint64_t*)0x20002988 = 0x1ba000;
-  *(uint64_t*)0x20002990 = 0;
-  *(uint64_t*)0x20002998 = 0;
-  *(uint64_t*)0x200029a0 = 0x1bb000;
-  *(uint64_t*)0x200029a8 = 0;
-  *(uint64_t*)0x200029b0 = 0;
-  *(uint64_t*)0x200029b8 = 0x1bc000;
-  *(uint64_t*)0x200029c0 = 0;
-  *(uint64_t*)0x200029c8 = 0;
-  *(uint64_t*)0x200029d0 = 0x1bd000;
-  *(uint64_t*)0x200029d8 = 0;
-  *(uint64_t*)0x200029e0 = 0;
-  *(uint64_t*)0x200029e8 = 0x1be000;
-  *(uint64_t*)0x200029f0 = 0;
-  *(uint64_t*)0x200029f8 = 0;
-  *(uint64_t*)0x20002a00 = 0x1bf000;
-  *(uint64_t*)0x20002a08 = 0;
-  *(uint64_t*)0x20002a10 = 0;
-  *(uint64_t*)0x20002a18 = 0x1c0000;
-  *(uint64_t*)0x20002a20 = 0;
-  *(uint64_t*)0x20002a28 = 0;
-  *(uint64_t*)0x20002a30 = 0x1c1000;
-  *(uint64_t*)0x20002a38 = 0;
-  *(uint64_t*)0x20002a40 = 0;
-  *(uint64_t*)0x20002a48 = 0x1c2000;
-  *(uint64_t*)0x20002a50 = 0;
-  *(uint64_t*)0x20002a58 = 0;
-  *(uint64_t*)0x20002a60 = 0x1c3000;
-  *(uint64_t*)0x20002a68 = 0;
-  *(uint64_t*)0x20002a70 = 0;
-  *(uint64_t*)0x20002a78 = 0x1c4000;
-  *(uint64_t*)0x20002a80 = 0;
-  *(uint64_t*)0x20002a88 = 0;
-  *(uint64_t*)0x20002a90 = 0x1c5000;
-  *(uint64_t*)0x20002a98 = 0;
-  *(uint64_t*)0x20002aa0 = 0;
-  *(uint64_t*)0x20002aa8 = 0x1c6000;
-  *(uint64_t*)0x20002ab0 = 0;
-  *(uint64_t*)0x20002ab8 = 0;
-  *(uint64_t*)0x20002ac0 = 0x1c7000;
-  *(uint64_t*)0x20002ac8 = 0;
-  *(uint64_t*)0x20002ad0 = 0;
-  *(uint64_t*)0x20002ad8 = 0x1c8000;
-  *(uint64_t*)0x20002ae0 = 0;
-  *(uint64_t*)0x20002ae8 = 0;
-  *(uint64_t*)0x20002af0 = 0x1c9000;
-  *(uint64_t*)0x20002af8 = 0;
-  *(uint64_t*)0x20002b00 = 0;
-  *(uint64_t*)0x20002b08 = 0x1ca000;
-  *(uint64_t*)0x20002b10 = 0;
-  *(uint64_t*)0x20002b18 = 0;
-  *(uint64_t*)0x20002b20 = 0x1cb000;
-  *(uint64_t*)0x20002b28 = 0;
-  *(uint64_t*)0x20002b30 = 0;
-  *(uint64_t*)0x20002b38 = 0x1cc000;
-  *(uint64_t*)0x20002b40 = 0;
-  *(uint64_t*)0x20002b48 = 0;
-  *(uint64_t*)0x20002b50 = 0x1cd000;
-  *(uint64_t*)0x20002b58 = 0;
-  *(uint64_t*)0x20002b60 = 0;
-  *(uint64_t*)0x20002b68 = 0x1ce000;
-  *(uint64_t*)0x20002b70 = 0;
-  *(uint64_t*)0x20002b78 = 0;
-  *(uint64_t*)0x20002b80 = 0x1cf000;
-  *(uint64_t*)0x20002b88 = 0;
-  *(uint64_t*)0x20002b90 = 0;
-  *(uint64_t*)0x20002b98 = 0x1d0000;
-  *(uint64_t*)0x20002ba0 = 0;
-  *(uint64_t*)0x20002ba8 = 0;
-  *(uint64_t*)0x20002bb0 = 0x1d1000;
-  *(uint64_t*)0x20002bb8 = 0;
-  *(uint64_t*)0x20002bc0 = 0;
-  *(uint64_t*)0x20002bc8 = 0x1d2000;
-  *(uint64_t*)0x20002bd0 = 0;
-  *(uint64_t*)0x20002bd8 = 0;
-  *(uint64_t*)0x20002be0 = 0x1d3000;
-  *(uint64_t*)0x20002be8 = 0;
-  *(uint64_t*)0x20002bf0 = 0;
-  *(uint64_t*)0x20002bf8 = 0x1d4000;
-  *(uint64_t*)0x20002c00 = 0;
-  *(uint64_t*)0x20002c08 = 0;
-  *(uint64_t*)0x20002c10 = 0x1d5000;
-  *(uint64_t*)0x20002c18 = 0;
-  *(uint64_t*)0x20002c20 = 0;
-  *(uint64_t*)0x20002c28 = 0x1d6000;
-  *(uint64_t*)0x20002c30 = 0;
-  *(uint64_t*)0x20002c38 = 0;
-  *(uint64_t*)0x20002c40 = 0x1d7000;
-  *(uint64_t*)0x20002c48 = 0;
-  *(uint64_t*)0x20002c50 = 0;
-  *(uint64_t*)0x20002c58 = 0x1d8000;
-  *(uint64_t*)0x20002c60 = 0;
-  *(uint64_t*)0x20002c68 = 0;
-  *(uint64_t*)0x20002c70 = 0x1d9000;
-  *(uint64_t*)0x20002c78 = 0;
-  *(uint64_t*)0x20002c80 = 0;
-  *(uint64_t*)0x20002c88 = 0x1da000;
-  *(uint64_t*)0x20002c90 = 0;
-  *(uint64_t*)0x20002c98 = 0;
-  *(uint64_t*)0x20002ca0 = 0x1db000;
-  *(uint64_t*)0x20002ca8 = 0;
-  *(uint64_t*)0x20002cb0 = 0;
-  *(uint64_t*)0x20002cb8 = 0x1dc000;
-  *(uint64_t*)0x20002cc0 = 0;
-  *(uint64_t*)0x20002cc8 = 0;
-  *(uint64_t*)0x20002cd0 = 0x1dd000;
-  *(uint64_t*)0x20002cd8 = 0;
-  *(uint64_t*)0x20002ce0 = 0;
-  *(uint64_t*)0x20002ce8 = 0x1de000;
-  *(uint64_t*)0x20002cf0 = 0;
-  *(uint64_t*)0x20002cf8 = 0;
-  *(uint64_t*)0x20002d00 = 0x1df000;
-  *(uint64_t*)0x20002d08 = 0;
-  *(uint64_t*)0x20002d10 = 0;
-  *(uint64_t*)0x20002d18 = 0x1e0000;
-  *(uint64_t*)0x20002d20 = 0;
-  *(uint64_t*)0x20002d28 = 0;
-  *(uint64_t*)0x20002d30 = 0x1e1000;
-  *(uint64_t*)0x20002d38 = 0;
-  *(uint64_t*)0x20002d40 = 0;
-  *(uint64_t*)0x20002d48 = 0x1e2000;
-  *(uint64_t*)0x20002d50 = 0;
-  *(uint64_t*)0x20002d58 = 0;
-  *(uint64_t*)0x20002d60 = 0x1e3000;
-  *(uint64_t*)0x20002d68 = 0;
-  *(uint64_t*)0x20002d70 = 0;
-  *(uint64_t*)0x20002d78 = 0x1e4000;
-  *(uint64_t*)0x20002d80 = 0;
-  *(uint64_t*)0x20002d88 = 0;
-  *(uint64_t*)0x20002d90 = 0x1e5000;
-  *(uint64_t*)0x20002d98 = 0;
-  *(uint64_t*)0x20002da0 = 0;
-  *(uint64_t*)0x20002da8 = 0x1e6000;
-  *(uint64_t*)0x20002db0 = 0;
-  *(uint64_t*)0x20002db8 = 0;
-  *(uint64_t*)0x20002dc0 = 0x1e7000;
-  *(uint64_t*)0x20002dc8 = 0;
-  *(uint64_t*)0x20002dd0 = 0;
-  *(uint64_t*)0x20002dd8 = 0x1e8000;
-  *(uint64_t*)0x20002de0 = 0;
-  *(uint64_t*)0x20002de8 = 0;
-  *(uint64_t*)0x20002df0 = 0x1e9000;
-  *(uint64_t*)0x20002df8 = 0;
-  *(uint64_t*)0x20002e00 = 0;
-  *(uint64_t*)0x20002e08 = 0x1ea000;
-  *(uint64_t*)0x20002e10 = 0;
-  *(uint64_t*)0x20002e18 = 0;
-  *(uint64_t*)0x20002e20 = 0x1eb000;
-  *(uint64_t*)0x20002e28 = 0;
-  *(uint64_t*)0x20002e30 = 0;
-  *(uint64_t*)0x20002e38 = 0x1ec000;
-  *(uint64_t*)0x20002e40 = 0;
-  *(uint64_t*)0x20002e48 = 0;
-  *(uint64_t*)0x20002e50 = 0x1ed000;
-  *(uint64_t*)0x20002e58 = 0;
-  *(uint64_t*)0x20002e60 = 0;
-  *(uint64_t*)0x20002e68 = 0x1ee000;
-  *(uint64_t*)0x20002e70 = 0;
-  *(uint64_t*)0x20002e78 = 0;
-  *(uint64_t*)0x20002e80 = 0x1ef000;
-  *(uint64_t*)0x20002e88 = 0;
-  *(uint64_t*)0x20002e90 = 0;
-  *(uint64_t*)0x20002e98 = 0x1f0000;
-  *(uint64_t*)0x20002ea0 = 0;
-  *(uint64_t*)0x20002ea8 = 0;
-  *(uint64_t*)0x20002eb0 = 0x1f1000;
-  *(uint64_t*)0x20002eb8 = 0;
-  *(uint64_t*)0x20002ec0 = 0;
-  *(uint64_t*)0x20002ec8 = 0x1f2000;
-  *(uint64_t*)0x20002ed0 = 0;
-  *(uint64_t*)0x20002ed8 = 0;
-  *(uint64_t*)0x20002ee0 = 0x1f3000;
-  *(uint64_t*)0x20002ee8 = 0;
-  *(uint64_t*)0x20002ef0 = 0;
-  *(uint64_t*)0x20002ef8 = 0x1f4000;
-  *(uint64_t*)0x20002f00 = 0;
-  *(uint64_t*)0x20002f08 = 0;
-  *(uint64_t*)0x20002f10 = 0x1f5000;
-  *(uint64_t*)0x20002f18 = 0;
-  *(uint64_t*)0x20002f20 = 0;
-  *(uint64_t*)0x20002f28 = 0x1f6000;
-  *(uint64_t*)0x20002f30 = 0;
-  *(uint64_t*)0x20002f38 = 0;
-  *(uint64_t*)0x20002f40 = 0x1f7000;
-  *(uint64_t*)0x20002f48 = 0;
-  *(uint64_t*)0x20002f50 = 0;
-  *(uint64_t*)0x20002f58 = 0x1f8000;
-  *(uint64_t*)0x20002f60 = 0;
-  *(uint64_t*)0x20002f68 = 0;
-  *(uint64_t*)0x20002f70 = 0x1f9000;
-  *(uint64_t*)0x20002f78 = 0;
-  *(uint64_t*)0x20002f80 = 0;
-  *(uint64_t*)0x20002f88 = 0x1fa000;
-  *(uint64_t*)0x20002f90 = 0;
-  *(uint64_t*)0x20002f98 = 0;
-  *(uint64_t*)0x20002fa0 = 0x1fb000;
-  *(uint64_t*)0x20002fa8 = 0;
-  *(uint64_t*)0x20002fb0 = 0;
-  *(uint64_t*)0x20002fb8 = 0x1fc000;
-  *(uint64_t*)0x20002fc0 = 0;
-  *(uint64_t*)0x20002fc8 = 0;
-  *(uint64_t*)0x20002fd0 = 0x1fd000;
-  *(uint64_t*)0x20002fd8 = 0;
-  *(uint64_t*)0x20002fe0 = 0;
-  *(uint64_t*)0x20002fe8 = 0x1fe000;
-  *(uint64_t*)0x20002ff0 = 0;
-  *(uint64_t*)0x20002ff8 = 0;
-  *(uint64_t*)0x20003000 = 0x1ff000;
-  *(uint64_t*)0x20003008 = 0;
-  *(uint64_t*)0x20003010 = 0;
-  *(uint64_t*)0x20003018 = 0x200000;
-  *(uint64_t*)0x20003020 = 0;
-  *(uint64_t*)0x20003028 = 0;
-  *(uint64_t*)0x20003030 = 0x201000;
-  *(uint64_t*)0x20003038 = 0;
-  *(uint64_t*)0x20003040 = 0;
-  *(uint64_t*)0x20003048 = 0x202000;
-  *(uint64_t*)0x20003050 = 0;
-  *(uint64_t*)0x20003058 = 0;
-  *(uint64_t*)0x20003060 = 0x203000;
-  *(uint64_t*)0x20003068 = 0;
-  *(uint64_t*)0x20003070 = 0;
-  *(uint64_t*)0x20003078 = 0x204000;
-  *(uint64_t*)0x20003080 = 0;
-  *(uint64_t*)0x20003088 = 0;
-  *(uint64_t*)0x20003090 = 0x205000;
-  *(uint64_t*)0x20003098 = 0;
-  *(uint64_t*)0x200030a0 = 0;
-  *(uint64_t*)0x200030a8 = 0x206000;
-  *(uint64_t*)0x200030b0 = 0;
-  *(uint64_t*)0x200030b8 = 0;
-  *(uint64_t*)0x200030c0 = 0x207000;
-  *(uint64_t*)0x200030c8 = 0;
-  *(uint64_t*)0x200030d0 = 0;
-  *(uint64_t*)0x200030d8 = 0x208000;
-  *(uint64_t*)0x200030e0 = 0;
-  *(uint64_t*)0x200030e8 = 0;
-  *(uint64_t*)0x200030f0 = 0x209000;
-  *(uint64_t*)0x200030f8 = 0;
-  *(uint64_t*)0x20003100 = 0;
-  *(uint64_t*)0x20003108 = 0x20a000;
-  *(uint64_t*)0x20003110 = 0;
-  *(uint64_t*)0x20003118 = 0;
-  *(uint64_t*)0x20003120 = 0x20b000;
-  *(uint64_t*)0x20003128 = 0;
-  *(uint64_t*)0x20003130 = 0;
-  *(uint64_t*)0x20003138 = 0x20c000;
-  *(uint64_t*)0x20003140 = 0;
-  *(uint64_t*)0x20003148 = 0;
-  *(uint64_t*)0x20003150 = 0x20d000;
-  *(uint64_t*)0x20003158 = 0;
-  *(uint64_t*)0x20003160 = 0;
-  *(uint64_t*)0x20003168 = 0x20e000;
-  *(uint64_t*)0x20003170 = 0;
-  *(uint64_t*)0x20003178 = 0;
-  *(uint64_t*)0x20003180 = 0x20f000;
-  *(uint64_t*)0x20003188 = 0;
-  *(uint64_t*)0x20003190 = 0;
-  *(uint64_t*)0x20003198 = 0x210000;
-  *(uint64_t*)0x200031a0 = 0;
-  *(uint64_t*)0x200031a8 = 0;
-  *(uint64_t*)0x200031b0 = 0x211000;
-  *(uint64_t*)0x200031b8 = 0;
-  *(uint64_t*)0x200031c0 = 0;
-  *(uint64_t*)0x200031c8 = 0x212000;
-  *(uint64_t*)0x200031d0 = 0;
-  *(uint64_t*)0x200031d8 = 0;
-  *(uint64_t*)0x200031e0 = 0x213000;
-  *(uint64_t*)0x200031e8 = 0;
-  *(uint64_t*)0x200031f0 = 0;
-  *(uint64_t*)0x200031f8 = 0x214000;
-  *(uint64_t*)0x20003200 = 0;
-  *(uint64_t*)0x20003208 = 0;
-  *(uint64_t*)0x20003210 = 0x215000;
-  *(uint64_t*)0x20003218 = 0;
-  *(uint64_t*)0x20003220 = 0;
-  *(uint64_t*)0x20003228 = 0x216000;
-  *(uint64_t*)0x20003230 = 0;
-  *(uint64_t*)0x20003238 = 0;
-  *(uint64_t*)0x20003240 = 0x217000;
-  *(uint64_t*)0x20003248 = 0;
-  *(uint64_t*)0x20003250 = 0;
-  *(uint64_t*)0x20003258 = 0x218000;
-  *(uint64_t*)0x20003260 = 0;
-  *(uint64_t*)0x20003268 = 0;
-  *(uint64_t*)0x20003270 = 0x219000;
-  *(uint64_t*)0x20003278 = 0;
-  *(uint64_t*)0x20003280 = 0;
-  *(uint64_t*)0x20003288 = 0x21a000;
-  *(uint64_t*)0x20003290 = 0;
-  *(uint64_t*)0x20003298 = 0;
-  *(uint64_t*)0x200032a0 = 0x21b000;
-  *(uint64_t*)0x200032a8 = 0;
-  *(uint64_t*)0x200032b0 = 0;
-  *(uint64_t*)0x200032b8 = 0x21c000;
-  *(uint64_t*)0x200032c0 = 0;
-  *(uint64_t*)0x200032c8 = 0;
-  *(uint64_t*)0x200032d0 = 0x21d000;
-  *(uint64_t*)0x200032d8 = 0;
-  *(uint64_t*)0x200032e0 = 0;
-  *(uint64_t*)0x200032e8 = 0x21e000;
-  *(uint64_t*)0x200032f0 = 0;
-  *(uint64_t*)0x200032f8 = 0;
-  *(uint64_t*)0x20003300 = 0x21f000;
-  *(uint64_t*)0x20003308 = 0;
-  *(uint64_t*)0x20003310 = 0;
-  *(uint64_t*)0x20003318 = 0x220000;
-  *(uint64_t*)0x20003320 = 0;
-  *(uint64_t*)0x20003328 = 0;
-  *(uint64_t*)0x20003330 = 0x221000;
-  *(uint64_t*)0x20003338 = 0;
-  *(uint64_t*)0x20003340 = 0;
-  *(uint64_t*)0x20003348 = 0x222000;
-  *(uint64_t*)0x20003350 = 0;
-  *(uint64_t*)0x20003358 = 0;
-  *(uint64_t*)0x20003360 = 0x223000;
-  *(uint64_t*)0x20003368 = 0;
-  *(uint64_t*)0x20003370 = 0;
-  *(uint64_t*)0x20003378 = 0x224000;
-  *(uint64_t*)0x20003380 = 0;
-  *(uint64_t*)0x20003388 = 0;
-  *(uint64_t*)0x20003390 = 0x225000;
-  *(uint64_t*)0x20003398 = 0;
-  *(uint64_t*)0x200033a0 = 0;
-  *(uint64_t*)0x200033a8 = 0x226000;
-  *(uint64_t*)0x200033b0 = 0;
-  *(uint64_t*)0x200033b8 = 0;
-  *(uint64_t*)0x200033c0 = 0x227000;
-  *(uint64_t*)0x200033c8 = 0;
-  *(uint64_t*)0x200033d0 = 0;
-  *(uint64_t*)0x200033d8 = 0x228000;
-  *(uint64_t*)0x200033e0 = 0;
-  *(uint64_t*)0x200033e8 = 0;
-  *(uint64_t*)0x200033f0 = 0x229000;
-  *(uint64_t*)0x200033f8 = 0;
-  *(uint64_t*)0x20003400 = 0;
-  *(uint64_t*)0x20003408 = 0x22a000;
-  *(uint64_t*)0x20003410 = 0;
-  *(uint64_t*)0x20003418 = 0;
-  *(uint64_t*)0x20003420 = 0x22b000;
-  *(uint64_t*)0x20003428 = 0;
-  *(uint64_t*)0x20003430 = 0;
-  *(uint64_t*)0x20003438 = 0x22c000;
-  *(uint64_t*)0x20003440 = 0;
-  *(uint64_t*)0x20003448 = 0;
-  *(uint64_t*)0x20003450 = 0x22d000;
-  *(uint64_t*)0x20003458 = 0;
-  *(uint64_t*)0x20003460 = 0;
-  *(uint64_t*)0x20003468 = 0x22e000;
-  *(uint64_t*)0x20003470 = 0;
-  *(uint64_t*)0x20003478 = 0;
-  *(uint64_t*)0x20003480 = 0x22f000;
-  *(uint64_t*)0x20003488 = 0;
-  *(uint64_t*)0x20003490 = 0;
-  *(uint64_t*)0x20003498 = 0x230000;
-  *(uint64_t*)0x200034a0 = 0;
-  *(uint64_t*)0x200034a8 = 0;
-  *(uint64_t*)0x200034b0 = 0x231000;
-  *(uint64_t*)0x200034b8 = 0;
-  *(uint64_t*)0x200034c0 = 0;
-  *(uint64_t*)0x200034c8 = 0x232000;
-  *(uint64_t*)0x200034d0 = 0;
-  *(uint64_t*)0x200034d8 = 0;
-  *(uint64_t*)0x200034e0 = 0x233000;
-  *(uint64_t*)0x200034e8 = 0;
-  *(uint64_t*)0x200034f0 = 0;
-  *(uint64_t*)0x200034f8 = 0x234000;
-  *(uint64_t*)0x20003500 = 0;
-  *(uint64_t*)0x20003508 = 0;
-  *(uint64_t*)0x20003510 = 0x235000;
-  *(uint64_t*)0x20003518 = 0;
-  *(uint64_t*)0x20003520 = 0;
-  *(uint64_t*)0x20003528 = 0x236000;
-  *(uint64_t*)0x20003530 = 0;
-  *(uint64_t*)0x20003538 = 0;
-  *(uint64_t*)0x20003540 = 0x237000;
-  *(uint64_t*)0x20003548 = 0;
-  *(uint64_t*)0x20003550 = 0;
-  *(uint64_t*)0x20003558 = 0x238000;
-  *(uint64_t*)0x20003560 = 0;
-  *(uint64_t*)0x20003568 = 0;
-  *(uint64_t*)0x20003570 = 0x239000;
-  *(uint64_t*)0x20003578 = 0;
-  *(uint64_t*)0x20003580 = 0;
-  *(uint64_t*)0x20003588 = 0x23a000;
-  *(uint64_t*)0x20003590 = 0;
-  *(uint64_t*)0x20003598 = 0;
-  *(uint64_t*)0x200035a0 = 0x23b000;
-  *(uint64_t*)0x200035a8 = 0;
-  *(uint64_t*)0x200035b0 = 0;
-  *(uint64_t*)0x200035b8 = 0x23c000;
-  *(uint64_t*)0x200035c0 = 0;
-  *(uint64_t*)0x200035c8 = 0;
-  *(uint64_t*)0x200035d0 = 0x23d000;
-  *(uint64_t*)0x200035d8 = 0;
-  *(uint64_t*)0x200035e0 = 0;
-  *(uint64_t*)0x200035e8 = 0x23e000;
-  *(uint64_t*)0x200035f0 = 0;
-  *(uint64_t*)0x200035f8 = 0;
-  *(uint64_t*)0x20003600 = 0x23f000;
-  *(uint64_t*)0x20003608 = 0;
-  *(uint64_t*)0x20003610 = 0;
-  *(uint64_t*)0x20003618 = 0x240000;
-  *(uint64_t*)0x20003620 = 0;
-  *(uint64_t*)0x20003628 = 0;
-  *(uint64_t*)0x20003630 = 0x241000;
-  *(uint64_t*)0x20003638 = 0;
-  *(uint64_t*)0x20003640 = 0;
-  *(uint64_t*)0x20003648 = 0x242000;
-  *(uint64_t*)0x20003650 = 0;
-  *(uint64_t*)0x20003658 = 0;
-  *(uint64_t*)0x20003660 = 0x243000;
-  *(uint64_t*)0x20003668 = 0;
-  *(uint64_t*)0x20003670 = 0;
-  *(uint64_t*)0x20003678 = 0x244000;
-  *(uint64_t*)0x20003680 = 0;
-  *(uint64_t*)0x20003688 = 0;
-  *(uint64_t*)0x20003690 = 0x245000;
-  *(uint64_t*)0x20003698 = 0;
-  *(uint64_t*)0x200036a0 = 0;
-  *(uint64_t*)0x200036a8 = 0x246000;
-  *(uint64_t*)0x200036b0 = 0;
-  *(uint64_t*)0x200036b8 = 0;
-  *(uint64_t*)0x200036c0 = 0x247000;
-  *(uint64_t*)0x200036c8 = 0;
-  *(uint64_t*)0x200036d0 = 0;
-  *(uint64_t*)0x200036d8 = 0x248000;
-  *(uint64_t*)0x200036e0 = 0;
-  *(uint64_t*)0x200036e8 = 0;
-  *(uint64_t*)0x200036f0 = 0x249000;
-  *(uint64_t*)0x200036f8 = 0;
-  *(uint64_t*)0x20003700 = 0;
-  *(uint64_t*)0x20003708 = 0x24a000;
-  *(uint64_t*)0x20003710 = 0;
-  *(uint64_t*)0x20003718 = 0;
-  *(uint64_t*)0x20003720 = 0x24b000;
-  *(uint64_t*)0x20003728 = 0;
-  *(uint64_t*)0x20003730 = 0;
-  *(uint64_t*)0x20003738 = 0x24c000;
-  *(uint64_t*)0x20003740 = 0;
-  *(uint64_t*)0x20003748 = 0;
-  *(uint64_t*)0x20003750 = 0x24d000;
-  *(uint64_t*)0x20003758 = 0;
-  *(uint64_t*)0x20003760 = 0;
-  *(uint64_t*)0x20003768 = 0x24e000;
-  *(uint64_t*)0x20003770 = 0;
-  *(uint64_t*)0x20003778 = 0;
-  *(uint64_t*)0x20003780 = 0x24f000;
-  *(uint64_t*)0x20003788 = 0;
-  *(uint64_t*)0x20003790 = 0;
-  *(uint64_t*)0x20003798 = 0x250000;
-  *(uint64_t*)0x200037a0 = 0;
-  *(uint64_t*)0x200037a8 = 0;
-  *(uint64_t*)0x200037b0 = 0x251000;
-  *(uint64_t*)0x200037b8 = 0;
-  *(uint64_t*)0x200037c0 = 0;
-  *(uint64_t*)0x200037c8 = 0x252000;
-  *(uint64_t*)0x200037d0 = 0;
-  *(uint64_t*)0x200037d8 = 0;
-  *(uint64_t*)0x200037e0 = 0x253000;
-  *(uint64_t*)0x200037e8 = 0;
-  *(uint64_t*)0x200037f0 = 0;
-  *(uint64_t*)0x200037f8 = 0x254000;
-  *(uint64_t*)0x20003800 = 0;
-  *(uint64_t*)0x20003808 = 0;
-  *(uint64_t*)0x20003810 = 0x255000;
-  *(uint64_t*)0x20003818 = 0;
-  *(uint64_t*)0x20003820 = 0;
-  *(uint64_t*)0x20003828 = 0x256000;
-  *(uint64_t*)0x20003830 = 0;
-  *(uint64_t*)0x20003838 = 0;
-  *(uint64_t*)0x20003840 = 0x257000;
-  *(uint64_t*)0x20003848 = 0;
-  *(uint64_t*)0x20003850 = 0;
-  *(uint64_t*)0x20003858 = 0x258000;
-  *(uint64_t*)0x20003860 = 0;
-  *(uint64_t*)0x20003868 = 0;
-  *(uint64_t*)0x20003870 = 0x259000;
-  *(uint64_t*)0x20003878 = 0;
-  *(uint64_t*)0x20003880 = 0;
-  *(uint64_t*)0x20003888 = 0x25a000;
-  *(uint64_t*)0x20003890 = 0;
-  *(uint64_t*)0x20003898 = 0;
-  *(uint64_t*)0x200038a0 = 0x25b000;
-  *(uint64_t*)0x200038a8 = 0;
-  *(uint64_t*)0x200038b0 = 0;
-  *(uint64_t*)0x200038b8 = 0x25c000;
-  *(uint64_t*)0x200038c0 = 0;
-  *(uint64_t*)0x200038c8 = 0;
-  *(uint64_t*)0x200038d0 = 0x25d000;
-  *(uint64_t*)0x200038d8 = 0;
-  *(uint64_t*)0x200038e0 = 0;
-  *(uint64_t*)0x200038e8 = 0x25e000;
-  *(uint64_t*)0x200038f0 = 0;
-  *(uint64_t*)0x200038f8 = 0;
-  *(uint64_t*)0x20003900 = 0x25f000;
-  *(uint64_t*)0x20003908 = 0;
-  *(uint64_t*)0x20003910 = 0;
-  *(uint64_t*)0x20003918 = 0x260000;
-  *(uint64_t*)0x20003920 = 0;
-  *(uint64_t*)0x20003928 = 0;
-  *(uint64_t*)0x20003930 = 0x261000;
-  *(uint64_t*)0x20003938 = 0;
-  *(uint64_t*)0x20003940 = 0;
-  *(uint64_t*)0x20003948 = 0x262000;
-  *(uint64_t*)0x20003950 = 0;
-  *(uint64_t*)0x20003958 = 0;
-  *(uint64_t*)0x20003960 = 0x263000;
-  *(uint64_t*)0x20003968 = 0;
-  *(uint64_t*)0x20003970 = 0;
-  *(uint64_t*)0x20003978 = 0x264000;
-  *(uint64_t*)0x20003980 = 0;
-  *(uint64_t*)0x20003988 = 0;
-  *(uint64_t*)0x20003990 = 0x265000;
-  *(uint64_t*)0x20003998 = 0;
-  *(uint64_t*)0x200039a0 = 0;
-  *(uint64_t*)0x200039a8 = 0x266000;
-  *(uint64_t*)0x200039b0 = 0;
-  *(uint64_t*)0x200039b8 = 0;
-  *(uint64_t*)0x200039c0 = 0x267000;
-  *(uint64_t*)0x200039c8 = 0;
-  *(uint64_t*)0x200039d0 = 0;
-  *(uint64_t*)0x200039d8 = 0x268000;
-  *(uint64_t*)0x200039e0 = 0;
-  *(uint64_t*)0x200039e8 = 0;
-  *(uint64_t*)0x200039f0 = 0x269000;
-  *(uint64_t*)0x200039f8 = 0;
-  *(uint64_t*)0x20003a00 = 0;
-  *(uint64_t*)0x20003a08 = 0x26a000;
-  *(uint64_t*)0x20003a10 = 0;
-  *(uint64_t*)0x20003a18 = 0;
-  *(uint64_t*)0x20003a20 = 0x26b000;
-  *(uint64_t*)0x20003a28 = 0;
-  *(uint64_t*)0x20003a30 = 0;
-  *(uint64_t*)0x20003a38 = 0x26c000;
-  *(uint64_t*)0x20003a40 = 0;
-  *(uint64_t*)0x20003a48 = 0;
-  *(uint64_t*)0x20003a50 = 0x26d000;
-  *(uint64_t*)0x20003a58 = 0;
-  *(uint64_t*)0x20003a60 = 0;
-  *(uint64_t*)0x20003a68 = 0x26e000;
-  *(uint64_t*)0x20003a70 = 0;
-  *(uint64_t*)0x20003a78 = 0;
-  *(uint64_t*)0x20003a80 = 0x26f000;
-  *(uint64_t*)0x20003a88 = 0;
-  *(uint64_t*)0x20003a90 = 0;
-  *(uint64_t*)0x20003a98 = 0x270000;
-  *(uint64_t*)0x20003aa0 = 0;
-  *(uint64_t*)0x20003aa8 = 0;
-  *(uint64_t*)0x20003ab0 = 0x271000;
-  *(uint64_t*)0x20003ab8 = 0;
-  *(uint64_t*)0x20003ac0 = 0;
-  *(uint64_t*)0x20003ac8 = 0x272000;
-  *(uint64_t*)0x20003ad0 = 0;
-  *(uint64_t*)0x20003ad8 = 0;
-  *(uint64_t*)0x20003ae0 = 0x273000;
-  *(uint64_t*)0x20003ae8 = 0;
-  *(uint64_t*)0x20003af0 = 0;
-  *(uint64_t*)0x20003af8 = 0x274000;
-  *(uint64_t*)0x20003b00 = 0;
-  *(uint64_t*)0x20003b08 = 0;
-  *(uint64_t*)0x20003b10 = 0x275000;
-  *(uint64_t*)0x20003b18 = 0;
-  *(uint64_t*)0x20003b20 = 0;
-  *(uint64_t*)0x20003b28 = 0x276000;
-  *(uint64_t*)0x20003b30 = 0;
-  *(uint64_t*)0x20003b38 = 0;
-  *(uint64_t*)0x20003b40 = 0x277000;
-  *(uint64_t*)0x20003b48 = 0;
-  *(uint64_t*)0x20003b50 = 0;
-  *(uint64_t*)0x20003b58 = 0x278000;
-  *(uint64_t*)0x20003b60 = 0;
-  *(uint64_t*)0x20003b68 = 0;
-  *(uint64_t*)0x20003b70 = 0x279000;
-  *(uint64_t*)0x20003b78 = 0;
-  *(uint64_t*)0x20003b80 = 0;
-  *(uint64_t*)0x20003b88 = 0x27a000;
-  *(uint64_t*)0x20003b90 = 0;
-  *(uint64_t*)0x20003b98 = 0;
-  *(uint64_t*)0x20003ba0 = 0x27b000;
-  *(uint64_t*)0x20003ba8 = 0;
-  *(uint64_t*)0x20003bb0 = 0;
-  *(uint64_t*)0x20003bb8 = 0x27c000;
-  *(uint64_t*)0x20003bc0 = 0;
-  *(uint64_t*)0x20003bc8 = 0;
-  *(uint64_t*)0x20003bd0 = 0x27d000;
-  *(uint64_t*)0x20003bd8 = 0;
-  *(uint64_t*)0x20003be0 = 0;
-  *(uint64_t*)0x20003be8 = 0x27e000;
-  *(uint64_t*)0x20003bf0 = 0;
-  *(uint64_t*)0x20003bf8 = 0;
-  *(uint64_t*)0x20003c00 = 0x27f000;
-  *(uint64_t*)0x20003c08 = 0;
-  *(uint64_t*)0x20003c10 = 0;
-  *(uint64_t*)0x20003c18 = 0x280000;
-  *(uint64_t*)0x20003c20 = 0;
-  *(uint64_t*)0x20003c28 = 0;
-  *(uint64_t*)0x20003c30 = 0x281000;
-  *(uint64_t*)0x20003c38 = 0;
-  *(uint64_t*)0x20003c40 = 0;
-  *(uint64_t*)0x20003c48 = 0x282000;
-  *(uint64_t*)0x20003c50 = 0;
-  *(uint64_t*)0x20003c58 = 0;
-  *(uint64_t*)0x20003c60 = 0x283000;
-  *(uint64_t*)0x20003c68 = 0;
-  *(uint64_t*)0x20003c70 = 0;
-  *(uint64_t*)0x20003c78 = 0x284000;
-  *(uint64_t*)0x20003c80 = 0;
-  *(uint64_t*)0x20003c88 = 0;
-  *(uint64_t*)0x20003c90 = 0x285000;
-  *(uint64_t*)0x20003c98 = 0;
-  *(uint64_t*)0x20003ca0 = 0;
-  *(uint64_t*)0x20003ca8 = 0x286000;
-  *(uint64_t*)0x20003cb0 = 0;
-  *(uint64_t*)0x20003cb8 = 0;
-  *(uint64_t*)0x20003cc0 = 0x287000;
-  *(uint64_t*)0x20003cc8 = 0;
-  *(uint64_t*)0x20003cd0 = 0;
-  *(uint64_t*)0x20003cd8 = 0x288000;
-  *(uint64_t*)0x20003ce0 = 0;
-  *(uint64_t*)0x20003ce8 = 0;
-  *(uint64_t*)0x20003cf0 = 0x289000;
-  *(uint64_t*)0x20003cf8 = 0;
-  *(uint64_t*)0x20003d00 = 0;
-  *(uint64_t*)0x20003d08 = 0x28a000;
-  *(uint64_t*)0x20003d10 = 0;
-  *(uint64_t*)0x20003d18 = 0;
-  *(uint64_t*)0x20003d20 = 0x28b000;
-  *(uint64_t*)0x20003d28 = 0;
-  *(uint64_t*)0x20003d30 = 0;
-  *(uint64_t*)0x20003d38 = 0x28c000;
-  *(uint64_t*)0x20003d40 = 0;
-  *(uint64_t*)0x20003d48 = 0;
-  *(uint64_t*)0x20003d50 = 0x28d000;
-  *(uint64_t*)0x20003d58 = 0;
-  *(uint64_t*)0x20003d60 = 0;
-  *(uint64_t*)0x20003d68 = 0x28e000;
-  *(uint64_t*)0x20003d70 = 0;
-  *(uint64_t*)0x20003d78 = 0;
-  *(uint64_t*)0x20003d80 = 0x28f000;
-  *(uint64_t*)0x20003d88 = 0;
-  *(uint64_t*)0x20003d90 = 0;
-  *(uint64_t*)0x20003d98 = 0x290000;
-  *(uint64_t*)0x20003da0 = 0;
-  *(uint64_t*)0x20003da8 = 0;
-  *(uint64_t*)0x20003db0 = 0x291000;
-  *(uint64_t*)0x20003db8 = 0;
-  *(uint64_t*)0x20003dc0 = 0;
-  *(uint64_t*)0x20003dc8 = 0x292000;
-  *(uint64_t*)0x20003dd0 = 0;
-  *(uint64_t*)0x20003dd8 = 0;
-  *(uint64_t*)0x20003de0 = 0x293000;
-  *(uint64_t*)0x20003de8 = 0;
-  *(uint64_t*)0x20003df0 = 0;
-  *(uint64_t*)0x20003df8 = 0x294000;
-  *(uint64_t*)0x20003e00 = 0;
-  *(uint64_t*)0x20003e08 = 0;
-  *(uint64_t*)0x20003e10 = 0x295000;
-  *(uint64_t*)0x20003e18 = 0;
-  *(uint64_t*)0x20003e20 = 0;
-  *(uint64_t*)0x20003e28 = 0x296000;
-  *(uint64_t*)0x20003e30 = 0;
-  *(uint64_t*)0x20003e38 = 0;
-  *(uint64_t*)0x20003e40 = 0x297000;
-  *(uint64_t*)0x20003e48 = 0;
-  *(uint64_t*)0x20003e50 = 0;
-  *(uint64_t*)0x20003e58 = 0x298000;
-  *(uint64_t*)0x20003e60 = 0;
-  *(uint64_t*)0x20003e68 = 0;
-  *(uint64_t*)0x20003e70 = 0x299000;
-  *(uint64_t*)0x20003e78 = 0;
-  *(uint64_t*)0x20003e80 = 0;
-  *(uint64_t*)0x20003e88 = 0x29a000;
-  *(uint64_t*)0x20003e90 = 0;
-  *(uint64_t*)0x20003e98 = 0;
-  *(uint64_t*)0x20003ea0 = 0x29b000;
-  *(uint64_t*)0x20003ea8 = 0;
-  *(uint64_t*)0x20003eb0 = 0;
-  *(uint64_t*)0x20003eb8 = 0x29c000;
-  *(uint64_t*)0x20003ec0 = 0;
-  *(uint64_t*)0x20003ec8 = 0;
-  *(uint64_t*)0x20003ed0 = 0x29d000;
-  *(uint64_t*)0x20003ed8 = 0;
-  *(uint64_t*)0x20003ee0 = 0;
-  *(uint64_t*)0x20003ee8 = 0x29e000;
-  *(uint64_t*)0x20003ef0 = 0;
-  *(uint64_t*)0x20003ef8 = 0;
-  *(uint64_t*)0x20003f00 = 0x29f000;
-  *(uint64_t*)0x20003f08 = 0;
-  *(uint64_t*)0x20003f10 = 0;
-  *(uint64_t*)0x20003f18 = 0x2a0000;
-  *(uint64_t*)0x20003f20 = 0;
-  *(uint64_t*)0x20003f28 = 0;
-  *(uint64_t*)0x20003f30 = 0x2a1000;
-  *(uint64_t*)0x20003f38 = 0;
-  *(uint64_t*)0x20003f40 = 0;
-  *(uint64_t*)0x20003f48 = 0x2a2000;
-  *(uint64_t*)0x20003f50 = 0;
-  *(uint64_t*)0x20003f58 = 0;
-  *(uint64_t*)0x20003f60 = 0x2a3000;
-  *(uint64_t*)0x20003f68 = 0;
-  *(uint64_t*)0x20003f70 = 0;
-  *(uint64_t*)0x20003f78 = 0x2a4000;
-  *(uint64_t*)0x20003f80 = 0;
-  *(uint64_t*)0x20003f88 = 0;
-  *(uint64_t*)0x20003f90 = 0x2a5000;
-  *(uint64_t*)0x20003f98 = 0;
-  *(uint64_t*)0x20003fa0 = 0;
-  *(uint64_t*)0x20003fa8 = 0x2a6000;
-  *(uint64_t*)0x20003fb0 = 0;
-  *(uint64_t*)0x20003fb8 = 0;
-  *(uint64_t*)0x20003fc0 = 0x2a7000;
-  *(uint64_t*)0x20003fc8 = 0;
-  *(uint64_t*)0x20003fd0 = 0;
-  *(uint64_t*)0x20003fd8 = 0x2a8000;
-  *(uint64_t*)0x20003fe0 = 0;
-  *(uint64_t*)0x20003fe8 = 0;
-  *(uint64_t*)0x20003ff0 = 0x2a9000;
-  *(uint64_t*)0x20003ff8 = 0;
-  *(uint64_t*)0x20004000 = 0;
-  *(uint64_t*)0x20004008 = 0x2aa000;
-  *(uint64_t*)0x20004010 = 0;
-  *(uint64_t*)0x20004018 = 0;
-  *(uint64_t*)0x20004020 = 0x2ab000;
-  *(uint64_t*)0x20004028 = 0;
-  *(uint64_t*)0x20004030 = 0;
-  *(uint64_t*)0x20004038 = 0x2ac000;
-  *(uint64_t*)0x20004040 = 0;
-  *(uint64_t*)0x20004048 = 0;
-  *(uint64_t*)0x20004050 = 0x2ad000;
-  *(uint64_t*)0x20004058 = 0;
-  *(uint64_t*)0x20004060 = 0;
-  *(uint64_t*)0x20004068 = 0x2ae000;
-  *(uint64_t*)0x20004070 = 0;
-  *(uint64_t*)0x20004078 = 0;
-  *(uint64_t*)0x20004080 = 0x2af000;
-  *(uint64_t*)0x20004088 = 0;
-  *(uint64_t*)0x20004090 = 0;
-  *(uint64_t*)0x20004098 = 0x2b0000;
-  *(uint64_t*)0x200040a0 = 0;
-  *(uint64_t*)0x200040a8 = 0;
-  *(uint64_t*)0x200040b0 = 0x2b1000;
-  *(uint64_t*)0x200040b8 = 0;
-  *(uint64_t*)0x200040c0 = 0;
-  *(uint64_t*)0x200040c8 = 0x2b2000;
-  *(uint64_t*)0x200040d0 = 0;
-  *(uint64_t*)0x200040d8 = 0;
-  *(uint64_t*)0x200040e0 = 0x2b3000;
-  *(uint64_t*)0x200040e8 = 0;
-  *(uint64_t*)0x200040f0 = 0;
-  *(uint64_t*)0x200040f8 = 0x2b4000;
-  *(uint64_t*)0x20004100 = 0;
-  *(uint64_t*)0x20004108 = 0;
-  *(uint64_t*)0x20004110 = 0x2b5000;
-  *(uint64_t*)0x20004118 = 0;
-  *(uint64_t*)0x20004120 = 0;
-  *(uint64_t*)0x20004128 = 0x2b6000;
-  *(uint64_t*)0x20004130 = 0;
-  *(uint64_t*)0x20004138 = 0;
-  *(uint64_t*)0x20004140 = 0x2b7000;
-  *(uint64_t*)0x20004148 = 0;
-  *(uint64_t*)0x20004150 = 0;
-  *(uint64_t*)0x20004158 = 0x2b8000;
-  *(uint64_t*)0x20004160 = 0;
-  *(uint64_t*)0x20004168 = 0;
-  *(uint64_t*)0x20004170 = 0x2b9000;
-  *(uint64_t*)0x20004178 = 0;
-  *(uint64_t*)0x20004180 = 0;
-  *(uint64_t*)0x20004188 = 0x2ba000;
-  *(uint64_t*)0x20004190 = 0;
-  *(uint64_t*)0x20004198 = 0;
-  *(uint64_t*)0x200041a0 = 0x2bb000;
-  *(uint64_t*)0x200041a8 = 0;
-  *(uint64_t*)0x200041b0 = 0;
-  *(uint64_t*)0x200041b8 = 0x2bc000;
-  *(uint64_t*)0x200041c0 = 0;
-  *(uint64_t*)0x200041c8 = 0;
-  *(uint64_t*)0x200041d0 = 0x2bd000;
-  *(uint64_t*)0x200041d8 = 0;
-  *(uint64_t*)0x200041e0 = 0;
-  *(uint64_t*)0x200041e8 = 0x2be000;
-  *(uint64_t*)0x200041f0 = 0;
-  *(uint64_t*)0x200041f8 = 0;
-  *(uint64_t*)0x20004200 = 0x2bf000;
-  *(uint64_t*)0x20004208 = 0;
-  *(uint64_t*)0x20004210 = 0;
-  *(uint64_t*)0x20004218 = 0x2c0000;
-  *(uint64_t*)0x20004220 = 0;
-  *(uint64_t*)0x20004228 = 0;
-  *(uint64_t*)0x20004230 = 0x2c1000;
-  *(uint64_t*)0x20004238 = 0;
-  *(uint64_t*)0x20004240 = 0;
-  *(uint64_t*)0x20004248 = 0x2c2000;
-  *(uint64_t*)0x20004250 = 0;
-  *(uint64_t*)0x20004258 = 0;
-  *(uint64_t*)0x20004260 = 0x2c3000;
-  *(uint64_t*)0x20004268 = 0;
-  *(uint64_t*)0x20004270 = 0;
-  *(uint64_t*)0x20004278 = 0x2c4000;
-  *(uint64_t*)0x20004280 = 0;
-  *(uint64_t*)0x20004288 = 0;
-  *(uint64_t*)0x20004290 = 0x2c5000;
-  *(uint64_t*)0x20004298 = 0;
-  *(uint64_t*)0x200042a0 = 0;
-  *(uint64_t*)0x200042a8 = 0x2c6000;
-  *(uint64_t*)0x200042b0 = 0;
-  *(uint64_t*)0x200042b8 = 0;
-  *(uint64_t*)0x200042c0 = 0x2c7000;
-  *(uint64_t*)0x200042c8 = 0;
-  *(uint64_t*)0x200042d0 = 0;
-  *(uint64_t*)0x200042d8 = 0x2c8000;
-  *(uint64_t*)0x200042e0 = 0;
-  *(uint64_t*)0x200042e8 = 0;
-  *(uint64_t*)0x200042f0 = 0x2c9000;
-  *(uint64_t*)0x200042f8 = 0;
-  *(uint64_t*)0x20004300 = 0;
-  *(uint64_t*)0x20004308 = 0x2ca000;
-  *(uint64_t*)0x20004310 = 0;
-  *(uint64_t*)0x20004318 = 0;
-  *(uint64_t*)0x20004320 = 0x2cb000;
-  *(uint64_t*)0x20004328 = 0;
-  *(uint64_t*)0x20004330 = 0;
-  *(uint64_t*)0x20004338 = 0x2cc000;
-  *(uint64_t*)0x20004340 = 0;
-  *(uint64_t*)0x20004348 = 0;
-  *(uint64_t*)0x20004350 = 0x2cd000;
-  *(uint64_t*)0x20004358 = 0;
-  *(uint64_t*)0x20004360 = 0;
-  *(uint64_t*)0x20004368 = 0x2ce000;
-  *(uint64_t*)0x20004370 = 0;
-  *(uint64_t*)0x20004378 = 0;
-  *(uint64_t*)0x20004380 = 0x2cf000;
-  *(uint64_t*)0x20004388 = 0;
-  *(uint64_t*)0x20004390 = 0;
-  *(uint64_t*)0x20004398 = 0x2d0000;
-  *(uint64_t*)0x200043a0 = 0;
-  *(uint64_t*)0x200043a8 = 0;
-  *(uint64_t*)0x200043b0 = 0x2d1000;
-  *(uint64_t*)0x200043b8 = 0;
-  *(uint64_t*)0x200043c0 = 0;
-  *(uint64_t*)0x200043c8 = 0x2d2000;
-  *(uint64_t*)0x200043d0 = 0;
-  *(uint64_t*)0x200043d8 = 0;
-  *(uint64_t*)0x200043e0 = 0x2d3000;
-  *(uint64_t*)0x200043e8 = 0;
-  *(uint64_t*)0x200043f0 = 0;
-  *(uint64_t*)0x200043f8 = 0x2d4000;
-  *(uint64_t*)0x20004400 = 0;
-  *(uint64_t*)0x20004408 = 0;
-  *(uint64_t*)0x20004410 = 0x2d5000;
-  *(uint64_t*)0x20004418 = 0;
-  *(uint64_t*)0x20004420 = 0;
-  *(uint64_t*)0x20004428 = 0x2d6000;
-  *(uint64_t*)0x20004430 = 0;
-  *(uint64_t*)0x20004438 = 0;
-  *(uint64_t*)0x20004440 = 0x2d7000;
-  *(uint64_t*)0x20004448 = 0;
-  *(uint64_t*)0x20004450 = 0;
-  *(uint64_t*)0x20004458 = 0x2d8000;
-  *(uint64_t*)0x20004460 = 0;
-  *(uint64_t*)0x20004468 = 0;
-  *(uint64_t*)0x20004470 = 0x2d9000;
-  *(uint64_t*)0x20004478 = 0;
-  *(uint64_t*)0x20004480 = 0;
-  *(uint64_t*)0x20004488 = 0x2da000;
-  *(uint64_t*)0x20004490 = 0;
-  *(uint64_t*)0x20004498 = 0;
-  *(uint64_t*)0x200044a0 = 0x2db000;
-  *(uint64_t*)0x200044a8 = 0;
-  *(uint64_t*)0x200044b0 = 0;
-  *(uint64_t*)0x200044b8 = 0x2dc000;
-  *(uint64_t*)0x200044c0 = 0;
-  *(uint64_t*)0x200044c8 = 0;
-  *(uint64_t*)0x200044d0 = 0x2dd000;
-  *(uint64_t*)0x200044d8 = 0;
-  *(uint64_t*)0x200044e0 = 0;
-  *(uint64_t*)0x200044e8 = 0x2de000;
-  *(uint64_t*)0x200044f0 = 0;
-  *(uint64_t*)0x200044f8 = 0;
-  *(uint64_t*)0x20004500 = 0x2df000;
-  *(uint64_t*)0x20004508 = 0;
-  *(uint64_t*)0x20004510 = 0;
-  *(uint64_t*)0x20004518 = 0x2e0000;
-  *(uint64_t*)0x20004520 = 0;
-  *(uint64_t*)0x20004528 = 0;
-  *(uint64_t*)0x20004530 = 0x2e1000;
-  *(uint64_t*)0x20004538 = 0;
-  *(uint64_t*)0x20004540 = 0;
-  *(uint64_t*)0x20004548 = 0x2e2000;
-  *(uint64_t*)0x20004550 = 0;
-  *(uint64_t*)0x20004558 = 0;
-  *(uint64_t*)0x20004560 = 0x2e3000;
-  *(uint64_t*)0x20004568 = 0;
-  *(uint64_t*)0x20004570 = 0;
-  *(uint64_t*)0x20004578 = 0x2e4000;
-  *(uint64_t*)0x20004580 = 0;
-  *(uint64_t*)0x20004588 = 0;
-  *(uint64_t*)0x20004590 = 0x2e5000;
-  *(uint64_t*)0x20004598 = 0;
-  *(uint64_t*)0x200045a0 = 0;
-  *(uint64_t*)0x200045a8 = 0x2e6000;
-  *(uint64_t*)0x200045b0 = 0;
-  *(uint64_t*)0x200045b8 = 0;
-  *(uint64_t*)0x200045c0 = 0x2e7000;
-  *(uint64_t*)0x200045c8 = 0;
-  *(uint64_t*)0x200045d0 = 0;
-  *(uint64_t*)0x200045d8 = 0x2e8000;
-  *(uint64_t*)0x200045e0 = 0;
-  *(uint64_t*)0x200045e8 = 0;
-  *(uint64_t*)0x200045f0 = 0x2e9000;
-  *(uint64_t*)0x200045f8 = 0;
-  *(uint64_t*)0x20004600 = 0;
-  *(uint64_t*)0x20004608 = 0x2ea000;
-  *(uint64_t*)0x20004610 = 0;
-  *(uint64_t*)0x20004618 = 0;
-  *(uint64_t*)0x20004620 = 0x2eb000;
-  *(uint64_t*)0x20004628 = 0;
-  *(uint64_t*)0x20004630 = 0;
-  *(uint64_t*)0x20004638 = 0x2ec000;
-  *(uint64_t*)0x20004640 = 0;
-  *(uint64_t*)0x20004648 = 0;
-  *(uint64_t*)0x20004650 = 0x2ed000;
-  *(uint64_t*)0x20004658 = 0;
-  *(uint64_t*)0x20004660 = 0;
-  *(uint64_t*)0x20004668 = 0x2ee000;
-  *(uint64_t*)0x20004670 = 0;
-  *(uint64_t*)0x20004678 = 0;
-  *(uint64_t*)0x20004680 = 0x2ef000;
-  *(uint64_t*)0x20004688 = 0;
-  *(uint64_t*)0x20004690 = 0;
-  *(uint64_t*)0x20004698 = 0x2f0000;
-  *(uint64_t*)0x200046a0 = 0;
-  *(uint64_t*)0x200046a8 = 0;
-  *(uint64_t*)0x200046b0 = 0x2f1000;
-  *(uint64_t*)0x200046b8 = 0;
-  *(uint64_t*)0x200046c0 = 0;
-  *(uint64_t*)0x200046c8 = 0x2f2000;
-  *(uint64_t*)0x200046d0 = 0;
-  *(uint64_t*)0x200046d8 = 0;
-  *(uint64_t*)0x200046e0 = 0x2f3000;
-  *(uint64_t*)0x200046e8 = 0;
-  *(uint64_t*)0x200046f0 = 0;
-  *(uint64_t*)0x200046f8 = 0x2f4000;
-  *(uint64_t*)0x20004700 = 0;
-  *(uint64_t*)0x20004708 = 0;
-  *(uint64_t*)0x20004710 = 0x2f5000;
-  *(uint64_t*)0x20004718 = 0;
-  *(uint64_t*)0x20004720 = 0;
-  *(uint64_t*)0x20004728 = 0x2f6000;
-  *(uint64_t*)0x20004730 = 0;
-  *(uint64_t*)0x20004738 = 0;
-  *(uint64_t*)0x20004740 = 0x2f7000;
-  *(uint64_t*)0x20004748 = 0;
-  *(uint64_t*)0x20004750 = 0;
-  *(uint64_t*)0x20004758 = 0x2f8000;
-  *(uint64_t*)0x20004760 = 0;
-  *(uint64_t*)0x20004768 = 0;
-  *(uint64_t*)0x20004770 = 0x2f9000;
-  *(uint64_t*)0x20004778 = 0;
-  *(uint64_t*)0x20004780 = 0;
-  *(uint64_t*)0x20004788 = 0x2fa000;
-  *(uint64_t*)0x20004790 = 0;
-  *(uint64_t*)0x20004798 = 0;
-  *(uint64_t*)0x200047a0 = 0x2fb000;
-  *(uint64_t*)0x200047a8 = 0;
-  *(uint64_t*)0x200047b0 = 0;
-  *(uint64_t*)0x200047b8 = 0x2fc000;
-  *(uint64_t*)0x200047c0 = 0;
-  *(uint64_t*)0x200047c8 = 0;
-  *(uint64_t*)0x200047d0 = 0x2fd000;
-  *(uint64_t*)0x200047d8 = 0;
-  *(uint64_t*)0x200047e0 = 0;
-  *(uint64_t*)0x200047e8 = 0x2fe000;
-  *(uint64_t*)0x200047f0 = 0;
-  *(uint64_t*)0x200047f8 = 0;
-  *(uint64_t*)0x20004800 = 0x2ff000;
-  *(uint64_t*)0x20004808 = 0;
-  *(uint64_t*)0x20004810 = 0;
-  *(uint64_t*)0x20004818 = 0x300000;
-  *(uint64_t*)0x20004820 = 0;
-  *(uint64_t*)0x20004828 = 0;
-  *(uint64_t*)0x20004830 = 0x301000;
-  *(uint64_t*)0x20004838 = 0;
-  *(uint64_t*)0x20004840 = 0;
-  *(uint64_t*)0x20004848 = 0x302000;
-  *(uint64_t*)0x20004850 = 0;
-  *(uint64_t*)0x20004858 = 0;
-  *(uint64_t*)0x20004860 = 0x303000;
-  *(uint64_t*)0x20004868 = 0;
-  *(uint64_t*)0x20004870 = 0;
-  *(uint64_t*)0x20004878 = 0x304000;
-  *(uint64_t*)0x20004880 = 0;
-  *(uint64_t*)0x20004888 = 0;
-  *(uint64_t*)0x20004890 = 0x305000;
-  *(uint64_t*)0x20004898 = 0;
-  *(uint64_t*)0x200048a0 = 0;
-  *(uint64_t*)0x200048a8 = 0x306000;
-  *(uint64_t*)0x200048b0 = 0;
-  *(uint64_t*)0x200048b8 = 0;
-  *(uint64_t*)0x200048c0 = 0x307000;
-  *(uint64_t*)0x200048c8 = 0;
-  *(uint64_t*)0x200048d0 = 0;
-  *(uint64_t*)0x200048d8 = 0x308000;
-  *(uint64_t*)0x200048e0 = 0;
-  *(uint64_t*)0x200048e8 = 0;
-  *(uint64_t*)0x200048f0 = 0x309000;
-  *(uint64_t*)0x200048f8 = 0;
-  *(uint64_t*)0x20004900 = 0;
-  *(uint64_t*)0x20004908 = 0x30a000;
-  *(uint64_t*)0x20004910 = 0;
-  *(uint64_t*)0x20004918 = 0;
-  *(uint64_t*)0x20004920 = 0x30b000;
-  *(uint64_t*)0x20004928 = 0;
-  *(uint64_t*)0x20004930 = 0;
-  *(uint64_t*)0x20004938 = 0x30c000;
-  *(uint64_t*)0x20004940 = 0;
-  *(uint64_t*)0x20004948 = 0;
-  *(uint64_t*)0x20004950 = 0x30d000;
-  *(uint64_t*)0x20004958 = 0;
-  *(uint64_t*)0x20004960 = 0;
-  *(uint64_t*)0x20004968 = 0x30e000;
-  *(uint64_t*)0x20004970 = 0;
-  *(uint64_t*)0x20004978 = 0;
-  *(uint64_t*)0x20004980 = 0x30f000;
-  *(uint64_t*)0x20004988 = 0;
-  *(uint64_t*)0x20004990 = 0;
-  *(uint64_t*)0x20004998 = 0x310000;
-  *(uint64_t*)0x200049a0 = 0;
-  *(uint64_t*)0x200049a8 = 0;
-  *(uint64_t*)0x200049b0 = 0x311000;
-  *(uint64_t*)0x200049b8 = 0;
-  *(uint64_t*)0x200049c0 = 0;
-  *(uint64_t*)0x200049c8 = 0x312000;
-  *(uint64_t*)0x200049d0 = 0;
-  *(uint64_t*)0x200049d8 = 0;
-  *(uint64_t*)0x200049e0 = 0x313000;
-  *(uint64_t*)0x200049e8 = 0;
-  *(uint64_t*)0x200049f0 = 0;
-  *(uint64_t*)0x200049f8 = 0x314000;
-  *(uint64_t*)0x20004a00 = 0;
-  *(uint64_t*)0x20004a08 = 0;
-  *(uint64_t*)0x20004a10 = 0x315000;
-  *(uint64_t*)0x20004a18 = 0;
-  *(uint64_t*)0x20004a20 = 0;
-  *(uint64_t*)0x20004a28 = 0x316000;
-  *(uint64_t*)0x20004a30 = 0;
-  *(uint64_t*)0x20004a38 = 0;
-  *(uint64_t*)0x20004a40 = 0x317000;
-  *(uint64_t*)0x20004a48 = 0;
-  *(uint64_t*)0x20004a50 = 0;
-  *(uint64_t*)0x20004a58 = 0x318000;
-  *(uint64_t*)0x20004a60 = 0;
-  *(uint64_t*)0x20004a68 = 0;
-  *(uint64_t*)0x20004a70 = 0x319000;
-  *(uint64_t*)0x20004a78 = 0;
-  *(uint64_t*)0x20004a80 = 0;
-  *(uint64_t*)0x20004a88 = 0x31a000;
-  *(uint64_t*)0x20004a90 = 0;
-  *(uint64_t*)0x20004a98 = 0;
-  *(uint64_t*)0x20004aa0 = 0x31b000;
-  *(uint64_t*)0x20004aa8 = 0;
-  *(uint64_t*)0x20004ab0 = 0;
-  *(uint64_t*)0x20004ab8 = 0x31c000;
-  *(uint64_t*)0x20004ac0 = 0;
-  *(uint64_t*)0x20004ac8 = 0;
-  *(uint64_t*)0x20004ad0 = 0x31d000;
-  *(uint64_t*)0x20004ad8 = 0;
-  *(uint64_t*)0x20004ae0 = 0;
-  *(uint64_t*)0x20004ae8 = 0x31e000;
-  *(uint64_t*)0x20004af0 = 0;
-  *(uint64_t*)0x20004af8 = 0;
-  *(uint64_t*)0x20004b00 = 0x31f000;
-  *(uint64_t*)0x20004b08 = 0;
-  *(uint64_t*)0x20004b10 = 0;
-  *(uint64_t*)0x20004b18 = 0x320000;
-  *(uint64_t*)0x20004b20 = 0;
-  *(uint64_t*)0x20004b28 = 0;
-  *(uint64_t*)0x20004b30 = 0x321000;
-  *(uint64_t*)0x20004b38 = 0;
-  *(uint64_t*)0x20004b40 = 0;
-  *(uint64_t*)0x20004b48 = 0x322000;
-  *(uint64_t*)0x20004b50 = 0;
-  *(uint64_t*)0x20004b58 = 0;
-  *(uint64_t*)0x20004b60 = 0x323000;
-  *(uint64_t*)0x20004b68 = 0;
-  *(uint64_t*)0x20004b70 = 0;
-  *(uint64_t*)0x20004b78 = 0x324000;
-  *(uint64_t*)0x20004b80 = 0;
-  *(uint64_t*)0x20004b88 = 0;
-  *(uint64_t*)0x20004b90 = 0x325000;
-  *(uint64_t*)0x20004b98 = 0;
-  *(uint64_t*)0x20004ba0 = 0;
-  *(uint64_t*)0x20004ba8 = 0x326000;
-  *(uint64_t*)0x20004bb0 = 0;
-  *(uint64_t*)0x20004bb8 = 0;
-  *(uint64_t*)0x20004bc0 = 0x327000;
-  *(uint64_t*)0x20004bc8 = 0;
-  *(uint64_t*)0x20004bd0 = 0;
-  *(uint64_t*)0x20004bd8 = 0x328000;
-  *(uint64_t*)0x20004be0 = 0;
-  *(uint64_t*)0x20004be8 = 0;
-  *(uint64_t*)0x20004bf0 = 0x329000;
-  *(uint64_t*)0x20004bf8 = 0;
-  *(uint64_t*)0x20004c00 = 0;
-  *(uint64_t*)0x20004c08 = 0x32a000;
-  *(uint64_t*)0x20004c10 = 0;
-  *(uint64_t*)0x20004c18 = 0;
-  *(uint64_t*)0x20004c20 = 0x32b000;
-  *(uint64_t*)0x20004c28 = 0;
-  *(uint64_t*)0x20004c30 = 0;
-  *(uint64_t*)0x20004c38 = 0x32c000;
-  *(uint64_t*)0x20004c40 = 0;
-  *(uint64_t*)0x20004c48 = 0;
-  *(uint64_t*)0x20004c50 = 0x32d000;
-  *(uint64_t*)0x20004c58 = 0;
-  *(uint64_t*)0x20004c60 = 0;
-  *(uint64_t*)0x20004c68 = 0x32e000;
-  *(uint64_t*)0x20004c70 = 0;
-  *(uint64_t*)0x20004c78 = 0;
-  *(uint64_t*)0x20004c80 = 0x32f000;
-  *(uint64_t*)0x20004c88 = 0;
-  *(uint64_t*)0x20004c90 = 0;
-  *(uint64_t*)0x20004c98 = 0x330000;
-  *(uint64_t*)0x20004ca0 = 0;
-  *(uint64_t*)0x20004ca8 = 0;
-  *(uint64_t*)0x20004cb0 = 0x331000;
-  *(uint64_t*)0x20004cb8 = 0;
-  *(uint64_t*)0x20004cc0 = 0;
-  *(uint64_t*)0x20004cc8 = 0x332000;
-  *(uint64_t*)0x20004cd0 = 0;
-  *(uint64_t*)0x20004cd8 = 0;
-  *(uint64_t*)0x20004ce0 = 0x333000;
-  *(uint64_t*)0x20004ce8 = 0;
-  *(uint64_t*)0x20004cf0 = 0;
-  *(uint64_t*)0x20004cf8 = 0x334000;
-  *(uint64_t*)0x20004d00 = 0;
-  *(uint64_t*)0x20004d08 = 0;
-  *(uint64_t*)0x20004d10 = 0x335000;
-  *(uint64_t*)0x20004d18 = 0;
-  *(uint64_t*)0x20004d20 = 0;
-  *(uint64_t*)0x20004d28 = 0x336000;
-  *(uint64_t*)0x20004d30 = 0;
-  *(uint64_t*)0x20004d38 = 0;
-  *(uint64_t*)0x20004d40 = 0x337000;
-  *(uint64_t*)0x20004d48 = 0;
-  *(uint64_t*)0x20004d50 = 0;
-  *(uint64_t*)0x20004d58 = 0x338000;
-  *(uint64_t*)0x20004d60 = 0;
-  *(uint64_t*)0x20004d68 = 0;
-  *(uint64_t*)0x20004d70 = 0x339000;
-  *(uint64_t*)0x20004d78 = 0;
-  *(uint64_t*)0x20004d80 = 0;
-  *(uint64_t*)0x20004d88 = 0x33a000;
-  *(uint64_t*)0x20004d90 = 0;
-  *(uint64_t*)0x20004d98 = 0;
-  *(uint64_t*)0x20004da0 = 0x33b000;
-  *(uint64_t*)0x20004da8 = 0;
-  *(uint64_t*)0x20004db0 = 0;
-  *(uint64_t*)0x20004db8 = 0x33c000;
-  *(uint64_t*)0x20004dc0 = 0;
-  *(uint64_t*)0x20004dc8 = 0;
-  *(uint64_t*)0x20004dd0 = 0x33d000;
-  *(uint64_t*)0x20004dd8 = 0;
-  *(uint64_t*)0x20004de0 = 0;
-  *(uint64_t*)0x20004de8 = 0x33e000;
-  *(uint64_t*)0x20004df0 = 0;
-  *(uint64_t*)0x20004df8 = 0;
-  *(uint64_t*)0x20004e00 = 0x33f000;
-  *(uint64_t*)0x20004e08 = 0;
-  *(uint64_t*)0x20004e10 = 0;
-  *(uint64_t*)0x20004e18 = 0x340000;
-  *(uint64_t*)0x20004e20 = 0;
-  *(uint64_t*)0x20004e28 = 0;
-  *(uint64_t*)0x20004e30 = 0x341000;
-  *(uint64_t*)0x20004e38 = 0;
-  *(uint64_t*)0x20004e40 = 0;
-  *(uint64_t*)0x20004e48 = 0x342000;
-  *(uint64_t*)0x20004e50 = 0;
-  *(uint64_t*)0x20004e58 = 0;
-  *(uint64_t*)0x20004e60 = 0x343000;
-  *(uint64_t*)0x20004e68 = 0;
-  *(uint64_t*)0x20004e70 = 0;
-  *(uint64_t*)0x20004e78 = 0x344000;
-  *(uint64_t*)0x20004e80 = 0;
-  *(uint64_t*)0x20004e88 = 0;
-  *(uint64_t*)0x20004e90 = 0x345000;
-  *(uint64_t*)0x20004e98 = 0;
-  *(uint64_t*)0x20004ea0 = 0;
-  *(uint64_t*)0x20004ea8 = 0x346000;
-  *(uint64_t*)0x20004eb0 = 0;
-  *(uint64_t*)0x20004eb8 = 0;
-  *(uint64_t*)0x20004ec0 = 0x347000;
-  *(uint64_t*)0x20004ec8 = 0;
-  *(uint64_t*)0x20004ed0 = 0;
-  *(uint64_t*)0x20004ed8 = 0x348000;
-  *(uint64_t*)0x20004ee0 = 0;
-  *(uint64_t*)0x20004ee8 = 0;
-  *(uint64_t*)0x20004ef0 = 0x349000;
-  *(uint64_t*)0x20004ef8 = 0;
-  *(uint64_t*)0x20004f00 = 0;
-  *(uint64_t*)0x20004f08 = 0x34a000;
-  *(uint64_t*)0x20004f10 = 0;
-  *(uint64_t*)0x20004f18 = 0;
-  *(uint64_t*)0x20004f20 = 0x34b000;
-  *(uint64_t*)0x20004f28 = 0;
-  *(uint64_t*)0x20004f30 = 0;
-  *(uint64_t*)0x20004f38 = 0x34c000;
-  *(uint64_t*)0x20004f40 = 0;
-  *(uint64_t*)0x20004f48 = 0;
-  *(uint64_t*)0x20004f50 = 0x34d000;
-  *(uint64_t*)0x20004f58 = 0;
-  *(uint64_t*)0x20004f60 = 0;
-  *(uint64_t*)0x20004f68 = 0x34e000;
-  *(uint64_t*)0x20004f70 = 0;
-  *(uint64_t*)0x20004f78 = 0;
-  *(uint64_t*)0x20004f80 = 0x34f000;
-  *(uint64_t*)0x20004f88 = 0;
-  *(uint64_t*)0x20004f90 = 0;
-  *(uint64_t*)0x20004f98 = 0x350000;
-  *(uint64_t*)0x20004fa0 = 0;
-  *(uint64_t*)0x20004fa8 = 0;
-  *(uint64_t*)0x20004fb0 = 0x351000;
-  *(uint64_t*)0x20004fb8 = 0;
-  *(uint64_t*)0x20004fc0 = 0;
-  *(uint64_t*)0x20004fc8 = 0x352000;
-  *(uint64_t*)0x20004fd0 = 0;
-  *(uint64_t*)0x20004fd8 = 0;
-  *(uint64_t*)0x20004fe0 = 0x353000;
-  *(uint64_t*)0x20004fe8 = 0;
-  *(uint64_t*)0x20004ff0 = 0;
-  *(uint64_t*)0x20004ff8 = 0x354000;
-  *(uint64_t*)0x20005000 = 0;
-  *(uint64_t*)0x20005008 = 0;
-  *(uint64_t*)0x20005010 = 0x355000;
-  *(uint64_t*)0x20005018 = 0;
-  *(uint64_t*)0x20005020 = 0;
-  *(uint64_t*)0x20005028 = 0x356000;
-  *(uint64_t*)0x20005030 = 0;
-  *(uint64_t*)0x20005038 = 0;
-  *(uint64_t*)0x20005040 = 0x357000;
-  *(uint64_t*)0x20005048 = 0;
-  *(uint64_t*)0x20005050 = 0;
-  *(uint64_t*)0x20005058 = 0x358000;
-  *(uint64_t*)0x20005060 = 0;
-  *(uint64_t*)0x20005068 = 0;
-  *(uint64_t*)0x20005070 = 0x359000;
-  *(uint64_t*)0x20005078 = 0;
-  *(uint64_t*)0x20005080 = 0;
-  *(uint64_t*)0x20005088 = 0x35a000;
-  *(uint64_t*)0x20005090 = 0;
-  *(uint64_t*)0x20005098 = 0;
-  *(uint64_t*)0x200050a0 = 0x35b000;
-  *(uint64_t*)0x200050a8 = 0;
-  *(uint64_t*)0x200050b0 = 0;
-  *(uint64_t*)0x200050b8 = 0x35c000;
-  *(uint64_t*)0x200050c0 = 0;
-  *(uint64_t*)0x200050c8 = 0;
-  *(uint64_t*)0x200050d0 = 0x35d000;
-  *(uint64_t*)0x200050d8 = 0;
-  *(uint64_t*)0x200050e0 = 0;
-  *(uint64_t*)0x200050e8 = 0x35e000;
-  *(uint64_t*)0x200050f0 = 0;
-  *(uint64_t*)0x200050f8 = 0;
-  *(uint64_t*)0x20005100 = 0x35f000;
-  *(uint64_t*)0x20005108 = 0;
-  *(uint64_t*)0x20005110 = 0;
-  *(uint64_t*)0x20005118 = 0x360000;
-  *(uint64_t*)0x20005120 = 0;
-  *(uint64_t*)0x20005128 = 0;
-  *(uint64_t*)0x20005130 = 0x361000;
-  *(uint64_t*)0x20005138 = 0;
-  *(uint64_t*)0x20005140 = 0;
-  *(uint64_t*)0x20005148 = 0x362000;
-  *(uint64_t*)0x20005150 = 0;
-  *(uint64_t*)0x20005158 = 0;
-  *(uint64_t*)0x20005160 = 0x363000;
-  *(uint64_t*)0x20005168 = 0;
-  *(uint64_t*)0x20005170 = 0;
-  *(uint64_t*)0x20005178 = 0x364000;
-  *(uint64_t*)0x20005180 = 0;
-  *(uint64_t*)0x20005188 = 0;
-  *(uint64_t*)0x20005190 = 0x365000;
-  *(uint64_t*)0x20005198 = 0;
-  *(uint64_t*)0x200051a0 = 0;
-  *(uint64_t*)0x200051a8 = 0x366000;
-  *(uint64_t*)0x200051b0 = 0;
-  *(uint64_t*)0x200051b8 = 0;
-  *(uint64_t*)0x200051c0 = 0x367000;
-  *(uint64_t*)0x200051c8 = 0;
-  *(uint64_t*)0x200051d0 = 0;
-  *(uint64_t*)0x200051d8 = 0x368000;
-  *(uint64_t*)0x200051e0 = 0;
-  *(uint64_t*)0x200051e8 = 0;
-  *(uint64_t*)0x200051f0 = 0x369000;
-  *(uint64_t*)0x200051f8 = 0;
-  *(uint64_t*)0x20005200 = 0;
-  *(uint64_t*)0x20005208 = 0x36a000;
-  *(uint64_t*)0x20005210 = 0;
-  *(uint64_t*)0x20005218 = 0;
-  *(uint64_t*)0x20005220 = 0x36b000;
-  *(uint64_t*)0x20005228 = 0;
-  *(uint64_t*)0x20005230 = 0;
-  *(uint64_t*)0x20005238 = 0x36c000;
-  *(uint64_t*)0x20005240 = 0;
-  *(uint64_t*)0x20005248 = 0;
-  *(uint64_t*)0x20005250 = 0x36d000;
-  *(uint64_t*)0x20005258 = 0;
-  *(uint64_t*)0x20005260 = 0;
-  *(uint64_t*)0x20005268 = 0x36e000;
-  *(uint64_t*)0x20005270 = 0;
-  *(uint64_t*)0x20005278 = 0;
-  *(uint64_t*)0x20005280 = 0x36f000;
-  *(uint64_t*)0x20005288 = 0;
-  *(uint64_t*)0x20005290 = 0;
-  *(uint64_t*)0x20005298 = 0x370000;
-  *(uint64_t*)0x200052a0 = 0;
-  *(uint64_t*)0x200052a8 = 0;
-  *(uint64_t*)0x200052b0 = 0x371000;
-  *(uint64_t*)0x200052b8 = 0;
-  *(uint64_t*)0x200052c0 = 0;
-  *(uint64_t*)0x200052c8 = 0x372000;
-  *(uint64_t*)0x200052d0 = 0;
-  *(uint64_t*)0x200052d8 = 0;
-  *(uint64_t*)0x200052e0 = 0x373000;
-  *(uint64_t*)0x200052e8 = 0;
-  *(uint64_t*)0x200052f0 = 0;
-  *(uint64_t*)0x200052f8 = 0x374000;
-  *(uint64_t*)0x20005300 = 0;
-  *(uint64_t*)0x20005308 = 0;
-  *(uint64_t*)0x20005310 = 0x375000;
-  *(uint64_t*)0x20005318 = 0;
-  *(uint64_t*)0x20005320 = 0;
-  *(uint64_t*)0x20005328 = 0x376000;
-  *(uint64_t*)0x20005330 = 0;
-  *(uint64_t*)0x20005338 = 0;
-  *(uint64_t*)0x20005340 = 0x377000;
-  *(uint64_t*)0x20005348 = 0;
-  *(uint64_t*)0x20005350 = 0;
-  *(uint64_t*)0x20005358 = 0x378000;
-  *(uint64_t*)0x20005360 = 0;
-  *(uint64_t*)0x20005368 = 0;
-  *(uint64_t*)0x20005370 = 0x379000;
-  *(uint64_t*)0x20005378 = 0;
-  *(uint64_t*)0x20005380 = 0;
-  *(uint64_t*)0x20005388 = 0x37a000;
-  *(uint64_t*)0x20005390 = 0;
-  *(uint64_t*)0x20005398 = 0;
-  *(uint64_t*)0x200053a0 = 0x37b000;
-  *(uint64_t*)0x200053a8 = 0;
-  *(uint64_t*)0x200053b0 = 0;
-  *(uint64_t*)0x200053b8 = 0x37c000;
-  *(uint64_t*)0x200053c0 = 0;
-  *(uint64_t*)0x200053c8 = 0;
-  *(uint64_t*)0x200053d0 = 0x37d000;
-  *(uint64_t*)0x200053d8 = 0;
-  *(uint64_t*)0x200053e0 = 0;
-  *(uint64_t*)0x200053e8 = 0x37e000;
-  *(uint64_t*)0x200053f0 = 0;
-  *(uint64_t*)0x200053f8 = 0;
-  *(uint64_t*)0x20005400 = 0x37f000;
-  *(uint64_t*)0x20005408 = 0;
-  *(uint64_t*)0x20005410 = 0;
-  *(uint64_t*)0x20005418 = 0x380000;
-  *(uint64_t*)0x20005420 = 0;
-  *(uint64_t*)0x20005428 = 0;
-  *(uint64_t*)0x20005430 = 0x381000;
-  *(uint64_t*)0x20005438 = 0;
-  *(uint64_t*)0x20005440 = 0;
-  *(uint64_t*)0x20005448 = 0x382000;
-  *(uint64_t*)0x20005450 = 0;
-  *(uint64_t*)0x20005458 = 0;
-  *(uint64_t*)0x20005460 = 0x383000;
-  *(uint64_t*)0x20005468 = 0;
-  *(uint64_t*)0x20005470 = 0;
-  *(uint64_t*)0x20005478 = 0x384000;
-  *(uint64_t*)0x20005480 = 0;
-  *(uint64_t*)0x20005488 = 0;
-  *(uint64_t*)0x20005490 = 0x385000;
-  *(uint64_t*)0x20005498 = 0;
-  *(uint64_t*)0x200054a0 = 0;
-  *(uint64_t*)0x200054a8 = 0x386000;
-  *(uint64_t*)0x200054b0 = 0;
-  *(uint64_t*)0x200054b8 = 0;
-  *(uint64_t*)0x200054c0 = 0x387000;
-  *(uint64_t*)0x200054c8 = 0;
-  *(uint64_t*)0x200054d0 = 0;
-  *(uint64_t*)0x200054d8 = 0x388000;
-  *(uint64_t*)0x200054e0 = 0;
-  *(uint64_t*)0x200054e8 = 0;
-  *(uint64_t*)0x200054f0 = 0x389000;
-  *(uint64_t*)0x200054f8 = 0;
-  *(uint64_t*)0x20005500 = 0;
-  *(uint64_t*)0x20005508 = 0x38a000;
-  *(uint64_t*)0x20005510 = 0;
-  *(uint64_t*)0x20005518 = 0;
-  *(uint64_t*)0x20005520 = 0x38b000;
-  *(uint64_t*)0x20005528 = 0;
-  *(uint64_t*)0x20005530 = 0;
-  *(uint64_t*)0x20005538 = 0x38c000;
-  *(uint64_t*)0x20005540 = 0;
-  *(uint64_t*)0x20005548 = 0;
-  *(uint64_t*)0x20005550 = 0x38d000;
-  *(uint64_t*)0x20005558 = 0;
-  *(uint64_t*)0x20005560 = 0;
-  *(uint64_t*)0x20005568 = 0x38e000;
-  *(uint64_t*)0x20005570 = 0;
-  *(uint64_t*)0x20005578 = 0;
-  *(uint64_t*)0x20005580 = 0x38f000;
-  *(uint64_t*)0x20005588 = 0;
-  *(uint64_t*)0x20005590 = 0;
-  *(uint64_t*)0x20005598 = 0x390000;
-  *(uint64_t*)0x200055a0 = 0;
-  *(uint64_t*)0x200055a8 = 0;
-  *(uint64_t*)0x200055b0 = 0x391000;
-  *(uint64_t*)0x200055b8 = 0;
-  *(uint64_t*)0x200055c0 = 0;
-  *(uint64_t*)0x200055c8 = 0x392000;
-  *(uint64_t*)0x200055d0 = 0;
-  *(uint64_t*)0x200055d8 = 0;
-  *(uint64_t*)0x200055e0 = 0x393000;
-  *(uint64_t*)0x200055e8 = 0;
-  *(uint64_t*)0x200055f0 = 0;
-  *(uint64_t*)0x200055f8 = 0x394000;
-  *(uint64_t*)0x20005600 = 0;
-  *(uint64_t*)0x20005608 = 0;
-  *(uint64_t*)0x20005610 = 0x395000;
-  *(uint64_t*)0x20005618 = 0;
-  *(uint64_t*)0x20005620 = 0;
-  *(uint64_t*)0x20005628 = 0x396000;
-  *(uint64_t*)0x20005630 = 0;
-  *(uint64_t*)0x20005638 = 0;
-  *(uint64_t*)0x20005640 = 0x397000;
-  *(uint64_t*)0x20005648 = 0;
-  *(uint64_t*)0x20005650 = 0;
-  *(uint64_t*)0x20005658 = 0x398000;
-  *(uint64_t*)0x20005660 = 0;
-  *(uint64_t*)0x20005668 = 0;
-  *(uint64_t*)0x20005670 = 0x399000;
-  *(uint64_t*)0x20005678 = 0;
-  *(uint64_t*)0x20005680 = 0;
-  *(uint64_t*)0x20005688 = 0x39a000;
-  *(uint64_t*)0x20005690 = 0;
-  *(uint64_t*)0x20005698 = 0;
-  *(uint64_t*)0x200056a0 = 0x39b000;
-  *(uint64_t*)0x200056a8 = 0;
-  *(uint64_t*)0x200056b0 = 0;
-  *(uint64_t*)0x200056b8 = 0x39c000;
-  *(uint64_t*)0x200056c0 = 0;
-  *(uint64_t*)0x200056c8 = 0;
-  *(uint64_t*)0x200056d0 = 0x39d000;
-  *(uint64_t*)0x200056d8 = 0;
-  *(uint64_t*)0x200056e0 = 0;
-  *(uint64_t*)0x200056e8 = 0x39e000;
-  *(uint64_t*)0x200056f0 = 0;
-  *(uint64_t*)0x200056f8 = 0;
-  *(uint64_t*)0x20005700 = 0x39f000;
-  *(uint64_t*)0x20005708 = 0;
-  *(uint64_t*)0x20005710 = 0;
-  *(uint64_t*)0x20005718 = 0x3a0000;
-  *(uint64_t*)0x20005720 = 0;
-  *(uint64_t*)0x20005728 = 0;
-  *(uint64_t*)0x20005730 = 0x3a1000;
-  *(uint64_t*)0x20005738 = 0;
-  *(uint64_t*)0x20005740 = 0;
-  *(uint64_t*)0x20005748 = 0x3a2000;
-  *(uint64_t*)0x20005750 = 0;
-  *(uint64_t*)0x20005758 = 0;
-  *(uint64_t*)0x20005760 = 0x3a3000;
-  *(uint64_t*)0x20005768 = 0;
-  *(uint64_t*)0x20005770 = 0;
-  *(uint64_t*)0x20005778 = 0x3a4000;
-  *(uint64_t*)0x20005780 = 0;
-  *(uint64_t*)0x20005788 = 0;
-  *(uint64_t*)0x20005790 = 0x3a5000;
-  *(uint64_t*)0x20005798 = 0;
-  *(uint64_t*)0x200057a0 = 0;
-  *(uint64_t*)0x200057a8 = 0x3a6000;
-  *(uint64_t*)0x200057b0 = 0;
-  *(uint64_t*)0x200057b8 = 0;
-  *(uint64_t*)0x200057c0 = 0x3a7000;
-  *(uint64_t*)0x200057c8 = 0;
-  *(uint64_t*)0x200057d0 = 0;
-  *(uint64_t*)0x200057d8 = 0x3a8000;
-  *(uint64_t*)0x200057e0 = 0;
-  *(uint64_t*)0x200057e8 = 0;
-  *(uint64_t*)0x200057f0 = 0x3a9000;
-  *(uint64_t*)0x200057f8 = 0;
-  *(uint64_t*)0x20005800 = 0;
-  *(uint64_t*)0x20005808 = 0x3aa000;
-  *(uint64_t*)0x20005810 = 0;
-  *(uint64_t*)0x20005818 = 0;
-  *(uint64_t*)0x20005820 = 0x3ab000;
-  *(uint64_t*)0x20005828 = 0;
-  *(uint64_t*)0x20005830 = 0;
-  *(uint64_t*)0x20005838 = 0x3ac000;
-  *(uint64_t*)0x20005840 = 0;
-  *(uint64_t*)0x20005848 = 0;
-  *(uint64_t*)0x20005850 = 0x3ad000;
-  *(uint64_t*)0x20005858 = 0;
-  *(uint64_t*)0x20005860 = 0;
-  *(uint64_t*)0x20005868 = 0x3ae000;
-  *(uint64_t*)0x20005870 = 0;
-  *(uint64_t*)0x20005878 = 0;
-  *(uint64_t*)0x20005880 = 0x3af000;
-  *(uint64_t*)0x20005888 = 0;
-  *(uint64_t*)0x20005890 = 0;
-  *(uint64_t*)0x20005898 = 0x3b0000;
-  *(uint64_t*)0x200058a0 = 0;
-  *(uint64_t*)0x200058a8 = 0;
-  *(uint64_t*)0x200058b0 = 0x3b1000;
-  *(uint64_t*)0x200058b8 = 0;
-  *(uint64_t*)0x200058c0 = 0;
-  *(uint64_t*)0x200058c8 = 0x3b2000;
-  *(uint64_t*)0x200058d0 = 0;
-  *(uint64_t*)0x200058d8 = 0;
-  *(uint64_t*)0x200058e0 = 0x3b3000;
-  *(uint64_t*)0x200058e8 = 0;
-  *(uint64_t*)0x200058f0 = 0;
-  *(uint64_t*)0x200058f8 = 0x3b4000;
-  *(uint64_t*)0x20005900 = 0;
-  *(uint64_t*)0x20005908 = 0;
-  *(uint64_t*)0x20005910 = 0x3b5000;
-  *(uint64_t*)0x20005918 = 0;
-  *(uint64_t*)0x20005920 = 0;
-  *(uint64_t*)0x20005928 = 0x3b6000;
-  *(uint64_t*)0x20005930 = 0;
-  *(uint64_t*)0x20005938 = 0;
-  *(uint64_t*)0x20005940 = 0x3b7000;
-  *(uint64_t*)0x20005948 = 0;
-  *(uint64_t*)0x20005950 = 0;
-  *(uint64_t*)0x20005958 = 0x3b8000;
-  *(uint64_t*)0x20005960 = 0;
-  *(uint64_t*)0x20005968 = 0;
-  *(uint64_t*)0x20005970 = 0x3b9000;
-  *(uint64_t*)0x20005978 = 0;
-  *(uint64_t*)0x20005980 = 0;
-  *(uint64_t*)0x20005988 = 0x3ba000;
-  *(uint64_t*)0x20005990 = 0;
-  *(uint64_t*)0x20005998 = 0;
-  *(uint64_t*)0x200059a0 = 0x3bb000;
-  *(uint64_t*)0x200059a8 = 0;
-  *(uint64_t*)0x200059b0 = 0;
-  *(uint64_t*)0x200059b8 = 0x3bc000;
-  *(uint64_t*)0x200059c0 = 0;
-  *(uint64_t*)0x200059c8 = 0;
-  *(uint64_t*)0x200059d0 = 0x3bd000;
-  *(uint64_t*)0x200059d8 = 0;
-  *(uint64_t*)0x200059e0 = 0;
-  *(uint64_t*)0x200059e8 = 0x3be000;
-  *(uint64_t*)0x200059f0 = 0;
-  *(uint64_t*)0x200059f8 = 0;
-  *(uint64_t*)0x20005a00 = 0x3bf000;
-  *(uint64_t*)0x20005a08 = 0;
-  *(uint64_t*)0x20005a10 = 0;
-  *(uint64_t*)0x20005a18 = 0x3c0000;
-  *(uint64_t*)0x20005a20 = 0;
-  *(uint64_t*)0x20005a28 = 0;
-  *(uint64_t*)0x20005a30 = 0x3c1000;
-  *(uint64_t*)0x20005a38 = 0;
-  *(uint64_t*)0x20005a40 = 0;
-  *(uint64_t*)0x20005a48 = 0x3c2000;
-  *(uint64_t*)0x20005a50 = 0;
-  *(uint64_t*)0x20005a58 = 0;
-  *(uint64_t*)0x20005a60 = 0x3c3000;
-  *(uint64_t*)0x20005a68 = 0;
-  *(uint64_t*)0x20005a70 = 0;
-  *(uint64_t*)0x20005a78 = 0x3c4000;
-  *(uint64_t*)0x20005a80 = 0;
-  *(uint64_t*)0x20005a88 = 0;
-  *(uint64_t*)0x20005a90 = 0x3c5000;
-  *(uint64_t*)0x20005a98 = 0;
-  *(uint64_t*)0x20005aa0 = 0;
-  *(uint64_t*)0x20005aa8 = 0x3c6000;
-  *(uint64_t*)0x20005ab0 = 0;
-  *(uint64_t*)0x20005ab8 = 0;
-  *(uint64_t*)0x20005ac0 = 0x3c7000;
-  *(uint64_t*)0x20005ac8 = 0;
-  *(uint64_t*)0x20005ad0 = 0;
-  *(uint64_t*)0x20005ad8 = 0x3c8000;
-  *(uint64_t*)0x20005ae0 = 0;
-  *(uint64_t*)0x20005ae8 = 0;
-  *(uint64_t*)0x20005af0 = 0x3c9000;
-  *(uint64_t*)0x20005af8 = 0;
-  *(uint64_t*)0x20005b00 = 0;
-  *(uint64_t*)0x20005b08 = 0x3ca000;
-  *(uint64_t*)0x20005b10 = 0;
-  *(uint64_t*)0x20005b18 = 0;
-  *(uint64_t*)0x20005b20 = 0x3cb000;
-  *(uint64_t*)0x20005b28 = 0;
-  *(uint64_t*)0x20005b30 = 0;
-  *(uint64_t*)0x20005b38 = 0x3cc000;
-  *(uint64_t*)0x20005b40 = 0;
-  *(uint64_t*)0x20005b48 = 0;
-  *(uint64_t*)0x20005b50 = 0x3cd000;
-  *(uint64_t*)0x20005b58 = 0;
-  *(uint64_t*)0x20005b60 = 0;
-  *(uint64_t*)0x20005b68 = 0x3ce000;
-  *(uint64_t*)0x20005b70 = 0;
-  *(uint64_t*)0x20005b78 = 0;
-  *(uint64_t*)0x20005b80 = 0x3cf000;
-  *(uint64_t*)0x20005b88 = 0;
-  *(uint64_t*)0x20005b90 = 0;
-  *(uint64_t*)0x20005b98 = 0x3d0000;
-  *(uint64_t*)0x20005ba0 = 0;
-  *(uint64_t*)0x20005ba8 = 0;
-  *(uint64_t*)0x20005bb0 = 0x3d1000;
-  *(uint64_t*)0x20005bb8 = 0;
-  *(uint64_t*)0x20005bc0 = 0;
-  *(uint64_t*)0x20005bc8 = 0x3d2000;
-  *(uint64_t*)0x20005bd0 = 0;
-  *(uint64_t*)0x20005bd8 = 0;
-  *(uint64_t*)0x20005be0 = 0x3d3000;
-  *(uint64_t*)0x20005be8 = 0;
-  *(uint64_t*)0x20005bf0 = 0;
-  *(uint64_t*)0x20005bf8 = 0x3d4000;
-  *(uint64_t*)0x20005c00 = 0;
-  *(uint64_t*)0x20005c08 = 0;
-  *(uint64_t*)0x20005c10 = 0x3d5000;
-  *(uint64_t*)0x20005c18 = 0;
-  *(uint64_t*)0x20005c20 = 0;
-  *(uint64_t*)0x20005c28 = 0x3d6000;
-  *(uint64_t*)0x20005c30 = 0;
-  *(uint64_t*)0x20005c38 = 0;
-  *(uint64_t*)0x20005c40 = 0x3d7000;
-  *(uint64_t*)0x20005c48 = 0;
-  *(uint64_t*)0x20005c50 = 0;
-  *(uint64_t*)0x20005c58 = 0x3d8000;
-  *(uint64_t*)0x20005c60 = 0;
-  *(uint64_t*)0x20005c68 = 0;
-  *(uint64_t*)0x20005c70 = 0x3d9000;
-  *(uint64_t*)0x20005c78 = 0;
-  *(uint64_t*)0x20005c80 = 0;
-  *(uint64_t*)0x20005c88 = 0x3da000;
-  *(uint64_t*)0x20005c90 = 0;
-  *(uint64_t*)0x20005c98 = 0;
-  *(uint64_t*)0x20005ca0 = 0x3db000;
-  *(uint64_t*)0x20005ca8 = 0;
-  *(uint64_t*)0x20005cb0 = 0;
-  *(uint64_t*)0x20005cb8 = 0x3dc000;
-  *(uint64_t*)0x20005cc0 = 0;
-  *(uint64_t*)0x20005cc8 = 0;
-  *(uint64_t*)0x20005cd0 = 0x3dd000;
-  *(uint64_t*)0x20005cd8 = 0;
-  *(uint64_t*)0x20005ce0 = 0;
-  *(uint64_t*)0x20005ce8 = 0x3de000;
-  *(uint64_t*)0x20005cf0 = 0;
-  *(uint64_t*)0x20005cf8 = 0;
-  *(uint64_t*)0x20005d00 = 0x3df000;
-  *(uint64_t*)0x20005d08 = 0;
-  *(uint64_t*)0x20005d10 = 0;
-  *(uint64_t*)0x20005d18 = 0x3e0000;
-  *(uint64_t*)0x20005d20 = 0;
-  *(uint64_t*)0x20005d28 = 0;
-  *(uint64_t*)0x20005d30 = 0x3e1000;
-  *(uint64_t*)0x20005d38 = 0;
-  *(uint64_t*)0x20005d40 = 0;
-  *(uint64_t*)0x20005d48 = 0x3e2000;
-  *(uint64_t*)0x20005d50 = 0;
-  *(uint64_t*)0x20005d58 = 0;
-  *(uint64_t*)0x20005d60 = 0x3e3000;
-  *(uint64_t*)0x20005d68 = 0;
-  *(uint64_t*)0x20005d70 = 0;
-  *(uint64_t*)0x20005d78 = 0x3e4000;
-  *(uint64_t*)0x20005d80 = 0;
-  *(uint64_t*)0x20005d88 = 0;
-  *(uint64_t*)0x20005d90 = 0x3e5000;
-  *(uint64_t*)0x20005d98 = 0;
-  *(uint64_t*)0x20005da0 = 0;
-  *(uint64_t*)0x20005da8 = 0x3e6000;
-  *(uint64_t*)0x20005db0 = 0;
-  *(uint64_t*)0x20005db8 = 0;
-  *(uint64_t*)0x20005dc0 = 0x3e7000;
-  *(uint64_t*)0x20005dc8 = 0;
-  *(uint64_t*)0x20005dd0 = 0;
-  *(uint64_t*)0x20005dd8 = 0x3e8000;
-  *(uint64_t*)0x20005de0 = 0;
-  *(uint64_t*)0x20005de8 = 0;
-  *(uint64_t*)0x20005df0 = 0x3e9000;
-  *(uint64_t*)0x20005df8 = 0;
-  *(uint64_t*)0x20005e00 = 0;
-  *(uint64_t*)0x20005e08 = 0x3ea000;
-  *(uint64_t*)0x20005e10 = 0;
-  *(uint64_t*)0x20005e18 = 0;
-  *(uint64_t*)0x20005e20 = 0x3eb000;
-  *(uint64_t*)0x20005e28 = 0;
-  *(uint64_t*)0x20005e30 = 0;
-  *(uint64_t*)0x20005e38 = 0x3ec000;
-  *(uint64_t*)0x20005e40 = 0;
-  *(uint64_t*)0x20005e48 = 0;
-  *(uint64_t*)0x20005e50 = 0x3ed000;
-  *(uint64_t*)0x20005e58 = 0;
-  *(uint64_t*)0x20005e60 = 0;
-  *(uint64_t*)0x20005e68 = 0x3ee000;
-  *(uint64_t*)0x20005e70 = 0;
-  *(uint64_t*)0x20005e78 = 0;
-  *(uint64_t*)0x20005e80 = 0x3ef000;
-  *(uint64_t*)0x20005e88 = 0;
-  *(uint64_t*)0x20005e90 = 0;
-  *(uint64_t*)0x20005e98 = 0x3f0000;
-  *(uint64_t*)0x20005ea0 = 0;
-  *(uint64_t*)0x20005ea8 = 0;
-  *(uint64_t*)0x20005eb0 = 0x3f1000;
-  *(uint64_t*)0x20005eb8 = 0;
-  *(uint64_t*)0x20005ec0 = 0;
-  *(uint64_t*)0x20005ec8 = 0x3f2000;
-  *(uint64_t*)0x20005ed0 = 0;
-  *(uint64_t*)0x20005ed8 = 0;
-  *(uint64_t*)0x20005ee0 = 0x3f3000;
-  *(uint64_t*)0x20005ee8 = 0;
-  *(uint64_t*)0x20005ef0 = 0;
-  *(uint64_t*)0x20005ef8 = 0x3f4000;
-  *(uint64_t*)0x20005f00 = 0;
-  *(uint64_t*)0x20005f08 = 0;
-  *(uint64_t*)0x20005f10 = 0x3f5000;
-  *(uint64_t*)0x20005f18 = 0;
-  *(uint64_t*)0x20005f20 = 0;
-  *(uint64_t*)0x20005f28 = 0x3f6000;
-  *(uint64_t*)0x20005f30 = 0;
-  *(uint64_t*)0x20005f38 = 0;
-  *(uint64_t*)0x20005f40 = 0x3f7000;
-  *(uint64_t*)0x20005f48 = 0;
-  *(uint64_t*)0x20005f50 = 0;
-  *(uint64_t*)0x20005f58 = 0x3f8000;
-  *(uint64_t*)0x20005f60 = 0;
-  *(uint64_t*)0x20005f68 = 0;
-  *(uint64_t*)0x20005f70 = 0x3f9000;
-  *(uint64_t*)0x20005f78 = 0;
-  *(uint64_t*)0x20005f80 = 0;
-  *(uint64_t*)0x20005f88 = 0x3fa000;
-  *(uint64_t*)0x20005f90 = 0;
-  *(uint64_t*)0x20005f98 = 0;
-  *(uint64_t*)0x20005fa0 = 0x3fb000;
-  *(uint64_t*)0x20005fa8 = 0;
-  *(uint64_t*)0x20005fb0 = 0;
-  *(uint64_t*)0x20005fb8 = 0x3fc000;
-  *(uint64_t*)0x20005fc0 = 0;
-  *(uint64_t*)0x20005fc8 = 0;
-  *(uint64_t*)0x20005fd0 = 0x3fd000;
-  *(uint64_t*)0x20005fd8 = 0;
-  *(uint64_t*)0x20005fe0 = 0;
-  *(uint64_t*)0x20005fe8 = 0x3fe000;
-  *(uint64_t*)0x20005ff0 = 0;
-  *(uint64_t*)0x20005ff8 = 0;
-  *(uint64_t*)0x20006000 = 0x3ff000;
-  *(uint64_t*)0x20006008 = 0;
-  *(uint64_t*)0x20006010 = 0;
-  *(uint64_t*)0x20006018 = 0x400000;
-  *(uint64_t*)0x20006020 = 0;
-  *(uint64_t*)0x20006028 = 0;
-  *(uint64_t*)0x20006030 = 0x401000;
-  *(uint64_t*)0x20006038 = 0;
-  *(uint64_t*)0x20006040 = 0;
-  *(uint64_t*)0x20006048 = 0x402000;
-  *(uint64_t*)0x20006050 = 0;
-  *(uint64_t*)0x20006058 = 0;
-  *(uint64_t*)0x20006060 = 0x403000;
-  *(uint64_t*)0x20006068 = 0;
-  *(uint64_t*)0x20006070 = 0;
-  *(uint64_t*)0x20006078 = 0x404000;
-  *(uint64_t*)0x20006080 = 0;
-  *(uint64_t*)0x20006088 = 0;
-  *(uint64_t*)0x20006090 = 0x405000;
-  *(uint64_t*)0x20006098 = 0;
-  *(uint64_t*)0x200060a0 = 0;
-  *(uint64_t*)0x200060a8 = 0x406000;
-  *(uint64_t*)0x200060b0 = 0;
-  *(uint64_t*)0x200060b8 = 0;
-  *(uint64_t*)0x200060c0 = 0x407000;
-  *(uint64_t*)0x200060c8 = 0;
-  *(uint64_t*)0x200060d0 = 0;
-  *(uint64_t*)0x200060d8 = 0x408000;
-  *(uint64_t*)0x200060e0 = 0;
-  *(uint64_t*)0x200060e8 = 0;
-  *(uint64_t*)0x200060f0 = 0x409000;
-  *(uint64_t*)0x200060f8 = 0;
-  *(uint64_t*)0x20006100 = 0;
-  *(uint64_t*)0x20006108 = 0x40a000;
-  *(uint64_t*)0x20006110 = 0;
-  *(uint64_t*)0x20006118 = 0;
-  *(uint64_t*)0x20006120 = 0x40b000;
-  *(uint64_t*)0x20006128 = 0;
-  *(uint64_t*)0x20006130 = 0;
-  *(uint64_t*)0x20006138 = 0x40c000;
-  *(uint64_t*)0x20006140 = 0;
-  *(uint64_t*)0x20006148 = 0;
-  *(uint64_t*)0x20006150 = 0x40d000;
-  *(uint64_t*)0x20006158 = 0;
-  *(uint64_t*)0x20006160 = 0;
-  *(uint64_t*)0x20006168 = 0x40e000;
-  *(uint64_t*)0x20006170 = 0;
-  *(uint64_t*)0x20006178 = 0;
-  *(uint64_t*)0x20006180 = 0x40f000;
-  *(uint64_t*)0x20006188 = 0;
-  *(uint64_t*)0x20006190 = 0;
-  *(uint64_t*)0x20006198 = 0x410000;
-  *(uint64_t*)0x200061a0 = 0;
-  *(uint64_t*)0x200061a8 = 0;
-  *(uint64_t*)0x200061b0 = 0x411000;
-  *(uint64_t*)0x200061b8 = 0;
-  *(uint64_t*)0x200061c0 = 0;
-  *(uint64_t*)0x200061c8 = 0x412000;
-  *(uint64_t*)0x200061d0 = 0;
-  *(uint64_t*)0x200061d8 = 0;
-  *(uint64_t*)0x200061e0 = 0x413000;
-  *(uint64_t*)0x200061e8 = 0;
-  *(uint64_t*)0x200061f0 = 0;
-  *(uint64_t*)0x200061f8 = 0x414000;
-  *(uint64_t*)0x20006200 = 0;
-  *(uint64_t*)0x20006208 = 0;
-  *(uint64_t*)0x20006210 = 0x415000;
-  *(uint64_t*)0x20006218 = 0;
-  *(uint64_t*)0x20006220 = 0;
-  *(uint64_t*)0x20006228 = 0x416000;
-  *(uint64_t*)0x20006230 = 0;
-  *(uint64_t*)0x20006238 = 0;
-  *(uint64_t*)0x20006240 = 0x417000;
-  *(uint64_t*)0x20006248 = 0;
-  *(uint64_t*)0x20006250 = 0;
-  *(uint64_t*)0x20006258 = 0x418000;
-  *(uint64_t*)0x20006260 = 0;
-  *(uint64_t*)0x20006268 = 0;
-  *(uint64_t*)0x20006270 = 0x419000;
-  *(uint64_t*)0x20006278 = 0;
-  *(uint64_t*)0x20006280 = 0;
-  *(uint64_t*)0x20006288 = 0x41a000;
-  *(uint64_t*)0x20006290 = 0;
-  *(uint64_t*)0x20006298 = 0;
-  *(uint64_t*)0x200062a0 = 0x41b000;
-  *(uint64_t*)0x200062a8 = 0;
-  *(uint64_t*)0x200062b0 = 0;
-  *(uint64_t*)0x200062b8 = 0x41c000;
-  *(uint64_t*)0x200062c0 = 0;
-  *(uint64_t*)0x200062c8 = 0;
-  *(uint64_t*)0x200062d0 = 0x41d000;
-  *(uint64_t*)0x200062d8 = 0;
-  *(uint64_t*)0x200062e0 = 0;
-  *(uint64_t*)0x200062e8 = 0x41e000;
-  *(uint64_t*)0x200062f0 = 0;
-  *(uint64_t*)0x200062f8 = 0;
-  *(uint64_t*)0x20006300 = 0x41f000;
-  *(uint64_t*)0x20006308 = 0;
-  *(uint64_t*)0x20006310 = 0;
-  *(uint64_t*)0x20006318 = 0x420000;
-  *(uint64_t*)0x20006320 = 0;
-  *(uint64_t*)0x20006328 = 0;
-  *(uint64_t*)0x20006330 = 0x421000;
-  *(uint64_t*)0x20006338 = 0;
-  *(uint64_t*)0x20006340 = 0;
-  *(uint64_t*)0x20006348 = 0x422000;
-  *(uint64_t*)0x20006350 = 0;
-  *(uint64_t*)0x20006358 = 0;
-  *(uint64_t*)0x20006360 = 0x423000;
-  *(uint64_t*)0x20006368 = 0;
-  *(uint64_t*)0x20006370 = 0;
-  *(uint64_t*)0x20006378 = 0x424000;
-  *(uint64_t*)0x20006380 = 0;
-  *(uint64_t*)0x20006388 = 0;
-  *(uint64_t*)0x20006390 = 0x425000;
-  *(uint64_t*)0x20006398 = 0;
-  *(uint64_t*)0x200063a0 = 0;
-  *(uint64_t*)0x200063a8 = 0x426000;
-  *(uint64_t*)0x200063b0 = 0;
-  *(uint64_t*)0x200063b8 = 0;
-  *(uint64_t*)0x200063c0 = 0x427000;
-  *(uint64_t*)0x200063c8 = 0;
-  *(uint64_t*)0x200063d0 = 0;
-  *(uint64_t*)0x200063d8 = 0x428000;
-  *(uint64_t*)0x200063e0 = 0;
-  *(uint64_t*)0x200063e8 = 0;
-  *(uint64_t*)0x200063f0 = 0x429000;
-  *(uint64_t*)0x200063f8 = 0;
-  *(uint64_t*)0x20006400 = 0;
-  *(uint64_t*)0x20006408 = 0x42a000;
-  *(uint64_t*)0x20006410 = 0;
-  *(uint64_t*)0x20006418 = 0;
-  *(uint64_t*)0x20006420 = 0x42b000;
-  *(uint64_t*)0x20006428 = 0;
-  *(uint64_t*)0x20006430 = 0;
-  *(uint64_t*)0x20006438 = 0x42c000;
-  *(uint64_t*)0x20006440 = 0;
-  *(uint64_t*)0x20006448 = 0;
-  *(uint64_t*)0x20006450 = 0x42d000;
-  *(uint64_t*)0x20006458 = 0;
-  *(uint64_t*)0x20006460 = 0;
-  *(uint64_t*)0x20006468 = 0x42e000;
-  *(uint64_t*)0x20006470 = 0;
-  *(uint64_t*)0x20006478 = 0;
-  *(uint64_t*)0x20006480 = 0x42f000;
-  *(uint64_t*)0x20006488 = 0;
-  *(uint64_t*)0x20006490 = 0;
-  *(uint64_t*)0x20006498 = 0x430000;
-  *(uint64_t*)0x200064a0 = 0;
-  *(uint64_t*)0x200064a8 = 0;
-  *(uint64_t*)0x200064b0 = 0x431000;
-  *(uint64_t*)0x200064b8 = 0;
-  *(uint64_t*)0x200064c0 = 0;
-  *(uint64_t*)0x200064c8 = 0x432000;
-  *(uint64_t*)0x200064d0 = 0;
-  *(uint64_t*)0x200064d8 = 0;
-  *(uint64_t*)0x200064e0 = 0x433000;
-  *(uint64_t*)0x200064e8 = 0;
-  *(uint64_t*)0x200064f0 = 0;
-  *(uint64_t*)0x200064f8 = 0x434000;
-  *(uint64_t*)0x20006500 = 0;
-  *(uint64_t*)0x20006508 = 0;
-  *(uint64_t*)0x20006510 = 0x435000;
-  *(uint64_t*)0x20006518 = 0;
-  *(uint64_t*)0x20006520 = 0;
-  *(uint64_t*)0x20006528 = 0x436000;
-  *(uint64_t*)0x20006530 = 0;
-  *(uint64_t*)0x20006538 = 0;
-  *(uint64_t*)0x20006540 = 0x437000;
-  *(uint64_t*)0x20006548 = 0;
-  *(uint64_t*)0x20006550 = 0;
-  *(uint64_t*)0x20006558 = 0x438000;
-  *(uint64_t*)0x20006560 = 0;
-  *(uint64_t*)0x20006568 = 0;
-  *(uint64_t*)0x20006570 = 0x439000;
-  *(uint64_t*)0x20006578 = 0;
-  *(uint64_t*)0x20006580 = 0;
-  *(uint64_t*)0x20006588 = 0x43a000;
-  *(uint64_t*)0x20006590 = 0;
-  *(uint64_t*)0x20006598 = 0;
-  *(uint64_t*)0x200065a0 = 0x43b000;
-  *(uint64_t*)0x200065a8 = 0;
-  *(uint64_t*)0x200065b0 = 0;
-  *(uint64_t*)0x200065b8 = 0x43c000;
-  *(uint64_t*)0x200065c0 = 0;
-  *(uint64_t*)0x200065c8 = 0;
-  *(uint64_t*)0x200065d0 = 0x43d000;
-  *(uint64_t*)0x200065d8 = 0;
-  *(uint64_t*)0x200065e0 = 0;
-  *(uint64_t*)0x200065e8 = 0x43e000;
-  *(uint64_t*)0x200065f0 = 0;
-  *(uint64_t*)0x200065f8 = 0;
-  *(uint64_t*)0x20006600 = 0x43f000;
-  *(uint64_t*)0x20006608 = 0;
-  *(uint64_t*)0x20006610 = 0;
-  *(uint64_t*)0x20006618 = 0x440000;
-  *(uint64_t*)0x20006620 = 0;
-  *(uint64_t*)0x20006628 = 0;
-  *(uint64_t*)0x20006630 = 0x441000;
-  *(uint64_t*)0x20006638 = 0;
-  *(uint64_t*)0x20006640 = 0;
-  *(uint64_t*)0x20006648 = 0x442000;
-  *(uint64_t*)0x20006650 = 0;
-  *(uint64_t*)0x20006658 = 0;
-  *(uint64_t*)0x20006660 = 0x443000;
-  *(uint64_t*)0x20006668 = 0;
-  *(uint64_t*)0x20006670 = 0;
-  *(uint64_t*)0x20006678 = 0x444000;
-  *(uint64_t*)0x20006680 = 0;
-  *(uint64_t*)0x20006688 = 0;
-  *(uint64_t*)0x20006690 = 0x445000;
-  *(uint64_t*)0x20006698 = 0;
-  *(uint64_t*)0x200066a0 = 0;
-  *(uint64_t*)0x200066a8 = 0x446000;
-  *(uint64_t*)0x200066b0 = 0;
-  *(uint64_t*)0x200066b8 = 0;
-  *(uint64_t*)0x200066c0 = 0x447000;
-  *(uint64_t*)0x200066c8 = 0;
-  *(uint64_t*)0x200066d0 = 0;
-  *(uint64_t*)0x200066d8 = 0x448000;
-  *(uint64_t*)0x200066e0 = 0;
-  *(uint64_t*)0x200066e8 = 0;
-  *(uint64_t*)0x200066f0 = 0x449000;
-  *(uint64_t*)0x200066f8 = 0;
-  *(uint64_t*)0x20006700 = 0;
-  *(uint64_t*)0x20006708 = 0x44a000;
-  *(uint64_t*)0x20006710 = 0;
-  *(uint64_t*)0x20006718 = 0;
-  *(uint64_t*)0x20006720 = 0x44b000;
-  *(uint64_t*)0x20006728 = 0;
-  *(uint64_t*)0x20006730 = 0;
-  *(uint64_t*)0x20006738 = 0x44c000;
-  *(uint64_t*)0x20006740 = 0;
-  *(uint64_t*)0x20006748 = 0;
-  *(uint64_t*)0x20006750 = 0x44d000;
-  *(uint64_t*)0x20006758 = 0;
-  *(uint64_t*)0x20006760 = 0;
-  *(uint64_t*)0x20006768 = 0x44e000;
-  *(uint64_t*)0x20006770 = 0;
-  *(uint64_t*)0x20006778 = 0;
-  *(uint64_t*)0x20006780 = 0x44f000;
-  *(uint64_t*)0x20006788 = 0;
-  *(uint64_t*)0x20006790 = 0;
-  *(uint64_t*)0x20006798 = 0x450000;
-  *(uint64_t*)0x200067a0 = 0;
-  *(uint64_t*)0x200067a8 = 0;
-  *(uint64_t*)0x200067b0 = 0x451000;
-  *(uint64_t*)0x200067b8 = 0;
-  *(uint64_t*)0x200067c0 = 0;
-  *(uint64_t*)0x200067c8 = 0x452000;
-  *(uint64_t*)0x200067d0 = 0;
-  *(uint64_t*)0x200067d8 = 0;
-  *(uint64_t*)0x200067e0 = 0x453000;
-  *(uint64_t*)0x200067e8 = 0;
-  *(uint64_t*)0x200067f0 = 0;
-  *(uint64_t*)0x200067f8 = 0x454000;
-  *(uint64_t*)0x20006800 = 0;
-  *(uint64_t*)0x20006808 = 0;
-  *(uint64_t*)0x20006810 = 0x455000;
-  *(uint64_t*)0x20006818 = 0;
-  *(uint64_t*)0x20006820 = 0;
-  *(uint64_t*)0x20006828 = 0x456000;
-  *(uint64_t*)0x20006830 = 0;
-  *(uint64_t*)0x20006838 = 0;
-  *(uint64_t*)0x20006840 = 0x457000;
-  *(uint64_t*)0x20006848 = 0;
-  *(uint64_t*)0x20006850 = 0;
-  *(uint64_t*)0x20006858 = 0x458000;
-  *(uint64_t*)0x20006860 = 0;
-  *(uint64_t*)0x20006868 = 0;
-  *(uint64_t*)0x20006870 = 0x459000;
-  *(uint64_t*)0x20006878 = 0;
-  *(uint64_t*)0x20006880 = 0;
-  *(uint64_t*)0x20006888 = 0x45a000;
-  *(uint64_t*)0x20006890 = 0;
-  *(uint64_t*)0x20006898 = 0;
-  *(uint64_t*)0x200068a0 = 0x45b000;
-  *(uint64_t*)0x200068a8 = 0;
-  *(uint64_t*)0x200068b0 = 0;
-  *(uint64_t*)0x200068b8 = 0x45c000;
-  *(uint64_t*)0x200068c0 = 0;
-  *(uint64_t*)0x200068c8 = 0;
-  *(uint64_t*)0x200068d0 = 0x45d000;
-  *(uint64_t*)0x200068d8 = 0;
-  *(uint64_t*)0x200068e0 = 0;
-  *(uint64_t*)0x200068e8 = 0x45e000;
-  *(uint64_t*)0x200068f0 = 0;
-  *(uint64_t*)0x200068f8 = 0;
-  *(uint64_t*)0x20006900 = 0x45f000;
-  *(uint64_t*)0x20006908 = 0;
-  *(uint64_t*)0x20006910 = 0;
-  *(uint64_t*)0x20006918 = 0x460000;
-  *(uint64_t*)0x20006920 = 0;
-  *(uint64_t*)0x20006928 = 0;
-  *(uint64_t*)0x20006930 = 0x461000;
-  *(uint64_t*)0x20006938 = 0;
-  *(uint64_t*)0x20006940 = 0;
-  *(uint64_t*)0x20006948 = 0x462000;
-  *(uint64_t*)0x20006950 = 0;
-  *(uint64_t*)0x20006958 = 0;
-  *(uint64_t*)0x20006960 = 0x463000;
-  *(uint64_t*)0x20006968 = 0;
-  *(uint64_t*)0x20006970 = 0;
-  *(uint64_t*)0x20006978 = 0x464000;
-  *(uint64_t*)0x20006980 = 0;
-  *(uint64_t*)0x20006988 = 0;
-  *(uint64_t*)0x20006990 = 0x465000;
-  *(uint64_t*)0x20006998 = 0;
-  *(uint64_t*)0x200069a0 = 0;
-  *(uint64_t*)0x200069a8 = 0x466000;
-  *(uint64_t*)0x200069b0 = 0;
-  *(uint64_t*)0x200069b8 = 0;
-  *(uint64_t*)0x200069c0 = 0x467000;
-  *(uint64_t*)0x200069c8 = 0;
-  *(uint64_t*)0x200069d0 = 0;
-  *(uint64_t*)0x200069d8 = 0x468000;
-  *(uint64_t*)0x200069e0 = 0;
-  *(uint64_t*)0x200069e8 = 0;
-  *(uint64_t*)0x200069f0 = 0x469000;
-  *(uint64_t*)0x200069f8 = 0;
-  *(uint64_t*)0x20006a00 = 0;
-  *(uint64_t*)0x20006a08 = 0x46a000;
-  *(uint64_t*)0x20006a10 = 0;
-  *(uint64_t*)0x20006a18 = 0;
-  *(uint64_t*)0x20006a20 = 0x46b000;
-  *(uint64_t*)0x20006a28 = 0;
-  *(uint64_t*)0x20006a30 = 0;
-  *(uint64_t*)0x20006a38 = 0x46c000;
-  *(uint64_t*)0x20006a40 = 0;
-  *(uint64_t*)0x20006a48 = 0;
-  *(uint64_t*)0x20006a50 = 0x46d000;
-  *(uint64_t*)0x20006a58 = 0;
-  *(uint64_t*)0x20006a60 = 0;
-  *(uint64_t*)0x20006a68 = 0x46e000;
-  *(uint64_t*)0x20006a70 = 0;
-  *(uint64_t*)0x20006a78 = 0;
-  *(uint64_t*)0x20006a80 = 0x46f000;
-  *(uint64_t*)0x20006a88 = 0;
-  *(uint64_t*)0x20006a90 = 0;
-  *(uint64_t*)0x20006a98 = 0x470000;
-  *(uint64_t*)0x20006aa0 = 0;
-  *(uint64_t*)0x20006aa8 = 0;
-  *(uint64_t*)0x20006ab0 = 0x471000;
-  *(uint64_t*)0x20006ab8 = 0;
-  *(uint64_t*)0x20006ac0 = 0;
-  *(uint64_t*)0x20006ac8 = 0x472000;
-  *(uint64_t*)0x20006ad0 = 0;
-  *(uint64_t*)0x20006ad8 = 0;
-  *(uint64_t*)0x20006ae0 = 0x473000;
-  *(uint64_t*)0x20006ae8 = 0;
-  *(uint64_t*)0x20006af0 = 0;
-  *(uint64_t*)0x20006af8 = 0x474000;
-  *(uint64_t*)0x20006b00 = 0;
-  *(uint64_t*)0x20006b08 = 0;
-  *(uint64_t*)0x20006b10 = 0x475000;
-  *(uint64_t*)0x20006b18 = 0;
-  *(uint64_t*)0x20006b20 = 0;
-  *(uint64_t*)0x20006b28 = 0x476000;
-  *(uint64_t*)0x20006b30 = 0;
-  *(uint64_t*)0x20006b38 = 0;
-  *(uint64_t*)0x20006b40 = 0x477000;
-  *(uint64_t*)0x20006b48 = 0;
-  *(uint64_t*)0x20006b50 = 0;
-  *(uint64_t*)0x20006b58 = 0x478000;
-  *(uint64_t*)0x20006b60 = 0;
-  *(uint64_t*)0x20006b68 = 0;
-  *(uint64_t*)0x20006b70 = 0x479000;
-  *(uint64_t*)0x20006b78 = 0;
-  *(uint64_t*)0x20006b80 = 0;
-  *(uint64_t*)0x20006b88 = 0x47a000;
-  *(uint64_t*)0x20006b90 = 0;
-  *(uint64_t*)0x20006b98 = 0;
-  *(uint64_t*)0x20006ba0 = 0x47b000;
-  *(uint64_t*)0x20006ba8 = 0;
-  *(uint64_t*)0x20006bb0 = 0;
-  *(uint64_t*)0x20006bb8 = 0x47c000;
-  *(uint64_t*)0x20006bc0 = 0;
-  *(uint64_t*)0x20006bc8 = 0;
-  *(uint64_t*)0x20006bd0 = 0x47d000;
-  *(uint64_t*)0x20006bd8 = 0;
-  *(uint64_t*)0x20006be0 = 0;
-  *(uint64_t*)0x20006be8 = 0x47e000;
-  *(uint64_t*)0x20006bf0 = 0;
-  *(uint64_t*)0x20006bf8 = 0;
-  *(uint64_t*)0x20006c00 = 0x47f000;
-  *(uint64_t*)0x20006c08 = 0;
-  *(uint64_t*)0x20006c10 = 0;
-  *(uint64_t*)0x20006c18 = 0x480000;
-  *(uint64_t*)0x20006c20 = 0;
-  *(uint64_t*)0x20006c28 = 0;
-  *(uint64_t*)0x20006c30 = 0x481000;
-  *(uint64_t*)0x20006c38 = 0;
-  *(uint64_t*)0x20006c40 = 0;
-  *(uint64_t*)0x20006c48 = 0x482000;
-  *(uint64_t*)0x20006c50 = 0;
-  *(uint64_t*)0x20006c58 = 0;
-  *(uint64_t*)0x20006c60 = 0x483000;
-  *(uint64_t*)0x20006c68 = 0;
-  *(uint64_t*)0x20006c70 = 0;
-  *(uint64_t*)0x20006c78 = 0x484000;
-  *(uint64_t*)0x20006c80 = 0;
-  *(uint64_t*)0x20006c88 = 0;
-  *(uint64_t*)0x20006c90 = 0x485000;
-  *(uint64_t*)0x20006c98 = 0;
-  *(uint64_t*)0x20006ca0 = 0;
-  *(uint64_t*)0x20006ca8 = 0x486000;
-  *(uint64_t*)0x20006cb0 = 0;
-  *(uint64_t*)0x20006cb8 = 0;
-  *(uint64_t*)0x20006cc0 = 0x487000;
-  *(uint64_t*)0x20006cc8 = 0;
-  *(uint64_t*)0x20006cd0 = 0;
-  *(uint64_t*)0x20006cd8 = 0x488000;
-  *(uint64_t*)0x20006ce0 = 0;
-  *(uint64_t*)0x20006ce8 = 0;
-  *(uint64_t*)0x20006cf0 = 0x489000;
-  *(uint64_t*)0x20006cf8 = 0;
-  *(uint64_t*)0x20006d00 = 0;
-  *(uint64_t*)0x20006d08 = 0x48a000;
-  *(uint64_t*)0x20006d10 = 0;
-  *(uint64_t*)0x20006d18 = 0;
-  *(uint64_t*)0x20006d20 = 0x48b000;
-  *(uint64_t*)0x20006d28 = 0;
-  *(uint64_t*)0x20006d30 = 0;
-  *(uint64_t*)0x20006d38 = 0x48c000;
-  *(uint64_t*)0x20006d40 = 0;
-  *(uint64_t*)0x20006d48 = 0;
-  *(uint64_t*)0x20006d50 = 0x48d000;
-  *(uint64_t*)0x20006d58 = 0;
-  *(uint64_t*)0x20006d60 = 0;
-  *(uint64_t*)0x20006d68 = 0x48e000;
-  *(uint64_t*)0x20006d70 = 0;
-  *(uint64_t*)0x20006d78 = 0;
-  *(uint64_t*)0x20006d80 = 0x48f000;
-  *(uint64_t*)0x20006d88 = 0;
-  *(uint64_t*)0x20006d90 = 0;
-  *(uint64_t*)0x20006d98 = 0x490000;
-  *(uint64_t*)0x20006da0 = 0;
-  *(uint64_t*)0x20006da8 = 0;
-  *(uint64_t*)0x20006db0 = 0x491000;
-  *(uint64_t*)0x20006db8 = 0;
-  *(uint64_t*)0x20006dc0 = 0;
-  *(uint64_t*)0x20006dc8 = 0x492000;
-  *(uint64_t*)0x20006dd0 = 0;
-  *(uint64_t*)0x20006dd8 = 0;
-  *(uint64_t*)0x20006de0 = 0x493000;
-  *(uint64_t*)0x20006de8 = 0;
-  *(uint64_t*)0x20006df0 = 0;
-  *(uint64_t*)0x20006df8 = 0x494000;
-  *(uint64_t*)0x20006e00 = 0;
-  *(uint64_t*)0x20006e08 = 0;
-  *(uint64_t*)0x20006e10 = 0x495000;
-  *(uint64_t*)0x20006e18 = 0;
-  *(uint64_t*)0x20006e20 = 0;
-  *(uint64_t*)0x20006e28 = 0x496000;
-  *(uint64_t*)0x20006e30 = 0;
-  *(uint64_t*)0x20006e38 = 0;
-  *(uint64_t*)0x20006e40 = 0x497000;
-  *(uint64_t*)0x20006e48 = 0;
-  *(uint64_t*)0x20006e50 = 0;
-  *(uint64_t*)0x20006e58 = 0x498000;
-  *(uint64_t*)0x20006e60 = 0;
-  *(uint64_t*)0x20006e68 = 0;
-  *(uint64_t*)0x20006e70 = 0x499000;
-  *(uint64_t*)0x20006e78 = 0;
-  *(uint64_t*)0x20006e80 = 0;
-  *(uint64_t*)0x20006e88 = 0x49a000;
-  *(uint64_t*)0x20006e90 = 0;
-  *(uint64_t*)0x20006e98 = 0;
-  *(uint64_t*)0x20006ea0 = 0x49b000;
-  *(uint64_t*)0x20006ea8 = 0;
-  *(uint64_t*)0x20006eb0 = 0;
-  *(uint64_t*)0x20006eb8 = 0x49c000;
-  *(uint64_t*)0x20006ec0 = 0;
-  *(uint64_t*)0x20006ec8 = 0;
-  *(uint64_t*)0x20006ed0 = 0x49d000;
-  *(uint64_t*)0x20006ed8 = 0;
-  *(uint64_t*)0x20006ee0 = 0;
-  *(uint64_t*)0x20006ee8 = 0x49e000;
-  *(uint64_t*)0x20006ef0 = 0;
-  *(uint64_t*)0x20006ef8 = 0;
-  *(uint64_t*)0x20006f00 = 0x49f000;
-  *(uint64_t*)0x20006f08 = 0;
-  *(uint64_t*)0x20006f10 = 0;
-  *(uint64_t*)0x20006f18 = 0x4a0000;
-  *(uint64_t*)0x20006f20 = 0;
-  *(uint64_t*)0x20006f28 = 0;
-  *(uint64_t*)0x20006f30 = 0x4a1000;
-  *(uint64_t*)0x20006f38 = 0;
-  *(uint64_t*)0x20006f40 = 0;
-  *(uint64_t*)0x20006f48 = 0x4a2000;
-  *(uint64_t*)0x20006f50 = 0;
-  *(uint64_t*)0x20006f58 = 0;
-  *(uint64_t*)0x20006f60 = 0x4a3000;
-  *(uint64_t*)0x20006f68 = 0;
-  *(uint64_t*)0x20006f70 = 0;
-  *(uint64_t*)0x20006f78 = 0x4a4000;
-  *(uint64_t*)0x20006f80 = 0;
-  *(uint64_t*)0x20006f88 = 0;
-  *(uint64_t*)0x20006f90 = 0x4a5000;
-  *(uint64_t*)0x20006f98 = 0;
-  *(uint64_t*)0x20006fa0 = 0;
-  *(uint64_t*)0x20006fa8 = 0x4a6000;
-  *(uint64_t*)0x20006fb0 = 0;
-  *(uint64_t*)0x20006fb8 = 0;
-  *(uint64_t*)0x20006fc0 = 0x4a7000;
-  *(uint64_t*)0x20006fc8 = 0;
-  *(uint64_t*)0x20006fd0 = 0;
-  *(uint64_t*)0x20006fd8 = 0x4a8000;
-  *(uint64_t*)0x20006fe0 = 0;
-  *(uint64_t*)0x20006fe8 = 0;
-  *(uint64_t*)0x20006ff0 = 0x4a9000;
-  *(uint64_t*)0x20006ff8 = 0;
-  *(uint64_t*)0x20007000 = 0;
-  *(uint64_t*)0x20007008 = 0x4aa000;
-  *(uint64_t*)0x20007010 = 0;
-  *(uint64_t*)0x20007018 = 0;
-  *(uint64_t*)0x20007020 = 0x4ab000;
-  *(uint64_t*)0x20007028 = 0;
-  *(uint64_t*)0x20007030 = 0;
-  *(uint64_t*)0x20007038 = 0x4ac000;
-  *(uint64_t*)0x20007040 = 0;
-  *(uint64_t*)0x20007048 = 0;
-  *(uint64_t*)0x20007050 = 0x4ad000;
-  *(uint64_t*)0x20007058 = 0;
-  *(uint64_t*)0x20007060 = 0;
-  *(uint64_t*)0x20007068 = 0x4ae000;
-  *(uint64_t*)0x20007070 = 0;
-  *(uint64_t*)0x20007078 = 0;
-  *(uint64_t*)0x20007080 = 0x4af000;
-  *(uint64_t*)0x20007088 = 0;
-  *(uint64_t*)0x20007090 = 0;
-  *(uint64_t*)0x20007098 = 0x4b0000;
-  *(uint64_t*)0x200070a0 = 0;
-  *(uint64_t*)0x200070a8 = 0;
-  *(uint64_t*)0x200070b0 = 0x4b1000;
-  *(uint64_t*)0x200070b8 = 0;
-  *(uint64_t*)0x200070c0 = 0;
-  *(uint64_t*)0x200070c8 = 0x4b2000;
-  *(uint64_t*)0x200070d0 = 0;
-  *(uint64_t*)0x200070d8 = 0;
-  *(uint64_t*)0x200070e0 = 0x4b3000;
-  *(uint64_t*)0x200070e8 = 0;
-  *(uint64_t*)0x200070f0 = 0;
-  *(uint64_t*)0x200070f8 = 0x4b4000;
-  *(uint64_t*)0x20007100 = 0;
-  *(uint64_t*)0x20007108 = 0;
-  *(uint64_t*)0x20007110 = 0x4b5000;
-  *(uint64_t*)0x20007118 = 0;
-  *(uint64_t*)0x20007120 = 0;
-  *(uint64_t*)0x20007128 = 0x4b6000;
-  *(uint64_t*)0x20007130 = 0;
-  *(uint64_t*)0x20007138 = 0;
-  *(uint64_t*)0x20007140 = 0x4b7000;
-  *(uint64_t*)0x20007148 = 0;
-  *(uint64_t*)0x20007150 = 0;
-  *(uint64_t*)0x20007158 = 0x4b8000;
-  *(uint64_t*)0x20007160 = 0;
-  *(uint64_t*)0x20007168 = 0;
-  *(uint64_t*)0x20007170 = 0x4b9000;
-  *(uint64_t*)0x20007178 = 0;
-  *(uint64_t*)0x20007180 = 0;
-  *(uint64_t*)0x20007188 = 0x4ba000;
-  *(uint64_t*)0x20007190 = 0;
-  *(uint64_t*)0x20007198 = 0;
-  *(uint64_t*)0x200071a0 = 0x4bb000;
-  *(uint64_t*)0x200071a8 = 0;
-  *(uint64_t*)0x200071b0 = 0;
-  *(uint64_t*)0x200071b8 = 0x4bc000;
-  *(uint64_t*)0x200071c0 = 0;
-  *(uint64_t*)0x200071c8 = 0;
-  *(uint64_t*)0x200071d0 = 0x4bd000;
-  *(uint64_t*)0x200071d8 = 0;
-  *(uint64_t*)0x200071e0 = 0;
-  *(uint64_t*)0x200071e8 = 0x4be000;
-  *(uint64_t*)0x200071f0 = 0;
-  *(uint64_t*)0x200071f8 = 0;
-  *(uint64_t*)0x20007200 = 0x4bf000;
-  *(uint64_t*)0x20007208 = 0;
-  *(uint64_t*)0x20007210 = 0;
-  *(uint64_t*)0x20007218 = 0x4c0000;
-  *(uint64_t*)0x20007220 = 0;
-  *(uint64_t*)0x20007228 = 0;
-  *(uint64_t*)0x20007230 = 0x4c1000;
-  *(uint64_t*)0x20007238 = 0;
-  *(uint64_t*)0x20007240 = 0;
-  *(uint64_t*)0x20007248 = 0x4c2000;
-  *(uint64_t*)0x20007250 = 0;
-  *(uint64_t*)0x20007258 = 0;
-  *(uint64_t*)0x20007260 = 0x4c3000;
-  *(uint64_t*)0x20007268 = 0;
-  *(uint64_t*)0x20007270 = 0;
-  *(uint64_t*)0x20007278 = 0x4c4000;
-  *(uint64_t*)0x20007280 = 0;
-  *(uint64_t*)0x20007288 = 0;
-  *(uint64_t*)0x20007290 = 0x4c5000;
-  *(uint64_t*)0x20007298 = 0;
-  *(uint64_t*)0x200072a0 = 0;
-  *(uint64_t*)0x200072a8 = 0x4c6000;
-  *(uint64_t*)0x200072b0 = 0;
-  *(uint64_t*)0x200072b8 = 0;
-  *(uint64_t*)0x200072c0 = 0x4c7000;
-  *(uint64_t*)0x200072c8 = 0;
-  *(uint64_t*)0x200072d0 = 0;
-  *(uint64_t*)0x200072d8 = 0x4c8000;
-  *(uint64_t*)0x200072e0 = 0;
-  *(uint64_t*)0x200072e8 = 0;
-  *(uint64_t*)0x200072f0 = 0x4c9000;
-  *(uint64_t*)0x200072f8 = 0;
-  *(uint64_t*)0x20007300 = 0;
-  *(uint64_t*)0x20007308 = 0x4ca000;
-  *(uint64_t*)0x20007310 = 0;
-  *(uint64_t*)0x20007318 = 0;
-  *(uint64_t*)0x20007320 = 0x4cb000;
-  *(uint64_t*)0x20007328 = 0;
-  *(uint64_t*)0x20007330 = 0;
-  *(uint64_t*)0x20007338 = 0x4cc000;
-  *(uint64_t*)0x20007340 = 0;
-  *(uint64_t*)0x20007348 = 0;
-  *(uint64_t*)0x20007350 = 0x4cd000;
-  *(uint64_t*)0x20007358 = 0;
-  *(uint64_t*)0x20007360 = 0;
-  *(uint64_t*)0x20007368 = 0x4ce000;
-  *(uint64_t*)0x20007370 = 0;
-  *(uint64_t*)0x20007378 = 0;
-  *(uint64_t*)0x20007380 = 0x4cf000;
-  *(uint64_t*)0x20007388 = 0;
-  *(uint64_t*)0x20007390 = 0;
-  *(uint64_t*)0x20007398 = 0x4d0000;
-  *(uint64_t*)0x200073a0 = 0;
-  *(uint64_t*)0x200073a8 = 0;
-  *(uint64_t*)0x200073b0 = 0x4d1000;
-  *(uint64_t*)0x200073b8 = 0;
-  *(uint64_t*)0x200073c0 = 0;
-  *(uint64_t*)0x200073c8 = 0x4d2000;
-  *(uint64_t*)0x200073d0 = 0;
-  *(uint64_t*)0x200073d8 = 0;
-  *(uint64_t*)0x200073e0 = 0x4d3000;
-  *(uint64_t*)0x200073e8 = 0;
-  *(uint64_t*)0x200073f0 = 0;
-  *(uint64_t*)0x200073f8 = 0x4d4000;
-  *(uint64_t*)0x20007400 = 0;
-  *(uint64_t*)0x20007408 = 0;
-  *(uint64_t*)0x20007410 = 0x4d5000;
-  *(uint64_t*)0x20007418 = 0;
-  *(uint64_t*)0x20007420 = 0;
-  *(uint64_t*)0x20007428 = 0x4d6000;
-  *(uint64_t*)0x20007430 = 0;
-  *(uint64_t*)0x20007438 = 0;
-  *(uint64_t*)0x20007440 = 0x4d7000;
-  *(uint64_t*)0x20007448 = 0;
-  *(uint64_t*)0x20007450 = 0;
-  *(uint64_t*)0x20007458 = 0x4d8000;
-  *(uint64_t*)0x20007460 = 0;
-  *(uint64_t*)0x20007468 = 0;
-  *(uint64_t*)0x20007470 = 0x4d9000;
-  *(uint64_t*)0x20007478 = 0;
-  *(uint64_t*)0x20007480 = 0;
-  *(uint64_t*)0x20007488 = 0x4da000;
-  *(uint64_t*)0x20007490 = 0;
-  *(uint64_t*)0x20007498 = 0;
-  *(uint64_t*)0x200074a0 = 0x4db000;
-  *(uint64_t*)0x200074a8 = 0;
-  *(uint64_t*)0x200074b0 = 0;
-  *(uint64_t*)0x200074b8 = 0x4dc000;
-  *(uint64_t*)0x200074c0 = 0;
-  *(uint64_t*)0x200074c8 = 0;
-  *(uint64_t*)0x200074d0 = 0x4dd000;
-  *(uint64_t*)0x200074d8 = 0;
-  *(uint64_t*)0x200074e0 = 0;
-  *(uint64_t*)0x200074e8 = 0x4de000;
-  *(uint64_t*)0x200074f0 = 0;
-  *(uint64_t*)0x200074f8 = 0;
-  *(uint64_t*)0x20007500 = 0x4df000;
-  *(uint64_t*)0x20007508 = 0;
-  *(uint64_t*)0x20007510 = 0;
-  *(uint64_t*)0x20007518 = 0x4e0000;
-  *(uint64_t*)0x20007520 = 0;
-  *(uint64_t*)0x20007528 = 0;
-  *(uint64_t*)0x20007530 = 0x4e1000;
-  *(uint64_t*)0x20007538 = 0;
-  *(uint64_t*)0x20007540 = 0;
-  *(uint64_t*)0x20007548 = 0x4e2000;
-  *(uint64_t*)0x20007550 = 0;
-  *(uint64_t*)0x20007558 = 0;
-  *(uint64_t*)0x20007560 = 0x4e3000;
-  *(uint64_t*)0x20007568 = 0;
-  *(uint64_t*)0x20007570 = 0;
-  *(uint64_t*)0x20007578 = 0x4e4000;
-  *(uint64_t*)0x20007580 = 0;
-  *(uint64_t*)0x20007588 = 0;
-  *(uint64_t*)0x20007590 = 0x4e5000;
-  *(uint64_t*)0x20007598 = 0;
-  *(uint64_t*)0x200075a0 = 0;
-  *(uint64_t*)0x200075a8 = 0x4e6000;
-  *(uint64_t*)0x200075b0 = 0;
-  *(uint64_t*)0x200075b8 = 0;
-  *(uint64_t*)0x200075c0 = 0x4e7000;
-  *(uint64_t*)0x200075c8 = 0;
-  *(uint64_t*)0x200075d0 = 0;
-  *(uint64_t*)0x200075d8 = 0x4e8000;
-  *(uint64_t*)0x200075e0 = 0;
-  *(uint64_t*)0x200075e8 = 0;
-  *(uint64_t*)0x200075f0 = 0x4e9000;
-  *(uint64_t*)0x200075f8 = 0;
-  *(uint64_t*)0x20007600 = 0;
-  *(uint64_t*)0x20007608 = 0x4ea000;
-  *(uint64_t*)0x20007610 = 0;
-  *(uint64_t*)0x20007618 = 0;
-  *(uint64_t*)0x20007620 = 0x4eb000;
-  *(uint64_t*)0x20007628 = 0;
-  *(uint64_t*)0x20007630 = 0;
-  *(uint64_t*)0x20007638 = 0x4ec000;
-  *(uint64_t*)0x20007640 = 0;
-  *(uint64_t*)0x20007648 = 0;
-  *(uint64_t*)0x20007650 = 0x4ed000;
-  *(uint64_t*)0x20007658 = 0;
-  *(uint64_t*)0x20007660 = 0;
-  *(uint64_t*)0x20007668 = 0x4ee000;
-  *(uint64_t*)0x20007670 = 0;
-  *(uint64_t*)0x20007678 = 0;
-  *(uint64_t*)0x20007680 = 0x4ef000;
-  *(uint64_t*)0x20007688 = 0;
-  *(uint64_t*)0x20007690 = 0;
-  *(uint64_t*)0x20007698 = 0x4f0000;
-  *(uint64_t*)0x200076a0 = 0;
-  *(uint64_t*)0x200076a8 = 0;
-  *(uint64_t*)0x200076b0 = 0x4f1000;
-  *(uint64_t*)0x200076b8 = 0;
-  *(uint64_t*)0x200076c0 = 0;
-  *(uint64_t*)0x200076c8 = 0x4f2000;
-  *(uint64_t*)0x200076d0 = 0;
-  *(uint64_t*)0x200076d8 = 0;
-  *(uint64_t*)0x200076e0 = 0x4f3000;
-  *(uint64_t*)0x200076e8 = 0;
-  *(uint64_t*)0x200076f0 = 0;
-  *(uint64_t*)0x200076f8 = 0x4f4000;
-  *(uint64_t*)0x20007700 = 0;
-  *(uint64_t*)0x20007708 = 0;
-  *(uint64_t*)0x20007710 = 0x4f5000;
-  *(uint64_t*)0x20007718 = 0;
-  *(uint64_t*)0x20007720 = 0;
-  *(uint64_t*)0x20007728 = 0x4f6000;
-  *(uint64_t*)0x20007730 = 0;
-  *(uint64_t*)0x20007738 = 0;
-  *(uint64_t*)0x20007740 = 0x4f7000;
-  *(uint64_t*)0x20007748 = 0;
-  *(uint64_t*)0x20007750 = 0;
-  *(uint64_t*)0x20007758 = 0x4f8000;
-  *(uint64_t*)0x20007760 = 0;
-  *(uint64_t*)0x20007768 = 0;
-  *(uint64_t*)0x20007770 = 0x4f9000;
-  *(uint64_t*)0x20007778 = 0;
-  *(uint64_t*)0x20007780 = 0;
-  *(uint64_t*)0x20007788 = 0x4fa000;
-  *(uint64_t*)0x20007790 = 0;
-  *(uint64_t*)0x20007798 = 0;
-  *(uint64_t*)0x200077a0 = 0x4fb000;
-  *(uint64_t*)0x200077a8 = 0;
-  *(uint64_t*)0x200077b0 = 0;
-  *(uint64_t*)0x200077b8 = 0x4fc000;
-  *(uint64_t*)0x200077c0 = 0;
-  *(uint64_t*)0x200077c8 = 0;
-  *(uint64_t*)0x200077d0 = 0x4fd000;
-  *(uint64_t*)0x200077d8 = 0;
-  *(uint64_t*)0x200077e0 = 0;
-  *(uint64_t*)0x200077e8 = 0x4fe000;
-  *(uint64_t*)0x200077f0 = 0;
-  *(uint64_t*)0x200077f8 = 0;
-  *(uint64_t*)0x20007800 = 0x4ff000;
-  *(uint64_t*)0x20007808 = 0;
-  *(uint64_t*)0x20007810 = 0;
-  *(uint64_t*)0x20007818 = 0x500000;
-  *(uint64_t*)0x20007820 = 0;
-  *(uint64_t*)0x20007828 = 0;
-  *(uint64_t*)0x20007830 = 0x501000;
-  *(uint64_t*)0x20007838 = 0;
-  *(uint64_t*)0x20007840 = 0;
-  *(uint64_t*)0x20007848 = 0x502000;
-  *(uint64_t*)0x20007850 = 0;
-  *(uint64_t*)0x20007858 = 0;
-  *(uint64_t*)0x20007860 = 0x503000;
-  *(uint64_t*)0x20007868 = 0;
-  *(uint64_t*)0x20007870 = 0;
-  *(uint64_t*)0x20007878 = 0x504000;
-  *(uint64_t*)0x20007880 = 0;
-  *(uint64_t*)0x20007888 = 0;
-  *(uint64_t*)0x20007890 = 0x505000;
-  *(uint64_t*)0x20007898 = 0;
-  *(uint64_t*)0x200078a0 = 0;
-  *(uint64_t*)0x200078a8 = 0x506000;
-  *(uint64_t*)0x200078b0 = 0;
-  *(uint64_t*)0x200078b8 = 0;
-  *(uint64_t*)0x200078c0 = 0x507000;
-  *(uint64_t*)0x200078c8 = 0;
-  *(uint64_t*)0x200078d0 = 0;
-  *(uint64_t*)0x200078d8 = 0x508000;
-  *(uint64_t*)0x200078e0 = 0;
-  *(uint64_t*)0x200078e8 = 0;
-  *(uint64_t*)0x200078f0 = 0x509000;
-  *(uint64_t*)0x200078f8 = 0;
-  *(uint64_t*)0x20007900 = 0;
-  *(uint64_t*)0x20007908 = 0x50a000;
-  *(uint64_t*)0x20007910 = 0;
-  *(uint64_t*)0x20007918 = 0;
-  *(uint64_t*)0x20007920 = 0x50b000;
-  *(uint64_t*)0x20007928 = 0;
-  *(uint64_t*)0x20007930 = 0;
-  *(uint64_t*)0x20007938 = 0x50c000;
-  *(uint64_t*)0x20007940 = 0;
-  *(uint64_t*)0x20007948 = 0;
-  *(uint64_t*)0x20007950 = 0x50d000;
-  *(uint64_t*)0x20007958 = 0;
-  *(uint64_t*)0x20007960 = 0;
-  *(uint64_t*)0x20007968 = 0x50e000;
-  *(uint64_t*)0x20007970 = 0;
-  *(uint64_t*)0x20007978 = 0;
-  *(uint64_t*)0x20007980 = 0x50f000;
-  *(uint64_t*)0x20007988 = 0;
-  *(uint64_t*)0x20007990 = 0;
-  *(uint64_t*)0x20007998 = 0x510000;
-  *(uint64_t*)0x200079a0 = 0;
-  *(uint64_t*)0x200079a8 = 0;
-  *(uint64_t*)0x200079b0 = 0x511000;
-  *(uint64_t*)0x200079b8 = 0;
-  *(uint64_t*)0x200079c0 = 0;
-  *(uint64_t*)0x200079c8 = 0x512000;
-  *(uint64_t*)0x200079d0 = 0;
-  *(uint64_t*)0x200079d8 = 0;
-  *(uint64_t*)0x200079e0 = 0x513000;
-  *(uint64_t*)0x200079e8 = 0;
-  *(uint64_t*)0x200079f0 = 0;
-  *(uint64_t*)0x200079f8 = 0x514000;
-  *(uint64_t*)0x20007a00 = 0;
-  *(uint64_t*)0x20007a08 = 0;
-  *(uint64_t*)0x20007a10 = 0x515000;
-  *(uint64_t*)0x20007a18 = 0;
-  *(uint64_t*)0x20007a20 = 0;
-  *(uint64_t*)0x20007a28 = 0x516000;
-  *(uint64_t*)0x20007a30 = 0;
-  *(uint64_t*)0x20007a38 = 0;
-  *(uint64_t*)0x20007a40 = 0x517000;
-  *(uint64_t*)0x20007a48 = 0;
-  *(uint64_t*)0x20007a50 = 0;
-  *(uint64_t*)0x20007a58 = 0x518000;
-  *(uint64_t*)0x20007a60 = 0;
-  *(uint64_t*)0x20007a68 = 0;
-  *(uint64_t*)0x20007a70 = 0x519000;
-  *(uint64_t*)0x20007a78 = 0;
-  *(uint64_t*)0x20007a80 = 0;
-  *(uint64_t*)0x20007a88 = 0x51a000;
-  *(uint64_t*)0x20007a90 = 0;
-  *(uint64_t*)0x20007a98 = 0;
-  *(uint64_t*)0x20007aa0 = 0x51b000;
-  *(uint64_t*)0x20007aa8 = 0;
-  *(uint64_t*)0x20007ab0 = 0;
-  *(uint64_t*)0x20007ab8 = 0x51c000;
-  *(uint64_t*)0x20007ac0 = 0;
-  *(uint64_t*)0x20007ac8 = 0;
-  *(uint64_t*)0x20007ad0 = 0x51d000;
-  *(uint64_t*)0x20007ad8 = 0;
-  *(uint64_t*)0x20007ae0 = 0;
-  *(uint64_t*)0x20007ae8 = 0x51e000;
-  *(uint64_t*)0x20007af0 = 0;
-  *(uint64_t*)0x20007af8 = 0;
-  *(uint64_t*)0x20007b00 = 0x51f000;
-  *(uint64_t*)0x20007b08 = 0;
-  *(uint64_t*)0x20007b10 = 0;
-  *(uint64_t*)0x20007b18 = 0x520000;
-  *(uint64_t*)0x20007b20 = 0;
-  *(uint64_t*)0x20007b28 = 0;
-  *(uint64_t*)0x20007b30 = 0x521000;
-  *(uint64_t*)0x20007b38 = 0;
-  *(uint64_t*)0x20007b40 = 0;
-  *(uint64_t*)0x20007b48 = 0x522000;
-  *(uint64_t*)0x20007b50 = 0;
-  *(uint64_t*)0x20007b58 = 0;
-  *(uint64_t*)0x20007b60 = 0x523000;
-  *(uint64_t*)0x20007b68 = 0;
-  *(uint64_t*)0x20007b70 = 0;
-  *(uint64_t*)0x20007b78 = 0x524000;
-  *(uint64_t*)0x20007b80 = 0;
-  *(uint64_t*)0x20007b88 = 0;
-  *(uint64_t*)0x20007b90 = 0x525000;
-  *(uint64_t*)0x20007b98 = 0;
-  *(uint64_t*)0x20007ba0 = 0;
-  *(uint64_t*)0x20007ba8 = 0x526000;
-  *(uint64_t*)0x20007bb0 = 0;
-  *(uint64_t*)0x20007bb8 = 0;
-  *(uint64_t*)0x20007bc0 = 0x527000;
-  *(uint64_t*)0x20007bc8 = 0;
-  *(uint64_t*)0x20007bd0 = 0;
-  *(uint64_t*)0x20007bd8 = 0x528000;
-  *(uint64_t*)0x20007be0 = 0;
-  *(uint64_t*)0x20007be8 = 0;
-  *(uint64_t*)0x20007bf0 = 0x529000;
-  *(uint64_t*)0x20007bf8 = 0;
-  *(uint64_t*)0x20007c00 = 0;
-  *(uint64_t*)0x20007c08 = 0x52a000;
-  *(uint64_t*)0x20007c10 = 0;
-  *(uint64_t*)0x20007c18 = 0;
-  *(uint64_t*)0x20007c20 = 0x52b000;
-  *(uint64_t*)0x20007c28 = 0;
-  *(uint64_t*)0x20007c30 = 0;
-  *(uint64_t*)0x20007c38 = 0x52c000;
-  *(uint64_t*)0x20007c40 = 0;
-  *(uint64_t*)0x20007c48 = 0;
-  *(uint64_t*)0x20007c50 = 0x52d000;
-  *(uint64_t*)0x20007c58 = 0;
-  *(uint64_t*)0x20007c60 = 0;
-  *(uint64_t*)0x20007c68 = 0x52e000;
-  *(uint64_t*)0x20007c70 = 0;
-  *(uint64_t*)0x20007c78 = 0;
-  *(uint64_t*)0x20007c80 = 0x52f000;
-  *(uint64_t*)0x20007c88 = 0;
-  *(uint64_t*)0x20007c90 = 0;
-  *(uint64_t*)0x20007c98 = 0x530000;
-  *(uint64_t*)0x20007ca0 = 0;
-  *(uint64_t*)0x20007ca8 = 0;
-  *(uint64_t*)0x20007cb0 = 0x531000;
-  *(uint64_t*)0x20007cb8 = 0;
-  *(uint64_t*)0x20007cc0 = 0;
-  *(uint64_t*)0x20007cc8 = 0x532000;
-  *(uint64_t*)0x20007cd0 = 0;
-  *(uint64_t*)0x20007cd8 = 0;
-  *(uint64_t*)0x20007ce0 = 0x533000;
-  *(uint64_t*)0x20007ce8 = 0;
-  *(uint64_t*)0x20007cf0 = 0;
-  *(uint64_t*)0x20007cf8 = 0x534000;
-  *(uint64_t*)0x20007d00 = 0;
-  *(uint64_t*)0x20007d08 = 0;
-  *(uint64_t*)0x20007d10 = 0x535000;
-  *(uint64_t*)0x20007d18 = 0;
-  *(uint64_t*)0x20007d20 = 0;
-  *(uint64_t*)0x20007d28 = 0x536000;
-  *(uint64_t*)0x20007d30 = 0;
-  *(uint64_t*)0x20007d38 = 0;
-  *(uint64_t*)0x20007d40 = 0x537000;
-  *(uint64_t*)0x20007d48 = 0;
-  *(uint64_t*)0x20007d50 = 0;
-  *(uint64_t*)0x20007d58 = 0x538000;
-  *(uint64_t*)0x20007d60 = 0;
-  *(uint64_t*)0x20007d68 = 0;
-  *(uint64_t*)0x20007d70 = 0x539000;
-  *(uint64_t*)0x20007d78 = 0;
-  *(uint64_t*)0x20007d80 = 0;
-  *(uint64_t*)0x20007d88 = 0x53a000;
-  *(uint64_t*)0x20007d90 = 0;
-  *(uint64_t*)0x20007d98 = 0;
-  *(uint64_t*)0x20007da0 = 0x53b000;
-  *(uint64_t*)0x20007da8 = 0;
-  *(uint64_t*)0x20007db0 = 0;
-  *(uint64_t*)0x20007db8 = 0x53c000;
-  *(uint64_t*)0x20007dc0 = 0;
-  *(uint64_t*)0x20007dc8 = 0;
-  *(uint64_t*)0x20007dd0 = 0x53d000;
-  *(uint64_t*)0x20007dd8 = 0;
-  *(uint64_t*)0x20007de0 = 0;
-  *(uint64_t*)0x20007de8 = 0x53e000;
-  *(uint64_t*)0x20007df0 = 0;
-  *(uint64_t*)0x20007df8 = 0;
-  *(uint64_t*)0x20007e00 = 0x53f000;
-  *(uint64_t*)0x20007e08 = 0;
-  *(uint64_t*)0x20007e10 = 0;
-  *(uint64_t*)0x20007e18 = 0x540000;
-  *(uint64_t*)0x20007e20 = 0;
-  *(uint64_t*)0x20007e28 = 0;
-  *(uint64_t*)0x20007e30 = 0x541000;
-  *(uint64_t*)0x20007e38 = 0;
-  *(uint64_t*)0x20007e40 = 0;
-  *(uint64_t*)0x20007e48 = 0x542000;
-  *(uint64_t*)0x20007e50 = 0;
-  *(uint64_t*)0x20007e58 = 0;
-  *(uint64_t*)0x20007e60 = 0x543000;
-  *(uint64_t*)0x20007e68 = 0;
-  *(uint64_t*)0x20007e70 = 0;
-  *(uint64_t*)0x20007e78 = 0x544000;
-  *(uint64_t*)0x20007e80 = 0;
-  *(uint64_t*)0x20007e88 = 0;
-  *(uint64_t*)0x20007e90 = 0x545000;
-  *(uint64_t*)0x20007e98 = 0;
-  *(uint64_t*)0x20007ea0 = 0;
-  *(uint64_t*)0x20007ea8 = 0x546000;
-  *(uint64_t*)0x20007eb0 = 0;
-  *(uint64_t*)0x20007eb8 = 0;
-  *(uint64_t*)0x20007ec0 = 0x547000;
-  *(uint64_t*)0x20007ec8 = 0;
-  *(uint64_t*)0x20007ed0 = 0;
-  *(uint64_t*)0x20007ed8 = 0x548000;
-  *(uint64_t*)0x20007ee0 = 0;
-  *(uint64_t*)0x20007ee8 = 0;
-  *(uint64_t*)0x20007ef0 = 0x549000;
-  *(uint64_t*)0x20007ef8 = 0;
-  *(uint64_t*)0x20007f00 = 0;
-  *(uint64_t*)0x20007f08 = 0x54a000;
-  *(uint64_t*)0x20007f10 = 0;
-  *(uint64_t*)0x20007f18 = 0;
-  *(uint64_t*)0x20007f20 = 0x54b000;
-  *(uint64_t*)0x20007f28 = 0;
-  *(uint64_t*)0x20007f30 = 0;
-  *(uint64_t*)0x20007f38 = 0x54c000;
-  *(uint64_t*)0x20007f40 = 0;
-  *(uint64_t*)0x20007f48 = 0;
-  *(uint64_t*)0x20007f50 = 0x54d000;
-  *(uint64_t*)0x20007f58 = 0;
-  *(uint64_t*)0x20007f60 = 0;
-  *(uint64_t*)0x20007f68 = 0x54e000;
-  *(uint64_t*)0x20007f70 = 0;
-  *(uint64_t*)0x20007f78 = 0;
-  *(uint64_t*)0x20007f80 = 0x54f000;
-  *(uint64_t*)0x20007f88 = 0;
-  *(uint64_t*)0x20007f90 = 0;
-  *(uint64_t*)0x20007f98 = 0x550000;
-  *(uint64_t*)0x20007fa0 = 0;
-  *(uint64_t*)0x20007fa8 = 0;
-  *(uint64_t*)0x20007fb0 = 0x551000;
-  *(uint64_t*)0x20007fb8 = 0;
-  *(uint64_t*)0x20007fc0 = 0;
-  *(uint64_t*)0x20007fc8 = 0x552000;
-  *(uint64_t*)0x20007fd0 = 0;
-  *(uint64_t*)0x20007fd8 = 0;
-  *(uint64_t*)0x20007fe0 = 0x553000;
-  *(uint64_t*)0x20007fe8 = 0;
-  *(uint64_t*)0x20007ff0 = 0;
-  *(uint64_t*)0x20007ff8 = 0x554000;
-  *(uint64_t*)0x20008000 = 0;
-  *(uint64_t*)0x20008008 = 0;
-  *(uint64_t*)0x20008010 = 0x555000;
-  *(uint64_t*)0x20008018 = 0;
-  *(uint64_t*)0x20008020 = 0;
-  *(uint64_t*)0x20008028 = 0x556000;
-  *(uint64_t*)0x20008030 = 0;
-  *(uint64_t*)0x20008038 = 0;
-  *(uint64_t*)0x20008040 = 0x557000;
-  *(uint64_t*)0x20008048 = 0;
-  *(uint64_t*)0x20008050 = 0;
-  *(uint64_t*)0x20008058 = 0x558000;
-  *(uint64_t*)0x20008060 = 0;
-  *(uint64_t*)0x20008068 = 0;
-  *(uint64_t*)0x20008070 = 0x559000;
-  *(uint64_t*)0x20008078 = 0;
-  *(uint64_t*)0x20008080 = 0;
-  *(uint64_t*)0x20008088 = 0x55a000;
-  *(uint64_t*)0x20008090 = 0;
-  *(uint64_t*)0x20008098 = 0;
-  *(uint64_t*)0x200080a0 = 0x55b000;
-  *(uint64_t*)0x200080a8 = 0;
-  *(uint64_t*)0x200080b0 = 0;
-  *(uint64_t*)0x200080b8 = 0x55c000;
-  *(uint64_t*)0x200080c0 = 0;
-  *(uint64_t*)0x200080c8 = 0;
-  *(uint64_t*)0x200080d0 = 0x55d000;
-  *(uint64_t*)0x200080d8 = 0;
-  *(uint64_t*)0x200080e0 = 0;
-  *(uint64_t*)0x200080e8 = 0x55e000;
-  *(uint64_t*)0x200080f0 = 0;
-  *(uint64_t*)0x200080f8 = 0;
-  *(uint64_t*)0x20008100 = 0x55f000;
-  *(uint64_t*)0x20008108 = 0;
-  *(uint64_t*)0x20008110 = 0;
-  *(uint64_t*)0x20008118 = 0x560000;
-  *(uint64_t*)0x20008120 = 0;
-  *(uint64_t*)0x20008128 = 0;
-  *(uint64_t*)0x20008130 = 0x561000;
-  *(uint64_t*)0x20008138 = 0;
-  *(uint64_t*)0x20008140 = 0;
-  *(uint64_t*)0x20008148 = 0x562000;
-  *(uint64_t*)0x20008150 = 0;
-  *(uint64_t*)0x20008158 = 0;
-  *(uint64_t*)0x20008160 = 0x563000;
-  *(uint64_t*)0x20008168 = 0;
-  *(uint64_t*)0x20008170 = 0;
-  *(uint64_t*)0x20008178 = 0x564000;
-  *(uint64_t*)0x20008180 = 0;
-  *(uint64_t*)0x20008188 = 0;
-  *(uint64_t*)0x20008190 = 0x565000;
-  *(uint64_t*)0x20008198 = 0;
-  *(uint64_t*)0x200081a0 = 0;
-  *(uint64_t*)0x200081a8 = 0x566000;
-  *(uint64_t*)0x200081b0 = 0;
-  *(uint64_t*)0x200081b8 = 0;
-  *(uint64_t*)0x200081c0 = 0x567000;
-  *(uint64_t*)0x200081c8 = 0;
-  *(uint64_t*)0x200081d0 = 0;
-  *(uint64_t*)0x200081d8 = 0x568000;
-  *(uint64_t*)0x200081e0 = 0;
-  *(uint64_t*)0x200081e8 = 0;
-  *(uint64_t*)0x200081f0 = 0x569000;
-  *(uint64_t*)0x200081f8 = 0;
-  *(uint64_t*)0x20008200 = 0;
-  *(uint64_t*)0x20008208 = 0x56a000;
-  *(uint64_t*)0x20008210 = 0;
-  *(uint64_t*)0x20008218 = 0;
-  *(uint64_t*)0x20008220 = 0x56b000;
-  *(uint64_t*)0x20008228 = 0;
-  *(uint64_t*)0x20008230 = 0;
-  *(uint64_t*)0x20008238 = 0x56c000;
-  *(uint64_t*)0x20008240 = 0;
-  *(uint64_t*)0x20008248 = 0;
-  *(uint64_t*)0x20008250 = 0x56d000;
-  *(uint64_t*)0x20008258 = 0;
-  *(uint64_t*)0x20008260 = 0;
-  *(uint64_t*)0x20008268 = 0x56e000;
-  *(uint64_t*)0x20008270 = 0;
-  *(uint64_t*)0x20008278 = 0;
-  *(uint64_t*)0x20008280 = 0x56f000;
-  *(uint64_t*)0x20008288 = 0;
-  *(uint64_t*)0x20008290 = 0;
-  *(uint64_t*)0x20008298 = 0x570000;
-  *(uint64_t*)0x200082a0 = 0;
-  *(uint64_t*)0x200082a8 = 0;
-  *(uint64_t*)0x200082b0 = 0x571000;
-  *(uint64_t*)0x200082b8 = 0;
-  *(uint64_t*)0x200082c0 = 0;
-  *(uint64_t*)0x200082c8 = 0x572000;
-  *(uint64_t*)0x200082d0 = 0;
-  *(uint64_t*)0x200082d8 = 0;
-  *(uint64_t*)0x200082e0 = 0x573000;
-  *(uint64_t*)0x200082e8 = 0;
-  *(uint64_t*)0x200082f0 = 0;
-  *(uint64_t*)0x200082f8 = 0x574000;
-  *(uint64_t*)0x20008300 = 0;
-  *(uint64_t*)0x20008308 = 0;
-  *(uint64_t*)0x20008310 = 0x575000;
-  *(uint64_t*)0x20008318 = 0;
-  *(uint64_t*)0x20008320 = 0;
-  *(uint64_t*)0x20008328 = 0x576000;
-  *(uint64_t*)0x20008330 = 0;
-  *(uint64_t*)0x20008338 = 0;
-  *(uint64_t*)0x20008340 = 0x577000;
-  *(uint64_t*)0x20008348 = 0;
-  *(uint64_t*)0x20008350 = 0;
-  *(uint64_t*)0x20008358 = 0x578000;
-  *(uint64_t*)0x20008360 = 0;
-  *(uint64_t*)0x20008368 = 0;
-  *(uint64_t*)0x20008370 = 0x579000;
-  *(uint64_t*)0x20008378 = 0;
-  *(uint64_t*)0x20008380 = 0;
-  *(uint64_t*)0x20008388 = 0x57a000;
-  *(uint64_t*)0x20008390 = 0;
-  *(uint64_t*)0x20008398 = 0;
-  *(uint64_t*)0x200083a0 = 0x57b000;
-  *(uint64_t*)0x200083a8 = 0;
-  *(uint64_t*)0x200083b0 = 0;
-  *(uint64_t*)0x200083b8 = 0x57c000;
-  *(uint64_t*)0x200083c0 = 0;
-  *(uint64_t*)0x200083c8 = 0;
-  *(uint64_t*)0x200083d0 = 0x57d000;
-  *(uint64_t*)0x200083d8 = 0;
-  *(uint64_t*)0x200083e0 = 0;
-  *(uint64_t*)0x200083e8 = 0x57e000;
-  *(uint64_t*)0x200083f0 = 0;
-  *(uint64_t*)0x200083f8 = 0;
-  *(uint64_t*)0x20008400 = 0x57f000;
-  *(uint64_t*)0x20008408 = 0;
-  *(uint64_t*)0x20008410 = 0;
-  *(uint64_t*)0x20008418 = 0x580000;
-  *(uint64_t*)0x20008420 = 0;
-  *(uint64_t*)0x20008428 = 0;
-  *(uint64_t*)0x20008430 = 0x581000;
-  *(uint64_t*)0x20008438 = 0;
-  *(uint64_t*)0x20008440 = 0;
-  *(uint64_t*)0x20008448 = 0x582000;
-  *(uint64_t*)0x20008450 = 0;
-  *(uint64_t*)0x20008458 = 0;
-  *(uint64_t*)0x20008460 = 0x583000;
-  *(uint64_t*)0x20008468 = 0;
-  *(uint64_t*)0x20008470 = 0;
-  *(uint64_t*)0x20008478 = 0x584000;
-  *(uint64_t*)0x20008480 = 0;
-  *(uint64_t*)0x20008488 = 0;
-  *(uint64_t*)0x20008490 = 0x585000;
-  *(uint64_t*)0x20008498 = 0;
-  *(uint64_t*)0x200084a0 = 0;
-  *(uint64_t*)0x200084a8 = 0x586000;
-  *(uint64_t*)0x200084b0 = 0;
-  *(uint64_t*)0x200084b8 = 0;
-  *(uint64_t*)0x200084c0 = 0x587000;
-  *(uint64_t*)0x200084c8 = 0;
-  *(uint64_t*)0x200084d0 = 0;
-  *(uint64_t*)0x200084d8 = 0x588000;
-  *(uint64_t*)0x200084e0 = 0;
-  *(uint64_t*)0x200084e8 = 0;
-  *(uint64_t*)0x200084f0 = 0x589000;
-  *(uint64_t*)0x200084f8 = 0;
-  *(uint64_t*)0x20008500 = 0;
-  *(uint64_t*)0x20008508 = 0x58a000;
-  *(uint64_t*)0x20008510 = 0;
-  *(uint64_t*)0x20008518 = 0;
-  *(uint64_t*)0x20008520 = 0x58b000;
-  *(uint64_t*)0x20008528 = 0;
-  *(uint64_t*)0x20008530 = 0;
-  *(uint64_t*)0x20008538 = 0x58c000;
-  *(uint64_t*)0x20008540 = 0;
-  *(uint64_t*)0x20008548 = 0;
-  *(uint64_t*)0x20008550 = 0x58d000;
-  *(uint64_t*)0x20008558 = 0;
-  *(uint64_t*)0x20008560 = 0;
-  *(uint64_t*)0x20008568 = 0x58e000;
-  *(uint64_t*)0x20008570 = 0;
-  *(uint64_t*)0x20008578 = 0;
-  *(uint64_t*)0x20008580 = 0x58f000;
-  *(uint64_t*)0x20008588 = 0;
-  *(uint64_t*)0x20008590 = 0;
-  *(uint64_t*)0x20008598 = 0x590000;
-  *(uint64_t*)0x200085a0 = 0;
-  *(uint64_t*)0x200085a8 = 0;
-  *(uint64_t*)0x200085b0 = 0x591000;
-  *(uint64_t*)0x200085b8 = 0;
-  *(uint64_t*)0x200085c0 = 0;
-  *(uint64_t*)0x200085c8 = 0x592000;
-  *(uint64_t*)0x200085d0 = 0;
-  *(uint64_t*)0x200085d8 = 0;
-  *(uint64_t*)0x200085e0 = 0x593000;
-  *(uint64_t*)0x200085e8 = 0;
-  *(uint64_t*)0x200085f0 = 0;
-  *(uint64_t*)0x200085f8 = 0x594000;
-  *(uint64_t*)0x20008600 = 0;
-  *(uint64_t*)0x20008608 = 0;
-  *(uint64_t*)0x20008610 = 0x595000;
-  *(uint64_t*)0x20008618 = 0;
-  *(uint64_t*)0x20008620 = 0;
-  *(uint64_t*)0x20008628 = 0x596000;
-  *(uint64_t*)0x20008630 = 0;
-  *(uint64_t*)0x20008638 = 0;
-  *(uint64_t*)0x20008640 = 0x597000;
-  *(uint64_t*)0x20008648 = 0;
-  *(uint64_t*)0x20008650 = 0;
-  *(uint64_t*)0x20008658 = 0x598000;
-  *(uint64_t*)0x20008660 = 0;
-  *(uint64_t*)0x20008668 = 0;
-  *(uint64_t*)0x20008670 = 0x599000;
-  *(uint64_t*)0x20008678 = 0;
-  *(uint64_t*)0x20008680 = 0;
-  *(uint64_t*)0x20008688 = 0x59a000;
-  *(uint64_t*)0x20008690 = 0;
-  *(uint64_t*)0x20008698 = 0;
-  *(uint64_t*)0x200086a0 = 0x59b000;
-  *(uint64_t*)0x200086a8 = 0;
-  *(uint64_t*)0x200086b0 = 0;
-  *(uint64_t*)0x200086b8 = 0x59c000;
-  *(uint64_t*)0x200086c0 = 0;
-  *(uint64_t*)0x200086c8 = 0;
-  *(uint64_t*)0x200086d0 = 0x59d000;
-  *(uint64_t*)0x200086d8 = 0;
-  *(uint64_t*)0x200086e0 = 0;
-  *(uint64_t*)0x200086e8 = 0x59e000;
-  *(uint64_t*)0x200086f0 = 0;
-  *(uint64_t*)0x200086f8 = 0;
-  *(uint64_t*)0x20008700 = 0x59f000;
-  *(uint64_t*)0x20008708 = 0;
-  *(uint64_t*)0x20008710 = 0;
-  *(uint64_t*)0x20008718 = 0x5a0000;
-  *(uint64_t*)0x20008720 = 0;
-  *(uint64_t*)0x20008728 = 0;
-  *(uint64_t*)0x20008730 = 0x5a1000;
-  *(uint64_t*)0x20008738 = 0;
-  *(uint64_t*)0x20008740 = 0;
-  *(uint64_t*)0x20008748 = 0x5a2000;
-  *(uint64_t*)0x20008750 = 0;
-  *(uint64_t*)0x20008758 = 0;
-  *(uint64_t*)0x20008760 = 0x5a3000;
-  *(uint64_t*)0x20008768 = 0;
-  *(uint64_t*)0x20008770 = 0;
-  *(uint64_t*)0x20008778 = 0x5a4000;
-  *(uint64_t*)0x20008780 = 0;
-  *(uint64_t*)0x20008788 = 0;
-  *(uint64_t*)0x20008790 = 0x5a5000;
-  *(uint64_t*)0x20008798 = 0;
-  *(uint64_t*)0x200087a0 = 0;
-  *(uint64_t*)0x200087a8 = 0x5a6000;
-  *(uint64_t*)0x200087b0 = 0;
-  *(uint64_t*)0x200087b8 = 0;
-  *(uint64_t*)0x200087c0 = 0x5a7000;
-  *(uint64_t*)0x200087c8 = 0;
-  *(uint64_t*)0x200087d0 = 0;
-  *(uint64_t*)0x200087d8 = 0x5a8000;
-  *(uint64_t*)0x200087e0 = 0;
-  *(uint64_t*)0x200087e8 = 0;
-  *(uint64_t*)0x200087f0 = 0x5a9000;
-  *(uint64_t*)0x200087f8 = 0;
-  *(uint64_t*)0x20008800 = 0;
-  *(uint64_t*)0x20008808 = 0x5aa000;
-  *(uint64_t*)0x20008810 = 0;
-  *(uint64_t*)0x20008818 = 0;
-  *(uint64_t*)0x20008820 = 0x5ab000;
-  *(uint64_t*)0x20008828 = 0;
-  *(uint64_t*)0x20008830 = 0;
-  *(uint64_t*)0x20008838 = 0x5ac000;
-  *(uint64_t*)0x20008840 = 0;
-  *(uint64_t*)0x20008848 = 0;
-  *(uint64_t*)0x20008850 = 0x5ad000;
-  *(uint64_t*)0x20008858 = 0;
-  *(uint64_t*)0x20008860 = 0;
-  *(uint64_t*)0x20008868 = 0x5ae000;
-  *(uint64_t*)0x20008870 = 0;
-  *(uint64_t*)0x20008878 = 0;
-  *(uint64_t*)0x20008880 = 0x5af000;
-  *(uint64_t*)0x20008888 = 0;
-  *(uint64_t*)0x20008890 = 0;
-  *(uint64_t*)0x20008898 = 0x5b0000;
-  *(uint64_t*)0x200088a0 = 0;
-  *(uint64_t*)0x200088a8 = 0;
-  *(uint64_t*)0x200088b0 = 0x5b1000;
-  *(uint64_t*)0x200088b8 = 0;
-  *(uint64_t*)0x200088c0 = 0;
-  *(uint64_t*)0x200088c8 = 0x5b2000;
-  *(uint64_t*)0x200088d0 = 0;
-  *(uint64_t*)0x200088d8 = 0;
-  *(uint64_t*)0x200088e0 = 0x5b3000;
-  *(uint64_t*)0x200088e8 = 0;
-  *(uint64_t*)0x200088f0 = 0;
-  *(uint64_t*)0x200088f8 = 0x5b4000;
-  *(uint64_t*)0x20008900 = 0;
-  *(uint64_t*)0x20008908 = 0;
-  *(uint64_t*)0x20008910 = 0x5b5000;
-  *(uint64_t*)0x20008918 = 0;
-  *(uint64_t*)0x20008920 = 0;
-  *(uint64_t*)0x20008928 = 0x5b6000;
-  *(uint64_t*)0x20008930 = 0;
-  *(uint64_t*)0x20008938 = 0;
-  *(uint64_t*)0x20008940 = 0x5b7000;
-  *(uint64_t*)0x20008948 = 0;
-  *(uint64_t*)0x20008950 = 0;
-  *(uint64_t*)0x20008958 = 0x5b8000;
-  *(uint64_t*)0x20008960 = 0;
-  *(uint64_t*)0x20008968 = 0;
-  *(uint64_t*)0x20008970 = 0x5b9000;
-  *(uint64_t*)0x20008978 = 0;
-  *(uint64_t*)0x20008980 = 0;
-  *(uint64_t*)0x20008988 = 0x5ba000;
-  *(uint64_t*)0x20008990 = 0;
-  *(uint64_t*)0x20008998 = 0;
-  *(uint64_t*)0x200089a0 = 0x5bb000;
-  *(uint64_t*)0x200089a8 = 0;
-  *(uint64_t*)0x200089b0 = 0;
-  *(uint64_t*)0x200089b8 = 0x5bc000;
-  *(uint64_t*)0x200089c0 = 0;
-  *(uint64_t*)0x200089c8 = 0;
-  *(uint64_t*)0x200089d0 = 0x5bd000;
-  *(uint64_t*)0x200089d8 = 0;
-  *(uint64_t*)0x200089e0 = 0;
-  *(uint64_t*)0x200089e8 = 0x5be000;
-  *(uint64_t*)0x200089f0 = 0;
-  *(uint64_t*)0x200089f8 = 0;
-  *(uint64_t*)0x20008a00 = 0x5bf000;
-  *(uint64_t*)0x20008a08 = 0;
-  *(uint64_t*)0x20008a10 = 0;
-  *(uint64_t*)0x20008a18 = 0x5c0000;
-  *(uint64_t*)0x20008a20 = 0;
-  *(uint64_t*)0x20008a28 = 0;
-  *(uint64_t*)0x20008a30 = 0x5c1000;
-  *(uint64_t*)0x20008a38 = 0;
-  *(uint64_t*)0x20008a40 = 0;
-  *(uint64_t*)0x20008a48 = 0x5c2000;
-  *(uint64_t*)0x20008a50 = 0;
-  *(uint64_t*)0x20008a58 = 0;
-  *(uint64_t*)0x20008a60 = 0x5c3000;
-  *(uint64_t*)0x20008a68 = 0;
-  *(uint64_t*)0x20008a70 = 0;
-  *(uint64_t*)0x20008a78 = 0x5c4000;
-  *(uint64_t*)0x20008a80 = 0;
-  *(uint64_t*)0x20008a88 = 0;
-  *(uint64_t*)0x20008a90 = 0x5c5000;
-  *(uint64_t*)0x20008a98 = 0;
-  *(uint64_t*)0x20008aa0 = 0;
-  *(uint64_t*)0x20008aa8 = 0x5c6000;
-  *(uint64_t*)0x20008ab0 = 0;
-  *(uint64_t*)0x20008ab8 = 0;
-  *(uint64_t*)0x20008ac0 = 0x5c7000;
-  *(uint64_t*)0x20008ac8 = 0;
-  *(uint64_t*)0x20008ad0 = 0;
-  *(uint64_t*)0x20008ad8 = 0x5c8000;
-  *(uint64_t*)0x20008ae0 = 0;
-  *(uint64_t*)0x20008ae8 = 0;
-  *(uint64_t*)0x20008af0 = 0x5c9000;
-  *(uint64_t*)0x20008af8 = 0;
-  *(uint64_t*)0x20008b00 = 0;
-  *(uint64_t*)0x20008b08 = 0x5ca000;
-  *(uint64_t*)0x20008b10 = 0;
-  *(uint64_t*)0x20008b18 = 0;
-  *(uint64_t*)0x20008b20 = 0x5cb000;
-  *(uint64_t*)0x20008b28 = 0;
-  *(uint64_t*)0x20008b30 = 0;
-  *(uint64_t*)0x20008b38 = 0x5cc000;
-  *(uint64_t*)0x20008b40 = 0;
-  *(uint64_t*)0x20008b48 = 0;
-  *(uint64_t*)0x20008b50 = 0x5cd000;
-  *(uint64_t*)0x20008b58 = 0;
-  *(uint64_t*)0x20008b60 = 0;
-  *(uint64_t*)0x20008b68 = 0x5ce000;
-  *(uint64_t*)0x20008b70 = 0;
-  *(uint64_t*)0x20008b78 = 0;
-  *(uint64_t*)0x20008b80 = 0x5cf000;
-  *(uint64_t*)0x20008b88 = 0;
-  *(uint64_t*)0x20008b90 = 0;
-  *(uint64_t*)0x20008b98 = 0x5d0000;
-  *(uint64_t*)0x20008ba0 = 0;
-  *(uint64_t*)0x20008ba8 = 0;
-  *(uint64_t*)0x20008bb0 = 0x5d1000;
-  *(uint64_t*)0x20008bb8 = 0;
-  *(uint64_t*)0x20008bc0 = 0;
-  *(uint64_t*)0x20008bc8 = 0x5d2000;
-  *(uint64_t*)0x20008bd0 = 0;
-  *(uint64_t*)0x20008bd8 = 0;
-  *(uint64_t*)0x20008be0 = 0x5d3000;
-  *(uint64_t*)0x20008be8 = 0;
-  *(uint64_t*)0x20008bf0 = 0;
-  *(uint64_t*)0x20008bf8 = 0x5d4000;
-  *(uint64_t*)0x20008c00 = 0;
-  *(uint64_t*)0x20008c08 = 0;
-  *(uint64_t*)0x20008c10 = 0x5d5000;
-  *(uint64_t*)0x20008c18 = 0;
-  *(uint64_t*)0x20008c20 = 0;
-  *(uint64_t*)0x20008c28 = 0x5d6000;
-  *(uint64_t*)0x20008c30 = 0;
-  *(uint64_t*)0x20008c38 = 0;
-  *(uint64_t*)0x20008c40 = 0x5d7000;
-  *(uint64_t*)0x20008c48 = 0;
-  *(uint64_t*)0x20008c50 = 0;
-  *(uint64_t*)0x20008c58 = 0x5d8000;
-  *(uint64_t*)0x20008c60 = 0;
-  *(uint64_t*)0x20008c68 = 0;
-  *(uint64_t*)0x20008c70 = 0x5d9000;
-  *(uint64_t*)0x20008c78 = 0;
-  *(uint64_t*)0x20008c80 = 0;
-  *(uint64_t*)0x20008c88 = 0x5da000;
-  *(uint64_t*)0x20008c90 = 0;
-  *(uint64_t*)0x20008c98 = 0;
-  *(uint64_t*)0x20008ca0 = 0x5db000;
-  *(uint64_t*)0x20008ca8 = 0;
-  *(uint64_t*)0x20008cb0 = 0;
-  *(uint64_t*)0x20008cb8 = 0x5dc000;
-  *(uint64_t*)0x20008cc0 = 0;
-  *(uint64_t*)0x20008cc8 = 0;
-  *(uint64_t*)0x20008cd0 = 0x5dd000;
-  *(uint64_t*)0x20008cd8 = 0;
-  *(uint64_t*)0x20008ce0 = 0;
-  *(uint64_t*)0x20008ce8 = 0x5de000;
-  *(uint64_t*)0x20008cf0 = 0;
-  *(uint64_t*)0x20008cf8 = 0;
-  *(uint64_t*)0x20008d00 = 0x5df000;
-  *(uint64_t*)0x20008d08 = 0;
-  *(uint64_t*)0x20008d10 = 0;
-  *(uint64_t*)0x20008d18 = 0x5e0000;
-  *(uint64_t*)0x20008d20 = 0;
-  *(uint64_t*)0x20008d28 = 0;
-  *(uint64_t*)0x20008d30 = 0x5e1000;
-  *(uint64_t*)0x20008d38 = 0;
-  *(uint64_t*)0x20008d40 = 0;
-  *(uint64_t*)0x20008d48 = 0x5e2000;
-  *(uint64_t*)0x20008d50 = 0;
-  *(uint64_t*)0x20008d58 = 0;
-  *(uint64_t*)0x20008d60 = 0x5e3000;
-  *(uint64_t*)0x20008d68 = 0;
-  *(uint64_t*)0x20008d70 = 0;
-  *(uint64_t*)0x20008d78 = 0x5e4000;
-  *(uint64_t*)0x20008d80 = 0;
-  *(uint64_t*)0x20008d88 = 0;
-  *(uint64_t*)0x20008d90 = 0x5e5000;
-  *(uint64_t*)0x20008d98 = 0;
-  *(uint64_t*)0x20008da0 = 0;
-  *(uint64_t*)0x20008da8 = 0x5e6000;
-  *(uint64_t*)0x20008db0 = 0;
-  *(uint64_t*)0x20008db8 = 0;
-  *(uint64_t*)0x20008dc0 = 0x5e7000;
-  *(uint64_t*)0x20008dc8 = 0;
-  *(uint64_t*)0x20008dd0 = 0;
-  *(uint64_t*)0x20008dd8 = 0x5e8000;
-  *(uint64_t*)0x20008de0 = 0;
-  *(uint64_t*)0x20008de8 = 0;
-  *(uint64_t*)0x20008df0 = 0x5e9000;
-  *(uint64_t*)0x20008df8 = 0;
-  *(uint64_t*)0x20008e00 = 0;
-  *(uint64_t*)0x20008e08 = 0x5ea000;
-  *(uint64_t*)0x20008e10 = 0;
-  *(uint64_t*)0x20008e18 = 0;
-  *(uint64_t*)0x20008e20 = 0x5eb000;
-  *(uint64_t*)0x20008e28 = 0;
-  *(uint64_t*)0x20008e30 = 0;
-  *(uint64_t*)0x20008e38 = 0x5ec000;
-  *(uint64_t*)0x20008e40 = 0;
-  *(uint64_t*)0x20008e48 = 0;
-  *(uint64_t*)0x20008e50 = 0x5ed000;
-  *(uint64_t*)0x20008e58 = 0;
-  *(uint64_t*)0x20008e60 = 0;
-  *(uint64_t*)0x20008e68 = 0x5ee000;
-  *(uint64_t*)0x20008e70 = 0;
-  *(uint64_t*)0x20008e78 = 0;
-  *(uint64_t*)0x20008e80 = 0x5ef000;
-  *(uint64_t*)0x20008e88 = 0;
-  *(uint64_t*)0x20008e90 = 0;
-  *(uint64_t*)0x20008e98 = 0x5f0000;
-  *(uint64_t*)0x20008ea0 = 0;
-  *(uint64_t*)0x20008ea8 = 0;
-  *(uint64_t*)0x20008eb0 = 0x5f1000;
-  *(uint64_t*)0x20008eb8 = 0;
-  *(uint64_t*)0x20008ec0 = 0;
-  *(uint64_t*)0x20008ec8 = 0x5f2000;
-  *(uint64_t*)0x20008ed0 = 0;
-  *(uint64_t*)0x20008ed8 = 0;
-  *(uint64_t*)0x20008ee0 = 0x5f3000;
-  *(uint64_t*)0x20008ee8 = 0;
-  *(uint64_t*)0x20008ef0 = 0;
-  *(uint64_t*)0x20008ef8 = 0x5f4000;
-  *(uint64_t*)0x20008f00 = 0;
-  *(uint64_t*)0x20008f08 = 0;
-  *(uint64_t*)0x20008f10 = 0x5f5000;
-  *(uint64_t*)0x20008f18 = 0;
-  *(uint64_t*)0x20008f20 = 0;
-  *(uint64_t*)0x20008f28 = 0x5f6000;
-  *(uint64_t*)0x20008f30 = 0;
-  *(uint64_t*)0x20008f38 = 0;
-  *(uint64_t*)0x20008f40 = 0x5f7000;
-  *(uint64_t*)0x20008f48 = 0;
-  *(uint64_t*)0x20008f50 = 0;
-  *(uint64_t*)0x20008f58 = 0x5f8000;
-  *(uint64_t*)0x20008f60 = 0;
-  *(uint64_t*)0x20008f68 = 0;
-  *(uint64_t*)0x20008f70 = 0x5f9000;
-  *(uint64_t*)0x20008f78 = 0;
-  *(uint64_t*)0x20008f80 = 0;
-  *(uint64_t*)0x20008f88 = 0x5fa000;
-  *(uint64_t*)0x20008f90 = 0;
-  *(uint64_t*)0x20008f98 = 0;
-  *(uint64_t*)0x20008fa0 = 0x5fb000;
-  *(uint64_t*)0x20008fa8 = 0;
-  *(uint64_t*)0x20008fb0 = 0;
-  *(uint64_t*)0x20008fb8 = 0x5fc000;
-  *(uint64_t*)0x20008fc0 = 0;
-  *(uint64_t*)0x20008fc8 = 0;
-  *(uint64_t*)0x20008fd0 = 0x5fd000;
-  *(uint64_t*)0x20008fd8 = 0;
-  *(uint64_t*)0x20008fe0 = 0;
-  *(uint64_t*)0x20008fe8 = 0x5fe000;
-  *(uint64_t*)0x20008ff0 = 0;
-  *(uint64_t*)0x20008ff8 = 0;
-  *(uint64_t*)0x20009000 = 0x5ff000;
-  *(uint64_t*)0x20009008 = 0;
-  *(uint64_t*)0x20009010 = 0;
-  *(uint64_t*)0x20009018 = 0x600000;
-  *(uint64_t*)0x20009020 = 0;
-  *(uint64_t*)0x20009028 = 0;
-  *(uint64_t*)0x20009030 = 0x601000;
-  *(uint64_t*)0x20009038 = 0;
-  *(uint64_t*)0x20009040 = 0;
-  *(uint64_t*)0x20009048 = 0x602000;
-  *(uint64_t*)0x20009050 = 0;
-  *(uint64_t*)0x20009058 = 0;
-  *(uint64_t*)0x20009060 = 0x603000;
-  *(uint64_t*)0x20009068 = 0;
-  *(uint64_t*)0x20009070 = 0;
-  *(uint64_t*)0x20009078 = 0x604000;
-  *(uint64_t*)0x20009080 = 0;
-  *(uint64_t*)0x20009088 = 0;
-  *(uint64_t*)0x20009090 = 0x605000;
-  *(uint64_t*)0x20009098 = 0;
-  *(uint64_t*)0x200090a0 = 0;
-  *(uint64_t*)0x200090a8 = 0x606000;
-  *(uint64_t*)0x200090b0 = 0;
-  *(uint64_t*)0x200090b8 = 0;
-  *(uint64_t*)0x200090c0 = 0x607000;
-  *(uint64_t*)0x200090c8 = 0;
-  *(uint64_t*)0x200090d0 = 0;
-  *(uint64_t*)0x200090d8 = 0x608000;
-  *(uint64_t*)0x200090e0 = 0;
-  *(uint64_t*)0x200090e8 = 0;
-  *(uint64_t*)0x200090f0 = 0x609000;
-  *(uint64_t*)0x200090f8 = 0;
-  *(uint64_t*)0x20009100 = 0;
-  *(uint64_t*)0x20009108 = 0x60a000;
-  *(uint64_t*)0x20009110 = 0;
-  *(uint64_t*)0x20009118 = 0;
-  *(uint64_t*)0x20009120 = 0x60b000;
-  *(uint64_t*)0x20009128 = 0;
-  *(uint64_t*)0x20009130 = 0;
-  *(uint64_t*)0x20009138 = 0x60c000;
-  *(uint64_t*)0x20009140 = 0;
-  *(uint64_t*)0x20009148 = 0;
-  *(uint64_t*)0x20009150 = 0x60d000;
-  *(uint64_t*)0x20009158 = 0;
-  *(uint64_t*)0x20009160 = 0;
-  *(uint64_t*)0x20009168 = 0x60e000;
-  *(uint64_t*)0x20009170 = 0;
-  *(uint64_t*)0x20009178 = 0;
-  *(uint64_t*)0x20009180 = 0x60f000;
-  *(uint64_t*)0x20009188 = 0;
-  *(uint64_t*)0x20009190 = 0;
-  *(uint64_t*)0x20009198 = 0x610000;
-  *(uint64_t*)0x200091a0 = 0;
-  *(uint64_t*)0x200091a8 = 0;
-  *(uint64_t*)0x200091b0 = 0x611000;
-  *(uint64_t*)0x200091b8 = 0;
-  *(uint64_t*)0x200091c0 = 0;
-  *(uint64_t*)0x200091c8 = 0x612000;
-  *(uint64_t*)0x200091d0 = 0;
-  *(uint64_t*)0x200091d8 = 0;
-  *(uint64_t*)0x200091e0 = 0x613000;
-  *(uint64_t*)0x200091e8 = 0;
-  *(uint64_t*)0x200091f0 = 0;
-  *(uint64_t*)0x200091f8 = 0x614000;
-  *(uint64_t*)0x20009200 = 0;
-  *(uint64_t*)0x20009208 = 0;
-  *(uint64_t*)0x20009210 = 0x615000;
-  *(uint64_t*)0x20009218 = 0;
-  *(uint64_t*)0x20009220 = 0;
-  *(uint64_t*)0x20009228 = 0x616000;
-  *(uint64_t*)0x20009230 = 0;
-  *(uint64_t*)0x20009238 = 0;
-  *(uint64_t*)0x20009240 = 0x617000;
-  *(uint64_t*)0x20009248 = 0;
-  *(uint64_t*)0x20009250 = 0;
-  *(uint64_t*)0x20009258 = 0x618000;
-  *(uint64_t*)0x20009260 = 0;
-  *(uint64_t*)0x20009268 = 0;
-  *(uint64_t*)0x20009270 = 0x619000;
-  *(uint64_t*)0x20009278 = 0;
-  *(uint64_t*)0x20009280 = 0;
-  *(uint64_t*)0x20009288 = 0x61a000;
-  *(uint64_t*)0x20009290 = 0;
-  *(uint64_t*)0x20009298 = 0;
-  *(uint64_t*)0x200092a0 = 0x61b000;
-  *(uint64_t*)0x200092a8 = 0;
-  *(uint64_t*)0x200092b0 = 0;
-  *(uint64_t*)0x200092b8 = 0x61c000;
-  *(uint64_t*)0x200092c0 = 0;
-  *(uint64_t*)0x200092c8 = 0;
-  *(uint64_t*)0x200092d0 = 0x61d000;
-  *(uint64_t*)0x200092d8 = 0;
-  *(uint64_t*)0x200092e0 = 0;
-  *(uint64_t*)0x200092e8 = 0x61e000;
-  *(uint64_t*)0x200092f0 = 0;
-  *(uint64_t*)0x200092f8 = 0;
-  *(uint64_t*)0x20009300 = 0x61f000;
-  *(uint64_t*)0x20009308 = 0;
-  *(uint64_t*)0x20009310 = 0;
-  *(uint64_t*)0x20009318 = 0x620000;
-  *(uint64_t*)0x20009320 = 0;
-  *(uint64_t*)0x20009328 = 0;
-  *(uint64_t*)0x20009330 = 0x621000;
-  *(uint64_t*)0x20009338 = 0;
-  *(uint64_t*)0x20009340 = 0;
-  *(uint64_t*)0x20009348 = 0x622000;
-  *(uint64_t*)0x20009350 = 0;
-  *(uint64_t*)0x20009358 = 0;
-  *(uint64_t*)0x20009360 = 0x623000;
-  *(uint64_t*)0x20009368 = 0;
-  *(uint64_t*)0x20009370 = 0;
-  *(uint64_t*)0x20009378 = 0x624000;
-  *(uint64_t*)0x20009380 = 0;
-  *(uint64_t*)0x20009388 = 0;
-  *(uint64_t*)0x20009390 = 0x625000;
-  *(uint64_t*)0x20009398 = 0;
-  *(uint64_t*)0x200093a0 = 0;
-  *(uint64_t*)0x200093a8 = 0x626000;
-  *(uint64_t*)0x200093b0 = 0;
-  *(uint64_t*)0x200093b8 = 0;
-  *(uint64_t*)0x200093c0 = 0x627000;
-  *(uint64_t*)0x200093c8 = 0;
-  *(uint64_t*)0x200093d0 = 0;
-  *(uint64_t*)0x200093d8 = 0x628000;
-  *(uint64_t*)0x200093e0 = 0;
-  *(uint64_t*)0x200093e8 = 0;
-  *(uint64_t*)0x200093f0 = 0x629000;
-  *(uint64_t*)0x200093f8 = 0;
-  *(uint64_t*)0x20009400 = 0;
-  *(uint64_t*)0x20009408 = 0x62a000;
-  *(uint64_t*)0x20009410 = 0;
-  *(uint64_t*)0x20009418 = 0;
-  *(uint64_t*)0x20009420 = 0x62b000;
-  *(uint64_t*)0x20009428 = 0;
-  *(uint64_t*)0x20009430 = 0;
-  *(uint64_t*)0x20009438 = 0x62c000;
-  *(uint64_t*)0x20009440 = 0;
-  *(uint64_t*)0x20009448 = 0;
-  *(uint64_t*)0x20009450 = 0x62d000;
-  *(uint64_t*)0x20009458 = 0;
-  *(uint64_t*)0x20009460 = 0;
-  *(uint64_t*)0x20009468 = 0x62e000;
-  *(uint64_t*)0x20009470 = 0;
-  *(uint64_t*)0x20009478 = 0;
-  *(uint64_t*)0x20009480 = 0x62f000;
-  *(uint64_t*)0x20009488 = 0;
-  *(uint64_t*)0x20009490 = 0;
-  *(uint64_t*)0x20009498 = 0x630000;
-  *(uint64_t*)0x200094a0 = 0;
-  *(uint64_t*)0x200094a8 = 0;
-  *(uint64_t*)0x200094b0 = 0x631000;
-  *(uint64_t*)0x200094b8 = 0;
-  *(uint64_t*)0x200094c0 = 0;
-  *(uint64_t*)0x200094c8 = 0x632000;
-  *(uint64_t*)0x200094d0 = 0;
-  *(uint64_t*)0x200094d8 = 0;
-  *(uint64_t*)0x200094e0 = 0x633000;
-  *(uint64_t*)0x200094e8 = 0;
-  *(uint64_t*)0x200094f0 = 0;
-  *(uint64_t*)0x200094f8 = 0x634000;
-  *(uint64_t*)0x20009500 = 0;
-  *(uint64_t*)0x20009508 = 0;
-  *(uint64_t*)0x20009510 = 0x635000;
-  *(uint64_t*)0x20009518 = 0;
-  *(uint64_t*)0x20009520 = 0;
-  *(uint64_t*)0x20009528 = 0x636000;
-  *(uint64_t*)0x20009530 = 0;
-  *(uint64_t*)0x20009538 = 0;
-  *(uint64_t*)0x20009540 = 0x637000;
-  *(uint64_t*)0x20009548 = 0;
-  *(uint64_t*)0x20009550 = 0;
-  *(uint64_t*)0x20009558 = 0x638000;
-  *(uint64_t*)0x20009560 = 0;
-  *(uint64_t*)0x20009568 = 0;
-  *(uint64_t*)0x20009570 = 0x639000;
-  *(uint64_t*)0x20009578 = 0;
-  *(uint64_t*)0x20009580 = 0;
-  *(uint64_t*)0x20009588 = 0x63a000;
-  *(uint64_t*)0x20009590 = 0;
-  *(uint64_t*)0x20009598 = 0;
-  *(uint64_t*)0x200095a0 = 0x63b000;
-  *(uint64_t*)0x200095a8 = 0;
-  *(uint64_t*)0x200095b0 = 0;
-  *(uint64_t*)0x200095b8 = 0x63c000;
-  *(uint64_t*)0x200095c0 = 0;
-  *(uint64_t*)0x200095c8 = 0;
-  *(uint64_t*)0x200095d0 = 0x63d000;
-  *(uint64_t*)0x200095d8 = 0;
-  *(uint64_t*)0x200095e0 = 0;
-  *(uint64_t*)0x200095e8 = 0x63e000;
-  *(uint64_t*)0x200095f0 = 0;
-  *(uint64_t*)0x200095f8 = 0;
-  *(uint64_t*)0x20009600 = 0x63f000;
-  *(uint64_t*)0x20009608 = 0;
-  *(uint64_t*)0x20009610 = 0;
-  *(uint64_t*)0x20009618 = 0x640000;
-  *(uint64_t*)0x20009620 = 0;
-  *(uint64_t*)0x20009628 = 0;
-  *(uint64_t*)0x20009630 = 0x641000;
-  *(uint64_t*)0x20009638 = 0;
-  *(uint64_t*)0x20009640 = 0;
-  *(uint64_t*)0x20009648 = 0x642000;
-  *(uint64_t*)0x20009650 = 0;
-  *(uint64_t*)0x20009658 = 0;
-  *(uint64_t*)0x20009660 = 0x643000;
-  *(uint64_t*)0x20009668 = 0;
-  *(uint64_t*)0x20009670 = 0;
-  *(uint64_t*)0x20009678 = 0x644000;
-  *(uint64_t*)0x20009680 = 0;
-  *(uint64_t*)0x20009688 = 0;
-  *(uint64_t*)0x20009690 = 0x645000;
-  *(uint64_t*)0x20009698 = 0;
-  *(uint64_t*)0x200096a0 = 0;
-  *(uint64_t*)0x200096a8 = 0x646000;
-  *(uint64_t*)0x200096b0 = 0;
-  *(uint64_t*)0x200096b8 = 0;
-  *(uint64_t*)0x200096c0 = 0x647000;
-  *(uint64_t*)0x200096c8 = 0;
-  *(uint64_t*)0x200096d0 = 0;
-  *(uint64_t*)0x200096d8 = 0x648000;
-  *(uint64_t*)0x200096e0 = 0;
-  *(uint64_t*)0x200096e8 = 0;
-  *(uint64_t*)0x200096f0 = 0x649000;
-  *(uint64_t*)0x200096f8 = 0;
-  *(uint64_t*)0x20009700 = 0;
-  *(uint64_t*)0x20009708 = 0x64a000;
-  *(uint64_t*)0x20009710 = 0;
-  *(uint64_t*)0x20009718 = 0;
-  *(uint64_t*)0x20009720 = 0x64b000;
-  *(uint64_t*)0x20009728 = 0;
-  *(uint64_t*)0x20009730 = 0;
-  *(uint64_t*)0x20009738 = 0x64c000;
-  *(uint64_t*)0x20009740 = 0;
-  *(uint64_t*)0x20009748 = 0;
-  *(uint64_t*)0x20009750 = 0x64d000;
-  *(uint64_t*)0x20009758 = 0;
-  *(uint64_t*)0x20009760 = 0;
-  *(uint64_t*)0x20009768 = 0x64e000;
-  *(uint64_t*)0x20009770 = 0;
-  *(uint64_t*)0x20009778 = 0;
-  *(uint64_t*)0x20009780 = 0x64f000;
-  *(uint64_t*)0x20009788 = 0;
-  *(uint64_t*)0x20009790 = 0;
-  *(uint64_t*)0x20009798 = 0x650000;
-  *(uint64_t*)0x200097a0 = 0;
-  *(uint64_t*)0x200097a8 = 0;
-  *(uint64_t*)0x200097b0 = 0x651000;
-  *(uint64_t*)0x200097b8 = 0;
-  *(uint64_t*)0x200097c0 = 0;
-  *(uint64_t*)0x200097c8 = 0x652000;
-  *(uint64_t*)0x200097d0 = 0;
-  *(uint64_t*)0x200097d8 = 0;
-  *(uint64_t*)0x200097e0 = 0x653000;
-  *(uint64_t*)0x200097e8 = 0;
-  *(uint64_t*)0x200097f0 = 0;
-  *(uint64_t*)0x200097f8 = 0x654000;
-  *(uint64_t*)0x20009800 = 0;
-  *(uint64_t*)0x20009808 = 0;
-  *(uint64_t*)0x20009810 = 0x655000;
-  *(uint64_t*)0x20009818 = 0;
-  *(uint64_t*)0x20009820 = 0;
-  *(uint64_t*)0x20009828 = 0x656000;
-  *(uint64_t*)0x20009830 = 0;
-  *(uint64_t*)0x20009838 = 0;
-  *(uint64_t*)0x20009840 = 0x657000;
-  *(uint64_t*)0x20009848 = 0;
-  *(uint64_t*)0x20009850 = 0;
-  *(uint64_t*)0x20009858 = 0x658000;
-  *(uint64_t*)0x20009860 = 0;
-  *(uint64_t*)0x20009868 = 0;
-  *(uint64_t*)0x20009870 = 0x659000;
-  *(uint64_t*)0x20009878 = 0;
-  *(uint64_t*)0x20009880 = 0;
-  *(uint64_t*)0x20009888 = 0x65a000;
-  *(uint64_t*)0x20009890 = 0;
-  *(uint64_t*)0x20009898 = 0;
-  *(uint64_t*)0x200098a0 = 0x65b000;
-  *(uint64_t*)0x200098a8 = 0;
-  *(uint64_t*)0x200098b0 = 0;
-  *(uint64_t*)0x200098b8 = 0x65c000;
-  *(uint64_t*)0x200098c0 = 0;
-  *(uint64_t*)0x200098c8 = 0;
-  *(uint64_t*)0x200098d0 = 0x65d000;
-  *(uint64_t*)0x200098d8 = 0;
-  *(uint64_t*)0x200098e0 = 0;
-  *(uint64_t*)0x200098e8 = 0x65e000;
-  *(uint64_t*)0x200098f0 = 0;
-  *(uint64_t*)0x200098f8 = 0;
-  *(uint64_t*)0x20009900 = 0x65f000;
-  *(uint64_t*)0x20009908 = 0;
-  *(uint64_t*)0x20009910 = 0;
-  *(uint64_t*)0x20009918 = 0x660000;
-  *(uint64_t*)0x20009920 = 0;
-  *(uint64_t*)0x20009928 = 0;
-  *(uint64_t*)0x20009930 = 0x661000;
-  *(uint64_t*)0x20009938 = 0;
-  *(uint64_t*)0x20009940 = 0;
-  *(uint64_t*)0x20009948 = 0x662000;
-  *(uint64_t*)0x20009950 = 0;
-  *(uint64_t*)0x20009958 = 0;
-  *(uint64_t*)0x20009960 = 0x663000;
-  *(uint64_t*)0x20009968 = 0;
-  *(uint64_t*)0x20009970 = 0;
-  *(uint64_t*)0x20009978 = 0x664000;
-  *(uint64_t*)0x20009980 = 0;
-  *(uint64_t*)0x20009988 = 0;
-  *(uint64_t*)0x20009990 = 0x665000;
-  *(uint64_t*)0x20009998 = 0;
-  *(uint64_t*)0x200099a0 = 0;
-  *(uint64_t*)0x200099a8 = 0x666000;
-  *(uint64_t*)0x200099b0 = 0;
-  *(uint64_t*)0x200099b8 = 0;
-  *(uint64_t*)0x200099c0 = 0x667000;
-  *(uint64_t*)0x200099c8 = 0;
-  *(uint64_t*)0x200099d0 = 0;
-  *(uint64_t*)0x200099d8 = 0x668000;
-  *(uint64_t*)0x200099e0 = 0;
-  *(uint64_t*)0x200099e8 = 0;
-  *(uint64_t*)0x200099f0 = 0x669000;
-  *(uint64_t*)0x200099f8 = 0;
-  *(uint64_t*)0x20009a00 = 0;
-  *(uint64_t*)0x20009a08 = 0x66a000;
-  *(uint64_t*)0x20009a10 = 0;
-  *(uint64_t*)0x20009a18 = 0;
-  *(uint64_t*)0x20009a20 = 0x66b000;
-  *(uint64_t*)0x20009a28 = 0;
-  *(uint64_t*)0x20009a30 = 0;
-  *(uint64_t*)0x20009a38 = 0x66c000;
-  *(uint64_t*)0x20009a40 = 0;
-  *(uint64_t*)0x20009a48 = 0;
-  *(uint64_t*)0x20009a50 = 0x66d000;
-  *(uint64_t*)0x20009a58 = 0;
-  *(uint64_t*)0x20009a60 = 0;
-  *(uint64_t*)0x20009a68 = 0x66e000;
-  *(uint64_t*)0x20009a70 = 0;
-  *(uint64_t*)0x20009a78 = 0;
-  *(uint64_t*)0x20009a80 = 0x66f000;
-  *(uint64_t*)0x20009a88 = 0;
-  *(uint64_t*)0x20009a90 = 0;
-  *(uint64_t*)0x20009a98 = 0x670000;
-  *(uint64_t*)0x20009aa0 = 0;
-  *(uint64_t*)0x20009aa8 = 0;
-  *(uint64_t*)0x20009ab0 = 0x671000;
-  *(uint64_t*)0x20009ab8 = 0;
-  *(uint64_t*)0x20009ac0 = 0;
-  *(uint64_t*)0x20009ac8 = 0x672000;
-  *(uint64_t*)0x20009ad0 = 0;
-  *(uint64_t*)0x20009ad8 = 0;
-  *(uint64_t*)0x20009ae0 = 0x673000;
-  *(uint64_t*)0x20009ae8 = 0;
-  *(uint64_t*)0x20009af0 = 0;
-  *(uint64_t*)0x20009af8 = 0x674000;
-  *(uint64_t*)0x20009b00 = 0;
-  *(uint64_t*)0x20009b08 = 0;
-  *(uint64_t*)0x20009b10 = 0x675000;
-  *(uint64_t*)0x20009b18 = 0;
-  *(uint64_t*)0x20009b20 = 0;
-  *(uint64_t*)0x20009b28 = 0x676000;
-  *(uint64_t*)0x20009b30 = 0;
-  *(uint64_t*)0x20009b38 = 0;
-  *(uint64_t*)0x20009b40 = 0x677000;
-  *(uint64_t*)0x20009b48 = 0;
-  *(uint64_t*)0x20009b50 = 0;
-  *(uint64_t*)0x20009b58 = 0x678000;
-  *(uint64_t*)0x20009b60 = 0;
-  *(uint64_t*)0x20009b68 = 0;
-  *(uint64_t*)0x20009b70 = 0x679000;
-  *(uint64_t*)0x20009b78 = 0;
-  *(uint64_t*)0x20009b80 = 0;
-  *(uint64_t*)0x20009b88 = 0x67a000;
-  *(uint64_t*)0x20009b90 = 0;
-  *(uint64_t*)0x20009b98 = 0;
-  *(uint64_t*)0x20009ba0 = 0x67b000;
-  *(uint64_t*)0x20009ba8 = 0;
-  *(uint64_t*)0x20009bb0 = 0;
-  *(uint64_t*)0x20009bb8 = 0x67c000;
-  *(uint64_t*)0x20009bc0 = 0;
-  *(uint64_t*)0x20009bc8 = 0;
-  *(uint64_t*)0x20009bd0 = 0x67d000;
-  *(uint64_t*)0x20009bd8 = 0;
-  *(uint64_t*)0x20009be0 = 0;
-  *(uint64_t*)0x20009be8 = 0x67e000;
-  *(uint64_t*)0x20009bf0 = 0;
-  *(uint64_t*)0x20009bf8 = 0;
-  *(uint64_t*)0x20009c00 = 0x67f000;
-  *(uint64_t*)0x20009c08 = 0;
-  *(uint64_t*)0x20009c10 = 0;
-  *(uint64_t*)0x20009c18 = 0x680000;
-  *(uint64_t*)0x20009c20 = 0;
-  *(uint64_t*)0x20009c28 = 0;
-  *(uint64_t*)0x20009c30 = 0x681000;
-  *(uint64_t*)0x20009c38 = 0;
-  *(uint64_t*)0x20009c40 = 0;
-  *(uint64_t*)0x20009c48 = 0x682000;
-  *(uint64_t*)0x20009c50 = 0;
-  *(uint64_t*)0x20009c58 = 0;
-  *(uint64_t*)0x20009c60 = 0x683000;
-  *(uint64_t*)0x20009c68 = 0;
-  *(uint64_t*)0x20009c70 = 0;
-  *(uint64_t*)0x20009c78 = 0x684000;
-  *(uint64_t*)0x20009c80 = 0;
-  *(uint64_t*)0x20009c88 = 0;
-  *(uint64_t*)0x20009c90 = 0x685000;
-  *(uint64_t*)0x20009c98 = 0;
-  *(uint64_t*)0x20009ca0 = 0;
-  *(uint64_t*)0x20009ca8 = 0x686000;
-  *(uint64_t*)0x20009cb0 = 0;
-  *(uint64_t*)0x20009cb8 = 0;
-  *(uint64_t*)0x20009cc0 = 0x687000;
-  *(uint64_t*)0x20009cc8 = 0;
-  *(uint64_t*)0x20009cd0 = 0;
-  *(uint64_t*)0x20009cd8 = 0x688000;
-  *(uint64_t*)0x20009ce0 = 0;
-  *(uint64_t*)0x20009ce8 = 0;
-  *(uint64_t*)0x20009cf0 = 0x689000;
-  *(uint64_t*)0x20009cf8 = 0;
-  *(uint64_t*)0x20009d00 = 0;
-  *(uint64_t*)0x20009d08 = 0x68a000;
-  *(uint64_t*)0x20009d10 = 0;
-  *(uint64_t*)0x20009d18 = 0;
-  *(uint64_t*)0x20009d20 = 0x68b000;
-  *(uint64_t*)0x20009d28 = 0;
-  *(uint64_t*)0x20009d30 = 0;
-  *(uint64_t*)0x20009d38 = 0x68c000;
-  *(uint64_t*)0x20009d40 = 0;
-  *(uint64_t*)0x20009d48 = 0;
-  *(uint64_t*)0x20009d50 = 0x68d000;
-  *(uint64_t*)0x20009d58 = 0;
-  *(uint64_t*)0x20009d60 = 0;
-  *(uint64_t*)0x20009d68 = 0x68e000;
-  *(uint64_t*)0x20009d70 = 0;
-  *(uint64_t*)0x20009d78 = 0;
-  *(uint64_t*)0x20009d80 = 0x68f000;
-  *(uint64_t*)0x20009d88 = 0;
-  *(uint64_t*)0x20009d90 = 0;
-  *(uint64_t*)0x20009d98 = 0x690000;
-  *(uint64_t*)0x20009da0 = 0;
-  *(uint64_t*)0x20009da8 = 0;
-  *(uint64_t*)0x20009db0 = 0x691000;
-  *(uint64_t*)0x20009db8 = 0;
-  *(uint64_t*)0x20009dc0 = 0;
-  *(uint64_t*)0x20009dc8 = 0x692000;
-  *(uint64_t*)0x20009dd0 = 0;
-  *(uint64_t*)0x20009dd8 = 0;
-  *(uint64_t*)0x20009de0 = 0x693000;
-  *(uint64_t*)0x20009de8 = 0;
-  *(uint64_t*)0x20009df0 = 0;
-  *(uint64_t*)0x20009df8 = 0x694000;
-  *(uint64_t*)0x20009e00 = 0;
-  *(uint64_t*)0x20009e08 = 0;
-  *(uint64_t*)0x20009e10 = 0x695000;
-  *(uint64_t*)0x20009e18 = 0;
-  *(uint64_t*)0x20009e20 = 0;
-  *(uint64_t*)0x20009e28 = 0x696000;
-  *(uint64_t*)0x20009e30 = 0;
-  *(uint64_t*)0x20009e38 = 0;
-  *(uint64_t*)0x20009e40 = 0x697000;
-  *(uint64_t*)0x20009e48 = 0;
-  *(uint64_t*)0x20009e50 = 0;
-  *(uint64_t*)0x20009e58 = 0x698000;
-  *(uint64_t*)0x20009e60 = 0;
-  *(uint64_t*)0x20009e68 = 0;
-  *(uint64_t*)0x20009e70 = 0x699000;
-  *(uint64_t*)0x20009e78 = 0;
-  *(uint64_t*)0x20009e80 = 0;
-  *(uint64_t*)0x20009e88 = 0x69a000;
-  *(uint64_t*)0x20009e90 = 0;
-  *(uint64_t*)0x20009e98 = 0;
-  *(uint64_t*)0x20009ea0 = 0x69b000;
-  *(uint64_t*)0x20009ea8 = 0;
-  *(uint64_t*)0x20009eb0 = 0;
-  *(uint64_t*)0x20009eb8 = 0x69c000;
-  *(uint64_t*)0x20009ec0 = 0;
-  *(uint64_t*)0x20009ec8 = 0;
-  *(uint64_t*)0x20009ed0 = 0x69d000;
-  *(uint64_t*)0x20009ed8 = 0;
-  *(uint64_t*)0x20009ee0 = 0;
-  *(uint64_t*)0x20009ee8 = 0x69e000;
-  *(uint64_t*)0x20009ef0 = 0;
-  *(uint64_t*)0x20009ef8 = 0;
-  *(uint64_t*)0x20009f00 = 0x69f000;
-  *(uint64_t*)0x20009f08 = 0;
-  *(uint64_t*)0x20009f10 = 0;
-  *(uint64_t*)0x20009f18 = 0x6a0000;
-  *(uint64_t*)0x20009f20 = 0;
-  *(uint64_t*)0x20009f28 = 0;
-  *(uint64_t*)0x20009f30 = 0x6a1000;
-  *(uint64_t*)0x20009f38 = 0;
-  *(uint64_t*)0x20009f40 = 0;
-  *(uint64_t*)0x20009f48 = 0x6a2000;
-  *(uint64_t*)0x20009f50 = 0;
-  *(uint64_t*)0x20009f58 = 0;
-  *(uint64_t*)0x20009f60 = 0x6a3000;
-  *(uint64_t*)0x20009f68 = 0;
-  *(uint64_t*)0x20009f70 = 0;
-  *(uint64_t*)0x20009f78 = 0x6a4000;
-  *(uint64_t*)0x20009f80 = 0;
-  *(uint64_t*)0x20009f88 = 0;
-  *(uint64_t*)0x20009f90 = 0x6a5000;
-  *(uint64_t*)0x20009f98 = 0;
-  *(uint64_t*)0x20009fa0 = 0;
-  *(uint64_t*)0x20009fa8 = 0x6a6000;
-  *(uint64_t*)0x20009fb0 = 0;
-  *(uint64_t*)0x20009fb8 = 0;
-  *(uint64_t*)0x20009fc0 = 0x6a7000;
-  *(uint64_t*)0x20009fc8 = 0;
-  *(uint64_t*)0x20009fd0 = 0;
-  *(uint64_t*)0x20009fd8 = 0x6a8000;
-  *(uint64_t*)0x20009fe0 = 0;
-  *(uint64_t*)0x20009fe8 = 0;
-  *(uint64_t*)0x20009ff0 = 0x6a9000;
-  *(uint64_t*)0x20009ff8 = 0;
-  *(uint64_t*)0x2000a000 = 0;
-  *(uint64_t*)0x2000a008 = 0x6aa000;
-  *(uint64_t*)0x2000a010 = 0;
-  *(uint64_t*)0x2000a018 = 0;
-  *(uint64_t*)0x2000a020 = 0x6ab000;
-  *(uint64_t*)0x2000a028 = 0;
-  *(uint64_t*)0x2000a030 = 0;
-  *(uint64_t*)0x2000a038 = 0x6ac000;
-  *(uint64_t*)0x2000a040 = 0;
-  *(uint64_t*)0x2000a048 = 0;
-  *(uint64_t*)0x2000a050 = 0x6ad000;
-  *(uint64_t*)0x2000a058 = 0;
-  *(uint64_t*)0x2000a060 = 0;
-  *(uint64_t*)0x2000a068 = 0x6ae000;
-  *(uint64_t*)0x2000a070 = 0;
-  *(uint64_t*)0x2000a078 = 0;
-  *(uint64_t*)0x2000a080 = 0x6af000;
-  *(uint64_t*)0x2000a088 = 0;
-  *(uint64_t*)0x2000a090 = 0;
-  *(uint64_t*)0x2000a098 = 0x6b0000;
-  *(uint64_t*)0x2000a0a0 = 0;
-  *(uint64_t*)0x2000a0a8 = 0;
-  *(uint64_t*)0x2000a0b0 = 0x6b1000;
-  *(uint64_t*)0x2000a0b8 = 0;
-  *(uint64_t*)0x2000a0c0 = 0;
-  *(uint64_t*)0x2000a0c8 = 0x6b2000;
-  *(uint64_t*)0x2000a0d0 = 0;
-  *(uint64_t*)0x2000a0d8 = 0;
-  *(uint64_t*)0x2000a0e0 = 0x6b3000;
-  *(uint64_t*)0x2000a0e8 = 0;
-  *(uint64_t*)0x2000a0f0 = 0;
-  *(uint64_t*)0x2000a0f8 = 0x6b4000;
-  *(uint64_t*)0x2000a100 = 0;
-  *(uint64_t*)0x2000a108 = 0;
-  *(uint64_t*)0x2000a110 = 0x6b5000;
-  *(uint64_t*)0x2000a118 = 0;
-  *(uint64_t*)0x2000a120 = 0;
-  *(uint64_t*)0x2000a128 = 0x6b6000;
-  *(uint64_t*)0x2000a130 = 0;
-  *(uint64_t*)0x2000a138 = 0;
-  *(uint64_t*)0x2000a140 = 0x6b7000;
-  *(uint64_t*)0x2000a148 = 0;
-  *(uint64_t*)0x2000a150 = 0;
-  *(uint64_t*)0x2000a158 = 0x6b8000;
-  *(uint64_t*)0x2000a160 = 0;
-  *(uint64_t*)0x2000a168 = 0;
-  *(uint64_t*)0x2000a170 = 0x6b9000;
-  *(uint64_t*)0x2000a178 = 0;
-  *(uint64_t*)0x2000a180 = 0;
-  *(uint64_t*)0x2000a188 = 0x6ba000;
-  *(uint64_t*)0x2000a190 = 0;
-  *(uint64_t*)0x2000a198 = 0;
-  *(uint64_t*)0x2000a1a0 = 0x6bb000;
-  *(uint64_t*)0x2000a1a8 = 0;
-  *(uint64_t*)0x2000a1b0 = 0;
-  *(uint64_t*)0x2000a1b8 = 0x6bc000;
-  *(uint64_t*)0x2000a1c0 = 0;
-  *(uint64_t*)0x2000a1c8 = 0;
-  *(uint64_t*)0x2000a1d0 = 0x6bd000;
-  *(uint64_t*)0x2000a1d8 = 0;
-  *(uint64_t*)0x2000a1e0 = 0;
-  *(uint64_t*)0x2000a1e8 = 0x6be000;
-  *(uint64_t*)0x2000a1f0 = 0;
-  *(uint64_t*)0x2000a1f8 = 0;
-  *(uint64_t*)0x2000a200 = 0x6bf000;
-  *(uint64_t*)0x2000a208 = 0;
-  *(uint64_t*)0x2000a210 = 0;
-  *(uint64_t*)0x2000a218 = 0x6c0000;
-  *(uint64_t*)0x2000a220 = 0;
-  *(uint64_t*)0x2000a228 = 0;
-  *(uint64_t*)0x2000a230 = 0x6c1000;
-  *(uint64_t*)0x2000a238 = 0;
-  *(uint64_t*)0x2000a240 = 0;
-  *(uint64_t*)0x2000a248 = 0x6c2000;
-  *(uint64_t*)0x2000a250 = 0;
-  *(uint64_t*)0x2000a258 = 0;
-  *(uint64_t*)0x2000a260 = 0x6c3000;
-  *(uint64_t*)0x2000a268 = 0;
-  *(uint64_t*)0x2000a270 = 0;
-  *(uint64_t*)0x2000a278 = 0x6c4000;
-  *(uint64_t*)0x2000a280 = 0;
-  *(uint64_t*)0x2000a288 = 0;
-  *(uint64_t*)0x2000a290 = 0x6c5000;
-  *(uint64_t*)0x2000a298 = 0;
-  *(uint64_t*)0x2000a2a0 = 0;
-  *(uint64_t*)0x2000a2a8 = 0x6c6000;
-  *(uint64_t*)0x2000a2b0 = 0;
-  *(uint64_t*)0x2000a2b8 = 0;
-  *(uint64_t*)0x2000a2c0 = 0x6c7000;
-  *(uint64_t*)0x2000a2c8 = 0;
-  *(uint64_t*)0x2000a2d0 = 0;
-  *(uint64_t*)0x2000a2d8 = 0x6c8000;
-  *(uint64_t*)0x2000a2e0 = 0;
-  *(uint64_t*)0x2000a2e8 = 0;
-  *(uint64_t*)0x2000a2f0 = 0x6c9000;
-  *(uint64_t*)0x2000a2f8 = 0;
-  *(uint64_t*)0x2000a300 = 0;
-  *(uint64_t*)0x2000a308 = 0x6ca000;
-  *(uint64_t*)0x2000a310 = 0;
-  *(uint64_t*)0x2000a318 = 0;
-  *(uint64_t*)0x2000a320 = 0x6cb000;
-  *(uint64_t*)0x2000a328 = 0;
-  *(uint64_t*)0x2000a330 = 0;
-  *(uint64_t*)0x2000a338 = 0x6cc000;
-  *(uint64_t*)0x2000a340 = 0;
-  *(uint64_t*)0x2000a348 = 0;
-  *(uint64_t*)0x2000a350 = 0x6cd000;
-  *(uint64_t*)0x2000a358 = 0;
-  *(uint64_t*)0x2000a360 = 0;
-  *(uint64_t*)0x2000a368 = 0x6ce000;
-  *(uint64_t*)0x2000a370 = 0;
-  *(uint64_t*)0x2000a378 = 0;
-  *(uint64_t*)0x2000a380 = 0x6cf000;
-  *(uint64_t*)0x2000a388 = 0;
-  *(uint64_t*)0x2000a390 = 0;
-  *(uint64_t*)0x2000a398 = 0x6d0000;
-  *(uint64_t*)0x2000a3a0 = 0;
-  *(uint64_t*)0x2000a3a8 = 0;
-  *(uint64_t*)0x2000a3b0 = 0x6d1000;
-  *(uint64_t*)0x2000a3b8 = 0;
-  *(uint64_t*)0x2000a3c0 = 0;
-  *(uint64_t*)0x2000a3c8 = 0x6d2000;
-  *(uint64_t*)0x2000a3d0 = 0;
-  *(uint64_t*)0x2000a3d8 = 0;
-  *(uint64_t*)0x2000a3e0 = 0x6d3000;
-  *(uint64_t*)0x2000a3e8 = 0;
-  *(uint64_t*)0x2000a3f0 = 0;
-  *(uint64_t*)0x2000a3f8 = 0x6d4000;
-  *(uint64_t*)0x2000a400 = 0;
-  *(uint64_t*)0x2000a408 = 0;
-  *(uint64_t*)0x2000a410 = 0x6d5000;
-  *(uint64_t*)0x2000a418 = 0;
-  *(uint64_t*)0x2000a420 = 0;
-  *(uint64_t*)0x2000a428 = 0x6d6000;
-  *(uint64_t*)0x2000a430 = 0;
-  *(uint64_t*)0x2000a438 = 0;
-  *(uint64_t*)0x2000a440 = 0x6d7000;
-  *(uint64_t*)0x2000a448 = 0;
-  *(uint64_t*)0x2000a450 = 0;
-  *(uint64_t*)0x2000a458 = 0x6d8000;
-  *(uint64_t*)0x2000a460 = 0;
-  *(uint64_t*)0x2000a468 = 0;
-  *(uint64_t*)0x2000a470 = 0x6d9000;
-  *(uint64_t*)0x2000a478 = 0;
-  *(uint64_t*)0x2000a480 = 0;
-  *(uint64_t*)0x2000a488 = 0x6da000;
-  *(uint64_t*)0x2000a490 = 0;
-  *(uint64_t*)0x2000a498 = 0;
-  *(uint64_t*)0x2000a4a0 = 0x6db000;
-  *(uint64_t*)0x2000a4a8 = 0;
-  *(uint64_t*)0x2000a4b0 = 0;
-  *(uint64_t*)0x2000a4b8 = 0x6dc000;
-  *(uint64_t*)0x2000a4c0 = 0;
-  *(uint64_t*)0x2000a4c8 = 0;
-  *(uint64_t*)0x2000a4d0 = 0x6dd000;
-  *(uint64_t*)0x2000a4d8 = 0;
-  *(uint64_t*)0x2000a4e0 = 0;
-  *(uint64_t*)0x2000a4e8 = 0x6de000;
-  *(uint64_t*)0x2000a4f0 = 0;
-  *(uint64_t*)0x2000a4f8 = 0;
-  *(uint64_t*)0x2000a500 = 0x6df000;
-  *(uint64_t*)0x2000a508 = 0;
-  *(uint64_t*)0x2000a510 = 0;
-  *(uint64_t*)0x2000a518 = 0x6e0000;
-  *(uint64_t*)0x2000a520 = 0;
-  *(uint64_t*)0x2000a528 = 0;
-  *(uint64_t*)0x2000a530 = 0x6e1000;
-  *(uint64_t*)0x2000a538 = 0;
-  *(uint64_t*)0x2000a540 = 0;
-  *(uint64_t*)0x2000a548 = 0x6e2000;
-  *(uint64_t*)0x2000a550 = 0;
-  *(uint64_t*)0x2000a558 = 0;
-  *(uint64_t*)0x2000a560 = 0x6e3000;
-  *(uint64_t*)0x2000a568 = 0;
-  *(uint64_t*)0x2000a570 = 0;
-  *(uint64_t*)0x2000a578 = 0x6e4000;
-  *(uint64_t*)0x2000a580 = 0;
-  *(uint64_t*)0x2000a588 = 0;
-  *(uint64_t*)0x2000a590 = 0x6e5000;
-  *(uint64_t*)0x2000a598 = 0;
-  *(uint64_t*)0x2000a5a0 = 0;
-  *(uint64_t*)0x2000a5a8 = 0x6e6000;
-  *(uint64_t*)0x2000a5b0 = 0;
-  *(uint64_t*)0x2000a5b8 = 0;
-  *(uint64_t*)0x2000a5c0 = 0x6e7000;
-  *(uint64_t*)0x2000a5c8 = 0;
-  *(uint64_t*)0x2000a5d0 = 0;
-  *(uint64_t*)0x2000a5d8 = 0x6e8000;
-  *(uint64_t*)0x2000a5e0 = 0;
-  *(uint64_t*)0x2000a5e8 = 0;
-  *(uint64_t*)0x2000a5f0 = 0x6e9000;
-  *(uint64_t*)0x2000a5f8 = 0;
-  *(uint64_t*)0x2000a600 = 0;
-  *(uint64_t*)0x2000a608 = 0x6ea000;
-  *(uint64_t*)0x2000a610 = 0;
-  *(uint64_t*)0x2000a618 = 0;
-  *(uint64_t*)0x2000a620 = 0x6eb000;
-  *(uint64_t*)0x2000a628 = 0;
-  *(uint64_t*)0x2000a630 = 0;
-  *(uint64_t*)0x2000a638 = 0x6ec000;
-  *(uint64_t*)0x2000a640 = 0;
-  *(uint64_t*)0x2000a648 = 0;
-  *(uint64_t*)0x2000a650 = 0x6ed000;
-  *(uint64_t*)0x2000a658 = 0;
-  *(uint64_t*)0x2000a660 = 0;
-  *(uint64_t*)0x2000a668 = 0x6ee000;
-  *(uint64_t*)0x2000a670 = 0;
-  *(uint64_t*)0x2000a678 = 0;
-  *(uint64_t*)0x2000a680 = 0x6ef000;
-  *(uint64_t*)0x2000a688 = 0;
-  *(uint64_t*)0x2000a690 = 0;
-  *(uint64_t*)0x2000a698 = 0x6f0000;
-  *(uint64_t*)0x2000a6a0 = 0;
-  *(uint64_t*)0x2000a6a8 = 0;
-  *(uint64_t*)0x2000a6b0 = 0x6f1000;
-  *(uint64_t*)0x2000a6b8 = 0;
-  *(uint64_t*)0x2000a6c0 = 0;
-  *(uint64_t*)0x2000a6c8 = 0x6f2000;
-  *(uint64_t*)0x2000a6d0 = 0;
-  *(uint64_t*)0x2000a6d8 = 0;
-  *(uint64_t*)0x2000a6e0 = 0x6f3000;
-  *(uint64_t*)0x2000a6e8 = 0;
-  *(uint64_t*)0x2000a6f0 = 0;
-  *(uint64_t*)0x2000a6f8 = 0x6f4000;
-  *(uint64_t*)0x2000a700 = 0;
-  *(uint64_t*)0x2000a708 = 0;
-  *(uint64_t*)0x2000a710 = 0x6f5000;
-  *(uint64_t*)0x2000a718 = 0;
-  *(uint64_t*)0x2000a720 = 0;
-  *(uint64_t*)0x2000a728 = 0x6f6000;
-  *(uint64_t*)0x2000a730 = 0;
-  *(uint64_t*)0x2000a738 = 0;
-  *(uint64_t*)0x2000a740 = 0x6f7000;
-  *(uint64_t*)0x2000a748 = 0;
-  *(uint64_t*)0x2000a750 = 0;
-  *(uint64_t*)0x2000a758 = 0x6f8000;
-  *(uint64_t*)0x2000a760 = 0;
-  *(uint64_t*)0x2000a768 = 0;
-  *(uint64_t*)0x2000a770 = 0x6f9000;
-  *(uint64_t*)0x2000a778 = 0;
-  *(uint64_t*)0x2000a780 = 0;
-  *(uint64_t*)0x2000a788 = 0x6fa000;
-  *(uint64_t*)0x2000a790 = 0;
-  *(uint64_t*)0x2000a798 = 0;
-  *(uint64_t*)0x2000a7a0 = 0x6fb000;
-  *(uint64_t*)0x2000a7a8 = 0;
-  *(uint64_t*)0x2000a7b0 = 0;
-  *(uint64_t*)0x2000a7b8 = 0x6fc000;
-  *(uint64_t*)0x2000a7c0 = 0;
-  *(uint64_t*)0x2000a7c8 = 0;
-  *(uint64_t*)0x2000a7d0 = 0x6fd000;
-  *(uint64_t*)0x2000a7d8 = 0;
-  *(uint64_t*)0x2000a7e0 = 0;
-  *(uint64_t*)0x2000a7e8 = 0x6fe000;
-  *(uint64_t*)0x2000a7f0 = 0;
-  *(uint64_t*)0x2000a7f8 = 0;
-  *(uint64_t*)0x2000a800 = 0x6ff000;
-  *(uint64_t*)0x2000a808 = 0;
-  *(uint64_t*)0x2000a810 = 0;
-  *(uint64_t*)0x2000a818 = 0x700000;
-  *(uint64_t*)0x2000a820 = 0;
-  *(uint64_t*)0x2000a828 = 0;
-  *(uint64_t*)0x2000a830 = 0x701000;
-  *(uint64_t*)0x2000a838 = 0;
-  *(uint64_t*)0x2000a840 = 0;
-  *(uint64_t*)0x2000a848 = 0x702000;
-  *(uint64_t*)0x2000a850 = 0;
-  *(uint64_t*)0x2000a858 = 0;
-  *(uint64_t*)0x2000a860 = 0x703000;
-  *(uint64_t*)0x2000a868 = 0;
-  *(uint64_t*)0x2000a870 = 0;
-  *(uint64_t*)0x2000a878 = 0x704000;
-  *(uint64_t*)0x2000a880 = 0;
-  *(uint64_t*)0x2000a888 = 0;
-  *(uint64_t*)0x2000a890 = 0x705000;
-  *(uint64_t*)0x2000a898 = 0;
-  *(uint64_t*)0x2000a8a0 = 0;
-  *(uint64_t*)0x2000a8a8 = 0x706000;
-  *(uint64_t*)0x2000a8b0 = 0;
-  *(uint64_t*)0x2000a8b8 = 0;
-  *(uint64_t*)0x2000a8c0 = 0x707000;
-  *(uint64_t*)0x2000a8c8 = 0;
-  *(uint64_t*)0x2000a8d0 = 0;
-  *(uint64_t*)0x2000a8d8 = 0x708000;
-  *(uint64_t*)0x2000a8e0 = 0;
-  *(uint64_t*)0x2000a8e8 = 0;
-  *(uint64_t*)0x2000a8f0 = 0x709000;
-  *(uint64_t*)0x2000a8f8 = 0;
-  *(uint64_t*)0x2000a900 = 0;
-  *(uint64_t*)0x2000a908 = 0x70a000;
-  *(uint64_t*)0x2000a910 = 0;
-  *(uint64_t*)0x2000a918 = 0;
-  *(uint64_t*)0x2000a920 = 0x70b000;
-  *(uint64_t*)0x2000a928 = 0;
-  *(uint64_t*)0x2000a930 = 0;
-  *(uint64_t*)0x2000a938 = 0x70c000;
-  *(uint64_t*)0x2000a940 = 0;
-  *(uint64_t*)0x2000a948 = 0;
-  *(uint64_t*)0x2000a950 = 0x70d000;
-  *(uint64_t*)0x2000a958 = 0;
-  *(uint64_t*)0x2000a960 = 0;
-  *(uint64_t*)0x2000a968 = 0x70e000;
-  *(uint64_t*)0x2000a970 = 0;
-  *(uint64_t*)0x2000a978 = 0;
-  *(uint64_t*)0x2000a980 = 0x70f000;
-  *(uint64_t*)0x2000a988 = 0;
-  *(uint64_t*)0x2000a990 = 0;
-  *(uint64_t*)0x2000a998 = 0x710000;
-  *(uint64_t*)0x2000a9a0 = 0;
-  *(uint64_t*)0x2000a9a8 = 0;
-  *(uint64_t*)0x2000a9b0 = 0x711000;
-  *(uint64_t*)0x2000a9b8 = 0;
-  *(uint64_t*)0x2000a9c0 = 0;
-  *(uint64_t*)0x2000a9c8 = 0x712000;
-  *(uint64_t*)0x2000a9d0 = 0;
-  *(uint64_t*)0x2000a9d8 = 0;
-  *(uint64_t*)0x2000a9e0 = 0x713000;
-  *(uint64_t*)0x2000a9e8 = 0;
-  *(uint64_t*)0x2000a9f0 = 0;
-  *(uint64_t*)0x2000a9f8 = 0x714000;
-  *(uint64_t*)0x2000aa00 = 0;
-  *(uint64_t*)0x2000aa08 = 0;
-  *(uint64_t*)0x2000aa10 = 0x715000;
-  *(uint64_t*)0x2000aa18 = 0;
-  *(uint64_t*)0x2000aa20 = 0;
-  *(uint64_t*)0x2000aa28 = 0x716000;
-  *(uint64_t*)0x2000aa30 = 0;
-  *(uint64_t*)0x2000aa38 = 0;
-  *(uint64_t*)0x2000aa40 = 0x717000;
-  *(uint64_t*)0x2000aa48 = 0;
-  *(uint64_t*)0x2000aa50 = 0;
-  *(uint64_t*)0x2000aa58 = 0x718000;
-  *(uint64_t*)0x2000aa60 = 0;
-  *(uint64_t*)0x2000aa68 = 0;
-  *(uint64_t*)0x2000aa70 = 0x719000;
-  *(uint64_t*)0x2000aa78 = 0;
-  *(uint64_t*)0x2000aa80 = 0;
-  *(uint64_t*)0x2000aa88 = 0x71a000;
-  *(uint64_t*)0x2000aa90 = 0;
-  *(uint64_t*)0x2000aa98 = 0;
-  *(uint64_t*)0x2000aaa0 = 0x71b000;
-  *(uint64_t*)0x2000aaa8 = 0;
-  *(uint64_t*)0x2000aab0 = 0;
-  *(uint64_t*)0x2000aab8 = 0x71c000;
-  *(uint64_t*)0x2000aac0 = 0;
-  *(uint64_t*)0x2000aac8 = 0;
-  *(uint64_t*)0x2000aad0 = 0x71d000;
-  *(uint64_t*)0x2000aad8 = 0;
-  *(uint64_t*)0x2000aae0 = 0;
-  *(uint64_t*)0x2000aae8 = 0x71e000;
-  *(uint64_t*)0x2000aaf0 = 0;
-  *(uint64_t*)0x2000aaf8 = 0;
-  *(uint64_t*)0x2000ab00 = 0x71f000;
-  *(uint64_t*)0x2000ab08 = 0;
-  *(uint64_t*)0x2000ab10 = 0;
-  *(uint64_t*)0x2000ab18 = 0x720000;
-  *(uint64_t*)0x2000ab20 = 0;
-  *(uint64_t*)0x2000ab28 = 0;
-  *(uint64_t*)0x2000ab30 = 0x721000;
-  *(uint64_t*)0x2000ab38 = 0;
-  *(uint64_t*)0x2000ab40 = 0;
-  *(uint64_t*)0x2000ab48 = 0x722000;
-  *(uint64_t*)0x2000ab50 = 0;
-  *(uint64_t*)0x2000ab58 = 0;
-  *(uint64_t*)0x2000ab60 = 0x723000;
-  *(uint64_t*)0x2000ab68 = 0;
-  *(uint64_t*)0x2000ab70 = 0;
-  *(uint64_t*)0x2000ab78 = 0x724000;
-  *(uint64_t*)0x2000ab80 = 0;
-  *(uint64_t*)0x2000ab88 = 0;
-  *(uint64_t*)0x2000ab90 = 0x725000;
-  *(uint64_t*)0x2000ab98 = 0;
-  *(uint64_t*)0x2000aba0 = 0;
-  *(uint64_t*)0x2000aba8 = 0x726000;
-  *(uint64_t*)0x2000abb0 = 0;
-  *(uint64_t*)0x2000abb8 = 0;
-  *(uint64_t*)0x2000abc0 = 0x727000;
-  *(uint64_t*)0x2000abc8 = 0;
-  *(uint64_t*)0x2000abd0 = 0;
-  *(uint64_t*)0x2000abd8 = 0x728000;
-  *(uint64_t*)0x2000abe0 = 0;
-  *(uint64_t*)0x2000abe8 = 0;
-  *(uint64_t*)0x2000abf0 = 0x729000;
-  *(uint64_t*)0x2000abf8 = 0;
-  *(uint64_t*)0x2000ac00 = 0;
-  *(uint64_t*)0x2000ac08 = 0x72a000;
-  *(uint64_t*)0x2000ac10 = 0;
-  *(uint64_t*)0x2000ac18 = 0;
-  *(uint64_t*)0x2000ac20 = 0x72b000;
-  *(uint64_t*)0x2000ac28 = 0;
-  *(uint64_t*)0x2000ac30 = 0;
-  *(uint64_t*)0x2000ac38 = 0x72c000;
-  *(uint64_t*)0x2000ac40 = 0;
-  *(uint64_t*)0x2000ac48 = 0;
-  *(uint64_t*)0x2000ac50 = 0x72d000;
-  *(uint64_t*)0x2000ac58 = 0;
-  *(uint64_t*)0x2000ac60 = 0;
-  *(uint64_t*)0x2000ac68 = 0x72e000;
-  *(uint64_t*)0x2000ac70 = 0;
-  *(uint64_t*)0x2000ac78 = 0;
-  *(uint64_t*)0x2000ac80 = 0x72f000;
-  *(uint64_t*)0x2000ac88 = 0;
-  *(uint64_t*)0x2000ac90 = 0;
-  *(uint64_t*)0x2000ac98 = 0x730000;
-  *(uint64_t*)0x2000aca0 = 0;
-  *(uint64_t*)0x2000aca8 = 0;
-  *(uint64_t*)0x2000acb0 = 0x731000;
-  *(uint64_t*)0x2000acb8 = 0;
-  *(uint64_t*)0x2000acc0 = 0;
-  *(uint64_t*)0x2000acc8 = 0x732000;
-  *(uint64_t*)0x2000acd0 = 0;
-  *(uint64_t*)0x2000acd8 = 0;
-  *(uint64_t*)0x2000ace0 = 0x733000;
-  *(uint64_t*)0x2000ace8 = 0;
-  *(uint64_t*)0x2000acf0 = 0;
-  *(uint64_t*)0x2000acf8 = 0x734000;
-  *(uint64_t*)0x2000ad00 = 0;
-  *(uint64_t*)0x2000ad08 = 0;
-  *(uint64_t*)0x2000ad10 = 0x735000;
-  *(uint64_t*)0x2000ad18 = 0;
-  *(uint64_t*)0x2000ad20 = 0;
-  *(uint64_t*)0x2000ad28 = 0x736000;
-  *(uint64_t*)0x2000ad30 = 0;
-  *(uint64_t*)0x2000ad38 = 0;
-  *(uint64_t*)0x2000ad40 = 0x737000;
-  *(uint64_t*)0x2000ad48 = 0;
-  *(uint64_t*)0x2000ad50 = 0;
-  *(uint64_t*)0x2000ad58 = 0x738000;
-  *(uint64_t*)0x2000ad60 = 0;
-  *(uint64_t*)0x2000ad68 = 0;
-  *(uint64_t*)0x2000ad70 = 0x739000;
-  *(uint64_t*)0x2000ad78 = 0;
-  *(uint64_t*)0x2000ad80 = 0;
-  *(uint64_t*)0x2000ad88 = 0x73a000;
-  *(uint64_t*)0x2000ad90 = 0;
-  *(uint64_t*)0x2000ad98 = 0;
-  *(uint64_t*)0x2000ada0 = 0x73b000;
-  *(uint64_t*)0x2000ada8 = 0;
-  *(uint64_t*)0x2000adb0 = 0;
-  *(uint64_t*)0x2000adb8 = 0x73c000;
-  *(uint64_t*)0x2000adc0 = 0;
-  *(uint64_t*)0x2000adc8 = 0;
-  *(uint64_t*)0x2000add0 = 0x73d000;
-  *(uint64_t*)0x2000add8 = 0;
-  *(uint64_t*)0x2000ade0 = 0;
-  *(uint64_t*)0x2000ade8 = 0x73e000;
-  *(uint64_t*)0x2000adf0 = 0;
-  *(uint64_t*)0x2000adf8 = 0;
-  *(uint64_t*)0x2000ae00 = 0x73f000;
-  *(uint64_t*)0x2000ae08 = 0;
-  *(uint64_t*)0x2000ae10 = 0;
-  *(uint64_t*)0x2000ae18 = 0x740000;
-  *(uint64_t*)0x2000ae20 = 0;
-  *(uint64_t*)0x2000ae28 = 0;
-  *(uint64_t*)0x2000ae30 = 0x741000;
-  *(uint64_t*)0x2000ae38 = 0;
-  *(uint64_t*)0x2000ae40 = 0;
-  *(uint64_t*)0x2000ae48 = 0x742000;
-  *(uint64_t*)0x2000ae50 = 0;
-  *(uint64_t*)0x2000ae58 = 0;
-  *(uint64_t*)0x2000ae60 = 0x743000;
-  *(uint64_t*)0x2000ae68 = 0;
-  *(uint64_t*)0x2000ae70 = 0;
-  *(uint64_t*)0x2000ae78 = 0x744000;
-  *(uint64_t*)0x2000ae80 = 0;
-  *(uint64_t*)0x2000ae88 = 0;
-  *(uint64_t*)0x2000ae90 = 0x745000;
-  *(uint64_t*)0x2000ae98 = 0;
-  *(uint64_t*)0x2000aea0 = 0;
-  *(uint64_t*)0x2000aea8 = 0x746000;
-  *(uint64_t*)0x2000aeb0 = 0;
-  *(uint64_t*)0x2000aeb8 = 0;
-  *(uint64_t*)0x2000aec0 = 0x747000;
-  *(uint64_t*)0x2000aec8 = 0;
-  *(uint64_t*)0x2000aed0 = 0;
-  *(uint64_t*)0x2000aed8 = 0x748000;
-  *(uint64_t*)0x2000aee0 = 0;
-  *(uint64_t*)0x2000aee8 = 0;
-  *(uint64_t*)0x2000aef0 = 0x749000;
-  *(uint64_t*)0x2000aef8 = 0;
-  *(uint64_t*)0x2000af00 = 0;
-  *(uint64_t*)0x2000af08 = 0x74a000;
-  *(uint64_t*)0x2000af10 = 0;
-  *(uint64_t*)0x2000af18 = 0;
-  *(uint64_t*)0x2000af20 = 0x74b000;
-  *(uint64_t*)0x2000af28 = 0;
-  *(uint64_t*)0x2000af30 = 0;
-  *(uint64_t*)0x2000af38 = 0x74c000;
-  *(uint64_t*)0x2000af40 = 0;
-  *(uint64_t*)0x2000af48 = 0;
-  *(uint64_t*)0x2000af50 = 0x74d000;
-  *(uint64_t*)0x2000af58 = 0;
-  *(uint64_t*)0x2000af60 = 0;
-  *(uint64_t*)0x2000af68 = 0x74e000;
-  *(uint64_t*)0x2000af70 = 0;
-  *(uint64_t*)0x2000af78 = 0;
-  *(uint64_t*)0x2000af80 = 0x74f000;
-  *(uint64_t*)0x2000af88 = 0;
-  *(uint64_t*)0x2000af90 = 0;
-  *(uint64_t*)0x2000af98 = 0x750000;
-  *(uint64_t*)0x2000afa0 = 0;
-  *(uint64_t*)0x2000afa8 = 0;
-  *(uint64_t*)0x2000afb0 = 0x751000;
-  *(uint64_t*)0x2000afb8 = 0;
-  *(uint64_t*)0x2000afc0 = 0;
-  *(uint64_t*)0x2000afc8 = 0x752000;
-  *(uint64_t*)0x2000afd0 = 0;
-  *(uint64_t*)0x2000afd8 = 0;
-  *(uint64_t*)0x2000afe0 = 0x753000;
-  *(uint64_t*)0x2000afe8 = 0;
-  *(uint64_t*)0x2000aff0 = 0;
-  *(uint64_t*)0x2000aff8 = 0x754000;
-  *(uint64_t*)0x2000b000 = 0;
-  *(uint64_t*)0x2000b008 = 0;
-  *(uint64_t*)0x2000b010 = 0x755000;
-  *(uint64_t*)0x2000b018 = 0;
-  *(uint64_t*)0x2000b020 = 0;
-  *(uint64_t*)0x2000b028 = 0x756000;
-  *(uint64_t*)0x2000b030 = 0;
-  *(uint64_t*)0x2000b038 = 0;
-  *(uint64_t*)0x2000b040 = 0x757000;
-  *(uint64_t*)0x2000b048 = 0;
-  *(uint64_t*)0x2000b050 = 0;
-  *(uint64_t*)0x2000b058 = 0x758000;
-  *(uint64_t*)0x2000b060 = 0;
-  *(uint64_t*)0x2000b068 = 0;
-  *(uint64_t*)0x2000b070 = 0x759000;
-  *(uint64_t*)0x2000b078 = 0;
-  *(uint64_t*)0x2000b080 = 0;
-  *(uint64_t*)0x2000b088 = 0x75a000;
-  *(uint64_t*)0x2000b090 = 0;
-  *(uint64_t*)0x2000b098 = 0;
-  *(uint64_t*)0x2000b0a0 = 0x75b000;
-  *(uint64_t*)0x2000b0a8 = 0;
-  *(uint64_t*)0x2000b0b0 = 0;
-  *(uint64_t*)0x2000b0b8 = 0x75c000;
-  *(uint64_t*)0x2000b0c0 = 0;
-  *(uint64_t*)0x2000b0c8 = 0;
-  *(uint64_t*)0x2000b0d0 = 0x75d000;
-  *(uint64_t*)0x2000b0d8 = 0;
-  *(uint64_t*)0x2000b0e0 = 0;
-  *(uint64_t*)0x2000b0e8 = 0x75e000;
-  *(uint64_t*)0x2000b0f0 = 0;
-  *(uint64_t*)0x2000b0f8 = 0;
-  *(uint64_t*)0x2000b100 = 0x75f000;
-  *(uint64_t*)0x2000b108 = 0;
-  *(uint64_t*)0x2000b110 = 0;
-  *(uint64_t*)0x2000b118 = 0x760000;
-  *(uint64_t*)0x2000b120 = 0;
-  *(uint64_t*)0x2000b128 = 0;
-  *(uint64_t*)0x2000b130 = 0x761000;
-  *(uint64_t*)0x2000b138 = 0;
-  *(uint64_t*)0x2000b140 = 0;
-  *(uint64_t*)0x2000b148 = 0x762000;
-  *(uint64_t*)0x2000b150 = 0;
-  *(uint64_t*)0x2000b158 = 0;
-  *(uint64_t*)0x2000b160 = 0x763000;
-  *(uint64_t*)0x2000b168 = 0;
-  *(uint64_t*)0x2000b170 = 0;
-  *(uint64_t*)0x2000b178 = 0x764000;
-  *(uint64_t*)0x2000b180 = 0;
-  *(uint64_t*)0x2000b188 = 0;
-  *(uint64_t*)0x2000b190 = 0x765000;
-  *(uint64_t*)0x2000b198 = 0;
-  *(uint64_t*)0x2000b1a0 = 0;
-  *(uint64_t*)0x2000b1a8 = 0x766000;
-  *(uint64_t*)0x2000b1b0 = 0;
-  *(uint64_t*)0x2000b1b8 = 0;
-  *(uint64_t*)0x2000b1c0 = 0x767000;
-  *(uint64_t*)0x2000b1c8 = 0;
-  *(uint64_t*)0x2000b1d0 = 0;
-  *(uint64_t*)0x2000b1d8 = 0x768000;
-  *(uint64_t*)0x2000b1e0 = 0;
-  *(uint64_t*)0x2000b1e8 = 0;
-  *(uint64_t*)0x2000b1f0 = 0x769000;
-  *(uint64_t*)0x2000b1f8 = 0;
-  *(uint64_t*)0x2000b200 = 0;
-  *(uint64_t*)0x2000b208 = 0x76a000;
-  *(uint64_t*)0x2000b210 = 0;
-  *(uint64_t*)0x2000b218 = 0;
-  *(uint64_t*)0x2000b220 = 0x76b000;
-  *(uint64_t*)0x2000b228 = 0;
-  *(uint64_t*)0x2000b230 = 0;
-  *(uint64_t*)0x2000b238 = 0x76c000;
-  *(uint64_t*)0x2000b240 = 0;
-  *(uint64_t*)0x2000b248 = 0;
-  *(uint64_t*)0x2000b250 = 0x76d000;
-  *(uint64_t*)0x2000b258 = 0;
-  *(uint64_t*)0x2000b260 = 0;
-  *(uint64_t*)0x2000b268 = 0x76e000;
-  *(uint64_t*)0x2000b270 = 0;
-  *(uint64_t*)0x2000b278 = 0;
-  *(uint64_t*)0x2000b280 = 0x76f000;
-  *(uint64_t*)0x2000b288 = 0;
-  *(uint64_t*)0x2000b290 = 0;
-  *(uint64_t*)0x2000b298 = 0x770000;
-  *(uint64_t*)0x2000b2a0 = 0;
-  *(uint64_t*)0x2000b2a8 = 0;
-  *(uint64_t*)0x2000b2b0 = 0x771000;
-  *(uint64_t*)0x2000b2b8 = 0;
-  *(uint64_t*)0x2000b2c0 = 0;
-  *(uint64_t*)0x2000b2c8 = 0x772000;
-  *(uint64_t*)0x2000b2d0 = 0;
-  *(uint64_t*)0x2000b2d8 = 0;
-  *(uint64_t*)0x2000b2e0 = 0x773000;
-  *(uint64_t*)0x2000b2e8 = 0;
-  *(uint64_t*)0x2000b2f0 = 0;
-  *(uint64_t*)0x2000b2f8 = 0x774000;
-  *(uint64_t*)0x2000b300 = 0;
-  *(uint64_t*)0x2000b308 = 0;
-  *(uint64_t*)0x2000b310 = 0x775000;
-  *(uint64_t*)0x2000b318 = 0;
-  *(uint64_t*)0x2000b320 = 0;
-  *(uint64_t*)0x2000b328 = 0x776000;
-  *(uint64_t*)0x2000b330 = 0;
-  *(uint64_t*)0x2000b338 = 0;
-  *(uint64_t*)0x2000b340 = 0x777000;
-  *(uint64_t*)0x2000b348 = 0;
-  *(uint64_t*)0x2000b350 = 0;
-  *(uint64_t*)0x2000b358 = 0x778000;
-  *(uint64_t*)0x2000b360 = 0;
-  *(uint64_t*)0x2000b368 = 0;
-  *(uint64_t*)0x2000b370 = 0x779000;
-  *(uint64_t*)0x2000b378 = 0;
-  *(uint64_t*)0x2000b380 = 0;
-  *(uint64_t*)0x2000b388 = 0x77a000;
-  *(uint64_t*)0x2000b390 = 0;
-  *(uint64_t*)0x2000b398 = 0;
-  *(uint64_t*)0x2000b3a0 = 0x77b000;
-  *(uint64_t*)0x2000b3a8 = 0;
-  *(uint64_t*)0x2000b3b0 = 0;
-  *(uint64_t*)0x2000b3b8 = 0x77c000;
-  *(uint64_t*)0x2000b3c0 = 0;
-  *(uint64_t*)0x2000b3c8 = 0;
-  *(uint64_t*)0x2000b3d0 = 0x77d000;
-  *(uint64_t*)0x2000b3d8 = 0;
-  *(uint64_t*)0x2000b3e0 = 0;
-  *(uint64_t*)0x2000b3e8 = 0x77e000;
-  *(uint64_t*)0x2000b3f0 = 0;
-  *(uint64_t*)0x2000b3f8 = 0;
-  *(uint64_t*)0x2000b400 = 0x77f000;
-  *(uint64_t*)0x2000b408 = 0;
-  *(uint64_t*)0x2000b410 = 0;
-  *(uint64_t*)0x2000b418 = 0x780000;
-  *(uint64_t*)0x2000b420 = 0;
-  *(uint64_t*)0x2000b428 = 0;
-  *(uint64_t*)0x2000b430 = 0x781000;
-  *(uint64_t*)0x2000b438 = 0;
-  *(uint64_t*)0x2000b440 = 0;
-  *(uint64_t*)0x2000b448 = 0x782000;
-  *(uint64_t*)0x2000b450 = 0;
-  *(uint64_t*)0x2000b458 = 0;
-  *(uint64_t*)0x2000b460 = 0x783000;
-  *(uint64_t*)0x2000b468 = 0;
-  *(uint64_t*)0x2000b470 = 0;
-  *(uint64_t*)0x2000b478 = 0x784000;
-  *(uint64_t*)0x2000b480 = 0;
-  *(uint64_t*)0x2000b488 = 0;
-  *(uint64_t*)0x2000b490 = 0x785000;
-  *(uint64_t*)0x2000b498 = 0;
-  *(uint64_t*)0x2000b4a0 = 0;
-  *(uint64_t*)0x2000b4a8 = 0x786000;
-  *(uint64_t*)0x2000b4b0 = 0;
-  *(uint64_t*)0x2000b4b8 = 0;
-  *(uint64_t*)0x2000b4c0 = 0x787000;
-  *(uint64_t*)0x2000b4c8 = 0;
-  *(uint64_t*)0x2000b4d0 = 0;
-  *(uint64_t*)0x2000b4d8 = 0x788000;
-  *(uint64_t*)0x2000b4e0 = 0;
-  *(uint64_t*)0x2000b4e8 = 0;
-  *(uint64_t*)0x2000b4f0 = 0x789000;
-  *(uint64_t*)0x2000b4f8 = 0;
-  *(uint64_t*)0x2000b500 = 0;
-  *(uint64_t*)0x2000b508 = 0x78a000;
-  *(uint64_t*)0x2000b510 = 0;
-  *(uint64_t*)0x2000b518 = 0;
-  *(uint64_t*)0x2000b520 = 0x78b000;
-  *(uint64_t*)0x2000b528 = 0;
-  *(uint64_t*)0x2000b530 = 0;
-  *(uint64_t*)0x2000b538 = 0x78c000;
-  *(uint64_t*)0x2000b540 = 0;
-  *(uint64_t*)0x2000b548 = 0;
-  *(uint64_t*)0x2000b550 = 0x78d000;
-  *(uint64_t*)0x2000b558 = 0;
-  *(uint64_t*)0x2000b560 = 0;
-  *(uint64_t*)0x2000b568 = 0x78e000;
-  *(uint64_t*)0x2000b570 = 0;
-  *(uint64_t*)0x2000b578 = 0;
-  *(uint64_t*)0x2000b580 = 0x78f000;
-  *(uint64_t*)0x2000b588 = 0;
-  *(uint64_t*)0x2000b590 = 0;
-  *(uint64_t*)0x2000b598 = 0x790000;
-  *(uint64_t*)0x2000b5a0 = 0;
-  *(uint64_t*)0x2000b5a8 = 0;
-  *(uint64_t*)0x2000b5b0 = 0x791000;
-  *(uint64_t*)0x2000b5b8 = 0;
-  *(uint64_t*)0x2000b5c0 = 0;
-  *(uint64_t*)0x2000b5c8 = 0x792000;
-  *(uint64_t*)0x2000b5d0 = 0;
-  *(uint64_t*)0x2000b5d8 = 0;
-  *(uint64_t*)0x2000b5e0 = 0x793000;
-  *(uint64_t*)0x2000b5e8 = 0;
-  *(uint64_t*)0x2000b5f0 = 0;
-  *(uint64_t*)0x2000b5f8 = 0x794000;
-  *(uint64_t*)0x2000b600 = 0;
-  *(uint64_t*)0x2000b608 = 0;
-  *(uint64_t*)0x2000b610 = 0x795000;
-  *(uint64_t*)0x2000b618 = 0;
-  *(uint64_t*)0x2000b620 = 0;
-  *(uint64_t*)0x2000b628 = 0x796000;
-  *(uint64_t*)0x2000b630 = 0;
-  *(uint64_t*)0x2000b638 = 0;
-  *(uint64_t*)0x2000b640 = 0x797000;
-  *(uint64_t*)0x2000b648 = 0;
-  *(uint64_t*)0x2000b650 = 0;
-  *(uint64_t*)0x2000b658 = 0x798000;
-  *(uint64_t*)0x2000b660 = 0;
-  *(uint64_t*)0x2000b668 = 0;
-  *(uint64_t*)0x2000b670 = 0x799000;
-  *(uint64_t*)0x2000b678 = 0;
-  *(uint64_t*)0x2000b680 = 0;
-  *(uint64_t*)0x2000b688 = 0x79a000;
-  *(uint64_t*)0x2000b690 = 0;
-  *(uint64_t*)0x2000b698 = 0;
-  *(uint64_t*)0x2000b6a0 = 0x79b000;
-  *(uint64_t*)0x2000b6a8 = 0;
-  *(uint64_t*)0x2000b6b0 = 0;
-  *(uint64_t*)0x2000b6b8 = 0x79c000;
-  *(uint64_t*)0x2000b6c0 = 0;
-  *(uint64_t*)0x2000b6c8 = 0;
-  *(uint64_t*)0x2000b6d0 = 0x79d000;
-  *(uint64_t*)0x2000b6d8 = 0;
-  *(uint64_t*)0x2000b6e0 = 0;
-  *(uint64_t*)0x2000b6e8 = 0x79e000;
-  *(uint64_t*)0x2000b6f0 = 0;
-  *(uint64_t*)0x2000b6f8 = 0;
-  *(uint64_t*)0x2000b700 = 0x79f000;
-  *(uint64_t*)0x2000b708 = 0;
-  *(uint64_t*)0x2000b710 = 0;
-  *(uint64_t*)0x2000b718 = 0x7a0000;
-  *(uint64_t*)0x2000b720 = 0;
-  *(uint64_t*)0x2000b728 = 0;
-  *(uint64_t*)0x2000b730 = 0x7a1000;
-  *(uint64_t*)0x2000b738 = 0;
-  *(uint64_t*)0x2000b740 = 0;
-  *(uint64_t*)0x2000b748 = 0x7a2000;
-  *(uint64_t*)0x2000b750 = 0;
-  *(uint64_t*)0x2000b758 = 0;
-  *(uint64_t*)0x2000b760 = 0x7a3000;
-  *(uint64_t*)0x2000b768 = 0;
-  *(uint64_t*)0x2000b770 = 0;
-  *(uint64_t*)0x2000b778 = 0x7a4000;
-  *(uint64_t*)0x2000b780 = 0;
-  *(uint64_t*)0x2000b788 = 0;
-  *(uint64_t*)0x2000b790 = 0x7a5000;
-  *(uint64_t*)0x2000b798 = 0;
-  *(uint64_t*)0x2000b7a0 = 0;
-  *(uint64_t*)0x2000b7a8 = 0x7a6000;
-  *(uint64_t*)0x2000b7b0 = 0;
-  *(uint64_t*)0x2000b7b8 = 0;
-  *(uint64_t*)0x2000b7c0 = 0x7a7000;
-  *(uint64_t*)0x2000b7c8 = 0;
-  *(uint64_t*)0x2000b7d0 = 0;
-  *(uint64_t*)0x2000b7d8 = 0x7a8000;
-  *(uint64_t*)0x2000b7e0 = 0;
-  *(uint64_t*)0x2000b7e8 = 0;
-  *(uint64_t*)0x2000b7f0 = 0x7a9000;
-  *(uint64_t*)0x2000b7f8 = 0;
-  *(uint64_t*)0x2000b800 = 0;
-  *(uint64_t*)0x2000b808 = 0x7aa000;
-  *(uint64_t*)0x2000b810 = 0;
-  *(uint64_t*)0x2000b818 = 0;
-  *(uint64_t*)0x2000b820 = 0x7ab000;
-  *(uint64_t*)0x2000b828 = 0;
-  *(uint64_t*)0x2000b830 = 0;
-  *(uint64_t*)0x2000b838 = 0x7ac000;
-  *(uint64_t*)0x2000b840 = 0;
-  *(uint64_t*)0x2000b848 = 0;
-  *(uint64_t*)0x2000b850 = 0x7ad000;
-  *(uint64_t*)0x2000b858 = 0;
-  *(uint64_t*)0x2000b860 = 0;
-  *(uint64_t*)0x2000b868 = 0x7ae000;
-  *(uint64_t*)0x2000b870 = 0;
-  *(uint64_t*)0x2000b878 = 0;
-  *(uint64_t*)0x2000b880 = 0x7af000;
-  *(uint64_t*)0x2000b888 = 0;
-  *(uint64_t*)0x2000b890 = 0;
-  *(uint64_t*)0x2000b898 = 0x7b0000;
-  *(uint64_t*)0x2000b8a0 = 0;
-  *(uint64_t*)0x2000b8a8 = 0;
-  *(uint64_t*)0x2000b8b0 = 0x7b1000;
-  *(uint64_t*)0x2000b8b8 = 0;
-  *(uint64_t*)0x2000b8c0 = 0;
-  *(uint64_t*)0x2000b8c8 = 0x7b2000;
-  *(uint64_t*)0x2000b8d0 = 0;
-  *(uint64_t*)0x2000b8d8 = 0;
-  *(uint64_t*)0x2000b8e0 = 0x7b3000;
-  *(uint64_t*)0x2000b8e8 = 0;
-  *(uint64_t*)0x2000b8f0 = 0;
-  *(uint64_t*)0x2000b8f8 = 0x7b4000;
-  *(uint64_t*)0x2000b900 = 0;
-  *(uint64_t*)0x2000b908 = 0;
-  *(uint64_t*)0x2000b910 = 0x7b5000;
-  *(uint64_t*)0x2000b918 = 0;
-  *(uint64_t*)0x2000b920 = 0;
-  *(uint64_t*)0x2000b928 = 0x7b6000;
-  *(uint64_t*)0x2000b930 = 0;
-  *(uint64_t*)0x2000b938 = 0;
-  *(uint64_t*)0x2000b940 = 0x7b7000;
-  *(uint64_t*)0x2000b948 = 0;
-  *(uint64_t*)0x2000b950 = 0;
-  *(uint64_t*)0x2000b958 = 0x7b8000;
-  *(uint64_t*)0x2000b960 = 0;
-  *(uint64_t*)0x2000b968 = 0;
-  *(uint64_t*)0x2000b970 = 0x7b9000;
-  *(uint64_t*)0x2000b978 = 0;
-  *(uint64_t*)0x2000b980 = 0;
-  *(uint64_t*)0x2000b988 = 0x7ba000;
-  *(uint64_t*)0x2000b990 = 0;
-  *(uint64_t*)0x2000b998 = 0;
-  *(uint64_t*)0x2000b9a0 = 0x7bb000;
-  *(uint64_t*)0x2000b9a8 = 0;
-  *(uint64_t*)0x2000b9b0 = 0;
-  *(uint64_t*)0x2000b9b8 = 0x7bc000;
-  *(uint64_t*)0x2000b9c0 = 0;
-  *(uint64_t*)0x2000b9c8 = 0;
-  *(uint64_t*)0x2000b9d0 = 0x7bd000;
-  *(uint64_t*)0x2000b9d8 = 0;
-  *(uint64_t*)0x2000b9e0 = 0;
-  *(uint64_t*)0x2000b9e8 = 0x7be000;
-  *(uint64_t*)0x2000b9f0 = 0;
-  *(uint64_t*)0x2000b9f8 = 0;
-  *(uint64_t*)0x2000ba00 = 0x7bf000;
-  *(uint64_t*)0x2000ba08 = 0;
-  *(uint64_t*)0x2000ba10 = 0;
-  *(uint64_t*)0x2000ba18 = 0x7c0000;
-  *(uint64_t*)0x2000ba20 = 0;
-  *(uint64_t*)0x2000ba28 = 0;
-  *(uint64_t*)0x2000ba30 = 0x7c1000;
-  *(uint64_t*)0x2000ba38 = 0;
-  *(uint64_t*)0x2000ba40 = 0;
-  *(uint64_t*)0x2000ba48 = 0x7c2000;
-  *(uint64_t*)0x2000ba50 = 0;
-  *(uint64_t*)0x2000ba58 = 0;
-  *(uint64_t*)0x2000ba60 = 0x7c3000;
-  *(uint64_t*)0x2000ba68 = 0;
-  *(uint64_t*)0x2000ba70 = 0;
-  *(uint64_t*)0x2000ba78 = 0x7c4000;
-  *(uint64_t*)0x2000ba80 = 0;
-  *(uint64_t*)0x2000ba88 = 0;
-  *(uint64_t*)0x2000ba90 = 0x7c5000;
-  *(uint64_t*)0x2000ba98 = 0;
-  *(uint64_t*)0x2000baa0 = 0;
-  *(uint64_t*)0x2000baa8 = 0x7c6000;
-  *(uint64_t*)0x2000bab0 = 0;
-  *(uint64_t*)0x2000bab8 = 0;
-  *(uint64_t*)0x2000bac0 = 0x7c7000;
-  *(uint64_t*)0x2000bac8 = 0;
-  *(uint64_t*)0x2000bad0 = 0;
-  *(uint64_t*)0x2000bad8 = 0x7c8000;
-  *(uint64_t*)0x2000bae0 = 0;
-  *(uint64_t*)0x2000bae8 = 0;
-  *(uint64_t*)0x2000baf0 = 0x7c9000;
-  *(uint64_t*)0x2000baf8 = 0;
-  *(uint64_t*)0x2000bb00 = 0;
-  *(uint64_t*)0x2000bb08 = 0x7ca000;
-  *(uint64_t*)0x2000bb10 = 0;
-  *(uint64_t*)0x2000bb18 = 0;
-  *(uint64_t*)0x2000bb20 = 0x7cb000;
-  *(uint64_t*)0x2000bb28 = 0;
-  *(uint64_t*)0x2000bb30 = 0;
-  *(uint64_t*)0x2000bb38 = 0x7cc000;
-  *(uint64_t*)0x2000bb40 = 0;
-  *(uint64_t*)0x2000bb48 = 0;
-  *(uint64_t*)0x2000bb50 = 0x7cd000;
-  *(uint64_t*)0x2000bb58 = 0;
-  *(uint64_t*)0x2000bb60 = 0;
-  *(uint64_t*)0x2000bb68 = 0x7ce000;
-  *(uint64_t*)0x2000bb70 = 0;
-  *(uint64_t*)0x2000bb78 = 0;
-  *(uint64_t*)0x2000bb80 = 0x7cf000;
-  *(uint64_t*)0x2000bb88 = 0;
-  *(uint64_t*)0x2000bb90 = 0;
-  *(uint64_t*)0x2000bb98 = 0x7d0000;
-  *(uint64_t*)0x2000bba0 = 0;
-  *(uint64_t*)0x2000bba8 = 0;
-  *(uint64_t*)0x2000bbb0 = 0x7d1000;
-  *(uint64_t*)0x2000bbb8 = 0;
-  *(uint64_t*)0x2000bbc0 = 0;
-  *(uint64_t*)0x2000bbc8 = 0x7d2000;
-  *(uint64_t*)0x2000bbd0 = 0;
-  *(uint64_t*)0x2000bbd8 = 0;
-  *(uint64_t*)0x2000bbe0 = 0x7d3000;
-  *(uint64_t*)0x2000bbe8 = 0;
-  *(uint64_t*)0x2000bbf0 = 0;
-  *(uint64_t*)0x2000bbf8 = 0x7d4000;
-  *(uint64_t*)0x2000bc00 = 0;
-  *(uint64_t*)0x2000bc08 = 0;
-  *(uint64_t*)0x2000bc10 = 0x7d5000;
-  *(uint64_t*)0x2000bc18 = 0;
-  *(uint64_t*)0x2000bc20 = 0;
-  *(uint64_t*)0x2000bc28 = 0x7d6000;
-  *(uint64_t*)0x2000bc30 = 0;
-  *(uint64_t*)0x2000bc38 = 0;
-  *(uint64_t*)0x2000bc40 = 0x7d7000;
-  *(uint64_t*)0x2000bc48 = 0;
-  *(uint64_t*)0x2000bc50 = 0;
-  *(uint64_t*)0x2000bc58 = 0x7d8000;
-  *(uint64_t*)0x2000bc60 = 0;
-  *(uint64_t*)0x2000bc68 = 0;
-  *(uint64_t*)0x2000bc70 = 0x7d9000;
-  *(uint64_t*)0x2000bc78 = 0;
-  *(uint64_t*)0x2000bc80 = 0;
-  *(uint64_t*)0x2000bc88 = 0x7da000;
-  *(uint64_t*)0x2000bc90 = 0;
-  *(uint64_t*)0x2000bc98 = 0;
-  *(uint64_t*)0x2000bca0 = 0x7db000;
-  *(uint64_t*)0x2000bca8 = 0;
-  *(uint64_t*)0x2000bcb0 = 0;
-  *(uint64_t*)0x2000bcb8 = 0x7dc000;
-  *(uint64_t*)0x2000bcc0 = 0;
-  *(uint64_t*)0x2000bcc8 = 0;
-  *(uint64_t*)0x2000bcd0 = 0x7dd000;
-  *(uint64_t*)0x2000bcd8 = 0;
-  *(uint64_t*)0x2000bce0 = 0;
-  *(uint64_t*)0x2000bce8 = 0x7de000;
-  *(uint64_t*)0x2000bcf0 = 0;
-  *(uint64_t*)0x2000bcf8 = 0;
-  *(uint64_t*)0x2000bd00 = 0x7df000;
-  *(uint64_t*)0x2000bd08 = 0;
-  *(uint64_t*)0x2000bd10 = 0;
-  *(uint64_t*)0x2000bd18 = 0x7e0000;
-  *(uint64_t*)0x2000bd20 = 0;
-  *(uint64_t*)0x2000bd28 = 0;
-  *(uint64_t*)0x2000bd30 = 0x7e1000;
-  *(uint64_t*)0x2000bd38 = 0;
-  *(uint64_t*)0x2000bd40 = 0;
-  *(uint64_t*)0x2000bd48 = 0x7e2000;
-  *(uint64_t*)0x2000bd50 = 0;
-  *(uint64_t*)0x2000bd58 = 0;
-  *(uint64_t*)0x2000bd60 = 0x7e3000;
-  *(uint64_t*)0x2000bd68 = 0;
-  *(uint64_t*)0x2000bd70 = 0;
-  *(uint64_t*)0x2000bd78 = 0x7e4000;
-  *(uint64_t*)0x2000bd80 = 0;
-  *(uint64_t*)0x2000bd88 = 0;
-  *(uint64_t*)0x2000bd90 = 0x7e5000;
-  *(uint64_t*)0x2000bd98 = 0;
-  *(uint64_t*)0x2000bda0 = 0;
-  *(uint64_t*)0x2000bda8 = 0x7e6000;
-  *(uint64_t*)0x2000bdb0 = 0;
-  *(uint64_t*)0x2000bdb8 = 0;
-  *(uint64_t*)0x2000bdc0 = 0x7e7000;
-  *(uint64_t*)0x2000bdc8 = 0;
-  *(uint64_t*)0x2000bdd0 = 0;
-  *(uint64_t*)0x2000bdd8 = 0x7e8000;
-  *(uint64_t*)0x2000bde0 = 0;
-  *(uint64_t*)0x2000bde8 = 0;
-  *(uint64_t*)0x2000bdf0 = 0x7e9000;
-  *(uint64_t*)0x2000bdf8 = 0;
-  *(uint64_t*)0x2000be00 = 0;
-  *(uint64_t*)0x2000be08 = 0x7ea000;
-  *(uint64_t*)0x2000be10 = 0;
-  *(uint64_t*)0x2000be18 = 0;
-  *(uint64_t*)0x2000be20 = 0x7eb000;
-  *(uint64_t*)0x2000be28 = 0;
-  *(uint64_t*)0x2000be30 = 0;
-  *(uint64_t*)0x2000be38 = 0x7ec000;
-  *(uint64_t*)0x2000be40 = 0;
-  *(uint64_t*)0x2000be48 = 0;
-  *(uint64_t*)0x2000be50 = 0x7ed000;
-  *(uint64_t*)0x2000be58 = 0;
-  *(uint64_t*)0x2000be60 = 0;
-  *(uint64_t*)0x2000be68 = 0x7ee000;
-  *(uint64_t*)0x2000be70 = 0;
-  *(uint64_t*)0x2000be78 = 0;
-  *(uint64_t*)0x2000be80 = 0x7ef000;
-  *(uint64_t*)0x2000be88 = 0;
-  *(uint64_t*)0x2000be90 = 0;
-  *(uint64_t*)0x2000be98 = 0x7f0000;
-  *(uint64_t*)0x2000bea0 = 0;
-  *(uint64_t*)0x2000bea8 = 0;
-  *(uint64_t*)0x2000beb0 = 0x7f1000;
-  *(uint64_t*)0x2000beb8 = 0;
-  *(uint64_t*)0x2000bec0 = 0;
-  *(uint64_t*)0x2000bec8 = 0x7f2000;
-  *(uint64_t*)0x2000bed0 = 0;
-  *(uint64_t*)0x2000bed8 = 0;
-  *(uint64_t*)0x2000bee0 = 0x7f3000;
-  *(uint64_t*)0x2000bee8 = 0;
-  *(uint64_t*)0x2000bef0 = 0;
-  *(uint64_t*)0x2000bef8 = 0x7f4000;
-  *(uint64_t*)0x2000bf00 = 0;
-  *(uint64_t*)0x2000bf08 = 0;
-  *(uint64_t*)0x2000bf10 = 0x7f5000;
-  *(uint64_t*)0x2000bf18 = 0;
-  *(uint64_t*)0x2000bf20 = 0;
-  *(uint64_t*)0x2000bf28 = 0x7f6000;
-  *(uint64_t*)0x2000bf30 = 0;
-  *(uint64_t*)0x2000bf38 = 0;
-  *(uint64_t*)0x2000bf40 = 0x7f7000;
-  *(uint64_t*)0x2000bf48 = 0;
-  *(uint64_t*)0x2000bf50 = 0;
-  *(uint64_t*)0x2000bf58 = 0x7f8000;
-  *(uint64_t*)0x2000bf60 = 0;
-  *(uint64_t*)0x2000bf68 = 0;
-  *(uint64_t*)0x2000bf70 = 0x7f9000;
-  *(uint64_t*)0x2000bf78 = 0;
-  *(uint64_t*)0x2000bf80 = 0;
-  *(uint64_t*)0x2000bf88 = 0x7fa000;
-  *(uint64_t*)0x2000bf90 = 0;
-  *(uint64_t*)0x2000bf98 = 0;
-  *(uint64_t*)0x2000bfa0 = 0x7fb000;
-  *(uint64_t*)0x2000bfa8 = 0;
-  *(uint64_t*)0x2000bfb0 = 0;
-  *(uint64_t*)0x2000bfb8 = 0x7fc000;
-  *(uint64_t*)0x2000bfc0 = 0;
-  *(uint64_t*)0x2000bfc8 = 0;
-  *(uint64_t*)0x2000bfd0 = 0x7fd000;
-  *(uint64_t*)0x2000bfd8 = 0;
-  *(uint64_t*)0x2000bfe0 = 0;
-  *(uint64_t*)0x2000bfe8 = 0x7fe000;
-  *(uint64_t*)0x2000bff0 = 0;
-  *(uint64_t*)0x2000bff8 = 0;
-  *(uint64_t*)0x2000c000 = 0x7ff000;
-  *(uint64_t*)0x2000c008 = 0;
-  *(uint64_t*)0x2000c010 = 0;
-  *(uint64_t*)0x2000c018 = 0x800000;
-  *(uint64_t*)0x2000c020 = 0;
-  *(uint64_t*)0x2000c028 = 0;
-  *(uint64_t*)0x2000c030 = 0x801000;
-  *(uint64_t*)0x2000c038 = 0;
-  *(uint64_t*)0x2000c040 = 0;
-  *(uint64_t*)0x2000c048 = 0x802000;
-  *(uint64_t*)0x2000c050 = 0;
-  *(uint64_t*)0x2000c058 = 0;
-  *(uint64_t*)0x2000c060 = 0x803000;
-  *(uint64_t*)0x2000c068 = 0;
-  *(uint64_t*)0x2000c070 = 0;
-  *(uint64_t*)0x2000c078 = 0x804000;
-  *(uint64_t*)0x2000c080 = 0;
-  *(uint64_t*)0x2000c088 = 0;
-  *(uint64_t*)0x2000c090 = 0x805000;
-  *(uint64_t*)0x2000c098 = 0;
-  *(uint64_t*)0x2000c0a0 = 0;
-  *(uint64_t*)0x2000c0a8 = 0x806000;
-  *(uint64_t*)0x2000c0b0 = 0;
-  *(uint64_t*)0x2000c0b8 = 0;
-  *(uint64_t*)0x2000c0c0 = 0x807000;
-  *(uint64_t*)0x2000c0c8 = 0;
-  *(uint64_t*)0x2000c0d0 = 0;
-  *(uint64_t*)0x2000c0d8 = 0x808000;
-  *(uint64_t*)0x2000c0e0 = 0;
-  *(uint64_t*)0x2000c0e8 = 0;
-  *(uint64_t*)0x2000c0f0 = 0x809000;
-  *(uint64_t*)0x2000c0f8 = 0;
-  *(uint64_t*)0x2000c100 = 0;
-  *(uint64_t*)0x2000c108 = 0x80a000;
-  *(uint64_t*)0x2000c110 = 0;
-  *(uint64_t*)0x2000c118 = 0;
-  *(uint64_t*)0x2000c120 = 0x80b000;
-  *(uint64_t*)0x2000c128 = 0;
-  *(uint64_t*)0x2000c130 = 0;
-  *(uint64_t*)0x2000c138 = 0x80c000;
-  *(uint64_t*)0x2000c140 = 0;
-  *(uint64_t*)0x2000c148 = 0;
-  *(uint64_t*)0x2000c150 = 0x80d000;
-  *(uint64_t*)0x2000c158 = 0;
-  *(uint64_t*)0x2000c160 = 0;
-  *(uint64_t*)0x2000c168 = 0x80e000;
-  *(uint64_t*)0x2000c170 = 0;
-  *(uint64_t*)0x2000c178 = 0;
-  *(uint64_t*)0x2000c180 = 0x80f000;
-  *(uint64_t*)0x2000c188 = 0;
-  *(uint64_t*)0x2000c190 = 0;
-  *(uint64_t*)0x2000c198 = 0x810000;
-  *(uint64_t*)0x2000c1a0 = 0;
-  *(uint64_t*)0x2000c1a8 = 0;
-  *(uint64_t*)0x2000c1b0 = 0x811000;
-  *(uint64_t*)0x2000c1b8 = 0;
-  *(uint64_t*)0x2000c1c0 = 0;
-  *(uint64_t*)0x2000c1c8 = 0x812000;
-  *(uint64_t*)0x2000c1d0 = 0;
-  *(uint64_t*)0x2000c1d8 = 0;
-  *(uint64_t*)0x2000c1e0 = 0x813000;
-  *(uint64_t*)0x2000c1e8 = 0;
-  *(uint64_t*)0x2000c1f0 = 0;
-  *(uint64_t*)0x2000c1f8 = 0x814000;
-  *(uint64_t*)0x2000c200 = 0;
-  *(uint64_t*)0x2000c208 = 0;
-  *(uint64_t*)0x2000c210 = 0x815000;
-  *(uint64_t*)0x2000c218 = 0;
-  *(uint64_t*)0x2000c220 = 0;
-  *(uint64_t*)0x2000c228 = 0x816000;
-  *(uint64_t*)0x2000c230 = 0;
-  *(uint64_t*)0x2000c238 = 0;
-  *(uint64_t*)0x2000c240 = 0x817000;
-  *(uint64_t*)0x2000c248 = 0;
-  *(uint64_t*)0x2000c250 = 0;
-  *(uint64_t*)0x2000c258 = 0x818000;
-  *(uint64_t*)0x2000c260 = 0;
-  *(uint64_t*)0x2000c268 = 0;
-  *(uint64_t*)0x2000c270 = 0x819000;
-  *(uint64_t*)0x2000c278 = 0;
-  *(uint64_t*)0x2000c280 = 0;
-  *(uint64_t*)0x2000c288 = 0x81a000;
-  *(uint64_t*)0x2000c290 = 0;
-  *(uint64_t*)0x2000c298 = 0;
-  *(uint64_t*)0x2000c2a0 = 0x81b000;
-  *(uint64_t*)0x2000c2a8 = 0;
-  *(uint64_t*)0x2000c2b0 = 0;
-  *(uint64_t*)0x2000c2b8 = 0x81b0e0;
-  *(uint64_t*)0x2000c2c0 = 0;
-  *(uint64_t*)0x2000c2c8 = 0;
-  *(uint64_t*)0x2000c2d0 = 0x81c000;
-  *(uint64_t*)0x2000c2d8 = 0;
-  *(uint64_t*)0x2000c2e0 = 0;
-  *(uint64_t*)0x2000c2e8 = 0x81c0e0;
-  *(uint64_t*)0x2000c2f0 = 0;
-  *(uint64_t*)0x2000c2f8 = 0;
-  *(uint64_t*)0x2000c300 = 0x81d000;
-  *(uint64_t*)0x2000c308 = 0;
-  *(uint64_t*)0x2000c310 = 0;
-  *(uint64_t*)0x2000c318 = 0x81d0e0;
-  *(uint64_t*)0x2000c320 = 0;
-  *(uint64_t*)0x2000c328 = 0;
-  *(uint64_t*)0x2000c330 = 0x81e000;
-  *(uint64_t*)0x2000c338 = 0;
-  *(uint64_t*)0x2000c340 = 0;
-  *(uint64_t*)0x2000c348 = 0x81f000;
-  *(uint64_t*)0x2000c350 = 0;
-  *(uint64_t*)0x2000c358 = 0;
-  *(uint64_t*)0x2000c360 = 0x820000;
-  *(uint64_t*)0x2000c368 = 0;
-  *(uint64_t*)0x2000c370 = 0;
-  *(uint64_t*)0x2000c378 = 0x8200e0;
-  *(uint64_t*)0x2000c380 = 0;
-  *(uint64_t*)0x2000c388 = 0;
-  *(uint64_t*)0x2000c390 = 0x822000;
-  *(uint64_t*)0x2000c398 = 0;
-  *(uint64_t*)0x2000c3a0 = 0;
-  *(uint64_t*)0x2000c3a8 = 0x823000;
-  *(uint64_t*)0x2000c3b0 = 0;
-  *(uint64_t*)0x2000c3b8 = 0;
-  *(uint64_t*)0x2000c3c0 = 0x824000;
-  *(uint64_t*)0x2000c3c8 = 0;
-  *(uint64_t*)0x2000c3d0 = 0;
-  *(uint64_t*)0x2000c3d8 = 0x825000;
-  *(uint64_t*)0x2000c3e0 = 0;
-  *(uint64_t*)0x2000c3e8 = 0;
-  *(uint64_t*)0x2000c3f0 = 0x826000;
-  *(uint64_t*)0x2000c3f8 = 0;
-  *(uint64_t*)0x2000c400 = 0;
-  *(uint64_t*)0x2000c408 = 0x827000;
-  *(uint64_t*)0x2000c410 = 0;
-  *(uint64_t*)0x2000c418 = 0;
-  *(uint64_t*)0x2000c420 = 0x828000;
-  *(uint64_t*)0x2000c428 = 0;
-  *(uint64_t*)0x2000c430 = 0;
-  *(uint64_t*)0x2000c438 = 0x829000;
-  *(uint64_t*)0x2000c440 = 0;
-  *(uint64_t*)0x2000c448 = 0;
-  *(uint64_t*)0x2000c450 = 0x82a000;
-  *(uint64_t*)0x2000c458 = 0;
-  *(uint64_t*)0x2000c460 = 0;
-  *(uint64_t*)0x2000c468 = 0x82b000;
-  *(uint64_t*)0x2000c470 = 0;
-  *(uint64_t*)0x2000c478 = 0;
-  *(uint64_t*)0x2000c480 = 0x82c000;
-  *(uint64_t*)0x2000c488 = 0;
-  *(uint64_t*)0x2000c490 = 0;
-  *(uint64_t*)0x2000c498 = 0x82d000;
-  *(uint64_t*)0x2000c4a0 = 0;
-  *(uint64_t*)0x2000c4a8 = 0;
-  *(uint64_t*)0x2000c4b0 = 0x82e000;
-  *(uint64_t*)0x2000c4b8 = 0;
-  *(uint64_t*)0x2000c4c0 = 0;
-  *(uint64_t*)0x2000c4c8 = 0x82f000;
-  *(uint64_t*)0x2000c4d0 = 0;
-  *(uint64_t*)0x2000c4d8 = 0;
-  *(uint64_t*)0x2000c4e0 = 0x830000;
-  *(uint64_t*)0x2000c4e8 = 0;
-  *(uint64_t*)0x2000c4f0 = 0;
-  *(uint64_t*)0x2000c4f8 = 0x831000;
-  *(uint64_t*)0x2000c500 = 0;
-  *(uint64_t*)0x2000c508 = 0;
-  *(uint64_t*)0x2000c510 = 0x832000;
-  *(uint64_t*)0x2000c518 = 0;
-  *(uint64_t*)0x2000c520 = 0;
-  *(uint64_t*)0x2000c528 = 0x833000;
-  *(uint64_t*)0x2000c530 = 0;
-  *(uint64_t*)0x2000c538 = 0;
-  *(uint64_t*)0x2000c540 = 0x834000;
-  *(uint64_t*)0x2000c548 = 0;
-  *(uint64_t*)0x2000c550 = 0;
-  *(uint64_t*)0x2000c558 = 0x835000;
-  *(uint64_t*)0x2000c560 = 0;
-  *(uint64_t*)0x2000c568 = 0;
-  *(uint64_t*)0x2000c570 = 0x836000;
-  *(uint64_t*)0x2000c578 = 0;
-  *(uint64_t*)0x2000c580 = 0;
-  *(uint64_t*)0x2000c588 = 0x837000;
-  *(uint64_t*)0x2000c590 = 0;
-  *(uint64_t*)0x2000c598 = 0;
-  *(uint64_t*)0x2000c5a0 = 0x838000;
-  *(uint64_t*)0x2000c5a8 = 0;
-  *(uint64_t*)0x2000c5b0 = 0;
-  *(uint64_t*)0x2000c5b8 = 0x839000;
-  *(uint64_t*)0x2000c5c0 = 0;
-  *(uint64_t*)0x2000c5c8 = 0;
-  *(uint64_t*)0x2000c5d0 = 0x83a000;
-  *(uint64_t*)0x2000c5d8 = 0;
-  *(uint64_t*)0x2000c5e0 = 0;
-  *(uint64_t*)0x2000c5e8 = 0x83b000;
-  *(uint64_t*)0x2000c5f0 = 0;
-  *(uint64_t*)0x2000c5f8 = 0;
-  *(uint64_t*)0x2000c600 = 0x83c000;
-  *(uint64_t*)0x2000c608 = 0;
-  *(uint64_t*)0x2000c610 = 0;
-  *(uint64_t*)0x2000c618 = 0x83d000;
-  *(uint64_t*)0x2000c620 = 0;
-  *(uint64_t*)0x2000c628 = 0;
-  *(uint64_t*)0x2000c630 = 0x83e000;
-  *(uint64_t*)0x2000c638 = 0;
-  *(uint64_t*)0x2000c640 = 0;
-  *(uint64_t*)0x2000c648 = 0x83f000;
-  *(uint64_t*)0x2000c650 = 0;
-  *(uint64_t*)0x2000c658 = 0;
-  *(uint64_t*)0x2000c660 = 0x840000;
-  *(uint64_t*)0x2000c668 = 0;
-  *(uint64_t*)0x2000c670 = 0;
-  *(uint64_t*)0x2000c678 = 0x841000;
-  *(uint64_t*)0x2000c680 = 0;
-  *(uint64_t*)0x2000c688 = 0;
-  *(uint64_t*)0x2000c690 = 0x842000;
-  *(uint64_t*)0x2000c698 = 0;
-  *(uint64_t*)0x2000c6a0 = 0;
-  *(uint64_t*)0x2000c6a8 = 0x843000;
-  *(uint64_t*)0x2000c6b0 = 0;
-  *(uint64_t*)0x2000c6b8 = 0;
-  *(uint64_t*)0x2000c6c0 = 0x844000;
-  *(uint64_t*)0x2000c6c8 = 0;
-  *(uint64_t*)0x2000c6d0 = 0;
-  *(uint64_t*)0x2000c6d8 = 0x845000;
-  *(uint64_t*)0x2000c6e0 = 0;
-  *(uint64_t*)0x2000c6e8 = 0;
-  *(uint64_t*)0x2000c6f0 = 0x846000;
-  *(uint64_t*)0x2000c6f8 = 0;
-  *(uint64_t*)0x2000c700 = 0;
-  *(uint64_t*)0x2000c708 = 0x847000;
-  *(uint64_t*)0x2000c710 = 0;
-  *(uint64_t*)0x2000c718 = 0;
-  *(uint64_t*)0x2000c720 = 0x848000;
-  *(uint64_t*)0x2000c728 = 0;
-  *(uint64_t*)0x2000c730 = 0;
-  *(uint64_t*)0x2000c738 = 0x849000;
-  *(uint64_t*)0x2000c740 = 0;
-  *(uint64_t*)0x2000c748 = 0;
-  *(uint64_t*)0x2000c750 = 0x84a000;
-  *(uint64_t*)0x2000c758 = 0;
-  *(uint64_t*)0x2000c760 = 0;
-  *(uint64_t*)0x2000c768 = 0x84b000;
-  *(uint64_t*)0x2000c770 = 0;
-  *(uint64_t*)0x2000c778 = 0;
-  *(uint64_t*)0x2000c780 = 0x84c000;
-  *(uint64_t*)0x2000c788 = 0;
-  *(uint64_t*)0x2000c790 = 0;
-  *(uint64_t*)0x2000c798 = 0x84d000;
-  *(uint64_t*)0x2000c7a0 = 0;
-  *(uint64_t*)0x2000c7a8 = 0;
-  *(uint64_t*)0x2000c7b0 = 0x84e000;
-  *(uint64_t*)0x2000c7b8 = 0;
-  *(uint64_t*)0x2000c7c0 = 0;
-  *(uint64_t*)0x2000c7c8 = 0x84f000;
-  *(uint64_t*)0x2000c7d0 = 0;
-  *(uint64_t*)0x2000c7d8 = 0;
-  *(uint64_t*)0x2000c7e0 = 0x850000;
-  *(uint64_t*)0x2000c7e8 = 0;
-  *(uint64_t*)0x2000c7f0 = 0;
-  *(uint64_t*)0x2000c7f8 = 0x851000;
-  *(uint64_t*)0x2000c800 = 0;
-  *(uint64_t*)0x2000c808 = 0;
-  *(uint64_t*)0x2000c810 = 0x852000;
-  *(uint64_t*)0x2000c818 = 0;
-  *(uint64_t*)0x2000c820 = 0;
-  *(uint64_t*)0x2000c828 = 0x853000;
-  *(uint64_t*)0x2000c830 = 0;
-  *(uint64_t*)0x2000c838 = 0;
-  *(uint64_t*)0x2000c840 = 0x854000;
-  *(uint64_t*)0x2000c848 = 0;
-  *(uint64_t*)0x2000c850 = 0;
-  *(uint64_t*)0x2000c858 = 0x855000;
-  *(uint64_t*)0x2000c860 = 0;
-  *(uint64_t*)0x2000c868 = 0;
-  *(uint64_t*)0x2000c870 = 0x856000;
-  *(uint64_t*)0x2000c878 = 0;
-  *(uint64_t*)0x2000c880 = 0;
-  *(uint64_t*)0x2000c888 = 0x857000;
-  *(uint64_t*)0x2000c890 = 0;
-  *(uint64_t*)0x2000c898 = 0;
-  *(uint64_t*)0x2000c8a0 = 0x858000;
-  *(uint64_t*)0x2000c8a8 = 0;
-  *(uint64_t*)0x2000c8b0 = 0;
-  *(uint64_t*)0x2000c8b8 = 0x859000;
-  *(uint64_t*)0x2000c8c0 = 0;
-  *(uint64_t*)0x2000c8c8 = 0;
-  *(uint64_t*)0x2000c8d0 = 0x85a000;
-  *(uint64_t*)0x2000c8d8 = 0;
-  *(uint64_t*)0x2000c8e0 = 0;
-  *(uint64_t*)0x2000c8e8 = 0x85b000;
-  *(uint64_t*)0x2000c8f0 = 0;
-  *(uint64_t*)0x2000c8f8 = 0;
-  *(uint64_t*)0x2000c900 = 0x85c000;
-  *(uint64_t*)0x2000c908 = 0;
-  *(uint64_t*)0x2000c910 = 0;
-  *(uint64_t*)0x2000c918 = 0x85d000;
-  *(uint64_t*)0x2000c920 = 0;
-  *(uint64_t*)0x2000c928 = 0;
-  *(uint64_t*)0x2000c930 = 0x85e000;
-  *(uint64_t*)0x2000c938 = 0;
-  *(uint64_t*)0x2000c940 = 0;
-  *(uint64_t*)0x2000c948 = 0x85f000;
-  *(uint64_t*)0x2000c950 = 0;
-  *(uint64_t*)0x2000c958 = 0;
-  *(uint64_t*)0x2000c960 = 0x860000;
-  *(uint64_t*)0x2000c968 = 0;
-  *(uint64_t*)0x2000c970 = 0;
-  *(uint64_t*)0x2000c978 = 0x861000;
-  *(uint64_t*)0x2000c980 = 0;
-  *(uint64_t*)0x2000c988 = 0;
-  *(uint64_t*)0x2000c990 = 0x862000;
-  *(uint64_t*)0x2000c998 = 0;
-  *(uint64_t*)0x2000c9a0 = 0;
-  *(uint64_t*)0x2000c9a8 = 0x863000;
-  *(uint64_t*)0x2000c9b0 = 0;
-  *(uint64_t*)0x2000c9b8 = 0;
-  *(uint64_t*)0x2000c9c0 = 0x864000;
-  *(uint64_t*)0x2000c9c8 = 0;
-  *(uint64_t*)0x2000c9d0 = 0;
-  *(uint64_t*)0x2000c9d8 = 0x865000;
-  *(uint64_t*)0x2000c9e0 = 0;
-  *(uint64_t*)0x2000c9e8 = 0;
-  *(uint64_t*)0x2000c9f0 = 0x866000;
-  *(uint64_t*)0x2000c9f8 = 0;
-  *(uint64_t*)0x2000ca00 = 0;
-  *(uint64_t*)0x2000ca08 = 0x867000;
-  *(uint64_t*)0x2000ca10 = 0;
-  *(uint64_t*)0x2000ca18 = 0;
-  *(uint64_t*)0x2000ca20 = 0x868000;
-  *(uint64_t*)0x2000ca28 = 0;
-  *(uint64_t*)0x2000ca30 = 0;
-  *(uint64_t*)0x2000ca38 = 0x869000;
-  *(uint64_t*)0x2000ca40 = 0;
-  *(uint64_t*)0x2000ca48 = 0;
-  *(uint64_t*)0x2000ca50 = 0x86a000;
-  *(uint64_t*)0x2000ca58 = 0;
-  *(uint64_t*)0x2000ca60 = 0;
-  *(uint64_t*)0x2000ca68 = 0x86b000;
-  *(uint64_t*)0x2000ca70 = 0;
-  *(uint64_t*)0x2000ca78 = 0;
-  *(uint64_t*)0x2000ca80 = 0x86c000;
-  *(uint64_t*)0x2000ca88 = 0;
-  *(uint64_t*)0x2000ca90 = 0;
-  *(uint64_t*)0x2000ca98 = 0x86d000;
-  *(uint64_t*)0x2000caa0 = 0;
-  *(uint64_t*)0x2000caa8 = 0;
-  *(uint64_t*)0x2000cab0 = 0x86e000;
-  *(uint64_t*)0x2000cab8 = 0;
-  *(uint64_t*)0x2000cac0 = 0;
-  *(uint64_t*)0x2000cac8 = 0x86f000;
-  *(uint64_t*)0x2000cad0 = 0;
-  *(uint64_t*)0x2000cad8 = 0;
-  *(uint64_t*)0x2000cae0 = 0x870000;
-  *(uint64_t*)0x2000cae8 = 0;
-  *(uint64_t*)0x2000caf0 = 0;
-  *(uint64_t*)0x2000caf8 = 0x871000;
-  *(uint64_t*)0x2000cb00 = 0;
-  *(uint64_t*)0x2000cb08 = 0;
-  *(uint64_t*)0x2000cb10 = 0x872000;
-  *(uint64_t*)0x2000cb18 = 0;
-  *(uint64_t*)0x2000cb20 = 0;
-  *(uint64_t*)0x2000cb28 = 0x873000;
-  *(uint64_t*)0x2000cb30 = 0;
-  *(uint64_t*)0x2000cb38 = 0;
-  *(uint64_t*)0x2000cb40 = 0x874000;
-  *(uint64_t*)0x2000cb48 = 0;
-  *(uint64_t*)0x2000cb50 = 0;
-  *(uint64_t*)0x2000cb58 = 0x875000;
-  *(uint64_t*)0x2000cb60 = 0;
-  *(uint64_t*)0x2000cb68 = 0;
-  *(uint64_t*)0x2000cb70 = 0x876000;
-  *(uint64_t*)0x2000cb78 = 0;
-  *(uint64_t*)0x2000cb80 = 0;
-  *(uint64_t*)0x2000cb88 = 0x877000;
-  *(uint64_t*)0x2000cb90 = 0;
-  *(uint64_t*)0x2000cb98 = 0;
-  *(uint64_t*)0x2000cba0 = 0x878000;
-  *(uint64_t*)0x2000cba8 = 0;
-  *(uint64_t*)0x2000cbb0 = 0;
-  *(uint64_t*)0x2000cbb8 = 0x879000;
-  *(uint64_t*)0x2000cbc0 = 0;
-  *(uint64_t*)0x2000cbc8 = 0;
-  *(uint64_t*)0x2000cbd0 = 0x87a000;
-  *(uint64_t*)0x2000cbd8 = 0;
-  *(uint64_t*)0x2000cbe0 = 0;
-  *(uint64_t*)0x2000cbe8 = 0x87b000;
-  *(uint64_t*)0x2000cbf0 = 0;
-  *(uint64_t*)0x2000cbf8 = 0;
-  *(uint64_t*)0x2000cc00 = 0x87c000;
-  *(uint64_t*)0x2000cc08 = 0;
-  *(uint64_t*)0x2000cc10 = 0;
-  *(uint64_t*)0x2000cc18 = 0x87d000;
-  *(uint64_t*)0x2000cc20 = 0;
-  *(uint64_t*)0x2000cc28 = 0;
-  *(uint64_t*)0x2000cc30 = 0x87e000;
-  *(uint64_t*)0x2000cc38 = 0;
-  *(uint64_t*)0x2000cc40 = 0;
-  *(uint64_t*)0x2000cc48 = 0x87f000;
-  *(uint64_t*)0x2000cc50 = 0;
-  *(uint64_t*)0x2000cc58 = 0;
-  *(uint64_t*)0x2000cc60 = 0x880000;
-  *(uint64_t*)0x2000cc68 = 0;
-  *(uint64_t*)0x2000cc70 = 0;
-  *(uint64_t*)0x2000cc78 = 0x881000;
-  *(uint64_t*)0x2000cc80 = 0;
-  *(uint64_t*)0x2000cc88 = 0;
-  *(uint64_t*)0x2000cc90 = 0x882000;
-  *(uint64_t*)0x2000cc98 = 0;
-  *(uint64_t*)0x2000cca0 = 0;
-  *(uint64_t*)0x2000cca8 = 0x883000;
-  *(uint64_t*)0x2000ccb0 = 0;
-  *(uint64_t*)0x2000ccb8 = 0;
-  *(uint64_t*)0x2000ccc0 = 0x884000;
-  *(uint64_t*)0x2000ccc8 = 0;
-  *(uint64_t*)0x2000ccd0 = 0;
-  *(uint64_t*)0x2000ccd8 = 0x885000;
-  *(uint64_t*)0x2000cce0 = 0;
-  *(uint64_t*)0x2000cce8 = 0;
-  *(uint64_t*)0x2000ccf0 = 0x886000;
-  *(uint64_t*)0x2000ccf8 = 0;
-  *(uint64_t*)0x2000cd00 = 0;
-  *(uint64_t*)0x2000cd08 = 0x887000;
-  *(uint64_t*)0x2000cd10 = 0;
-  *(uint64_t*)0x2000cd18 = 0;
-  *(uint64_t*)0x2000cd20 = 0x888000;
-  *(uint64_t*)0x2000cd28 = 0;
-  *(uint64_t*)0x2000cd30 = 0;
-  *(uint64_t*)0x2000cd38 = 0x889000;
-  *(uint64_t*)0x2000cd40 = 0;
-  *(uint64_t*)0x2000cd48 = 0;
-  *(uint64_t*)0x2000cd50 = 0x88a000;
-  *(uint64_t*)0x2000cd58 = 0;
-  *(uint64_t*)0x2000cd60 = 0;
-  *(uint64_t*)0x2000cd68 = 0x88b000;
-  *(uint64_t*)0x2000cd70 = 0;
-  *(uint64_t*)0x2000cd78 = 0;
-  *(uint64_t*)0x2000cd80 = 0x88c000;
-  *(uint64_t*)0x2000cd88 = 0;
-  *(uint64_t*)0x2000cd90 = 0;
-  *(uint64_t*)0x2000cd98 = 0x88d000;
-  *(uint64_t*)0x2000cda0 = 0;
-  *(uint64_t*)0x2000cda8 = 0;
-  *(uint64_t*)0x2000cdb0 = 0x88e000;
-  *(uint64_t*)0x2000cdb8 = 0;
-  *(uint64_t*)0x2000cdc0 = 0;
-  *(uint64_t*)0x2000cdc8 = 0x88f000;
-  *(uint64_t*)0x2000cdd0 = 0;
-  *(uint64_t*)0x2000cdd8 = 0;
-  *(uint64_t*)0x2000cde0 = 0x890000;
-  *(uint64_t*)0x2000cde8 = 0;
-  *(uint64_t*)0x2000cdf0 = 0;
-  *(uint64_t*)0x2000cdf8 = 0x891000;
-  *(uint64_t*)0x2000ce00 = 0;
-  *(uint64_t*)0x2000ce08 = 0;
-  *(uint64_t*)0x2000ce10 = 0x892000;
-  *(uint64_t*)0x2000ce18 = 0;
-  *(uint64_t*)0x2000ce20 = 0;
-  *(uint64_t*)0x2000ce28 = 0x893000;
-  *(uint64_t*)0x2000ce30 = 0;
-  *(uint64_t*)0x2000ce38 = 0;
-  *(uint64_t*)0x2000ce40 = 0x894000;
-  *(uint64_t*)0x2000ce48 = 0;
-  *(uint64_t*)0x2000ce50 = 0;
-  *(uint64_t*)0x2000ce58 = 0x895000;
-  *(uint64_t*)0x2000ce60 = 0;
-  *(uint64_t*)0x2000ce68 = 0;
-  *(uint64_t*)0x2000ce70 = 0x896000;
-  *(uint64_t*)0x2000ce78 = 0;
-  *(uint64_t*)0x2000ce80 = 0;
-  *(uint64_t*)0x2000ce88 = 0x897000;
-  *(uint64_t*)0x2000ce90 = 0;
-  *(uint64_t*)0x2000ce98 = 0;
-  *(uint64_t*)0x2000cea0 = 0x898000;
-  *(uint64_t*)0x2000cea8 = 0;
-  *(uint64_t*)0x2000ceb0 = 0;
-  *(uint64_t*)0x2000ceb8 = 0x899000;
-  *(uint64_t*)0x2000cec0 = 0;
-  *(uint64_t*)0x2000cec8 = 0;
-  *(uint64_t*)0x2000ced0 = 0x89a000;
-  *(uint64_t*)0x2000ced8 = 0;
-  *(uint64_t*)0x2000cee0 = 0;
-  *(uint64_t*)0x2000cee8 = 0x89b000;
-  *(uint64_t*)0x2000cef0 = 0;
-  *(uint64_t*)0x2000cef8 = 0;
-  *(uint64_t*)0x2000cf00 = 0x89c000;
-  *(uint64_t*)0x2000cf08 = 0;
-  *(uint64_t*)0x2000cf10 = 0;
-  *(uint64_t*)0x2000cf18 = 0x89d000;
-  *(uint64_t*)0x2000cf20 = 0;
-  *(uint64_t*)0x2000cf28 = 0;
-  *(uint64_t*)0x2000cf30 = 0x89e000;
-  *(uint64_t*)0x2000cf38 = 0;
-  *(uint64_t*)0x2000cf40 = 0;
-  *(uint64_t*)0x2000cf48 = 0x89f000;
-  *(uint64_t*)0x2000cf50 = 0;
-  *(uint64_t*)0x2000cf58 = 0;
-  *(uint64_t*)0x2000cf60 = 0x8a0000;
-  *(uint64_t*)0x2000cf68 = 0;
-  *(uint64_t*)0x2000cf70 = 0;
-  *(uint64_t*)0x2000cf78 = 0x8a1000;
-  *(uint64_t*)0x2000cf80 = 0;
-  *(uint64_t*)0x2000cf88 = 0;
-  *(uint64_t*)0x2000cf90 = 0x8a2000;
-  *(uint64_t*)0x2000cf98 = 0;
-  *(uint64_t*)0x2000cfa0 = 0;
-  *(uint64_t*)0x2000cfa8 = 0x8a3000;
-  *(uint64_t*)0x2000cfb0 = 0;
-  *(uint64_t*)0x2000cfb8 = 0;
-  *(uint64_t*)0x2000cfc0 = 0x8a4000;
-  *(uint64_t*)0x2000cfc8 = 0;
-  *(uint64_t*)0x2000cfd0 = 0;
-  *(uint64_t*)0x2000cfd8 = 0x8a5000;
-  *(uint64_t*)0x2000cfe0 = 0;
-  *(uint64_t*)0x2000cfe8 = 0;
-  *(uint64_t*)0x2000cff0 = 0x8a6000;
-  *(uint64_t*)0x2000cff8 = 0;
-  *(uint64_t*)0x2000d000 = 0;
-  *(uint64_t*)0x2000d008 = 0x8a7000;
-  *(uint64_t*)0x2000d010 = 0;
-  *(uint64_t*)0x2000d018 = 0;
-  *(uint64_t*)0x2000d020 = 0x8a8000;
-  *(uint64_t*)0x2000d028 = 0;
-  *(uint64_t*)0x2000d030 = 0;
-  *(uint64_t*)0x2000d038 = 0x8a9000;
-  *(uint64_t*)0x2000d040 = 0;
-  *(uint64_t*)0x2000d048 = 0;
-  *(uint64_t*)0x2000d050 = 0x8aa000;
-  *(uint64_t*)0x2000d058 = 0;
-  *(uint64_t*)0x2000d060 = 0;
-  *(uint64_t*)0x2000d068 = 0x8ab000;
-  *(uint64_t*)0x2000d070 = 0;
-  *(uint64_t*)0x2000d078 = 0;
-  *(uint64_t*)0x2000d080 = 0x8ac000;
-  *(uint64_t*)0x2000d088 = 0;
-  *(uint64_t*)0x2000d090 = 0;
-  *(uint64_t*)0x2000d098 = 0x8ad000;
-  *(uint64_t*)0x2000d0a0 = 0;
-  *(uint64_t*)0x2000d0a8 = 0;
-  *(uint64_t*)0x2000d0b0 = 0x8ae000;
-  *(uint64_t*)0x2000d0b8 = 0;
-  *(uint64_t*)0x2000d0c0 = 0;
-  *(uint64_t*)0x2000d0c8 = 0x8af000;
-  *(uint64_t*)0x2000d0d0 = 0;
-  *(uint64_t*)0x2000d0d8 = 0;
-  *(uint64_t*)0x2000d0e0 = 0x8b0000;
-  *(uint64_t*)0x2000d0e8 = 0;
-  *(uint64_t*)0x2000d0f0 = 0;
-  *(uint64_t*)0x2000d0f8 = 0x8b1000;
-  *(uint64_t*)0x2000d100 = 0;
-  *(uint64_t*)0x2000d108 = 0;
-  *(uint64_t*)0x2000d110 = 0x8b2000;
-  *(uint64_t*)0x2000d118 = 0;
-  *(uint64_t*)0x2000d120 = 0;
-  *(uint64_t*)0x2000d128 = 0x8b3000;
-  *(uint64_t*)0x2000d130 = 0;
-  *(uint64_t*)0x2000d138 = 0;
-  *(uint64_t*)0x2000d140 = 0x8b4000;
-  *(uint64_t*)0x2000d148 = 0;
-  *(uint64_t*)0x2000d150 = 0;
-  *(uint64_t*)0x2000d158 = 0x8b5000;
-  *(uint64_t*)0x2000d160 = 0;
-  *(uint64_t*)0x2000d168 = 0;
-  *(uint64_t*)0x2000d170 = 0x8b6000;
-  *(uint64_t*)0x2000d178 = 0;
-  *(uint64_t*)0x2000d180 = 0;
-  *(uint64_t*)0x2000d188 = 0x8b7000;
-  *(uint64_t*)0x2000d190 = 0;
-  *(uint64_t*)0x2000d198 = 0;
-  *(uint64_t*)0x2000d1a0 = 0x8b8000;
-  *(uint64_t*)0x2000d1a8 = 0;
-  *(uint64_t*)0x2000d1b0 = 0;
-  *(uint64_t*)0x2000d1b8 = 0x8b9000;
-  *(uint64_t*)0x2000d1c0 = 0;
-  *(uint64_t*)0x2000d1c8 = 0;
-  *(uint64_t*)0x2000d1d0 = 0x8ba000;
-  *(uint64_t*)0x2000d1d8 = 0;
-  *(uint64_t*)0x2000d1e0 = 0;
-  *(uint64_t*)0x2000d1e8 = 0x8bb000;
-  *(uint64_t*)0x2000d1f0 = 0;
-  *(uint64_t*)0x2000d1f8 = 0;
-  *(uint64_t*)0x2000d200 = 0x8bc000;
-  *(uint64_t*)0x2000d208 = 0;
-  *(uint64_t*)0x2000d210 = 0;
-  *(uint64_t*)0x2000d218 = 0x8bd000;
-  *(uint64_t*)0x2000d220 = 0;
-  *(uint64_t*)0x2000d228 = 0;
-  *(uint64_t*)0x2000d230 = 0x8be000;
-  *(uint64_t*)0x2000d238 = 0;
-  *(uint64_t*)0x2000d240 = 0;
-  *(uint64_t*)0x2000d248 = 0x8bf000;
-  *(uint64_t*)0x2000d250 = 0;
-  *(uint64_t*)0x2000d258 = 0;
-  *(uint64_t*)0x2000d260 = 0x8c0000;
-  *(uint64_t*)0x2000d268 = 0;
-  *(uint64_t*)0x2000d270 = 0;
-  *(uint64_t*)0x2000d278 = 0x8c1000;
-  *(uint64_t*)0x2000d280 = 0;
-  *(uint64_t*)0x2000d288 = 0;
-  *(uint64_t*)0x2000d290 = 0x8c2000;
-  *(uint64_t*)0x2000d298 = 0;
-  *(uint64_t*)0x2000d2a0 = 0;
-  *(uint64_t*)0x2000d2a8 = 0x8c3000;
-  *(uint64_t*)0x2000d2b0 = 0;
-  *(uint64_t*)0x2000d2b8 = 0;
-  *(uint64_t*)0x2000d2c0 = 0x8c4000;
-  *(uint64_t*)0x2000d2c8 = 0;
-  *(uint64_t*)0x2000d2d0 = 0;
-  *(uint64_t*)0x2000d2d8 = 0x8c5000;
-  *(uint64_t*)0x2000d2e0 = 0;
-  *(uint64_t*)0x2000d2e8 = 0;
-  *(uint64_t*)0x2000d2f0 = 0x8c6000;
-  *(uint64_t*)0x2000d2f8 = 0;
-  *(uint64_t*)0x2000d300 = 0;
-  *(uint64_t*)0x2000d308 = 0x8c7000;
-  *(uint64_t*)0x2000d310 = 0;
-  *(uint64_t*)0x2000d318 = 0;
-  *(uint64_t*)0x2000d320 = 0x8c8000;
-  *(uint64_t*)0x2000d328 = 0;
-  *(uint64_t*)0x2000d330 = 0;
-  *(uint64_t*)0x2000d338 = 0x8c9000;
-  *(uint64_t*)0x2000d340 = 0;
-  *(uint64_t*)0x2000d348 = 0;
-  *(uint64_t*)0x2000d350 = 0x8ca000;
-  *(uint64_t*)0x2000d358 = 0;
-  *(uint64_t*)0x2000d360 = 0;
-  *(uint64_t*)0x2000d368 = 0x8cb000;
-  *(uint64_t*)0x2000d370 = 0;
-  *(uint64_t*)0x2000d378 = 0;
-  *(uint64_t*)0x2000d380 = 0x8cc000;
-  *(uint64_t*)0x2000d388 = 0;
-  *(uint64_t*)0x2000d390 = 0;
-  *(uint64_t*)0x2000d398 = 0x8cd000;
-  *(uint64_t*)0x2000d3a0 = 0;
-  *(uint64_t*)0x2000d3a8 = 0;
-  *(uint64_t*)0x2000d3b0 = 0x8ce000;
-  *(uint64_t*)0x2000d3b8 = 0;
-  *(uint64_t*)0x2000d3c0 = 0;
-  *(uint64_t*)0x2000d3c8 = 0x8cf000;
-  *(uint64_t*)0x2000d3d0 = 0;
-  *(uint64_t*)0x2000d3d8 = 0;
-  *(uint64_t*)0x2000d3e0 = 0x8d0000;
-  *(uint64_t*)0x2000d3e8 = 0;
-  *(uint64_t*)0x2000d3f0 = 0;
-  *(uint64_t*)0x2000d3f8 = 0x8d1000;
-  *(uint64_t*)0x2000d400 = 0;
-  *(uint64_t*)0x2000d408 = 0;
-  *(uint64_t*)0x2000d410 = 0x8d2000;
-  *(uint64_t*)0x2000d418 = 0;
-  *(uint64_t*)0x2000d420 = 0;
-  *(uint64_t*)0x2000d428 = 0x8d3000;
-  *(uint64_t*)0x2000d430 = 0;
-  *(uint64_t*)0x2000d438 = 0;
-  *(uint64_t*)0x2000d440 = 0x8d4000;
-  *(uint64_t*)0x2000d448 = 0;
-  *(uint64_t*)0x2000d450 = 0;
-  *(uint64_t*)0x2000d458 = 0x8d5000;
-  *(uint64_t*)0x2000d460 = 0;
-  *(uint64_t*)0x2000d468 = 0;
-  *(uint64_t*)0x2000d470 = 0x8d6000;
-  *(uint64_t*)0x2000d478 = 0;
-  *(uint64_t*)0x2000d480 = 0;
-  *(uint64_t*)0x2000d488 = 0x8d7000;
-  *(uint64_t*)0x2000d490 = 0;
-  *(uint64_t*)0x2000d498 = 0;
-  *(uint64_t*)0x2000d4a0 = 0x8d8000;
-  *(uint64_t*)0x2000d4a8 = 0;
-  *(uint64_t*)0x2000d4b0 = 0;
-  *(uint64_t*)0x2000d4b8 = 0x8d9000;
-  *(uint64_t*)0x2000d4c0 = 0;
-  *(uint64_t*)0x2000d4c8 = 0;
-  *(uint64_t*)0x2000d4d0 = 0x8da000;
-  *(uint64_t*)0x2000d4d8 = 0;
-  *(uint64_t*)0x2000d4e0 = 0;
-  *(uint64_t*)0x2000d4e8 = 0x8db000;
-  *(uint64_t*)0x2000d4f0 = 0;
-  *(uint64_t*)0x2000d4f8 = 0;
-  *(uint64_t*)0x2000d500 = 0x8dc000;
-  *(uint64_t*)0x2000d508 = 0;
-  *(uint64_t*)0x2000d510 = 0;
-  *(uint64_t*)0x2000d518 = 0x8dd000;
-  *(uint64_t*)0x2000d520 = 0;
-  *(uint64_t*)0x2000d528 = 0;
-  *(uint64_t*)0x2000d530 = 0x8de000;
-  *(uint64_t*)0x2000d538 = 0;
-  *(uint64_t*)0x2000d540 = 0;
-  *(uint64_t*)0x2000d548 = 0x8df000;
-  *(uint64_t*)0x2000d550 = 0;
-  *(uint64_t*)0x2000d558 = 0;
-  *(uint64_t*)0x2000d560 = 0x8e0000;
-  *(uint64_t*)0x2000d568 = 0;
-  *(uint64_t*)0x2000d570 = 0;
-  *(uint64_t*)0x2000d578 = 0x8e1000;
-  *(uint64_t*)0x2000d580 = 0;
-  *(uint64_t*)0x2000d588 = 0;
-  *(uint64_t*)0x2000d590 = 0x8e2000;
-  *(uint64_t*)0x2000d598 = 0;
-  *(uint64_t*)0x2000d5a0 = 0;
-  *(uint64_t*)0x2000d5a8 = 0x8e3000;
-  *(uint64_t*)0x2000d5b0 = 0;
-  *(uint64_t*)0x2000d5b8 = 0;
-  *(uint64_t*)0x2000d5c0 = 0x8e4000;
-  *(uint64_t*)0x2000d5c8 = 0;
-  *(uint64_t*)0x2000d5d0 = 0;
-  *(uint64_t*)0x2000d5d8 = 0x8e5000;
-  *(uint64_t*)0x2000d5e0 = 0;
-  *(uint64_t*)0x2000d5e8 = 0;
-  *(uint64_t*)0x2000d5f0 = 0x8e6000;
-  *(uint64_t*)0x2000d5f8 = 0;
-  *(uint64_t*)0x2000d600 = 0;
-  *(uint64_t*)0x2000d608 = 0x8e7000;
-  *(uint64_t*)0x2000d610 = 0;
-  *(uint64_t*)0x2000d618 = 0;
-  *(uint64_t*)0x2000d620 = 0x8e8000;
-  *(uint64_t*)0x2000d628 = 0;
-  *(uint64_t*)0x2000d630 = 0;
-  *(uint64_t*)0x2000d638 = 0x8e9000;
-  *(uint64_t*)0x2000d640 = 0;
-  *(uint64_t*)0x2000d648 = 0;
-  *(uint64_t*)0x2000d650 = 0x8ea000;
-  *(uint64_t*)0x2000d658 = 0;
-  *(uint64_t*)0x2000d660 = 0;
-  *(uint64_t*)0x2000d668 = 0x8eb000;
-  *(uint64_t*)0x2000d670 = 0;
-  *(uint64_t*)0x2000d678 = 0;
-  *(uint64_t*)0x2000d680 = 0x8ec000;
-  *(uint64_t*)0x2000d688 = 0;
-  *(uint64_t*)0x2000d690 = 0;
-  *(uint64_t*)0x2000d698 = 0x8ed000;
-  *(uint64_t*)0x2000d6a0 = 0;
-  *(uint64_t*)0x2000d6a8 = 0;
-  *(uint64_t*)0x2000d6b0 = 0x8ee000;
-  *(uint64_t*)0x2000d6b8 = 0;
-  *(uint64_t*)0x2000d6c0 = 0;
-  *(uint64_t*)0x2000d6c8 = 0x8ef000;
-  *(uint64_t*)0x2000d6d0 = 0;
-  *(uint64_t*)0x2000d6d8 = 0;
-  *(uint64_t*)0x2000d6e0 = 0x8f0000;
-  *(uint64_t*)0x2000d6e8 = 0;
-  *(uint64_t*)0x2000d6f0 = 0;
-  *(uint64_t*)0x2000d6f8 = 0x8f1000;
-  *(uint64_t*)0x2000d700 = 0;
-  *(uint64_t*)0x2000d708 = 0;
-  *(uint64_t*)0x2000d710 = 0x8f2000;
-  *(uint64_t*)0x2000d718 = 0;
-  *(uint64_t*)0x2000d720 = 0;
-  *(uint64_t*)0x2000d728 = 0x8f3000;
-  *(uint64_t*)0x2000d730 = 0;
-  *(uint64_t*)0x2000d738 = 0;
-  *(uint64_t*)0x2000d740 = 0x8f4000;
-  *(uint64_t*)0x2000d748 = 0;
-  *(uint64_t*)0x2000d750 = 0;
-  *(uint64_t*)0x2000d758 = 0x8f5000;
-  *(uint64_t*)0x2000d760 = 0;
-  *(uint64_t*)0x2000d768 = 0;
-  *(uint64_t*)0x2000d770 = 0x8f6000;
-  *(uint64_t*)0x2000d778 = 0;
-  *(uint64_t*)0x2000d780 = 0;
-  *(uint64_t*)0x2000d788 = 0x8f7000;
-  *(uint64_t*)0x2000d790 = 0;
-  *(uint64_t*)0x2000d798 = 0;
-  *(uint64_t*)0x2000d7a0 = 0x8f8000;
-  *(uint64_t*)0x2000d7a8 = 0;
-  *(uint64_t*)0x2000d7b0 = 0;
-  *(uint64_t*)0x2000d7b8 = 0x8f9000;
-  *(uint64_t*)0x2000d7c0 = 0;
-  *(uint64_t*)0x2000d7c8 = 0;
-  *(uint64_t*)0x2000d7d0 = 0x8fa000;
-  *(uint64_t*)0x2000d7d8 = 0;
-  *(uint64_t*)0x2000d7e0 = 0;
-  *(uint64_t*)0x2000d7e8 = 0x8fb000;
-  *(uint64_t*)0x2000d7f0 = 0;
-  *(uint64_t*)0x2000d7f8 = 0;
-  *(uint64_t*)0x2000d800 = 0x8fc000;
-  *(uint64_t*)0x2000d808 = 0;
-  *(uint64_t*)0x2000d810 = 0;
-  *(uint64_t*)0x2000d818 = 0x8fd000;
-  *(uint64_t*)0x2000d820 = 0;
-  *(uint64_t*)0x2000d828 = 0;
-  *(uint64_t*)0x2000d830 = 0x8fe000;
-  *(uint64_t*)0x2000d838 = 0;
-  *(uint64_t*)0x2000d840 = 0;
-  *(uint64_t*)0x2000d848 = 0x8ff000;
-  *(uint64_t*)0x2000d850 = 0;
-  *(uint64_t*)0x2000d858 = 0;
-  *(uint64_t*)0x2000d860 = 0x900000;
-  *(uint64_t*)0x2000d868 = 0;
-  *(uint64_t*)0x2000d870 = 0;
-  *(uint64_t*)0x2000d878 = 0x901000;
-  *(uint64_t*)0x2000d880 = 0;
-  *(uint64_t*)0x2000d888 = 0;
-  *(uint64_t*)0x2000d890 = 0x902000;
-  *(uint64_t*)0x2000d898 = 0;
-  *(uint64_t*)0x2000d8a0 = 0;
-  *(uint64_t*)0x2000d8a8 = 0x903000;
-  *(uint64_t*)0x2000d8b0 = 0;
-  *(uint64_t*)0x2000d8b8 = 0;
-  *(uint64_t*)0x2000d8c0 = 0x904000;
-  *(uint64_t*)0x2000d8c8 = 0;
-  *(uint64_t*)0x2000d8d0 = 0;
-  *(uint64_t*)0x2000d8d8 = 0x905000;
-  *(uint64_t*)0x2000d8e0 = 0;
-  *(uint64_t*)0x2000d8e8 = 0;
-  *(uint64_t*)0x2000d8f0 = 0x906000;
-  *(uint64_t*)0x2000d8f8 = 0;
-  *(uint64_t*)0x2000d900 = 0;
-  *(uint64_t*)0x2000d908 = 0x907000;
-  *(uint64_t*)0x2000d910 = 0;
-  *(uint64_t*)0x2000d918 = 0;
-  *(uint64_t*)0x2000d920 = 0x908000;
-  *(uint64_t*)0x2000d928 = 0;
-  *(uint64_t*)0x2000d930 = 0;
-  *(uint64_t*)0x2000d938 = 0x909000;
-  *(uint64_t*)0x2000d940 = 0;
-  *(uint64_t*)0x2000d948 = 0;
-  *(uint64_t*)0x2000d950 = 0x90a000;
-  *(uint64_t*)0x2000d958 = 0;
-  *(uint64_t*)0x2000d960 = 0;
-  *(uint64_t*)0x2000d968 = 0x90b000;
-  *(uint64_t*)0x2000d970 = 0;
-  *(uint64_t*)0x2000d978 = 0;
-  *(uint64_t*)0x2000d980 = 0x90c000;
-  *(uint64_t*)0x2000d988 = 0;
-  *(uint64_t*)0x2000d990 = 0;
-  *(uint64_t*)0x2000d998 = 0x90d000;
-  *(uint64_t*)0x2000d9a0 = 0;
-  *(uint64_t*)0x2000d9a8 = 0;
-  *(uint64_t*)0x2000d9b0 = 0x90e000;
-  *(uint64_t*)0x2000d9b8 = 0;
-  *(uint64_t*)0x2000d9c0 = 0;
-  *(uint64_t*)0x2000d9c8 = 0x90f000;
-  *(uint64_t*)0x2000d9d0 = 0;
-  *(uint64_t*)0x2000d9d8 = 0;
-  *(uint64_t*)0x2000d9e0 = 0x910000;
-  *(uint64_t*)0x2000d9e8 = 0;
-  *(uint64_t*)0x2000d9f0 = 0;
-  *(uint64_t*)0x2000d9f8 = 0x911000;
-  *(uint64_t*)0x2000da00 = 0;
-  *(uint64_t*)0x2000da08 = 0;
-  *(uint64_t*)0x2000da10 = 0x912000;
-  *(uint64_t*)0x2000da18 = 0;
-  *(uint64_t*)0x2000da20 = 0;
-  *(uint64_t*)0x2000da28 = 0x913000;
-  *(uint64_t*)0x2000da30 = 0;
-  *(uint64_t*)0x2000da38 = 0;
-  *(uint64_t*)0x2000da40 = 0x914000;
-  *(uint64_t*)0x2000da48 = 0;
-  *(uint64_t*)0x2000da50 = 0;
-  *(uint64_t*)0x2000da58 = 0x915000;
-  *(uint64_t*)0x2000da60 = 0;
-  *(uint64_t*)0x2000da68 = 0;
-  *(uint64_t*)0x2000da70 = 0x916000;
-  *(uint64_t*)0x2000da78 = 0;
-  *(uint64_t*)0x2000da80 = 0;
-  *(uint64_t*)0x2000da88 = 0x917000;
-  *(uint64_t*)0x2000da90 = 0;
-  *(uint64_t*)0x2000da98 = 0;
-  *(uint64_t*)0x2000daa0 = 0x918000;
-  *(uint64_t*)0x2000daa8 = 0;
-  *(uint64_t*)0x2000dab0 = 0;
-  *(uint64_t*)0x2000dab8 = 0x919000;
-  *(uint64_t*)0x2000dac0 = 0;
-  *(uint64_t*)0x2000dac8 = 0;
-  *(uint64_t*)0x2000dad0 = 0x91a000;
-  *(uint64_t*)0x2000dad8 = 0;
-  *(uint64_t*)0x2000dae0 = 0;
-  *(uint64_t*)0x2000dae8 = 0x91b000;
-  *(uint64_t*)0x2000daf0 = 0;
-  *(uint64_t*)0x2000daf8 = 0;
-  *(uint64_t*)0x2000db00 = 0x91c000;
-  *(uint64_t*)0x2000db08 = 0;
-  *(uint64_t*)0x2000db10 = 0;
-  *(uint64_t*)0x2000db18 = 0x91d000;
-  *(uint64_t*)0x2000db20 = 0;
-  *(uint64_t*)0x2000db28 = 0;
-  *(uint64_t*)0x2000db30 = 0x91e000;
-  *(uint64_t*)0x2000db38 = 0;
-  *(uint64_t*)0x2000db40 = 0;
-  *(uint64_t*)0x2000db48 = 0x91f000;
-  *(uint64_t*)0x2000db50 = 0;
-  *(uint64_t*)0x2000db58 = 0;
-  *(uint64_t*)0x2000db60 = 0x920000;
-  *(uint64_t*)0x2000db68 = 0;
-  *(uint64_t*)0x2000db70 = 0;
-  *(uint64_t*)0x2000db78 = 0x921000;
-  *(uint64_t*)0x2000db80 = 0;
-  *(uint64_t*)0x2000db88 = 0;
-  *(uint64_t*)0x2000db90 = 0x922000;
-  *(uint64_t*)0x2000db98 = 0;
-  *(uint64_t*)0x2000dba0 = 0;
-  *(uint64_t*)0x2000dba8 = 0x923000;
-  *(uint64_t*)0x2000dbb0 = 0;
-  *(uint64_t*)0x2000dbb8 = 0;
-  *(uint64_t*)0x2000dbc0 = 0x9230e0;
-  *(uint64_t*)0x2000dbc8 = 0;
-  *(uint64_t*)0x2000dbd0 = 0;
-  *(uint64_t*)0x2000dbd8 = 0x924000;
-  *(uint64_t*)0x2000dbe0 = 0;
-  *(uint64_t*)0x2000dbe8 = 0;
-  *(uint64_t*)0x2000dbf0 = 0x9240e0;
-  *(uint64_t*)0x2000dbf8 = 0;
-  *(uint64_t*)0x2000dc00 = 0;
-  *(uint64_t*)0x2000dc08 = 0x925000;
-  *(uint64_t*)0x2000dc10 = 0;
-  *(uint64_t*)0x2000dc18 = 0;
-  *(uint64_t*)0x2000dc20 = 0x9250e0;
-  *(uint64_t*)0x2000dc28 = 0;
-  *(uint64_t*)0x2000dc30 = 0;
-  *(uint64_t*)0x2000dc38 = 0x925140;
-  *(uint64_t*)0x2000dc40 = 0;
-  *(uint64_t*)0x2000dc48 = 0;
-  *(uint64_t*)0x2000dc50 = 0x926000;
-  *(uint64_t*)0x2000dc58 = 0;
-  *(uint64_t*)0x2000dc60 = 0;
-  *(uint64_t*)0x2000dc68 = 0;
-  *(uint64_t*)0x2000dc70 = 0;
-  *(uint64_t*)0x2000dc78 = 0;
-  *(uint64_t*)0x2000dc80 = 0x927000;
   *(uint8_t*)0x200a6800 = 0;
-  syz_mount_image(0x20000000, 0x20000100, 0, 0x91b, 0x20000200, 0, 0x200a6800);
+  syz_mount_image_blob(0x20000000, 0x20000100, 0x927000, image,
+                       image_end - image, 0, 0x200a6800);
   return 0;
 }
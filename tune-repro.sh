@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# tune-repro.sh searches the thread pool settings (see test/lib/threads.c) for
+# the ones that make a racy reproducer crash most reliably and fastest. Every
+# combination of TUNE_THREADS x TUNE_PASSES x TUNE_WAITS x TUNE_CPUS is
+# benchmarked with bench-repro.sh; the best one is printed last as a SYZ_ENV
+# value ready for run-qemu.sh, bench-repro.sh or `env` in the guest.
+
+if [ $# -ne 4 ]; then
+	echo "Usage: $0 <BZIMAGE> <RUNS> <TIMEOUT_SECONDS> <TEST.exe>" >&2
+	exit 1
+fi
+
+BZIMAGE=$1
+RUNS=$2
+TIMEOUT=$3
+TEST=`basename $4`
+
+TUNE_THREADS=${TUNE_THREADS:-"2 4 8 16"}
+TUNE_PASSES=${TUNE_PASSES:-"1 2 4"}
+TUNE_WAITS=${TUNE_WAITS:-"10 45"}
+# "-" leaves the threads unpinned; "0,1" needs a guest with at least 2 vCPUs.
+TUNE_CPUS=${TUNE_CPUS:-"- 0,1"}
+
+best=""
+best_prob=-1
+best_median=""
+
+for threads in $TUNE_THREADS; do
+for passes in $TUNE_PASSES; do
+for wait in $TUNE_WAITS; do
+for cpus in $TUNE_CPUS; do
+	env="SYZ_THREADS=$threads SYZ_COLLIDE_PASSES=$passes SYZ_CALL_WAIT_MS=$wait"
+	if [ "$cpus" != "-" ]; then
+		env="$env SYZ_CPUS=$cpus"
+	fi
+	out=bench/tune/$TEST/t$threads.p$passes.w$wait.c${cpus//,/_}
+	read name runs crashes prob median p95 <<< `SYZ_ENV="$env" OUT_DIR=$out \
+		./bench-repro.sh $BZIMAGE $RUNS $TIMEOUT $TEST |tail -1`
+	echo "$env: prob $prob median $median p95 $p95"
+	# Highest crash probability wins; ties go to the lower median.
+	if awk -v p=$prob -v bp=$best_prob -v m=$median -v bm=$best_median \
+		'BEGIN { exit !(p > bp || (p == bp && m != "-" && (bm == "-" || m < bm))) }'; then
+		best=$env
+		best_prob=$prob
+		best_median=$median
+	fi
+done
+done
+done
+done
+
+echo "best: SYZ_ENV=\"$best\" (prob $best_prob, median $best_median s)"
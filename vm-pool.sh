@@ -0,0 +1,97 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# vm-pool.sh runs reproducers from /root/test on N guests at once. Guest i
+# lives in pool/vm<i>: a throwaway qcow2 overlay of stretch.img, its own ssh
+# port (POOL_PORT + i), pidfile, QMP socket and console log. Reproducers are
+# queued in pool/queue and each guest pulls the next one as soon as it is
+# free. A guest that crashes is recreated from a fresh overlay.
+#
+# Prints "<test> vm<i> ok|timeout|lost|crash <title>" for every reproducer.
+
+if [ $# -lt 3 ]; then
+	echo "Usage: $0 <NUM_VMS> <TIMEOUT_SECONDS> <TEST.exe>..." >&2
+	exit 1
+fi
+
+NUM_VMS=$1
+TIMEOUT=$2
+shift 2
+
+BASE_IMG=$PWD/stretch.img
+POOL_DIR=pool
+POOL_PORT=${POOL_PORT:-10100}
+QUEUE=$POOL_DIR/queue
+
+# Split the host between the guests.
+export SMP=$((`nproc` / NUM_VMS > 0 ? `nproc` / NUM_VMS : 1))
+export MEM=$((`awk '/^MemTotal:/ {print $2}' /proc/meminfo` / 2048 / NUM_VMS))M
+
+mkdir -p $POOL_DIR
+for test in "$@"; do
+	basename $test
+done > $QUEUE
+
+# Pops the next reproducer off the queue; fails when it is empty.
+pop() {
+	(
+		flock 9
+		head -1 $QUEUE |grep . && sed -i 1d $QUEUE
+	) 9> $QUEUE.lock
+}
+
+start_vm() {
+	local dir=$1 port=$2
+	if [ -f $dir/vm.pid ]; then
+		kill `cat $dir/vm.pid` 2>/dev/null
+	fi
+	rm -f $dir/stretch.qcow2 $dir/vm.pid $dir/vm.qmp
+	./create-overlay.sh $BASE_IMG $dir/stretch.qcow2 > /dev/null
+	OVERLAY=$dir/stretch.qcow2 SSH_PORT=$port VM_PID=$dir/vm.pid \
+		VM_LOG=$dir/vm.log VM_QMP=$dir/vm.qmp \
+		./run-qemu.sh > /dev/null 2>&1 &
+	until ssh_vm $port true 2>/dev/null; do
+		sleep 1
+	done
+}
+
+ssh_vm() {
+	local port=$1
+	shift
+	ssh -i stretch.id_rsa -p $port -o StrictHostKeyChecking=no \
+		-o UserKnownHostsFile=/dev/null -o LogLevel=ERROR \
+		-o ConnectTimeout=2 root@localhost "$@"
+}
+
+worker() {
+	local i=$1
+	local dir=$POOL_DIR/vm$i port=$((POOL_PORT + i))
+	local test crashes status
+	mkdir -p $dir
+	start_vm $dir $port
+	while test=`pop`; do
+		crashes=`cat $dir/vm.log.crash 2>/dev/null |wc -l`
+		ssh_vm $port "timeout -s KILL $TIMEOUT /root/test/$test" > /dev/null 2>&1
+		status=$?
+		if [ `cat $dir/vm.log.crash 2>/dev/null |wc -l` -gt $crashes ]; then
+			echo "$test vm$i crash `tail -1 $dir/vm.log.crash |cut -f2-`"
+			cp $dir/vm.log $POOL_DIR/$test.crash.log
+			start_vm $dir $port
+		elif [ $status -eq 137 ]; then
+			echo "$test vm$i timeout"
+		elif [ $status -eq 255 ]; then
+			# ssh itself failed: the guest hung without a report.
+			echo "$test vm$i lost"
+			start_vm $dir $port
+		else
+			echo "$test vm$i ok"
+		fi
+	done
+	kill `cat $dir/vm.pid` 2>/dev/null
+}
+
+for ((i = 0; i < NUM_VMS; i++)); do
+	worker $i &
+done
+wait
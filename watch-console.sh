@@ -0,0 +1,64 @@
+#!/usr/bin/env bash
+# Copyright 2021 Dokyung Song. All rights reserved.
+# Use of this source code is governed by Apache 2 LICENSE that can be found in the LICENSE file.
+
+# watch-console.sh copies the guest console from stdin to LOG (like tee) and
+# stops the VM as soon as a kernel crash report shows up. The report title and
+# its byte offset in LOG are appended to LOG.crash. Exits 2 on a crash.
+
+if [ $# -ne 2 ]; then
+	echo "Usage: $0 <LOG> <PIDFILE>" >&2
+	exit 1
+fi
+
+LOG=$1
+PIDFILE=$2
+CRASH=$LOG.crash
+
+# Seconds to keep reading after the first line of a report so the rest of it
+# (stack trace, register dump) lands in the log before the VM goes away.
+GRACE=${GRACE:-5}
+
+. $(dirname $0)/crash-patterns.sh
+
+export LC_ALL=C
+
+: > $CRASH
+exec 3> $LOG
+offset=0
+crashed=0
+deadline=0
+
+while true; do
+	timeout=""
+	if [ $crashed -eq 1 ]; then
+		left=$((deadline - SECONDS))
+		if [ $left -le 0 ]; then
+			break
+		fi
+		timeout="-t $left"
+	fi
+	if ! IFS= read -r $timeout line; then
+		# EOF, or the grace period ran out.
+		[ $crashed -eq 1 ] || exit 0
+		break
+	fi
+	printf '%s\n' "$line"
+	printf '%s\n' "$line" >&3
+	clean=${line//$'\r'/}
+	if [ $crashed -eq 0 ] && [[ $clean =~ $CRASH_RE ]]; then
+		title=${clean#*\] }
+		printf '%d\t%s\n' $offset "$title" >> $CRASH
+		echo "watch-console: crash at offset $offset: $title" >&2
+		crashed=1
+		deadline=$((SECONDS + GRACE))
+	elif [ $crashed -eq 1 ] && [[ $clean =~ $END_RE ]]; then
+		break
+	fi
+	offset=$((offset + ${#line} + 1))
+done
+
+if [ -f $PIDFILE ]; then
+	kill `cat $PIDFILE` 2>/dev/null
+fi
+exit 2